@@ -0,0 +1,118 @@
+#pragma once
+
+#ifndef _ALGORITHM_
+#include <algorithm>
+#endif
+
+#ifndef _ARRAY_
+#include <array>
+#endif
+
+#ifndef _BIT_
+#include <bit>
+#endif
+
+#ifndef _CONCEPTS_
+#include <concepts>
+#endif
+
+#ifndef _CSTRING_
+#include <cstring>
+#endif
+
+#ifndef _SPAN_
+#include <span>
+#endif
+
+#ifndef _STRING_VIEW_
+#include <string_view>
+#endif
+
+#ifndef _STRING_
+#include <string>
+#endif
+
+#ifndef _VECTOR_
+#include <vector>
+#endif
+
+// Little-endian integers and u32 length-prefixed strings without terminator, shared by the cache files.
+// Wide strings are native wchar_t units, they are only meant to be read back on the same platform.
+
+struct binary_writer_t final
+{
+	std::vector<std::byte> m_Buffer{};
+
+	void Write(std::integral auto val) noexcept
+	{
+		auto const bytes = std::bit_cast<std::array<std::byte, sizeof(val)>>(val);
+		m_Buffer.append_range(bytes);
+	}
+
+	void Write(std::string_view sz) noexcept
+	{
+		Write(static_cast<uint32_t>(sz.length()));
+		m_Buffer.append_range(std::as_bytes(std::span{ sz }));
+	}
+
+	void Write(std::wstring_view sz) noexcept
+	{
+		Write(static_cast<uint32_t>(sz.length()));
+		m_Buffer.append_range(std::as_bytes(std::span{ sz }));
+	}
+};
+
+struct binary_reader_t final
+{
+	std::span<std::byte const> m_Data{};
+	bool m_bBad{};
+
+	template <std::integral T>
+	[[nodiscard]] T Read() noexcept
+	{
+		if (m_bBad || m_Data.size() < sizeof(T)) [[unlikely]]
+		{
+			m_bBad = true;
+			return T{};
+		}
+
+		std::array<std::byte, sizeof(T)> bytes{};
+		std::ranges::copy(m_Data.first<sizeof(T)>(), bytes.begin());
+		m_Data = m_Data.subspan(sizeof(T));
+
+		return std::bit_cast<T>(bytes);
+	}
+
+	[[nodiscard]] std::string_view ReadString() noexcept
+	{
+		auto const iLength = Read<uint32_t>();
+
+		if (m_bBad || m_Data.size() < iLength) [[unlikely]]
+		{
+			m_bBad = true;
+			return {};
+		}
+
+		std::string_view const ret{ reinterpret_cast<char const*>(m_Data.data()), iLength };
+		m_Data = m_Data.subspan(iLength);
+
+		return ret;
+	}
+
+	[[nodiscard]] std::wstring ReadWString() noexcept
+	{
+		auto const iLength = Read<uint32_t>();
+
+		if (m_bBad || m_Data.size() / sizeof(wchar_t) < iLength) [[unlikely]]
+		{
+			m_bBad = true;
+			return {};
+		}
+
+		std::wstring ret(iLength, L'\0');	// The data may not be aligned for wchar_t.
+		std::memcpy(ret.data(), m_Data.data(), iLength * sizeof(wchar_t));
+		m_Data = m_Data.subspan(iLength * sizeof(wchar_t));
+
+		return ret;
+	}
+};
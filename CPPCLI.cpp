@@ -21,8 +21,8 @@
 #include <fmt/ranges.h>
 
 #include "CPPCLI.hpp"
+#include "RimWorldClasses.hpp"
 #include "Style.hpp"
-extern classinfo_dict_t const gRimWorldClasses;
 
 
 //using namespace CSharpSupporter;
@@ -54,7 +54,7 @@ public:
 	static String^ EnginePath = nullptr;
 	static String^ WorkshopPath = nullptr;
 
-	static void PathResolution(const char* mod)
+	static void PathResolution(const wchar_t* mod)
 	{
 		ModPath = gcnew String(mod);
 
@@ -348,9 +348,9 @@ static Assembly^ LoadUnityEngine(String^ eng_dir)
 	return nullptr;
 }
 
-void GetModClasses(const char* path_to_mod, classinfo_dict_t* pret)
+void ReflectModClasses(std::filesystem::path const& path_to_mod, classinfo_dict_t* pret)
 {
-	cliglb::PathResolution(path_to_mod);
+	cliglb::PathResolution(path_to_mod.c_str());
 	auto asm_dir = Path::GetFullPath(Path::Combine(cliglb::ModPath, L"Assemblies/"));
 
 	if (!Directory::Exists(asm_dir))
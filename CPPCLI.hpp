@@ -3,10 +3,22 @@
 // Because of the use of C++/CLI, Modules from C++20 cannot be used.
 
 
+#ifndef _ALGORITHM_
+#include <algorithm>
+#endif
+
 #ifndef _COMPARE_
 #include <compare>
 #endif
 
+#ifndef _CSTDINT_
+#include <cstdint>
+#endif
+
+#ifndef _FILESYSTEM_
+#include <filesystem>
+#endif
+
 #ifndef _FUNCTIONAL_
 #include <functional>
 #endif
@@ -91,4 +103,105 @@ struct class_info_t final
 
 using classinfo_dict_t = std::map<std::string, class_info_t, sv_less_t>;	// #UPDATE_AT_CPP23 std::flat_map
 
-extern void GetModClasses(const char* path_to_mod, classinfo_dict_t* pret);
+extern void GetModClasses(std::filesystem::path const& path_to_mod, classinfo_dict_t* pret) noexcept;	// Metadata.cpp, reads the assemblies directly.
+extern void ReflectModClasses(std::filesystem::path const& path_to_mod, classinfo_dict_t* pret);	// CPPCLI.cpp, loads the assemblies into CLR.
+
+// Flat, non-owning layout of class_info_t.
+// The vanilla one is generated as constexpr table by CSharpExecutable, the mod one is frozen from classinfo_dict_t after reflection.
+
+struct field_type_t final
+{
+	std::string_view m_Field{};
+	std::string_view m_Type{};
+};
+
+struct class_schema_t final
+{
+	std::string_view m_FullName{};	// Key of the dictionary.
+	std::string_view m_Namespace{};
+	std::string_view m_Name{};
+	std::string_view m_Base{};
+	std::string_view m_FolderName{};	// Folder under DefInjected. For vanilla classes, the namespace part is dropped.
+	std::span<std::string_view const> m_MustTranslates{};	// Sorted
+	std::span<std::string_view const> m_ArraysMustTranslate{};	// Sorted
+	std::span<field_type_t const> m_ObjectArrays{};	// Sorted by m_Field
+	std::span<field_type_t const> m_Objects{};	// Sorted by m_Field
+
+	[[nodiscard]]
+	constexpr bool IsMustTranslate(std::string_view szField) const noexcept
+	{
+		return std::ranges::binary_search(m_MustTranslates, szField);
+	}
+
+	[[nodiscard]]
+	constexpr bool IsArrayMustTranslate(std::string_view szField) const noexcept
+	{
+		return std::ranges::binary_search(m_ArraysMustTranslate, szField);
+	}
+
+	[[nodiscard]]
+	constexpr std::string_view ObjectArrayType(std::string_view szField) const noexcept	// Empty if it is not an array of objects.
+	{
+		return FindFieldType(m_ObjectArrays, szField);
+	}
+
+	[[nodiscard]]
+	constexpr std::string_view ObjectType(std::string_view szField) const noexcept	// Empty if it is not an object.
+	{
+		return FindFieldType(m_Objects, szField);
+	}
+
+	[[nodiscard]]
+	static constexpr std::string_view FindFieldType(std::span<field_type_t const> Fields, std::string_view szField) noexcept
+	{
+		auto const it = std::ranges::lower_bound(Fields, szField, {}, &field_type_t::m_Field);
+
+		return it != Fields.end() && it->m_Field == szField ? it->m_Type : std::string_view{};
+	}
+};
+
+// FNV-1a with seed. CSharpExecutable must use the identical function when it is searching for seeds.
+[[nodiscard]]
+constexpr std::uint32_t SchemaHash(std::string_view sz, std::uint32_t iSeed) noexcept
+{
+	std::uint32_t ret = 0x811C9DC5u ^ iSeed;
+
+	for (auto&& c : sz)
+	{
+		ret ^= static_cast<std::uint8_t>(c);
+		ret *= 0x01000193u;
+	}
+
+	return ret;
+}
+
+struct static_classinfo_dict_t final
+{
+	std::span<class_schema_t const> m_Classes{};	// Sorted by m_FullName
+	std::span<std::uint16_t const> m_Seeds{};	// Bucket -> seed of the second hash.
+	std::span<std::uint16_t const> m_Slots{};	// Slot -> index of m_Classes, UINT16_MAX for vacancy.
+	std::span<std::string_view const> m_Namespaces{};	// Sorted and unique.
+
+	[[nodiscard]]
+	constexpr class_schema_t const* find(std::string_view szFullName) const noexcept
+	{
+		// Hash and displace: the seed picked by the first hash leads to a slot occupied by no one but this key.
+		auto const iSeed = m_Seeds[SchemaHash(szFullName, 0) % m_Seeds.size()];
+		auto const idx = m_Slots[SchemaHash(szFullName, iSeed) % m_Slots.size()];
+
+		if (idx >= m_Classes.size() || m_Classes[idx].m_FullName != szFullName)
+			return nullptr;
+
+		return &m_Classes[idx];
+	}
+
+	[[nodiscard]]
+	constexpr bool contains(std::string_view szFullName) const noexcept
+	{
+		return find(szFullName) != nullptr;
+	}
+
+	[[nodiscard]] constexpr auto begin() const noexcept { return m_Classes.begin(); }
+	[[nodiscard]] constexpr auto end() const noexcept { return m_Classes.end(); }
+	[[nodiscard]] constexpr auto size() const noexcept { return m_Classes.size(); }
+};
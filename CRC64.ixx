@@ -3,8 +3,23 @@ module;
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
+#include <array>
 #include <bit>
+#include <string_view>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define CRC64_HAS_CLMUL
+#ifdef _MSC_VER
+#include <intrin.h>
+#define CRC64_TARGET_CLMUL
+#else
+#include <cpuid.h>
+#include <immintrin.h>
+#define CRC64_TARGET_CLMUL __attribute__((target("pclmul,sse2")))
+#endif
+#endif
 
 export module CRC64;
 
@@ -142,34 +157,233 @@ inline constexpr uint64_t crc64_tab[256] =
 	UINT64_C(0x536fa08fdfd90e51), UINT64_C(0x29b7d047efec8728),
 };
 
+// Reflected polynomial, the one crc64_tab was generated with.
+inline constexpr uint64_t CRC64_POLY = crc64_tab[0x80];
+
+// crc64_slices[k][b]: CRC of byte b followed by k zero bytes.
+inline constexpr auto crc64_slices = []() consteval noexcept
+{
+	std::array<std::array<uint64_t, 256>, 16> ret{};
+
+	for (size_t i = 0; i < 256; ++i)
+		ret[0][i] = crc64_tab[i];
+
+	for (size_t k = 1; k < ret.size(); ++k)
+		for (size_t i = 0; i < 256; ++i)
+			ret[k][i] = (ret[k - 1][i] >> 8) ^ crc64_tab[ret[k - 1][i] & 0xFF];
+
+	return ret;
+}();
+
+[[nodiscard]]
+static inline uint64_t Load64(std::byte const* p) noexcept
+{
+	uint64_t ret{};
+	memcpy(&ret, p, sizeof(ret));	// Little-endian only.
+	return ret;
+}
+
+[[nodiscard]]
+static uint64_t CheckStreamBytewise(std::byte const* p, size_t l, uint64_t crc) noexcept
+{
+	for (size_t j = 0; j < l; ++j)
+	{
+		crc = crc64_tab[(uint8_t)crc ^ bit_cast<uint8_t>(p[j])] ^ (crc >> 8);
+	}
+
+	return crc;
+}
+
+[[nodiscard]]
+static uint64_t CheckStreamSlicing8(std::byte const* p, size_t l, uint64_t crc) noexcept
+{
+	auto& T = crc64_slices;
+
+	for (; l >= 8; p += 8, l -= 8)
+	{
+		auto const v = crc ^ Load64(p);
+
+		crc = T[7][v & 0xFF] ^ T[6][(v >> 8) & 0xFF] ^ T[5][(v >> 16) & 0xFF] ^ T[4][(v >> 24) & 0xFF]
+			^ T[3][(v >> 32) & 0xFF] ^ T[2][(v >> 40) & 0xFF] ^ T[1][(v >> 48) & 0xFF] ^ T[0][v >> 56];
+	}
+
+	return CheckStreamBytewise(p, l, crc);
+}
+
+[[nodiscard]]
+static uint64_t CheckStreamSlicing16(std::byte const* p, size_t l, uint64_t crc) noexcept
+{
+	auto& T = crc64_slices;
+
+	for (; l >= 16; p += 16, l -= 16)
+	{
+		auto const v1 = crc ^ Load64(p);
+		auto const v2 = Load64(p + 8);
+
+		crc = T[15][v1 & 0xFF] ^ T[14][(v1 >> 8) & 0xFF] ^ T[13][(v1 >> 16) & 0xFF] ^ T[12][(v1 >> 24) & 0xFF]
+			^ T[11][(v1 >> 32) & 0xFF] ^ T[10][(v1 >> 40) & 0xFF] ^ T[9][(v1 >> 48) & 0xFF] ^ T[8][v1 >> 56]
+			^ T[7][v2 & 0xFF] ^ T[6][(v2 >> 8) & 0xFF] ^ T[5][(v2 >> 16) & 0xFF] ^ T[4][(v2 >> 24) & 0xFF]
+			^ T[3][(v2 >> 32) & 0xFF] ^ T[2][(v2 >> 40) & 0xFF] ^ T[1][(v2 >> 48) & 0xFF] ^ T[0][v2 >> 56];
+	}
+
+	return CheckStreamSlicing8(p, l, crc);
+}
+
+#ifdef CRC64_HAS_CLMUL
+// x^n mod P, bit-reflected as the CRC register is: bit i stands for x^(63-i).
+[[nodiscard]]
+static consteval uint64_t XPowMod(size_t n) noexcept
+{
+	uint64_t ret = uint64_t{ 1 } << 63;
+
+	for (size_t i = 0; i < n; ++i)
+		ret = (ret >> 1) ^ ((ret & 1) ? CRC64_POLY : 0);
+
+	return ret;
+}
+
+// A carry-less product of two reflected qwords lands one degree short in the 128-bit register, hence n-1 for shifting by x^n.
+// Low qword of the register holds the higher degree half, which travels 64 degrees further.
+inline constexpr uint64_t K_127 = XPowMod(128 - 1), K_191 = XPowMod(128 + 64 - 1);
+inline constexpr uint64_t K_1023 = XPowMod(1024 - 1), K_1087 = XPowMod(1024 + 64 - 1);
+
+[[nodiscard]]
+static CRC64_TARGET_CLMUL inline __m128i Fold(__m128i x, __m128i k, __m128i data) noexcept
+{
+	return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11)), data);
+}
+
+// Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction, Intel, 2009.
+// Instead of Barrett reduction, the last 128 bits are handed to the table. They are congruent to the whole message modulo P.
+[[nodiscard]]
+static CRC64_TARGET_CLMUL uint64_t CheckStreamClmul(std::byte const* p, size_t l, uint64_t crc) noexcept
+{
+	if (l < 256)
+		return CheckStreamSlicing16(p, l, crc);
+
+	__m128i x[8]{};
+	for (size_t i = 0; i < 8; ++i)
+		x[i] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i * 16));
+
+	x[0] = _mm_xor_si128(x[0], _mm_cvtsi64_si128(static_cast<long long>(crc)));
+	p += 128;
+	l -= 128;
+
+	auto const k1024 = _mm_set_epi64x(static_cast<long long>(K_1023), static_cast<long long>(K_1087));
+	for (; l >= 128; p += 128, l -= 128)
+	{
+		for (size_t i = 0; i < 8; ++i)
+			x[i] = Fold(x[i], k1024, _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i * 16)));
+	}
+
+	auto const k128 = _mm_set_epi64x(static_cast<long long>(K_127), static_cast<long long>(K_191));
+	auto acc = x[0];
+	for (size_t i = 1; i < 8; ++i)
+		acc = Fold(acc, k128, x[i]);
+
+	for (; l >= 16; p += 16, l -= 16)
+		acc = Fold(acc, k128, _mm_loadu_si128(reinterpret_cast<__m128i const*>(p)));
+
+	alignas(16) std::byte Remainder[16]{};
+	_mm_store_si128(reinterpret_cast<__m128i*>(Remainder), acc);
+
+	return CheckStreamSlicing16(p, l, CheckStreamSlicing16(Remainder, sizeof(Remainder), 0));
+}
+
+[[nodiscard]]
+static bool CpuHasClmul() noexcept
+{
+#ifdef _MSC_VER
+	int Registers[4]{};
+	__cpuid(Registers, 1);
+	return (Registers[2] & (1 << 1)) != 0;
+#else
+	unsigned eax{}, ebx{}, ecx{}, edx{};
+	return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_PCLMUL) != 0;
+#endif
+}
+#endif
+
 export namespace CRC64
 {
-	uint64_t CheckStream(std::byte const* p, size_t l) noexcept
+	enum struct EKernel : uint8_t
 	{
-		uint64_t crc{};
+		Bytewise,
+		Slicing8,
+		Slicing16,
+		Clmul,
+	};
+
+	inline constexpr EKernel ALL_KERNELS[] = { EKernel::Bytewise, EKernel::Slicing8, EKernel::Slicing16, EKernel::Clmul, };
 
-		for (size_t j = 0; j < l; ++j)
+	[[nodiscard]]
+	constexpr std::string_view KernelName(EKernel k) noexcept
+	{
+		switch (k)
 		{
-			crc = crc64_tab[(uint8_t)crc ^ bit_cast<uint8_t>(p[j])] ^ (crc >> 8);
+		case EKernel::Bytewise:
+			return "Bytewise";
+		case EKernel::Slicing8:
+			return "Slicing-by-8";
+		case EKernel::Slicing16:
+			return "Slicing-by-16";
+		case EKernel::Clmul:
+			return "PCLMULQDQ";
+		default:
+			return "Unknown";
 		}
+	}
 
-		return crc;
+	[[nodiscard]]
+	bool IsSupported(EKernel k) noexcept
+	{
+#ifdef CRC64_HAS_CLMUL
+		static bool const bHasClmul = CpuHasClmul();
+#else
+		static constexpr bool bHasClmul = false;
+#endif
+
+		return k != EKernel::Clmul || bHasClmul;
 	}
 
-	uint64_t CheckFile(FILE* f) noexcept
+	// All kernels yield identical result. The crc of the previous chunk continues the stream.
+	[[nodiscard]]
+	uint64_t CheckStream(EKernel k, std::byte const* p, size_t l, uint64_t crc = 0) noexcept
+	{
+		switch (k)
+		{
+		case EKernel::Slicing8:
+			return CheckStreamSlicing8(p, l, crc);
+		case EKernel::Slicing16:
+			return CheckStreamSlicing16(p, l, crc);
+#ifdef CRC64_HAS_CLMUL
+		case EKernel::Clmul:
+			return CheckStreamClmul(p, l, crc);
+#endif
+		default:
+			return CheckStreamBytewise(p, l, crc);
+		}
+	}
+
+	[[nodiscard]]
+	uint64_t CheckStream(std::byte const* p, size_t l, uint64_t crc = 0) noexcept
 	{
-		fseek(f, 0, SEEK_END);
+		static auto const kBest = IsSupported(EKernel::Clmul) ? EKernel::Clmul : EKernel::Slicing16;
 
-		auto const iFileSize = ftell(f);
-		auto p = (std::byte*)malloc(iFileSize);
+		// Most of the entries are short texts, not worthy of the folding setup.
+		return CheckStream(l < 256 ? EKernel::Slicing16 : kBest, p, l, crc);
+	}
 
-		fseek(f, 0, SEEK_SET);
-		fread(p, 1, iFileSize, f);
+	// Streams from the current position through a fixed buffer. 0 if it could not be read to the end.
+	uint64_t CheckFile(FILE* f) noexcept
+	{
+		alignas(64) static thread_local std::byte Buffer[64 * 1024];
+		uint64_t crc{};
 
-		auto const crc = CheckStream(p, iFileSize);
+		for (size_t iRead{}; (iRead = fread(Buffer, 1, sizeof(Buffer), f)) > 0;)
+			crc = CheckStream(Buffer, iRead, crc);
 
-		free(p);
-		return crc;
+		return ferror(f) ? 0 : crc;
 	}
 
 	inline uint64_t CheckFile(const char* pszPath) noexcept
@@ -178,6 +392,7 @@ export namespace CRC64
 
 		if (auto f = fopen(pszPath, "rb"); f)
 		{
+			setvbuf(f, nullptr, _IONBF, 0);	// We have our own buffer.
 			crc = CheckFile(f);
 			fclose(f);
 		}
@@ -191,6 +406,7 @@ export namespace CRC64
 
 		if (auto f = _wfopen(pszPath, L"rb"); f)
 		{
+			setvbuf(f, nullptr, _IONBF, 0);	// We have our own buffer.
 			crc = CheckFile(f);
 			fclose(f);
 		}
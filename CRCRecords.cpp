@@ -0,0 +1,414 @@
+#include "Precompiled.hpp"
+#include "CRCRecords.hpp"
+#include "FileWriter.hpp"
+#include "Log.hpp"
+
+import CRC64;
+import Style;
+
+using namespace tinyxml2;
+
+namespace fs = std::filesystem;
+namespace ch = std::chrono;
+
+using std::optional;
+using std::pair;
+using std::span;
+using std::string;
+using std::string_view;
+using std::vector;
+
+using namespace CRCRecords;
+
+static_assert(std::endian::native == std::endian::little, "The binary records are mapped as-is.");
+
+template <typename T>
+[[nodiscard]] static span<T const> RowsAt(span<std::byte const> Data, uint64_t iOffset, uint32_t iCount) noexcept
+{
+	return { reinterpret_cast<T const*>(Data.data() + iOffset), iCount };
+}
+
+uint64_t CRCRecords::RollUp(uint64_t iPrev, string_view Identifier, uint64_t iCRC) noexcept
+{
+	// Length-prefixed so that no two different sequences of pairs could feed the same bytes.
+	auto const iLength = static_cast<uint32_t>(Identifier.size());
+
+	iPrev = CRC64::CheckStream(reinterpret_cast<std::byte const*>(&iLength), sizeof(iLength), iPrev);
+	iPrev = CRC64::CheckStream(reinterpret_cast<std::byte const*>(Identifier.data()), Identifier.size(), iPrev);
+	return CRC64::CheckStream(reinterpret_cast<std::byte const*>(&iCRC), sizeof(iCRC), iPrev);
+}
+
+vector<std::byte> table_t::Serialize() && noexcept
+{
+	string Strings{};
+	vector<file_row_t> Files{};
+	vector<record_row_t> Records{};
+	vector<filler_row_t> Fillers{};
+
+	auto const fnIntern = [&Strings](string_view sz) noexcept
+	{
+		auto const iOffset = static_cast<uint32_t>(Strings.size());
+		Strings.append(sz);
+		return std::pair{ iOffset, static_cast<uint32_t>(sz.size()) };
+	};
+
+	Files.reserve(m_Records.size());
+	for (auto&& [szFile, File] : m_Records)	// std::map already sorted them in byte order.
+	{
+		auto const iFile = static_cast<uint32_t>(Files.size());
+		auto const [iFileOffset, iFileLength] = fnIntern(szFile);
+		uint64_t iRollUp = 0;
+
+		std::ranges::stable_sort(File.m_Entries, std::less<>{}, [](auto& Entry) noexcept { return string_view{ Entry.first }; });
+
+		for (auto&& [szIdentifier, iCRC] : File.m_Entries)
+		{
+			auto const [iOffset, iLength] = fnIntern(szIdentifier);
+			Records.push_back({ .m_iFile = iFile, .m_iOffset = iOffset, .m_iLength = iLength, .m_iReserved = 0, .m_iCRC = iCRC, });
+
+			iRollUp = RollUp(iRollUp, szIdentifier, iCRC);
+		}
+
+		Files.push_back({ .m_iOffset = iFileOffset, .m_iLength = iFileLength, .m_iRollUp = iRollUp, .m_iTargetCRC = File.m_iTargetCRC, });
+	}
+
+	if (m_StringFillers)
+	{
+		std::ranges::stable_sort(*m_StringFillers, std::less<>{}, [](auto& Entry) noexcept { return string_view{ Entry.first }; });
+
+		for (auto&& [szFile, iCRC] : *m_StringFillers)
+		{
+			auto const [iOffset, iLength] = fnIntern(szFile);
+			Fillers.push_back({ .m_iOffset = iOffset, .m_iLength = iLength, .m_iCRC = iCRC, });
+		}
+	}
+
+	header_t Header{
+		.m_Magic{},
+		.m_iFormatVersion = FORMAT_VERSION,
+		.m_iAppVersion = m_iAppVersion,
+		.m_iBuild = m_iBuild,
+		.m_iFlags = m_StringFillers ? HAS_STRING_FILLERS : 0u,
+		.m_iTimestamp = m_iTimestamp,
+		.m_iFileCount = static_cast<uint32_t>(Files.size()),
+		.m_iRecordCount = static_cast<uint32_t>(Records.size()),
+		.m_iFillerCount = static_cast<uint32_t>(Fillers.size()),
+		.m_iReserved = 0,
+		.m_iStringsSize = Strings.size(),
+	};
+	std::ranges::copy(MAGIC, Header.m_Magic);
+
+	vector<std::byte> ret{};
+	ret.reserve(sizeof(Header) + std::as_bytes(span{ Files }).size() + std::as_bytes(span{ Records }).size() + std::as_bytes(span{ Fillers }).size() + Strings.size());
+
+	ret.append_range(std::as_bytes(span{ &Header, 1 }));
+	ret.append_range(std::as_bytes(span{ Files }));
+	ret.append_range(std::as_bytes(span{ Records }));
+	ret.append_range(std::as_bytes(span{ Fillers }));
+	ret.append_range(std::as_bytes(span{ Strings }));
+
+	return ret;
+}
+
+view_t::view_t(mapped_file_t&& File) noexcept
+	: m_File{ std::move(File) }, m_Data{ m_File.Data() }
+{
+	Bind();
+}
+
+view_t::view_t(vector<std::byte>&& Buffer) noexcept
+	: m_Buffer{ std::move(Buffer) }, m_Data{ m_Buffer }
+{
+	Bind();
+}
+
+void view_t::Bind() noexcept
+{
+	if (m_Data.size() < sizeof(header_t) || reinterpret_cast<uintptr_t>(m_Data.data()) % alignof(header_t) != 0) [[unlikely]]
+		return;
+
+	auto const pHeader = reinterpret_cast<header_t const*>(m_Data.data());
+	if (std::memcmp(pHeader->m_Magic, MAGIC, sizeof(MAGIC)) != 0 || pHeader->m_iFormatVersion != FORMAT_VERSION)
+		return;
+
+	// The counts are 32-bit, no way to overflow here. The string table size must be checked before adding up.
+	uint64_t const iFiles = sizeof(header_t);
+	uint64_t const iRecords = iFiles + uint64_t{ pHeader->m_iFileCount } * sizeof(file_row_t);
+	uint64_t const iFillers = iRecords + uint64_t{ pHeader->m_iRecordCount } * sizeof(record_row_t);
+	uint64_t const iStrings = iFillers + uint64_t{ pHeader->m_iFillerCount } * sizeof(filler_row_t);
+
+	if (iStrings > m_Data.size() || pHeader->m_iStringsSize != m_Data.size() - iStrings) [[unlikely]]
+		return;
+
+	m_Files = RowsAt<file_row_t>(m_Data, iFiles, pHeader->m_iFileCount);
+	m_Records = RowsAt<record_row_t>(m_Data, iRecords, pHeader->m_iRecordCount);
+	m_Fillers = RowsAt<filler_row_t>(m_Data, iFillers, pHeader->m_iFillerCount);
+	m_Strings = string_view{ reinterpret_cast<char const*>(m_Data.data() + iStrings), static_cast<size_t>(pHeader->m_iStringsSize) };
+
+	// Validate once here so that no accessor has to.
+	auto const fnInBound = [iSize = pHeader->m_iStringsSize](auto const& row) noexcept { return uint64_t{ row.m_iOffset } + row.m_iLength <= iSize; };
+
+	if (!std::ranges::all_of(m_Files, fnInBound)
+		|| !std::ranges::all_of(m_Fillers, fnInBound)
+		|| !std::ranges::all_of(m_Records, [&](record_row_t const& row) noexcept { return fnInBound(row) && row.m_iFile < m_Files.size(); }))
+	{
+		m_Files = {};
+		m_Records = {};
+		m_Fillers = {};
+		m_Strings = {};
+		return;
+	}
+
+	m_pHeader = pHeader;
+}
+
+pair<size_t, size_t> view_t::RowsOf(size_t iFile) const noexcept
+{
+	auto const Rows = std::ranges::equal_range(m_Records, static_cast<uint32_t>(iFile), std::less<>{}, &record_row_t::m_iFile);
+
+	return { static_cast<size_t>(Rows.begin() - m_Records.begin()), static_cast<size_t>(Rows.end() - m_Records.begin()) };
+}
+
+view_t::file_t view_t::File(size_t i) const noexcept
+{
+	auto const& row = m_Files[i];
+
+	return {
+		.m_File = String(row.m_iOffset, row.m_iLength),
+		.m_RollUp = row.m_iRollUp,
+		.m_TargetCRC = row.m_iTargetCRC,
+	};
+}
+
+view_t::record_t view_t::Record(size_t i) const noexcept
+{
+	auto const& row = m_Records[i];
+	auto const& file = m_Files[row.m_iFile];
+
+	return {
+		.m_File = String(file.m_iOffset, file.m_iLength),
+		.m_Identifier = String(row.m_iOffset, row.m_iLength),
+		.m_CRC = row.m_iCRC,
+	};
+}
+
+view_t::filler_t view_t::Filler(size_t i) const noexcept
+{
+	auto const& row = m_Fillers[i];
+
+	return {
+		.m_File = String(row.m_iOffset, row.m_iLength),
+		.m_CRC = row.m_iCRC,
+	};
+}
+
+optional<uint64_t> view_t::Find(string_view File, string_view Identifier) const noexcept
+{
+	auto const fnName = [this](auto const& row) noexcept { return String(row.m_iOffset, row.m_iLength); };
+
+	auto const itFile = std::ranges::lower_bound(m_Files, File, std::less<>{}, fnName);
+	if (itFile == m_Files.end() || fnName(*itFile) != File)
+		return std::nullopt;
+
+	auto const [iFirst, iLast] = RowsOf(static_cast<size_t>(itFile - m_Files.begin()));
+	auto const Rows = m_Records.subspan(iFirst, iLast - iFirst);
+	auto const itRecord = std::ranges::lower_bound(Rows, Identifier, std::less<>{}, fnName);
+	if (itRecord == Rows.end() || fnName(*itRecord) != Identifier)
+		return std::nullopt;
+
+	return itRecord->m_iCRC;
+}
+
+optional<uint64_t> view_t::FindFiller(string_view File) const noexcept
+{
+	auto const fnName = [this](auto const& row) noexcept { return String(row.m_iOffset, row.m_iLength); };
+
+	auto const it = std::ranges::lower_bound(m_Fillers, File, std::less<>{}, fnName);
+	if (it == m_Fillers.end() || fnName(*it) != File)
+		return std::nullopt;
+
+	return it->m_iCRC;
+}
+
+[[nodiscard]] static int64_t ParseTimestamp(XMLElement const* Timestamp) noexcept
+{
+	if (!Timestamp)
+		return 0;
+
+	auto const szDate = Timestamp->Attribute("Date");
+	auto const szTime = Timestamp->Attribute("Time");
+	int y{}, m{}, d{}, H{}, M{}, S{};
+
+	if (!szDate || !szTime || sscanf_s(szDate, "%d-%d-%d", &y, &m, &d) != 3 || sscanf_s(szTime, "%d:%d:%d", &H, &M, &S) != 3)
+		return 0;
+
+	ch::sys_seconds const t{ ch::sys_days{ ch::year{ y } / m / d } + ch::hours{ H } + ch::minutes{ M } + ch::seconds{ S } };
+	return t.time_since_epoch().count();
+}
+
+// The pre-binary format. Only kept for migration and for human inspection.
+[[nodiscard]] static optional<table_t> ReadXml(span<std::byte const> Content) noexcept
+{
+	XMLDocument xml;
+	if (auto err = xml.Parse(reinterpret_cast<char const*>(Content.data()), Content.size()); err != XML_SUCCESS) [[unlikely]]
+	{
+		Log::Print(ELogLevel::Error, Style::Error, "XMLDocument::Parse returns: {0} ({1})\n", XMLDocument::ErrorIDToName(err), std::to_underlying(err));
+		return std::nullopt;
+	}
+
+	table_t ret{};
+
+	if (auto const Version = xml.FirstChildElement("Version"); Version)
+	{
+		ret.m_iAppVersion = Version->UnsignedAttribute("Checksum");
+		ret.m_iBuild = Version->IntAttribute("Build");
+	}
+
+	ret.m_iTimestamp = ParseTimestamp(xml.FirstChildElement("Timestamp"));
+
+	if (auto const Records = xml.FirstChildElement("Records"); Records)
+	{
+		for (auto Record = Records->FirstChildElement(); Record; Record = Record->NextSiblingElement())
+		{
+			auto const szFile = Record->Attribute("File");
+			auto const szIdentifier = Record->Attribute("Identifier");
+
+			if (!szFile || !szIdentifier) [[unlikely]]
+				continue;
+
+			ret.m_Records[szFile].m_Entries.emplace_back(szIdentifier, Record->Unsigned64Attribute("CRC"));
+		}
+	}
+	else
+		Log::Print(ELogLevel::Warning, Style::Warning, "Bad record file: missing entry 'Records'.\n");
+
+	// Absent from the legacy files. Without them the first run after migration simply does not skip anything.
+	if (auto const TargetFiles = xml.FirstChildElement("TargetFiles"); TargetFiles)
+	{
+		for (auto TargetFile = TargetFiles->FirstChildElement(); TargetFile; TargetFile = TargetFile->NextSiblingElement())
+		{
+			if (auto const szFile = TargetFile->Attribute("File"); szFile)
+			{
+				if (auto const it = ret.m_Records.find(string_view{ szFile }); it != ret.m_Records.end())
+					it->second.m_iTargetCRC = TargetFile->Unsigned64Attribute("CRC");
+			}
+		}
+	}
+
+	if (auto const StringFillers = xml.FirstChildElement("StringFillers"); StringFillers)
+	{
+		auto& Fillers = ret.m_StringFillers.emplace();
+
+		for (auto StringFiller = StringFillers->FirstChildElement(); StringFiller; StringFiller = StringFiller->NextSiblingElement())
+		{
+			if (auto const szFile = StringFiller->Attribute("File"); szFile) [[likely]]
+				Fillers.emplace_back(szFile, StringFiller->Unsigned64Attribute("CRC"));
+		}
+	}
+
+	return ret;
+}
+
+[[nodiscard]] static bool WriteXml(fs::path const& hFile, view_t const& Records) noexcept
+{
+	auto const& Header = Records.Header();
+	auto const AppVersion = std::bit_cast<std::array<uint8_t, 4>>(Header.m_iAppVersion);	// major, minor, revision, build
+
+	XMLDocument xml;
+	xml.InsertFirstChild(xml.NewDeclaration());
+	xml.SetBOM(true);
+
+	auto const Version = xml.NewElement("Version");
+	xml.InsertEndChild(Version);
+	Version->SetAttribute("Major", AppVersion[0]);
+	Version->SetAttribute("Minor", AppVersion[1]);
+	Version->SetAttribute("Revision", AppVersion[2]);
+	Version->SetAttribute("Build", Header.m_iBuild);
+	Version->SetAttribute("Checksum", Header.m_iAppVersion);
+
+	auto const Timestamp = xml.NewElement("Timestamp");
+	xml.InsertEndChild(Timestamp);
+	auto const t = fmt::gmtime(static_cast<std::time_t>(Header.m_iTimestamp));
+	Timestamp->SetAttribute("GMT", true);
+	Timestamp->SetAttribute("Date", fmt::format("{:%Y-%m-%d}", t).c_str());
+	Timestamp->SetAttribute("Time", fmt::format("{:%H:%M:%S}", t).c_str());
+
+	auto const RecordsNode = xml.NewElement("Records");
+	xml.InsertEndChild(RecordsNode);
+
+	for (auto&& [szFile, szIdentifier, iCRC] : Records.Records())
+	{
+		auto const Record = RecordsNode->InsertNewChildElement("Record");
+
+		Record->SetAttribute("File", string{ szFile }.c_str());
+		Record->SetAttribute("Identifier", string{ szIdentifier }.c_str());
+		Record->SetAttribute("CRC", iCRC);
+	}
+
+	auto const TargetFiles = xml.NewElement("TargetFiles");
+	xml.InsertEndChild(TargetFiles);
+
+	for (auto&& [szFile, iRollUp, iTargetCRC] : Records.Files())
+	{
+		auto const TargetFile = TargetFiles->InsertNewChildElement("TargetFile");
+
+		TargetFile->SetAttribute("File", string{ szFile }.c_str());
+		TargetFile->SetAttribute("CRC", iTargetCRC);
+	}
+
+	if (Records.HasStringFillers())
+	{
+		auto const StringFillers = xml.NewElement("StringFillers");
+		xml.InsertEndChild(StringFillers);
+
+		for (auto&& [szFile, iCRC] : Records.Fillers())
+		{
+			auto const StringFiller = StringFillers->InsertNewChildElement("StringFiller");
+
+			StringFiller->SetAttribute("File", string{ szFile }.c_str());
+			StringFiller->SetAttribute("CRC", iCRC);
+		}
+	}
+
+	return SaveXmlIfChanged(xml, hFile) != EWriteResult::Failed;
+}
+
+view_t CRCRecords::Open(fs::path const& hFile) noexcept
+{
+	mapped_file_t File{ hFile };
+	if (!File)
+		return {};
+
+	auto const Content = File.Data();
+
+	if (Content.size() >= sizeof(MAGIC) && std::memcmp(Content.data(), MAGIC, sizeof(MAGIC)) == 0)
+	{
+		view_t ret{ std::move(File) };
+
+		if (!ret && Content.size() >= sizeof(header_t) && reinterpret_cast<header_t const*>(Content.data())->m_iFormatVersion != FORMAT_VERSION)
+			Log::Print(ELogLevel::Warning, Style::Warning, "Record file '{}' is of an outdated format.\n", hFile.u8string());
+		else if (!ret) [[unlikely]]
+			Log::Print(ELogLevel::Warning, Style::Warning, "Bad record file: '{}'\n", hFile.u8string());
+
+		return ret;
+	}
+
+	if (auto Table = ReadXml(Content); Table)
+		return view_t{ std::move(*Table).Serialize() };
+
+	return {};
+}
+
+bool CRCRecords::Save(fs::path const& hFile, view_t const& Records) noexcept
+{
+	if (!Records) [[unlikely]]
+		return false;
+
+	std::error_code ec{};
+	fs::create_directories(hFile.parent_path(), ec);
+
+	if (hFile.has_extension() && _wcsicmp(hFile.extension().c_str(), L".xml") == 0)
+		return WriteXml(hFile, Records);
+
+	return WriteFileIfChanged(hFile, Records.Data()) != EWriteResult::Failed;
+}
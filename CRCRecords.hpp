@@ -0,0 +1,177 @@
+#pragma once
+
+#include "MappedFile.hpp"
+
+#ifndef _FILESYSTEM_
+#include <filesystem>
+#endif
+
+#ifndef _MAP_
+#include <map>
+#endif
+
+#ifndef _OPTIONAL_
+#include <optional>
+#endif
+
+#ifndef _RANGES_
+#include <ranges>
+#endif
+
+#ifndef _STRING_
+#include <string>
+#endif
+
+#ifndef _STRING_VIEW_
+#include <string_view>
+#endif
+
+#ifndef _VECTOR_
+#include <vector>
+#endif
+
+// Binary form of the CRC records. Every section is 8-byte aligned, all integers are little-endian.
+//	header_t
+//	file_row_t[m_iFileCount]		sorted by name
+//	record_row_t[m_iRecordCount]	sorted by file, then by identifier
+//	filler_row_t[m_iFillerCount]	sorted by path
+//	char[m_iStringsSize]			string table, neither terminated nor aligned
+// All the names are UTF-8 and relative: to the language folder for records, to the English Strings folder for string fillers.
+// The roll-up of a file folds RollUp() over its (identifier, CRC) pairs in row order, so a file can be compared without touching its records.
+namespace CRCRecords
+{
+	inline constexpr char MAGIC[8] = { 'R', 'W', 'P', 'H', 'G', 'C', 'R', 'C', };
+	inline constexpr uint32_t FORMAT_VERSION = 2;
+
+	enum EFlags : uint32_t
+	{
+		HAS_STRING_FILLERS = 1u << 0,
+	};
+
+	struct header_t final
+	{
+		char m_Magic[8];
+		uint32_t m_iFormatVersion;
+		uint32_t m_iAppVersion;
+		int32_t m_iBuild;
+		uint32_t m_iFlags;
+		int64_t m_iTimestamp;	// seconds since epoch, UTC.
+		uint32_t m_iFileCount;
+		uint32_t m_iRecordCount;
+		uint32_t m_iFillerCount;
+		uint32_t m_iReserved;
+		uint64_t m_iStringsSize;
+	};
+
+	struct file_row_t final
+	{
+		uint32_t m_iOffset;
+		uint32_t m_iLength;
+		uint64_t m_iRollUp;
+		uint64_t m_iTargetCRC;	// CRC64 of the localization file as it was left by the last run, 0 if unknown.
+	};
+
+	struct record_row_t final
+	{
+		uint32_t m_iFile;	// index into file rows.
+		uint32_t m_iOffset;
+		uint32_t m_iLength;
+		uint32_t m_iReserved;
+		uint64_t m_iCRC;
+	};
+
+	struct filler_row_t final
+	{
+		uint32_t m_iOffset;
+		uint32_t m_iLength;
+		uint64_t m_iCRC;
+	};
+
+	static_assert(sizeof(header_t) == 56 && sizeof(file_row_t) == 24 && sizeof(record_row_t) == 24 && sizeof(filler_row_t) == 16);
+
+	[[nodiscard]] uint64_t RollUp(uint64_t iPrev, std::string_view Identifier, uint64_t iCRC) noexcept;
+
+	// Owning form, only for producing the records.
+	struct table_t final
+	{
+		struct file_t final
+		{
+			uint64_t m_iTargetCRC{};
+			std::vector<std::pair<std::string, uint64_t>> m_Entries{};	// [Identifier, CRC]
+		};
+
+		uint32_t m_iAppVersion{};
+		int32_t m_iBuild{};
+		int64_t m_iTimestamp{};
+		std::map<std::string, file_t, std::less<>> m_Records{};	// keyed by file.
+		std::optional<std::vector<std::pair<std::string, uint64_t>>> m_StringFillers{};	// Nullopt if the mod has no string filler at all.
+
+		[[nodiscard]] std::vector<std::byte> Serialize() && noexcept;
+	};
+
+	// Read-only form, either mmapped from disk or built in memory from a legacy XML file.
+	struct view_t final
+	{
+		struct record_t final
+		{
+			std::string_view m_File{};
+			std::string_view m_Identifier{};
+			uint64_t m_CRC{};
+		};
+
+		struct filler_t final
+		{
+			std::string_view m_File{};
+			uint64_t m_CRC{};
+		};
+
+		struct file_t final
+		{
+			std::string_view m_File{};
+			uint64_t m_RollUp{};
+			uint64_t m_TargetCRC{};
+		};
+
+		view_t() noexcept = default;
+		explicit view_t(mapped_file_t&& File) noexcept;
+		explicit view_t(std::vector<std::byte>&& Buffer) noexcept;
+
+		[[nodiscard]] explicit operator bool() const noexcept { return m_pHeader != nullptr; }
+		[[nodiscard]] std::span<std::byte const> Data() const noexcept { return m_Data; }
+		[[nodiscard]] header_t const& Header() const noexcept { return *m_pHeader; }
+		[[nodiscard]] bool HasStringFillers() const noexcept { return m_pHeader->m_iFlags & HAS_STRING_FILLERS; }
+
+		[[nodiscard]] file_t File(std::size_t i) const noexcept;
+		[[nodiscard]] record_t Record(std::size_t i) const noexcept;
+		[[nodiscard]] filler_t Filler(std::size_t i) const noexcept;
+		[[nodiscard]] auto Files() const noexcept { return std::views::iota(std::size_t{}, m_Files.size()) | std::views::transform([this](std::size_t i) noexcept { return File(i); }); }
+		[[nodiscard]] auto Records() const noexcept { return std::views::iota(std::size_t{}, m_Records.size()) | std::views::transform([this](std::size_t i) noexcept { return Record(i); }); }
+		[[nodiscard]] auto RecordsOf(std::size_t iFile) const noexcept { auto const [iFirst, iLast] = RowsOf(iFile); return std::views::iota(iFirst, iLast) | std::views::transform([this](std::size_t i) noexcept { return Record(i); }); }
+		[[nodiscard]] auto Fillers() const noexcept { return std::views::iota(std::size_t{}, m_Fillers.size()) | std::views::transform([this](std::size_t i) noexcept { return Filler(i); }); }
+
+		// Binary search on the rows, no allocation.
+		[[nodiscard]] std::optional<uint64_t> Find(std::string_view File, std::string_view Identifier) const noexcept;
+		[[nodiscard]] std::optional<uint64_t> FindFiller(std::string_view File) const noexcept;
+
+	private:
+		void Bind() noexcept;
+		[[nodiscard]] std::pair<std::size_t, std::size_t> RowsOf(std::size_t iFile) const noexcept;
+		[[nodiscard]] std::string_view String(uint32_t iOffset, uint32_t iLength) const noexcept { return m_Strings.substr(iOffset, iLength); }
+
+		mapped_file_t m_File{};
+		std::vector<std::byte> m_Buffer{};
+		std::span<std::byte const> m_Data{};
+
+		header_t const* m_pHeader{};
+		std::span<file_row_t const> m_Files{};
+		std::span<record_row_t const> m_Records{};
+		std::span<filler_row_t const> m_Fillers{};
+		std::string_view m_Strings{};
+	};
+
+	// Accepts both the binary form and the legacy XML form, tell apart by the magic.
+	[[nodiscard]] view_t Open(std::filesystem::path const& hFile) noexcept;
+
+	// Writes XML if the extension is .xml, binary otherwise.
+	[[nodiscard]] bool Save(std::filesystem::path const& hFile, view_t const& Records) noexcept;
+}
@@ -1,5 +1,6 @@
 ﻿using Microsoft.VisualBasic.FileIO;
 using System.Reflection;
+using System.Text;
 using CSharpSupporter;
 using System.Linq;
 
@@ -7,65 +8,202 @@ namespace CSharpExecutable
 {
 	static class Program
 	{
-		// Fuck C#, why the alignment has to be constant??
-
-		const int LongestFullName = -63;
-		const int LongestNamespace = -15;
-		const int LongestName = -54;
-		const int LongestBase = -57;
-
-		public static void WriteArray(this StreamWriter file, List<string> arr)
+		// Must be identical to SchemaHash() in CPPCLI.hpp
+		public static uint SchemaHash(string s, uint seed)
 		{
-			if (arr.Count > 0)
+			unchecked
 			{
-				var Text = string.Join("\", \"", arr);
-				file.Write($"{{ \"{Text}\" }}, ");
-			}
-			else
-			{
-				file.Write("{}, ");
+				uint ret = 0x811C9DC5u ^ seed;
+
+				foreach (var c in Encoding.UTF8.GetBytes(s))
+				{
+					ret ^= c;
+					ret *= 0x01000193u;
+				}
+
+				return ret;
 			}
 		}
 
-		public static void WritePairs(this StreamWriter file, List<(string, string)> arr)
+		// All strings are packed into one blob, and referred as S(offset, length).
+		class StringBlob
 		{
-			if (arr.Count > 0)
+			public readonly List<string> Pieces = [];
+			readonly Dictionary<string, int> Offsets = [];
+			int Length = 0;
+
+			public string Ref(string s)
 			{
-				var Text = string.Join(", ", arr.Select(p => $"{{ \"{p.Item1}\", \"{p.Item2}\" }}"));
-				file.Write($"{{ {Text} }}, ");
+				if (!Offsets.TryGetValue(s, out var offset))
+				{
+					offset = Length;
+					Offsets[s] = offset;
+					Pieces.Add(s);
+					Length += Encoding.UTF8.GetByteCount(s);
+				}
+
+				return $"S({offset}, {Encoding.UTF8.GetByteCount(s)})";
 			}
-			else
+		}
+
+		static string SpanOf(string array, int offset, int count)
+		{
+			return count > 0 ? $"{{ {array} + {offset}, {count} }}" : "{}";
+		}
+
+		// Hash and displace: keys are grouped into buckets by the first hash,
+		// then each bucket finds a seed that sends all its keys to vacant slots.
+		static (ushort[] Seeds, ushort[] Slots) BuildPerfectHash(List<string> keys)
+		{
+			var SlotCount = (int)System.Numerics.BitOperations.RoundUpToPowerOf2((uint)Math.Max(keys.Count, 1));
+			var BucketCount = Math.Max(keys.Count / 4, 1);
+
+			var Seeds = new ushort[BucketCount];
+			var Slots = Enumerable.Repeat(ushort.MaxValue, SlotCount).ToArray();
+
+			var Buckets = Enumerable.Range(0, keys.Count)
+				.GroupBy(i => SchemaHash(keys[i], 0) % (uint)BucketCount)
+				.OrderByDescending(g => g.Count());
+
+			foreach (var Bucket in Buckets)
 			{
-				file.Write("{}, ");
+				for (uint seed = 1; ; ++seed)
+				{
+					if (seed > ushort.MaxValue)
+						throw new InvalidOperationException("No perfect hash seed found.");
+
+					var Candidates = Bucket.Select(i => (int)(SchemaHash(keys[i], seed) % (uint)SlotCount)).ToList();
+
+					if (Candidates.Distinct().Count() != Candidates.Count || Candidates.Any(slot => Slots[slot] != ushort.MaxValue))
+						continue;
+
+					foreach (var (i, slot) in Bucket.Zip(Candidates))
+						Slots[slot] = (ushort)i;
+
+					Seeds[Bucket.Key] = (ushort)seed;
+					break;
+				}
 			}
+
+			return (Seeds, Slots);
 		}
 
-		public static void Main(string[] args)
+		public static void WriteSchema(this StreamWriter hpp, SortedDictionary<string, ClassInfo> VanillaClassInfo, string Version)
 		{
-			var VanillaClassInfo = RimWolrdVanilla.GetClasses();
-			//var LongestFullName_dyn = VanillaClassInfo.Keys.Max(s => s.Length) + 2;
-			//var LongestNamespace_dyn = VanillaClassInfo.Values.Max(info => info.Namespace.Length) + 2;
-			//var LongestName_dyn = VanillaClassInfo.Values.Max(info => info.Name.Length) + 2;
-			//var LongestBase_dyn = VanillaClassInfo.Values.Max(info => info.Base.Length) + 2;
+			// Both binary search and perfect hash on C++ side are byte-wise.
+			var Classes = VanillaClassInfo.OrderBy(kv => kv.Key, StringComparer.Ordinal).ToList();
+			var Keys = Classes.Select(kv => kv.Key).ToList();
+			var Blob = new StringBlob();
 
-			//Console.WriteLine($"{LongestFullName_dyn}, {LongestNamespace_dyn}, {LongestName_dyn}, {LongestBase_dyn}");
+			var Fields = new List<string>();
+			var FieldTypes = new List<string>();
+			var FieldsOffsets = new Dictionary<string, int>();	// Identical lists share one span, such as all these label-description pairs.
+			var FieldTypesOffsets = new Dictionary<string, int>();
+			var ClassLines = new List<string>();
 
-			using var hpp = new StreamWriter("../../../../RimWorldClasses.hpp");
+			foreach (var (Name, Info) in Classes)
+			{
+				var FullName = Info.Namespace.Length > 0 ? $"{Info.Namespace}.{Info.Name}" : Info.Name;
+				var FolderName = VanillaClassInfo.ContainsKey(FullName) ? Info.Name : FullName;
+
+				var Line = new StringBuilder();
+				Line.Append($"\t\t{{ {Blob.Ref(Name)}, {Blob.Ref(Info.Namespace)}, {Blob.Ref(Info.Name)}, {Blob.Ref(Info.Base)}, {Blob.Ref(FolderName)}, ");
+
+				foreach (var Set in new[] { Info.MustTranslates, Info.ArraysMustTranslate })
+				{
+					var Sorted = Set.Distinct().Order(StringComparer.Ordinal).Select(Blob.Ref).ToList();
+					var Joined = string.Join(", ", Sorted);
+
+					if (!FieldsOffsets.TryGetValue(Joined, out var Offset))
+					{
+						FieldsOffsets[Joined] = Offset = Fields.Count;
+						Fields.AddRange(Sorted);
+					}
+
+					Line.Append($"{SpanOf("FIELDS", Offset, Sorted.Count)}, ");
+				}
+
+				foreach (var Pairs in new[] { Info.ObjectArrays, Info.Objects })
+				{
+					var Sorted = Pairs.DistinctBy(p => p.Item1).OrderBy(p => p.Item1, StringComparer.Ordinal).Select(p => $"{{ {Blob.Ref(p.Item1)}, {Blob.Ref(p.Item2)} }}").ToList();
+					var Joined = string.Join(", ", Sorted);
+
+					if (!FieldTypesOffsets.TryGetValue(Joined, out var Offset))
+					{
+						FieldTypesOffsets[Joined] = Offset = FieldTypes.Count;
+						FieldTypes.AddRange(Sorted);
+					}
+
+					Line.Append($"{SpanOf("FIELD_TYPES", Offset, Sorted.Count)}, ");
+				}
 
-			hpp.WriteLine($"inline constexpr char RIMWORLD_ASSEMBLY_VERSION[] = \"{RimWolrdVanilla.LastReadVersion}\";");
+				Line.Append($"}},\t// {Name}");
+				ClassLines.Add(Line.ToString());
+			}
+
+			var Namespaces = Classes.Select(kv => kv.Value.Namespace).Distinct().Order(StringComparer.Ordinal).Select(Blob.Ref).ToList();
+			var (Seeds, Slots) = BuildPerfectHash(Keys);
+
+			hpp.WriteLine("#pragma once");
+			hpp.WriteLine();
+			hpp.WriteLine("// Generated by CSharpExecutable. Do not edit.");
 			hpp.WriteLine();
-			hpp.WriteLine("inline classinfo_dict_t const gRimWorldClasses");
+			hpp.WriteLine($"inline constexpr char RIMWORLD_ASSEMBLY_VERSION[] = \"{Version}\";");
+			hpp.WriteLine();
+			hpp.WriteLine("namespace RimWorldSchema");
 			hpp.WriteLine("{");
+			hpp.WriteLine("\tinline constexpr char BLOB[] =");
+			foreach (var Piece in Blob.Pieces)
+				hpp.WriteLine($"\t\t\"{Piece}\"");
+			hpp.WriteLine("\t\t;");
+			hpp.WriteLine();
+			hpp.WriteLine("\t[[nodiscard]]");
+			hpp.WriteLine("\tconstexpr std::string_view S(std::size_t pos, std::size_t len) noexcept { return { BLOB + pos, len }; }");
+			hpp.WriteLine();
+			hpp.WriteLine("\tinline constexpr std::string_view FIELDS[] =");
+			hpp.WriteLine("\t{");
+			foreach (var Chunk in Fields.Chunk(8))
+				hpp.WriteLine($"\t\t{string.Join(", ", Chunk)},");
+			hpp.WriteLine("\t};");
+			hpp.WriteLine();
+			hpp.WriteLine("\tinline constexpr field_type_t FIELD_TYPES[] =");
+			hpp.WriteLine("\t{");
+			foreach (var Chunk in FieldTypes.Chunk(4))
+				hpp.WriteLine($"\t\t{string.Join(", ", Chunk)},");
+			hpp.WriteLine("\t};");
+			hpp.WriteLine();
+			hpp.WriteLine("\tinline constexpr class_schema_t CLASSES[] =");
+			hpp.WriteLine("\t{");
+			foreach (var Line in ClassLines)
+				hpp.WriteLine(Line);
+			hpp.WriteLine("\t};");
+			hpp.WriteLine();
+			hpp.WriteLine($"\tinline constexpr std::string_view NAMESPACES[] = {{ {string.Join(", ", Namespaces)}, }};");
+			hpp.WriteLine();
+			hpp.WriteLine("\tinline constexpr std::uint16_t SEEDS[] =");
+			hpp.WriteLine("\t{");
+			foreach (var Chunk in Seeds.Chunk(16))
+				hpp.WriteLine($"\t\t{string.Join(", ", Chunk)},");
+			hpp.WriteLine("\t};");
+			hpp.WriteLine();
+			hpp.WriteLine("\tinline constexpr std::uint16_t SLOTS[] =");
+			hpp.WriteLine("\t{");
+			foreach (var Chunk in Slots.Chunk(16))
+				hpp.WriteLine($"\t\t{string.Join(", ", Chunk)},");
+			hpp.WriteLine("\t};");
+			hpp.WriteLine("}");
+			hpp.WriteLine();
+			hpp.WriteLine("inline constexpr static_classinfo_dict_t gRimWorldClasses{ RimWorldSchema::CLASSES, RimWorldSchema::SEEDS, RimWorldSchema::SLOTS, RimWorldSchema::NAMESPACES, };");
+			hpp.WriteLine();
+			hpp.WriteLine("static_assert(std::ranges::all_of(gRimWorldClasses, [](class_schema_t const& info) { return gRimWorldClasses.find(info.m_FullName) == &info; }));");
+		}
 
-			foreach (var (Name, Info) in VanillaClassInfo)
-			{
-				hpp.Write($"\t{{ {$"\"{Name}\"",LongestFullName}, {{ {$"\"{Info.Namespace}\"",LongestNamespace}, {$"\"{Info.Name}\"",LongestName}, {$"\"{Info.Base}\"",LongestBase}, ");
-				hpp.WriteArray(Info.MustTranslates);
-				hpp.WriteArray(Info.ArraysMustTranslate);
-				hpp.WritePairs(Info.ObjectArrays);
-				hpp.WritePairs(Info.Objects);
-				hpp.WriteLine("}, },");
-			}
+		public static void Main(string[] args)
+		{
+			var VanillaClassInfo = RimWolrdVanilla.GetClasses();
+
+			using var hpp = new StreamWriter("../../../../RimWorldClasses.hpp");
+			hpp.WriteSchema(VanillaClassInfo, RimWolrdVanilla.LastReadVersion);
 
 			foreach (var (Name, Info) in VanillaClassInfo)
 			{
@@ -78,9 +216,6 @@ namespace CSharpExecutable
 				}
 			}
 
-			hpp.WriteLine("};");
-			hpp.WriteLine();
-
 			Console.WriteLine("File 'RimWorldClasses.hpp' had been outputed.");
 			Console.WriteLine($"{VanillaClassInfo.Count} classes were exported.");
 		}
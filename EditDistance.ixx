@@ -0,0 +1,258 @@
+module;
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define EDIT_DISTANCE_HAS_AVX2
+#ifdef _MSC_VER
+#include <intrin.h>
+#define EDIT_DISTANCE_TARGET_AVX2
+#else
+#include <cpuid.h>
+#include <immintrin.h>
+#define EDIT_DISTANCE_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+export module EditDistance;
+
+// Levenshtein distance, ASCII case-insensitive, on bytes.
+// Patterns up to 64 bytes go through the bit-parallel algorithm of Myers (1999), in the formulation of Hyyro (2001): one machine word per column.
+// The AVX2 kernel runs four texts against the same pattern at once, one per 64-bit lane. Longer patterns fall back to the textbook DP.
+
+inline constexpr size_t MYERS_MAX_PATTERN = 64;
+
+[[nodiscard]]
+static constexpr uint8_t FoldCase(char c) noexcept
+{
+	return (c >= 'A' && c <= 'Z') ? static_cast<uint8_t>(c + 0x20) : static_cast<uint8_t>(c);
+}
+
+struct pattern_masks_t final
+{
+	explicit pattern_masks_t(std::string_view Pattern) noexcept
+	{
+		for (size_t i = 0; i < Pattern.size(); ++i)
+			m_Peq[FoldCase(Pattern[i])] |= uint64_t{ 1 } << i;
+	}
+
+	std::array<uint64_t, 256> m_Peq{};	// Bit i of m_Peq[c] is set if the i-th byte of the pattern is c.
+};
+
+[[nodiscard]]
+static uint32_t DistanceDP(std::string_view Pattern, std::string_view Text) noexcept
+{
+	std::vector<uint32_t> Row(Pattern.size() + 1);
+	for (uint32_t i = 0; i < Row.size(); ++i)
+		Row[i] = i;
+
+	for (size_t j = 0; j < Text.size(); ++j)
+	{
+		auto iDiagonal = Row[0];
+		Row[0] = static_cast<uint32_t>(j + 1);
+
+		for (size_t i = 1; i <= Pattern.size(); ++i)
+		{
+			auto const iSubstitution = iDiagonal + (FoldCase(Pattern[i - 1]) != FoldCase(Text[j]));
+			iDiagonal = Row[i];
+			Row[i] = std::min({ Row[i] + 1, Row[i - 1] + 1, iSubstitution });
+		}
+	}
+
+	return Row.back();
+}
+
+[[nodiscard]]
+static uint32_t DistanceMyers(pattern_masks_t const& Masks, size_t iPatternLength, std::string_view Text) noexcept
+{
+	uint64_t Pv = ~uint64_t{}, Mv = 0;
+	uint64_t const HighBit = uint64_t{ 1 } << (iPatternLength - 1);
+	auto iScore = static_cast<uint32_t>(iPatternLength);
+
+	for (auto&& c : Text)
+	{
+		auto const Eq = Masks.m_Peq[FoldCase(c)];
+		auto const Xv = Eq | Mv;
+		auto const Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+		auto Ph = Mv | ~(Xh | Pv);
+		auto Mh = Pv & Xh;
+
+		iScore += (Ph & HighBit) != 0;
+		iScore -= (Mh & HighBit) != 0;
+
+		// Row 0 is the distance to an empty pattern, which goes up by one every column, hence the 1 shifted in.
+		Ph = (Ph << 1) | 1;
+		Mh <<= 1;
+
+		Pv = Mh | ~(Xv | Ph);
+		Mv = Ph & Xv;
+	}
+
+	return iScore;
+}
+
+#ifdef EDIT_DISTANCE_HAS_AVX2
+EDIT_DISTANCE_TARGET_AVX2
+static void DistanceMyersAvx2(pattern_masks_t const& Masks, size_t iPatternLength, std::span<std::string_view const, 4> Texts, uint32_t* pret) noexcept
+{
+	auto const Ones = _mm256_set1_epi64x(-1);
+	auto const One = _mm256_set1_epi64x(1);
+	auto const HighShift = _mm_cvtsi32_si128(static_cast<int>(iPatternLength - 1));
+	auto const Lengths = _mm256_setr_epi64x((int64_t)Texts[0].size(), (int64_t)Texts[1].size(), (int64_t)Texts[2].size(), (int64_t)Texts[3].size());
+	auto const iLongest = std::ranges::max(Texts, {}, &std::string_view::size).size();
+
+	auto Pv = Ones, Mv = _mm256_setzero_si256();
+	auto Score = _mm256_set1_epi64x(static_cast<int64_t>(iPatternLength));
+
+	auto const fnPeq = [&](std::string_view Text, size_t j) noexcept { return j < Text.size() ? static_cast<int64_t>(Masks.m_Peq[FoldCase(Text[j])]) : 0; };
+
+	for (size_t j = 0; j < iLongest; ++j)
+	{
+		auto const Eq = _mm256_setr_epi64x(fnPeq(Texts[0], j), fnPeq(Texts[1], j), fnPeq(Texts[2], j), fnPeq(Texts[3], j));
+		auto const Xv = _mm256_or_si256(Eq, Mv);
+		auto const Xh = _mm256_or_si256(_mm256_xor_si256(_mm256_add_epi64(_mm256_and_si256(Eq, Pv), Pv), Pv), Eq);
+		auto Ph = _mm256_or_si256(Mv, _mm256_xor_si256(_mm256_or_si256(Xh, Pv), Ones));
+		auto Mh = _mm256_and_si256(Pv, Xh);
+
+		// Lanes past the end of their text keep the score they had.
+		auto const Active = _mm256_cmpgt_epi64(Lengths, _mm256_set1_epi64x(static_cast<int64_t>(j)));
+		auto const Delta = _mm256_sub_epi64(_mm256_and_si256(_mm256_srl_epi64(Ph, HighShift), One), _mm256_and_si256(_mm256_srl_epi64(Mh, HighShift), One));
+		Score = _mm256_add_epi64(Score, _mm256_and_si256(Delta, Active));
+
+		Ph = _mm256_or_si256(_mm256_slli_epi64(Ph, 1), One);
+		Mh = _mm256_slli_epi64(Mh, 1);
+
+		Pv = _mm256_or_si256(Mh, _mm256_xor_si256(_mm256_or_si256(Xv, Ph), Ones));
+		Mv = _mm256_and_si256(Ph, Xv);
+	}
+
+	alignas(32) int64_t Scores[4];
+	_mm256_store_si256(reinterpret_cast<__m256i*>(Scores), Score);
+
+	for (size_t i = 0; i < 4; ++i)
+		pret[i] = static_cast<uint32_t>(Scores[i]);
+}
+
+[[nodiscard]]
+static bool CpuHasAvx2() noexcept
+{
+	// The OS must save the YMM registers as well, not just the CPU having them.
+#ifdef _MSC_VER
+	int Registers[4]{};
+	__cpuid(Registers, 1);
+	if ((Registers[2] & (1 << 27)) == 0 || (_xgetbv(0) & 6) != 6)
+		return false;
+
+	__cpuidex(Registers, 7, 0);
+	return (Registers[1] & (1 << 5)) != 0;
+#else
+	unsigned eax{}, ebx{}, ecx{}, edx{};
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & bit_OSXSAVE) == 0)
+		return false;
+
+	unsigned iXcr0Low{}, iXcr0High{};
+	__asm__("xgetbv" : "=a"(iXcr0Low), "=d"(iXcr0High) : "c"(0));
+	if ((iXcr0Low & 6) != 6)
+		return false;
+
+	return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & bit_AVX2) != 0;
+#endif
+}
+#endif
+
+export namespace EditDistance
+{
+	enum struct EKernel : uint8_t
+	{
+		DP,
+		Myers,
+		MyersAvx2,
+	};
+
+	inline constexpr EKernel ALL_KERNELS[] = { EKernel::DP, EKernel::Myers, EKernel::MyersAvx2, };
+
+	[[nodiscard]]
+	constexpr std::string_view KernelName(EKernel k) noexcept
+	{
+		switch (k)
+		{
+		case EKernel::DP:
+			return "DP";
+		case EKernel::Myers:
+			return "Myers";
+		case EKernel::MyersAvx2:
+			return "Myers-AVX2";
+		default:
+			return "Unknown";
+		}
+	}
+
+	[[nodiscard]]
+	bool IsSupported(EKernel k) noexcept
+	{
+#ifdef EDIT_DISTANCE_HAS_AVX2
+		static bool const bHasAvx2 = CpuHasAvx2();
+#else
+		static constexpr bool bHasAvx2 = false;
+#endif
+
+		return k != EKernel::MyersAvx2 || bHasAvx2;
+	}
+
+	// Distance between Pattern and every one of Texts, into pret. All kernels yield identical result, Myers ones fall back to DP for patterns too long.
+	void Batch(EKernel k, std::string_view Pattern, std::span<std::string_view const> Texts, uint32_t* pret) noexcept
+	{
+		if (Pattern.empty())
+		{
+			for (size_t i = 0; i < Texts.size(); ++i)
+				pret[i] = static_cast<uint32_t>(Texts[i].size());
+
+			return;
+		}
+
+		if (k == EKernel::DP || Pattern.size() > MYERS_MAX_PATTERN)
+		{
+			for (size_t i = 0; i < Texts.size(); ++i)
+				pret[i] = DistanceDP(Pattern, Texts[i]);
+
+			return;
+		}
+
+		pattern_masks_t const Masks{ Pattern };
+		size_t i = 0;
+
+#ifdef EDIT_DISTANCE_HAS_AVX2
+		if (k == EKernel::MyersAvx2)
+		{
+			for (; i + 4 <= Texts.size(); i += 4)
+				DistanceMyersAvx2(Masks, Pattern.size(), Texts.subspan(i).first<4>(), pret + i);
+		}
+#endif
+
+		for (; i < Texts.size(); ++i)
+			pret[i] = DistanceMyers(Masks, Pattern.size(), Texts[i]);
+	}
+
+	void Batch(std::string_view Pattern, std::span<std::string_view const> Texts, uint32_t* pret) noexcept
+	{
+		static auto const kBest = IsSupported(EKernel::MyersAvx2) ? EKernel::MyersAvx2 : EKernel::Myers;
+
+		return Batch(kBest, Pattern, Texts, pret);
+	}
+
+	[[nodiscard]]
+	uint32_t Distance(std::string_view Pattern, std::string_view Text) noexcept
+	{
+		uint32_t ret{};
+		Batch(EKernel::Myers, Pattern, { &Text, 1 }, &ret);
+
+		return ret;
+	}
+}
@@ -0,0 +1,81 @@
+#include "Precompiled.hpp"
+#include "FileWriter.hpp"
+#include "Mod.hpp"
+#include "Log.hpp"
+
+import CRC64;
+import Style;
+
+using namespace tinyxml2;
+
+namespace fs = std::filesystem;
+
+using std::span;
+using std::string;
+using std::string_view;
+
+EWriteResult WriteFileIfChanged(fs::path const& hPath, span<std::byte const> Content) noexcept
+{
+	std::error_code ec{};
+
+	// The size rules most of the changes out before any hashing. The hash of the file on disk is memoized, likely already known.
+	if (auto const iSize = fs::file_size(hPath, ec);
+		!ec && iSize == Content.size() && CheckFileCRC(hPath) == CRC64::CheckStream(Content.data(), Content.size()))
+	{
+		return EWriteResult::Unchanged;
+	}
+
+	auto hTemp = hPath;
+	hTemp += L".RWPHG_TMP";
+
+	bool bSucceeded = false;
+
+	if (auto const f = _wfopen(hTemp.c_str(), L"wb"); f != nullptr)
+	{
+		bSucceeded = fwrite(Content.data(), 1, Content.size(), f) == Content.size();
+		bSucceeded = fflush(f) == 0 && bSucceeded;
+		bSucceeded = fclose(f) == 0 && bSucceeded;
+	}
+
+	if (bSucceeded)
+	{
+		fs::rename(hTemp, hPath, ec);	// Replaces the existing one.
+		bSucceeded = !ec;
+	}
+
+	if (!bSucceeded)
+	{
+		fs::remove(hTemp, ec);
+		Log::Print(ELogLevel::Error, Style::Error, "[::WriteFileIfChanged] Unable to save file \"{}\"\n", hPath.u8string());
+
+		return EWriteResult::Failed;
+	}
+
+	return EWriteResult::Written;
+}
+
+EWriteResult SaveXmlIfChanged(XMLDocument const& xml, fs::path const& hPath) noexcept
+{
+	XMLPrinter printer{};
+	xml.Print(&printer);
+
+	string_view const szPrinted{ printer.CStr(), static_cast<size_t>(printer.CStrSize() - 1) };	// CStrSize() counts the terminator.
+
+#ifdef _WIN32
+	// XMLDocument::SaveFile() writes in text mode, keep the line endings it has been producing.
+	string szContent{};
+	szContent.reserve(szPrinted.size() + szPrinted.size() / 16);
+
+	for (auto&& c : szPrinted)
+	{
+		if (c == '\n')
+			szContent += '\r';
+
+		szContent += c;
+	}
+#else
+	auto const& szContent = szPrinted;
+#endif
+
+	return WriteFileIfChanged(hPath, std::as_bytes(span{ szContent }));
+}
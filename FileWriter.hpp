@@ -0,0 +1,32 @@
+#pragma once
+
+#ifndef _CSTDDEF_
+#include <cstddef>
+#endif
+
+#ifndef _FILESYSTEM_
+#include <filesystem>
+#endif
+
+#ifndef _SPAN_
+#include <span>
+#endif
+
+namespace tinyxml2
+{
+	class XMLDocument;
+}
+
+enum struct EWriteResult
+{
+	Failed,
+	Unchanged,
+	Written,
+};
+
+// Leaves the file untouched if it already holds these bytes, otherwise writes a sibling temp file and renames it over.
+// A crash in the middle never leaves a truncated file behind, and untouched files keep their timestamps.
+EWriteResult WriteFileIfChanged(std::filesystem::path const& hPath, std::span<std::byte const> Content) noexcept;
+
+// Same output as XMLDocument::SaveFile(), through WriteFileIfChanged().
+EWriteResult SaveXmlIfChanged(tinyxml2::XMLDocument const& xml, std::filesystem::path const& hPath) noexcept;
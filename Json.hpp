@@ -0,0 +1,40 @@
+#pragma once
+
+#if !defined(FMT_FORMAT_H_)
+#include <fmt/format.h>
+#endif
+
+#ifndef _STRING_
+#include <string>
+#endif
+
+#ifndef _STRING_VIEW_
+#include <string_view>
+#endif
+
+// Shared by the trace and the -serve protocol. Input is taken as UTF-8 already, only what JSON forbids is escaped.
+inline void AppendJsonString(std::string* pOut, std::string_view sz) noexcept
+{
+	pOut->push_back('"');
+
+	for (auto&& c : sz)
+	{
+		switch (c)
+		{
+		case '"':	pOut->append("\\\""); break;
+		case '\\':	pOut->append("\\\\"); break;
+		case '\n':	pOut->append("\\n"); break;
+		case '\r':	pOut->append("\\r"); break;
+		case '\t':	pOut->append("\\t"); break;
+
+		default:
+			if (static_cast<unsigned char>(c) < 0x20)
+				fmt::format_to(std::back_inserter(*pOut), "\\u{:04x}", static_cast<unsigned>(c));
+			else
+				pOut->push_back(c);
+			break;
+		}
+	}
+
+	pOut->push_back('"');
+}
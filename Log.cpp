@@ -0,0 +1,182 @@
+#include "Precompiled.hpp"
+#include "Log.hpp"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#define _isatty isatty
+#define _fileno fileno
+#endif
+
+namespace ch = std::chrono;
+
+using std::string;
+using std::string_view;
+using std::vector;
+
+inline constexpr size_t LOG_BATCH_SIZE = 16 * 1024;
+inline constexpr auto LOG_BATCH_AGE = ch::milliseconds{ 50 };
+
+static void StripAnsi(string* s) noexcept
+{
+	// CSI sequences only, which is all what fmt::text_style emits: ESC [ params final, where final is in '@'..'~'.
+	auto pWrite = s->begin();
+
+	for (auto it = s->begin(); it != s->end();)
+	{
+		if (*it == '\x1B' && std::next(it) != s->end() && *std::next(it) == '[')
+		{
+			it = std::ranges::find_if(std::next(it, 2), s->end(), [](char c) noexcept { return c >= '@' && c <= '~'; });
+
+			if (it != s->end())
+				++it;
+
+			continue;
+		}
+
+		*pWrite++ = *it++;
+	}
+
+	s->erase(pWrite, s->end());
+}
+
+struct log_sink_t final
+{
+	log_sink_t() noexcept
+		: m_bColored{ _isatty(_fileno(stdout)) != 0 }, m_Writer{ [this](std::stop_token const& st) noexcept { Run(st); } } {}
+
+	~log_sink_t() noexcept
+	{
+		{
+			std::scoped_lock Lock{ m_Lock };	// Otherwise the writer may miss the wake-up right before its wait.
+			m_Writer.request_stop();
+		}
+
+		m_cvQueue.notify_one();
+	}	// m_Writer drains the queue before joining.
+
+	log_sink_t(log_sink_t const&) = delete;
+	log_sink_t& operator=(log_sink_t const&) = delete;
+
+	void Submit(string&& szBatch) noexcept
+	{
+		{
+			std::scoped_lock Lock{ m_Lock };
+			m_Queue.emplace_back(std::move(szBatch));
+			++m_iSubmitted;
+		}
+
+		m_cvQueue.notify_one();
+	}
+
+	void WaitAll() noexcept
+	{
+		std::unique_lock Lock{ m_Lock };
+		m_cvWritten.wait(Lock, [this]() noexcept { return m_iWritten == m_iSubmitted; });
+	}
+
+private:
+	void Run(std::stop_token const& st) noexcept
+	{
+		vector<string> Batches{};
+
+		for (;;)
+		{
+			{
+				std::unique_lock Lock{ m_Lock };
+				m_cvQueue.wait(Lock, [&]() noexcept { return !m_Queue.empty() || st.stop_requested(); });
+
+				if (m_Queue.empty())
+					return;	// stop requested with nothing left.
+
+				std::swap(Batches, m_Queue);
+			}
+
+			for (auto& szBatch : Batches)
+			{
+				if (!m_bColored)
+					StripAnsi(&szBatch);
+
+				fmt::print(stdout, "{}", szBatch);	// Still through fmtlib for its console handling.
+			}
+
+			std::fflush(stdout);
+
+			{
+				std::scoped_lock Lock{ m_Lock };
+				m_iWritten += Batches.size();
+			}
+
+			m_cvWritten.notify_all();
+			Batches.clear();
+		}
+	}
+
+	bool const m_bColored;
+	std::mutex m_Lock{};
+	std::condition_variable m_cvQueue{};
+	std::condition_variable m_cvWritten{};
+	vector<string> m_Queue{};
+	size_t m_iSubmitted{};
+	size_t m_iWritten{};
+	std::jthread m_Writer;	// Last one, so that it starts after everything else is ready.
+};
+
+[[nodiscard]] static log_sink_t& Sink() noexcept
+{
+	static log_sink_t Instance{};
+	return Instance;
+}
+
+struct thread_buffer_t final
+{
+	string m_Text{};
+	ch::steady_clock::time_point m_LastCommit{ ch::steady_clock::now() };
+	bool m_bHeld{};
+
+	void HandOver() noexcept
+	{
+		if (!m_Text.empty())
+			Sink().Submit(std::exchange(m_Text, {}));
+
+		m_LastCommit = ch::steady_clock::now();
+	}
+
+	~thread_buffer_t() noexcept { HandOver(); }	// Worker threads hand their rest over on exit.
+};
+
+static thread_local thread_buffer_t tBuffer{};
+
+string& Log::Buffer() noexcept
+{
+	return tBuffer.m_Text;
+}
+
+void Log::Commit() noexcept
+{
+	if (tBuffer.m_bHeld)
+		return;
+
+	// Batching by age as well, so that a slow stream of lines does not sit in the buffer.
+	if (tBuffer.m_Text.size() >= LOG_BATCH_SIZE || ch::steady_clock::now() - tBuffer.m_LastCommit >= LOG_BATCH_AGE)
+		tBuffer.HandOver();
+}
+
+void Log::Hold() noexcept
+{
+	tBuffer.HandOver();
+	tBuffer.m_bHeld = true;
+}
+
+string Log::Release() noexcept
+{
+	tBuffer.m_bHeld = false;
+	return std::exchange(tBuffer.m_Text, {});
+}
+
+void Log::Flush() noexcept
+{
+	tBuffer.HandOver();
+	Sink().WaitAll();
+}
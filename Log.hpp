@@ -0,0 +1,74 @@
+#pragma once
+
+#if !defined(FMT_COLOR_H_)
+#include <fmt/color.h>
+#endif
+
+#ifndef _STRING_
+#include <string>
+#endif
+
+#ifndef _STRING_VIEW_
+#include <string_view>
+#endif
+
+// Everything is formatted into a buffer of the calling thread, then handed over in batches to a writer thread.
+// Output of any single thread keeps its order. Anything printed around the log, e.g. with fmt::print(), must be preceded by Log::Flush().
+// Colors are kept on a terminal, the ANSI sequences are stripped when stdout is redirected.
+
+enum struct ELogLevel : uint8_t
+{
+	Error,
+	Warning,
+	Info,		// The default.
+	Verbose,
+};
+
+inline ELogLevel gLogLevel = ELogLevel::Info;	// Only to be altered between commands.
+
+namespace Log
+{
+	[[nodiscard]] inline bool Enabled(ELogLevel lv) noexcept { return lv <= gLogLevel; }
+
+	[[nodiscard]] std::string& Buffer() noexcept;	// of the calling thread.
+	void Commit() noexcept;	// Hands the buffer of the calling thread over once it is large or old enough.
+	void Flush() noexcept;	// Hands everything of the calling thread over and waits until all of it is written.
+
+	// Keeps whatever the calling thread prints afterwards in its buffer, until taken out by Release() for the caller to write at its will.
+	void Hold() noexcept;
+	[[nodiscard]] std::string Release() noexcept;
+
+	template <typename... Args>
+	void FormatTo(std::string* pOut, ELogLevel lv, fmt::text_style const& style, fmt::format_string<Args...> szFormat, Args&&... args) noexcept
+	{
+		if (Enabled(lv))
+			fmt::format_to(std::back_inserter(*pOut), style, szFormat, std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	void Print(ELogLevel lv, fmt::text_style const& style, fmt::format_string<Args...> szFormat, Args&&... args) noexcept
+	{
+		if (!Enabled(lv))
+			return;
+
+		fmt::format_to(std::back_inserter(Buffer()), style, szFormat, std::forward<Args>(args)...);
+		Commit();
+	}
+
+	template <typename... Args>
+	void Print(ELogLevel lv, fmt::format_string<Args...> szFormat, Args&&... args) noexcept
+	{
+		if (!Enabled(lv))
+			return;
+
+		fmt::format_to(std::back_inserter(Buffer()), szFormat, std::forward<Args>(args)...);
+		Commit();
+	}
+
+	// Text already formatted, e.g. by FormatTo(), and already filtered by level.
+	inline void Write(std::string_view sz) noexcept
+	{
+		Buffer().append(sz);
+		Commit();
+	}
+}
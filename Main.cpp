@@ -2,10 +2,18 @@
 //
 
 #include "Precompiled.hpp"
+#include "CRCRecords.hpp"
+#include "Json.hpp"
+#include "Log.hpp"
 #include "Mod.hpp"
+#include "Server.hpp"
+#include "Stats.hpp"
+#include "Trace.hpp"
+#include "Watcher.hpp"
 
 import Application;
 import CommandLine;
+import CRC64;
 import Style;
 
 using namespace std::literals;
@@ -88,18 +96,76 @@ static void ShowVersion(span<string_view const> args) noexcept
 	fmt::println("");
 }
 
-static __forceinline void Default(const char* path_to_mod, string_view target_lang) noexcept
+// Set while -serve dispatches a request, whose arguments came as UTF-8 from JSON rather than in the code page of the console.
+static bool gUtf8Arguments = false;
+
+[[nodiscard]] static fs::path ArgumentToPath(string_view sz) noexcept
+{
+	return gUtf8Arguments ? Path::FromUtf8(sz) : fs::path{ sz };
+}
+
+// Path::Resolve() must be called in advance, the mod is the one resolved and the schema cache lives in its language folder.
+static void LoadModClasses() noexcept
 {
-	GetModClasses(path_to_mod, &gModClasses);
+	RWPHG_STAT_SCOPE(Schema);
+	RWPHG_TRACE_SCOPE("LoadModClasses");
+
+	auto const Digests = SchemaCache::DigestModAssemblies();
+	auto const Reader = gUseReflection ? SchemaCache::EReader::Reflection : SchemaCache::EReader::Metadata;
+
+	// Only a resident process ever comes here twice: same assemblies of the same mod read the same way as last time, the classes in hand are still the ones.
+	static fs::path LastModDir{};
+	static SchemaCache::assembly_digests_t LastDigests{};
+	static std::optional<SchemaCache::EReader> LastReader{};
+
+	if (gResident && Path::ModDirectory == LastModDir && Digests == LastDigests && Reader == LastReader)
+	{
+		Log::Print(ELogLevel::Verbose, Style::Info, "Mod classes reused from the last request.\n");
+		return;
+	}
+
+	// Namespaces are views into the classes, hence the order. Vanilla ones are put back below.
+	gAllNamespaces.clear();
+	gModClasses.clear();
+
+	if (Digests.empty() || !SchemaCache::Load(Path::Lang::SchemaCache, Digests, Reader, &gModClasses))
+	{
+		if (gUseReflection)
+		{
+			Log::Flush();	// CLR side prints directly.
+			ReflectModClasses(Path::ModDirectory, &gModClasses);
+		}
+		else
+			GetModClasses(Path::ModDirectory, &gModClasses);
+
+		if (!Digests.empty())
+			SchemaCache::Save(Path::Lang::SchemaCache, Digests, Reader, gModClasses);
+	}
+
+	gAllNamespaces.insert_range(gRimWorldClasses.m_Namespaces);
 	gAllNamespaces.insert_range(gModClasses | std::views::values | std::views::transform(&class_info_t::m_Namespace));
 
-	Path::Resolve(path_to_mod, target_lang);
-	ProcessMod();
+	BuildClassLookupCache();
+
+	LastModDir = Path::ModDirectory;
+	LastDigests = Digests;
+	LastReader = Reader;
+
+	RWPHG_STAT_ADD(Schema, Files, Digests.size());
+	RWPHG_STAT_ADD(Schema, Entries, gModClasses.size());
+}
+
+static __forceinline void Default(string_view path_to_mod, string_view target_lang, span<string_view const> other_langs = {}) noexcept
+{
+	Path::Resolve(ArgumentToPath(path_to_mod), target_lang);
+	LoadModClasses();
+
+	ProcessMod(other_langs);
 }
 
 static void Default(span<string_view const> args) noexcept
 {
-	return Default(args[0].data(), args[1]);
+	return Default(args[0], args[1], args.subspan(2));
 }
 
 static void NoXRef(span<string_view const> args) noexcept
@@ -107,10 +173,9 @@ static void NoXRef(span<string_view const> args) noexcept
 	auto& path_to_mod = args[0];
 	auto& target_lang = args[1];
 
-	GetModClasses(path_to_mod.data(), &gModClasses);
-	gAllNamespaces.insert_range(gModClasses | std::views::values | std::views::transform(&class_info_t::m_Namespace));
+	Path::Resolve(ArgumentToPath(path_to_mod), target_lang);
+	LoadModClasses();
 
-	Path::Resolve(path_to_mod, target_lang);
 	NoXRef();
 }
 
@@ -119,7 +184,7 @@ static void ClrDbg(span<string_view const> args) noexcept
 	auto& path_to_mod = args[0];
 	auto& target_lang = args[1];
 
-	Path::Resolve(path_to_mod, target_lang);
+	Path::Resolve(ArgumentToPath(path_to_mod), target_lang);
 	Path::ClearDebugFiles();
 }
 
@@ -134,23 +199,377 @@ static void XmlMerging(span<string_view const> args) noexcept
 	auto& target_lang = args[1];
 	bool bShouldWrite = args.size() < 3 || !TextToBoolean(args[2]);
 
-	GetModClasses(path_to_mod.data(), &gModClasses);
-	gAllNamespaces.insert_range(gModClasses | std::views::values | std::views::transform(&class_info_t::m_Namespace));
+	Path::Resolve(ArgumentToPath(path_to_mod), target_lang);
+	LoadModClasses();
 
-	Path::Resolve(path_to_mod, target_lang);
 	FileMergingSuggestion(bShouldWrite);
 }
 
+static void FuzzyMerging(span<string_view const> args) noexcept
+{
+	auto& path_to_mod = args[0];
+	auto& target_lang = args[1];
+	float flThreshold = 0.8f;
+	bool bShouldWrite = args.size() < 4 || !TextToBoolean(args[3]);
+
+	if (args.size() >= 3)
+	{
+		if (auto const [ptr, ec] = std::from_chars(args[2].data(), args[2].data() + args[2].size(), flThreshold);
+			ec != std::errc{} || flThreshold <= 0 || flThreshold > 1)
+		{
+			Log::Print(ELogLevel::Error, Style::Error, "Invalid score: '{}', expecting a number in (0, 1].\n", args[2]);
+			return;
+		}
+	}
+
+	Path::Resolve(ArgumentToPath(path_to_mod), target_lang);
+	LoadModClasses();
+
+	FuzzyMergingSuggestion(flThreshold, bShouldWrite);
+}
+
+static void SetJobs(span<string_view const> args) noexcept
+{
+	uint32_t iJobs{};
+
+	if (auto const [ptr, ec] = std::from_chars(args[0].data(), args[0].data() + args[0].size(), iJobs);
+		ec != std::errc{} || iJobs == 0)
+	{
+		Log::Print(ELogLevel::Error, Style::Error, "Invalid job count: '{}'\n", args[0]);
+		return;
+	}
+
+	gJobs = iJobs;
+	Log::Print(ELogLevel::Info, Style::Info, "Worker count set to {}{}\n", gJobs, gJobs == 1 ? " (serial)" : "");
+}
+
+static void UseReflection(span<string_view const>) noexcept
+{
+	gUseReflection = true;
+	Log::Print(ELogLevel::Info, Style::Info, "Mod classes will be loaded through CLR reflection.\n");
+}
+
+static void UseTranslationMemory(span<string_view const>) noexcept
+{
+	gTranslationMemory = true;
+	Log::Print(ELogLevel::Info, Style::Info, "New entries will be filled from the translation memory of their language.\n");
+}
+
+static void Quiet(span<string_view const>) noexcept
+{
+	gLogLevel = ELogLevel::Warning;
+}
+
+static void Verbose(span<string_view const>) noexcept
+{
+	gLogLevel = ELogLevel::Verbose;
+	Log::Print(ELogLevel::Info, Style::Info, "Verbose output enabled.\n");
+}
+
+[[nodiscard]]
+static bool WildcardMatch(std::wstring_view wcsPattern, std::wstring_view wcsName) noexcept
+{
+	// Only '*' and '?', case-insensitive as the file system is. Backtracks to the last star only.
+	size_t p = 0, n = 0, iStar = std::wstring_view::npos, iResume = 0;
+
+	while (n < wcsName.size())
+	{
+		if (p < wcsPattern.size() && (wcsPattern[p] == L'?' || towlower(wcsPattern[p]) == towlower(wcsName[n])))
+			++p, ++n;
+		else if (p < wcsPattern.size() && wcsPattern[p] == L'*')
+			iStar = p++, iResume = n;
+		else if (iStar != std::wstring_view::npos)
+			p = iStar + 1, n = ++iResume;
+		else
+			return false;
+	}
+
+	while (p < wcsPattern.size() && wcsPattern[p] == L'*')
+		++p;
+
+	return p == wcsPattern.size();
+}
+
+// Either a UTF-8 text file of one mod directory per line, with '#' for comments, or a path with wildcards, e.g. "workshop/294100/*/1.5".
+// Wildcards are only allowed in one component, the components after it are appended as is.
+[[nodiscard]]
+static vector<fs::path> ListBatchMods(string_view szSource) noexcept
+{
+	vector<fs::path> ret{};
+	std::error_code ec{};
+	fs::path const Source{ szSource };
+
+	if (fs::is_regular_file(Source, ec))
+	{
+		std::ifstream f{ Source };
+
+		for (string szLine{}; std::getline(f, szLine);)
+		{
+			if (szLine.starts_with("\xEF\xBB\xBF"))	// BOM, as Notepad saves it.
+				szLine.erase(0, 3);
+
+			auto const sz = string_view{ szLine }.substr(0, szLine.find('#'));
+			auto const iFirst = sz.find_first_not_of(" \t\r");
+			auto const iLast = sz.find_last_not_of(" \t\r");
+
+			if (iFirst != string_view::npos)
+				ret.emplace_back(Path::FromUtf8(sz.substr(iFirst, iLast - iFirst + 1)));
+		}
+
+		return ret;
+	}
+
+	fs::path Base{}, Rest{};
+	std::wstring Pattern{};
+
+	for (auto&& Component : Source)
+	{
+		if (!Pattern.empty())
+			Rest /= Component;
+		else if (Component.native().find_first_of(L"*?") != std::wstring::npos)
+			Pattern = Component.native();
+		else
+			Base /= Component;
+	}
+
+	if (Pattern.empty())
+	{
+		ret.emplace_back(Source);	// Just one mod.
+		return ret;
+	}
+
+	if (Base.empty())
+		Base = L".";
+
+	for (auto&& Entry : fs::directory_iterator(Base, ec))
+	{
+		if (Entry.is_directory(ec) && WildcardMatch(Pattern, Entry.path().filename().native()))
+		{
+			if (auto ModDir = Rest.empty() ? Entry.path() : Entry.path() / Rest; fs::is_directory(ModDir, ec))
+				ret.emplace_back(std::move(ModDir));
+		}
+	}
+
+	std::ranges::sort(ret);
+	return ret;
+}
+
+static void Batch(span<string_view const> args) noexcept
+{
+	auto const Mods = ListBatchMods(args[0]);
+	auto const Langs = args.subspan(1);
+
+	if (Mods.empty())
+	{
+		Log::Print(ELogLevel::Error, Style::Error, "No mod directory found from '{}'\n", args[0]);
+		return;
+	}
+
+	// One mod after another in this very process: the engine schema, the CLR assembly cache and the file CRC memo stay warm.
+	// The pipeline keeps the state of its mod in globals, so the parallelism is within each mod, all workers for one mod at a time.
+
+	size_t iDone = 0, iSkipped = 0, iEntries = 0;
+	auto const Begin = std::chrono::steady_clock::now();
+
+	for (auto&& ModDir : Mods)
+	{
+		std::error_code ec{};
+
+		if (!fs::is_directory(ModDir / L"Defs", ec))
+		{
+			Log::Print(ELogLevel::Info, Style::Skipping, "Skipping '{}': no Defs folder.\n", ModDir.u8string());
+			++iSkipped;
+			continue;
+		}
+
+		Log::Print(ELogLevel::Info, Style::Action, "\n[{}/{}] ", iDone + iSkipped + 1, Mods.size());
+		Log::Print(ELogLevel::Info, Style::Name, "{}\n", ModDir.u8string());
+
+		Path::Resolve(ModDir, Langs[0]);
+		LoadModClasses();
+
+		iEntries += ProcessMod(Langs.subspan(1));
+		++iDone;
+	}
+
+	std::chrono::duration<double> const Elapsed = std::chrono::steady_clock::now() - Begin;
+
+	Log::Print(
+		ELogLevel::Warning, Style::Positive,
+		"\nBatch: {} mod{} processed, {} skipped in {:.2f}s. {:.2f} mods/s, {:.0f} entries/s over {} language{}.\n",
+		iDone, iDone < 2 ? "" : "s", iSkipped, Elapsed.count(),
+		iDone / Elapsed.count(), iEntries * Langs.size() / Elapsed.count(), Langs.size(), Langs.size() < 2 ? "" : "s"
+	);
+}
+
+inline constexpr auto WATCH_DEBOUNCE = std::chrono::milliseconds{ 200 };
+
+static void Watch(span<string_view const> args) noexcept
+{
+	auto& path_to_mod = args[0];
+	auto& target_lang = args[1];
+
+	Path::Resolve(ArgumentToPath(path_to_mod), target_lang);
+	LoadModClasses();
+
+	ProcessWatchedMod(true, true);
+
+	// Assemblies are not looked after, a rebuilt mod needs a restart for its classes.
+	vector<fs::path> Roots{ Path::ModDirectory / L"Defs" };
+
+	if (Path::Source::Keyed)
+		Roots.push_back(*Path::Source::Keyed);
+	if (Path::Source::Strings)
+		Roots.push_back(*Path::Source::Strings);
+
+	dir_watcher_t Watcher{ Roots };
+
+	Log::Print(ELogLevel::Warning, Style::Positive, "\nWatching {} folder{}{}. Press Ctrl+C to stop.\n", Roots.size(), Roots.size() < 2 ? "" : "s", Watcher.IsPolling() ? " by polling" : "");
+	Log::Flush();
+
+	// Ctrl+C ends the loop rather than the process, -trace and -stats are saved by main() as usual.
+	while (!dir_watcher_t::Interrupted())
+	{
+		auto const Changed = Watcher.Wait(WATCH_DEBOUNCE);
+		if (Changed.empty())
+			continue;
+
+		auto const Begin = std::chrono::steady_clock::now();
+		auto const bStringsChanged = Path::Source::Strings && std::ranges::any_of(
+			Changed, [](fs::path const& File) noexcept { return File.native().starts_with(Path::Source::Strings->native()); }
+		);
+
+		Log::Print(ELogLevel::Info, Style::Action, "\n{} file{} changed.\n", Changed.size(), Changed.size() < 2 ? "" : "s");
+
+		auto const iPatched = ProcessWatchedMod(false, bStringsChanged);
+		std::chrono::duration<double, std::milli> const Elapsed = std::chrono::steady_clock::now() - Begin;
+
+		Log::Print(ELogLevel::Warning, Style::Positive, "{} localization file{} patched in {:.2f}ms.\n", iPatched, iPatched < 2 ? "" : "s", Elapsed.count());
+		Log::Flush();
+	}
+
+	Log::Print(ELogLevel::Warning, Style::Positive, "\nStopped watching.\n");
+}
+
+static void EnableStats(span<string_view const> args) noexcept
+{
+	gStats = true;
+
+	if (!args.empty())
+		gStatsJson.emplace(args[0]);
+}
+
+static void EnableTrace(span<string_view const> args) noexcept
+{
+	gTrace = true;
+	gTraceFile.emplace(args[0]);
+}
+
+static void SendRequest(span<string_view const> args) noexcept
+{
+	string szRequest{ "{\"id\":1,\"cmd\":" };
+	AppendJsonString(&szRequest, args[1]);
+	szRequest.append(",\"args\":[");
+
+	for (auto&& [i, arg] : args | std::views::drop(2) | std::views::enumerate)
+	{
+		if (i)
+			szRequest.push_back(',');
+
+		AppendJsonString(&szRequest, arg);
+	}
+
+	szRequest.append("]}");
+
+	auto const Begin = std::chrono::steady_clock::now();
+	auto const Response = Server::Request(fs::path{ args[0] }, szRequest);
+	std::chrono::duration<double, std::milli> const Elapsed = std::chrono::steady_clock::now() - Begin;
+
+	if (Response)
+		Log::Print(ELogLevel::Warning, Style::Info, "{}\nRound trip: {:.2f}ms\n", *Response, Elapsed.count());
+}
+
+static void BenchmarkCRC(span<string_view const> args) noexcept
+{
+	size_t iMegabytes = 256;
+
+	if (!args.empty())
+	{
+		if (auto const [ptr, ec] = std::from_chars(args[0].data(), args[0].data() + args[0].size(), iMegabytes);
+			ec != std::errc{} || iMegabytes == 0)
+		{
+			Log::Print(ELogLevel::Error, Style::Error, "Invalid buffer size: '{}'\n", args[0]);
+			return;
+		}
+	}
+
+	vector<std::byte> Buffer(iMegabytes << 20);
+	std::mt19937_64 Engine{ iMegabytes };
+	std::ranges::generate(Buffer, [&]() noexcept { return static_cast<std::byte>(Engine()); });
+
+	auto const iReference = CRC64::CheckStream(CRC64::EKernel::Bytewise, Buffer.data(), Buffer.size());
+
+	for (auto&& k : CRC64::ALL_KERNELS)
+	{
+		if (!CRC64::IsSupported(k))
+		{
+			Log::Print(ELogLevel::Info, Style::Skipping, "{:<16}Not supported by this CPU.\n", CRC64::KernelName(k));
+			continue;
+		}
+
+		auto const Begin = std::chrono::steady_clock::now();
+		auto const crc = CRC64::CheckStream(k, Buffer.data(), Buffer.size());
+		std::chrono::duration<double> const Elapsed = std::chrono::steady_clock::now() - Begin;
+
+		Log::Print(
+			ELogLevel::Warning, crc == iReference ? Style::Positive : Style::Error,
+			"{:<16}{:>8.2f} GB/s\t{:016X}\n",
+			CRC64::KernelName(k), Buffer.size() / Elapsed.count() / 1e9, crc
+		);
+	}
+}
+
+static void ConvertCRC(span<string_view const> args) noexcept
+{
+	fs::path const From{ args[0] };
+	fs::path const To{ args[1] };
+
+	auto const Records = CRCRecords::Open(From);
+	if (!Records)
+	{
+		Log::Print(ELogLevel::Error, Style::Error, "Unable to read CRC records from '{}'\n", From.u8string());
+		return;
+	}
+
+	if (CRCRecords::Save(To, Records))
+		Log::Print(ELogLevel::Info, Style::Positive, "{} CRC records converted into '{}'\n", Records.Header().m_iRecordCount, To.u8string());
+}
+
 #pragma region Command line stuff
 inline constexpr string_view ARG_DESC_HELP[] = { "-help" };
 inline constexpr string_view ARG_DESC_VERSION[] = { "-version", "[bool:show_extra]", };
 inline constexpr string_view ARG_DESC_CLRDBG[] = { "-clrdbg", "mod_dir", "target_lang", };
 inline constexpr string_view ARG_DESC_NOXREF[] = { "-noxref", "mod_dir", "target_lang", };
-inline constexpr string_view ARG_DESC_GENPH[] = { "-genph", "mod_dir", "target_lang", };
+inline constexpr string_view ARG_DESC_GENPH[] = { "-genph", "mod_dir", "target_lang", "[other_langs...]", };
 inline constexpr string_view ARG_DESC_CLR[] = { "-cls", };
 inline constexpr string_view ARG_DESC_XMLMERG[] = { "-xmlmerg","mod_dir", "target_lang", "[bool:print_only]" };
+inline constexpr string_view ARG_DESC_FUZZYMERG[] = { "-fuzzymerg", "mod_dir", "target_lang", "[min_score]", "[bool:print_only]", };
+inline constexpr string_view ARG_DESC_JOBS[] = { "-jobs", "count", };
+inline constexpr string_view ARG_DESC_REFLECT[] = { "-reflect", };
+inline constexpr string_view ARG_DESC_TM[] = { "-tm", };
+inline constexpr string_view ARG_DESC_QUIET[] = { "-quiet", };
+inline constexpr string_view ARG_DESC_VERBOSE[] = { "-verbose", };
+inline constexpr string_view ARG_DESC_BATCH[] = { "-batch", "list_file_or_glob", "target_lang", "[other_langs...]", };
+inline constexpr string_view ARG_DESC_WATCH[] = { "-watch", "mod_dir", "target_lang", };
+inline constexpr string_view ARG_DESC_STATS[] = { "-stats", "[json_file]", };
+inline constexpr string_view ARG_DESC_TRACE[] = { "-trace", "out_file", };
+inline constexpr string_view ARG_DESC_SERVE[] = { "-serve", "[socket_file]", };
+inline constexpr string_view ARG_DESC_REQUEST[] = { "-request", "socket_file", "cmd", "[args...]", };
+inline constexpr string_view ARG_DESC_CRCBENCH[] = { "-crcbench", "[size_in_mb]", };
+inline constexpr string_view ARG_DESC_CRCCONV[] = { "-crcconv", "from_file", "to_file", };
 
 extern void ShowHelp(span<string_view const>) noexcept;
+extern void Serve(span<string_view const>) noexcept;
 
 // #UPDATE_AT_CPP26 span over initializer list
 inline constexpr tuple<span<string_view const>, void(*)(span<string_view const>), string_view> CMD_HANDLER[] =
@@ -159,9 +578,23 @@ inline constexpr tuple<span<string_view const>, void(*)(span<string_view const>)
 	{ ARG_DESC_VERSION, &ShowVersion, "Display version of this application." },
 	{ ARG_DESC_CLRDBG, &ClrDbg, "Clearing all files generated by this application under debug mode." },
 	{ ARG_DESC_NOXREF, &NoXRef, "Finding all localization files which has no reference from current mod." },
-	{ ARG_DESC_GENPH, &Default, "Generate English-based placeholders for a certain language." },
+	{ ARG_DESC_GENPH, &Default, "Generate English-based placeholders for one or more languages. Sources are extracted once, the languages are then processed at once." },
 	{ ARG_DESC_CLR, &ClearConsole, "Clear the entire console output screen." },
 	{ ARG_DESC_XMLMERG, &XmlMerging, "Merging possible misplaced xmls and their entries." },
+	{ ARG_DESC_FUZZYMERG, &FuzzyMerging, "Carry over translations of renamed entries, paired by similarity of their names within the same Def type and field. min_score defaults to 0.8." },
+	{ ARG_DESC_JOBS, &SetJobs, "Set the worker count of the commands after it. Use 1 for the serial path." },
+	{ ARG_DESC_REFLECT, &UseReflection, "Load mod classes through CLR reflection rather than reading assembly metadata." },
+	{ ARG_DESC_TM, &UseTranslationMemory, "Fill new entries of the commands after it with the existing translation of the same English text, rather than the English itself." },
+	{ ARG_DESC_QUIET, &Quiet, "Print only warnings and errors from the commands after it." },
+	{ ARG_DESC_VERBOSE, &Verbose, "Print extra details, e.g. cache hits, from the commands after it." },
+	{ ARG_DESC_BATCH, &Batch, "Generate placeholders for every mod listed in a file, one directory per line, or matched by a wildcard such as 'content/294100/*'." },
+	{ ARG_DESC_WATCH, &Watch, "Generate placeholders, then keep regenerating on every change of the English sources. Only the files altered are parsed again." },
+	{ ARG_DESC_STATS, &EnableStats, "Print time and counters of every phase once all commands are done. Also written as JSON if a file is given." },
+	{ ARG_DESC_TRACE, &EnableTrace, "Record a timeline of the commands after it, saved in Chrome trace-event format once all commands are done." },
+	{ ARG_DESC_SERVE, &Serve, "Stay resident and serve genph, noxref and xmlmerg requests over a local socket, one JSON object per line. Schemas and extraction caches are kept in memory." },
+	{ ARG_DESC_REQUEST, &SendRequest, "Send one request to a running -serve, e.g. 'genph mod_dir target_lang', or 'quit' to stop it." },
+	{ ARG_DESC_CRCBENCH, &BenchmarkCRC, "Measure the throughput of every CRC64 kernel over a random buffer." },
+	{ ARG_DESC_CRCCONV, &ConvertCRC, "Convert CRC records between the binary and the XML form. Output is XML if to_file ends with '.xml'." },
 };
 
 void ShowHelp(span<string_view const>) noexcept
@@ -203,6 +636,79 @@ static_assert(
 );
 #pragma endregion Command line stuff
 
+#pragma region Resident mode
+inline constexpr string_view SERVE_COMMANDS[] = { "genph", "noxref", "xmlmerg", };
+
+// One request line in, one answer line out. Whatever the command prints goes to the console of the server as usual.
+static bool ServeRequest(string_view szLine, string* pResponse) noexcept
+{
+	auto const Begin = std::chrono::steady_clock::now();
+	Server::request_t Request{};
+	string_view szError{};
+	bool bServing = true;
+
+	if (!Server::ParseRequest(szLine, &Request))
+		szError = "Malformed request.";
+	else if (Request.m_Command == "quit")
+		bServing = false;
+	else if (!std::ranges::contains(SERVE_COMMANDS, Request.m_Command))
+		szError = "Unknown command.";
+	else
+	{
+		auto const szCommand = "-" + Request.m_Command;
+		auto const& Handler = *std::ranges::find(CMD_HANDLER, string_view{ szCommand }, [](auto&& Entry) noexcept { return std::get<0>(Entry).front(); });
+		auto const& arg_desc = std::get<0>(Handler);
+
+		// Checked here rather than by CommandLineWrapper(), which would complain to the console of the server instead of the client.
+		auto const iMaxArgs = arg_desc.size() - 1;
+		auto const iRequiredArgs = iMaxArgs - static_cast<size_t>(std::ranges::count_if(arg_desc, &IsOptionalArgument));
+		auto const bVariadic = IsVariadicArgument(arg_desc.back());
+		std::error_code ec{};
+
+		if (Request.m_Args.size() < iRequiredArgs || (!bVariadic && Request.m_Args.size() > iMaxArgs))
+			szError = "Wrong argument count.";
+		else if (!fs::is_directory(Path::FromUtf8(Request.m_Args[0]), ec))
+			szError = "Mod directory not found.";
+		else
+		{
+			auto const Args = Request.m_Args | as_string_view | std::ranges::to<vector>();	// Null-terminated, handlers may pass them on as C strings.
+
+			Log::Print(ELogLevel::Info, Style::Action, "\n{} ", szCommand);
+			Log::Print(ELogLevel::Info, Style::Name, "{}\n", Args[0]);
+
+			gUtf8Arguments = true;
+			std::get<1>(Handler)(Args);
+			gUtf8Arguments = false;
+			Log::Flush();
+		}
+	}
+
+	std::chrono::duration<double, std::milli> const Elapsed = std::chrono::steady_clock::now() - Begin;
+
+	fmt::format_to(std::back_inserter(*pResponse), "{{\"id\":{},\"ok\":{},\"ms\":{:.2f}", Request.m_Id, szError.empty(), Elapsed.count());
+
+	if (!szError.empty())
+	{
+		pResponse->append(",\"error\":");
+		AppendJsonString(pResponse, szError);
+	}
+
+	pResponse->push_back('}');
+	return bServing;
+}
+
+void Serve(span<string_view const> args) noexcept
+{
+	// Requests go one after another on this very thread, the state of the pipeline is not meant to be shared.
+	gResident = true;
+
+	if (Server::Serve(args.empty() ? Server::DefaultEndpoint() : fs::path{ args[0] }, &ServeRequest))
+		Log::Print(ELogLevel::Info, Style::Positive, "Server stopped.\n");
+
+	gResident = false;
+}
+#pragma endregion Resident mode
+
 static void DragAndDropMode(span<string_view const> args) noexcept
 {
 	switch (args.size())
@@ -242,7 +748,8 @@ static void DragAndDropMode(span<string_view const> args) noexcept
 #ifndef _DEBUG
 		std::this_thread::sleep_for(1s);
 #endif
-		Default(args[0].data(), sz);
+		Default(args[0], sz);
+		Log::Flush();
 
 #ifndef _DEBUG
 		fmt::print(Style::Positive, "\nDONE.\nPress Enter to exit.");
@@ -256,7 +763,8 @@ static void DragAndDropMode(span<string_view const> args) noexcept
 #ifndef _DEBUG
 		std::this_thread::sleep_for(1s);
 #endif
-		Default(args[0].data(), args[1]);
+		Default(args[0], args[1]);
+		Log::Flush();
 
 #ifndef _DEBUG
 		fmt::print(Style::Positive, "\nDONE.\nPress Enter to exit.");
@@ -348,8 +856,22 @@ int main(int argc, char *argv[]) noexcept
 		for (auto&& [arg_desc, pfn, desc] : CMD_HANDLER)
 			if (CommandLineWrapper(desc, arg_desc, arg_list, pfn))
 				break;
+
+		Log::Flush();	// Before the next command prints anything by itself.
+	}
+
+	if (gTrace && gTraceFile && Trace::Save(*gTraceFile))
+		Log::Print(ELogLevel::Info, Style::Positive, "Trace saved into '{}'\n", gTraceFile->u8string());
+
+	if (gStats)
+	{
+		Stats::Print();
+
+		if (gStatsJson && Stats::SaveJson(*gStatsJson))
+			Log::Print(ELogLevel::Info, Style::Positive, "Statistics saved into '{}'\n", gStatsJson->u8string());
 	}
 
+	Log::Flush();
 	return EXIT_SUCCESS;
 }
 
@@ -0,0 +1,62 @@
+#include "Precompiled.hpp"
+#include "MappedFile.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+mapped_file_t::mapped_file_t(std::filesystem::path const& hPath) noexcept
+{
+#ifdef _WIN32
+	auto const hFile = CreateFileW(hPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return;
+
+	if (LARGE_INTEGER iSize{}; GetFileSizeEx(hFile, &iSize) && iSize.QuadPart > 0)
+	{
+		if (auto const hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr); hMapping != nullptr)
+		{
+			m_pData = static_cast<std::byte const*>(MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0));
+			m_iSize = m_pData ? static_cast<std::size_t>(iSize.QuadPart) : 0;
+
+			CloseHandle(hMapping);
+		}
+	}
+
+	CloseHandle(hFile);
+#else
+	auto const fd = open(hPath.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return;
+
+	if (struct stat st {}; fstat(fd, &st) == 0 && st.st_size > 0)
+	{
+		if (auto const p = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0); p != MAP_FAILED)
+		{
+			m_pData = static_cast<std::byte const*>(p);
+			m_iSize = static_cast<std::size_t>(st.st_size);
+		}
+	}
+
+	close(fd);
+#endif
+}
+
+mapped_file_t::~mapped_file_t() noexcept
+{
+	if (m_pData == nullptr)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(m_pData);
+#else
+	munmap(const_cast<std::byte*>(m_pData), m_iSize);
+#endif
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#ifndef _CSTDDEF_
+#include <cstddef>
+#endif
+
+#ifndef _FILESYSTEM_
+#include <filesystem>
+#endif
+
+#ifndef _SPAN_
+#include <span>
+#endif
+
+#ifndef _UTILITY_
+#include <utility>
+#endif
+
+// Read-only view of a whole file. The handles are released right after mapping, the view alone keeps it alive.
+struct mapped_file_t final
+{
+	mapped_file_t() noexcept = default;
+	explicit mapped_file_t(std::filesystem::path const& hPath) noexcept;
+	~mapped_file_t() noexcept;
+
+	mapped_file_t(mapped_file_t const&) noexcept = delete;
+	mapped_file_t(mapped_file_t&& rhs) noexcept : m_pData{ std::exchange(rhs.m_pData, nullptr) }, m_iSize{ std::exchange(rhs.m_iSize, 0) } {}
+	mapped_file_t& operator=(mapped_file_t const&) noexcept = delete;
+	mapped_file_t& operator=(mapped_file_t&& rhs) noexcept { std::swap(m_pData, rhs.m_pData); std::swap(m_iSize, rhs.m_iSize); return *this; }
+
+	[[nodiscard]] std::span<std::byte const> Data() const noexcept { return { m_pData, m_iSize }; }
+	[[nodiscard]] explicit operator bool() const noexcept { return m_pData != nullptr; }
+
+private:
+	std::byte const* m_pData{};
+	std::size_t m_iSize{};
+};
@@ -0,0 +1,922 @@
+#include "Precompiled.hpp"
+#include "Mod.hpp"
+#include "MappedFile.hpp"
+#include "Log.hpp"
+#include "Trace.hpp"
+
+import Style;
+
+namespace fs = std::filesystem;
+
+using std::span;
+using std::string;
+using std::string_view;
+using std::vector;
+
+// Just enough of ECMA-335 Partition II to rebuild what System.Reflection gives ParseTypes() in CPPCLI.cpp.
+// Nothing is loaded or resolved by runtime, hence neither missing dependencies nor the CLR itself are of concern.
+
+namespace Metadata
+{
+	enum ETable : uint8_t
+	{
+		Module, TypeRef, TypeDef, FieldPtr, Field, MethodPtr, MethodDef, ParamPtr, Param, InterfaceImpl, MemberRef, Constant,
+		CustomAttribute, FieldMarshal, DeclSecurity, ClassLayout, FieldLayout, StandAloneSig, EventMap, EventPtr, Event, PropertyMap,
+		PropertyPtr, Property, MethodSemantics, MethodImpl, ModuleRef, TypeSpec, ImplMap, FieldRVA, EncLog, EncMap, Assembly,
+		AssemblyProcessor, AssemblyOS, AssemblyRef, AssemblyRefProcessor, AssemblyRefOS, File, ExportedType, ManifestResource,
+		NestedClass, GenericParam, MethodSpec, GenericParamConstraint,
+
+		TABLE_COUNT,	// Also stands for the unused tags of CustomAttributeType.
+	};
+
+	enum ECoded : uint8_t
+	{
+		TypeDefOrRef, HasConstant, HasCustomAttribute, HasFieldMarshal, HasDeclSecurity, MemberRefParent, HasSemantics,
+		MethodDefOrRef, MemberForwarded, Implementation, CustomAttributeType, ResolutionScope, TypeOrMethodDef,
+
+		CODED_COUNT,
+	};
+
+	enum ESignature : uint8_t
+	{
+		ELEMENT_TYPE_VALUETYPE = 0x11,
+		ELEMENT_TYPE_CLASS = 0x12,
+		ELEMENT_TYPE_ARRAY = 0x14,
+		ELEMENT_TYPE_GENERICINST = 0x15,
+		ELEMENT_TYPE_SZARRAY = 0x1D,
+		ELEMENT_TYPE_CMOD_REQD = 0x1F,
+		ELEMENT_TYPE_CMOD_OPT = 0x20,
+
+		FIELD = 0x06,
+	};
+
+	inline constexpr uint16_t fdStatic = 0x0010;
+	inline constexpr uint16_t fdFieldAccessMask = 0x0007;
+	inline constexpr uint16_t fdPrivate = 0x0001;
+
+	struct coded_index_t final
+	{
+		uint8_t m_iTagBits{};
+		uint8_t m_iCount{};
+		ETable m_Tables[22]{};
+	};
+
+	inline constexpr coded_index_t CODED_INDICES[CODED_COUNT] =
+	{
+		{ 2, 3, { TypeDef, TypeRef, TypeSpec, } },
+		{ 2, 3, { Field, Param, Property, } },
+		{ 5, 22, {
+			MethodDef, Field, TypeRef, TypeDef, Param, InterfaceImpl, MemberRef, Module, DeclSecurity, Property, Event,
+			StandAloneSig, ModuleRef, TypeSpec, Assembly, AssemblyRef, File, ExportedType, ManifestResource, GenericParam,
+			GenericParamConstraint, MethodSpec,
+		} },
+		{ 1, 2, { Field, Param, } },
+		{ 2, 3, { TypeDef, MethodDef, Assembly, } },
+		{ 3, 5, { TypeDef, TypeRef, ModuleRef, MethodDef, TypeSpec, } },
+		{ 1, 2, { Event, Property, } },
+		{ 1, 2, { MethodDef, MemberRef, } },
+		{ 1, 2, { Field, MethodDef, } },
+		{ 2, 3, { File, AssemblyRef, ExportedType, } },
+		{ 3, 5, { TABLE_COUNT, TABLE_COUNT, MethodDef, MemberRef, TABLE_COUNT, } },
+		{ 2, 4, { Module, ModuleRef, AssemblyRef, TypeRef, } },
+		{ 1, 2, { TypeDef, MethodDef, } },
+	};
+
+	enum struct EColumn : uint8_t { None, U16, U32, String, Guid, Blob, Index, Coded, };
+
+	struct column_t final
+	{
+		EColumn m_Kind{};
+		uint8_t m_iTarget{};	// ETable for EColumn::Index, ECoded for EColumn::Coded.
+	};
+
+	inline constexpr size_t MAX_COLUMNS = 9;
+
+	inline constexpr column_t U16{ EColumn::U16 }, U32{ EColumn::U32 }, Str{ EColumn::String }, Guid{ EColumn::Guid }, Blb{ EColumn::Blob };
+	consteval column_t Idx(ETable t) noexcept { return { EColumn::Index, t }; }
+	consteval column_t Cod(ECoded c) noexcept { return { EColumn::Coded, c }; }
+
+	inline constexpr column_t LAYOUTS[TABLE_COUNT][MAX_COLUMNS] =
+	{
+		/* Module */					{ U16, Str, Guid, Guid, Guid, },
+		/* TypeRef */					{ Cod(ResolutionScope), Str, Str, },
+		/* TypeDef */					{ U32, Str, Str, Cod(TypeDefOrRef), Idx(Field), Idx(MethodDef), },
+		/* FieldPtr */					{ Idx(Field), },
+		/* Field */						{ U16, Str, Blb, },
+		/* MethodPtr */					{ Idx(MethodDef), },
+		/* MethodDef */					{ U32, U16, U16, Str, Blb, Idx(Param), },
+		/* ParamPtr */					{ Idx(Param), },
+		/* Param */						{ U16, U16, Str, },
+		/* InterfaceImpl */				{ Idx(TypeDef), Cod(TypeDefOrRef), },
+		/* MemberRef */					{ Cod(MemberRefParent), Str, Blb, },
+		/* Constant */					{ U16, Cod(HasConstant), Blb, },
+		/* CustomAttribute */			{ Cod(HasCustomAttribute), Cod(CustomAttributeType), Blb, },
+		/* FieldMarshal */				{ Cod(HasFieldMarshal), Blb, },
+		/* DeclSecurity */				{ U16, Cod(HasDeclSecurity), Blb, },
+		/* ClassLayout */				{ U16, U32, Idx(TypeDef), },
+		/* FieldLayout */				{ U32, Idx(Field), },
+		/* StandAloneSig */				{ Blb, },
+		/* EventMap */					{ Idx(TypeDef), Idx(Event), },
+		/* EventPtr */					{ Idx(Event), },
+		/* Event */						{ U16, Str, Cod(TypeDefOrRef), },
+		/* PropertyMap */				{ Idx(TypeDef), Idx(Property), },
+		/* PropertyPtr */				{ Idx(Property), },
+		/* Property */					{ U16, Str, Blb, },
+		/* MethodSemantics */			{ U16, Idx(MethodDef), Cod(HasSemantics), },
+		/* MethodImpl */				{ Idx(TypeDef), Cod(MethodDefOrRef), Cod(MethodDefOrRef), },
+		/* ModuleRef */					{ Str, },
+		/* TypeSpec */					{ Blb, },
+		/* ImplMap */					{ U16, Cod(MemberForwarded), Str, Idx(ModuleRef), },
+		/* FieldRVA */					{ U32, Idx(Field), },
+		/* EncLog */					{ U32, U32, },
+		/* EncMap */					{ U32, },
+		/* Assembly */					{ U32, U16, U16, U16, U16, U32, Blb, Str, Str, },
+		/* AssemblyProcessor */			{ U32, },
+		/* AssemblyOS */				{ U32, U32, U32, },
+		/* AssemblyRef */				{ U16, U16, U16, U16, U32, Blb, Str, Str, Blb, },
+		/* AssemblyRefProcessor */		{ U32, Idx(AssemblyRef), },
+		/* AssemblyRefOS */				{ U32, U32, U32, Idx(AssemblyRef), },
+		/* File */						{ U32, Str, Blb, },
+		/* ExportedType */				{ U32, U32, Str, Str, Cod(Implementation), },
+		/* ManifestResource */			{ U32, U32, Str, Cod(Implementation), },
+		/* NestedClass */				{ Idx(TypeDef), Idx(TypeDef), },
+		/* GenericParam */				{ U16, U16, Cod(TypeOrMethodDef), Str, },
+		/* MethodSpec */				{ Cod(MethodDefOrRef), Blb, },
+		/* GenericParamConstraint */	{ Idx(GenericParam), Cod(TypeDefOrRef), },
+	};
+
+	// Column indices of the tables we actually read.
+	namespace Col
+	{
+		enum { TypeRef_ResolutionScope = 0, TypeRef_Name, TypeRef_Namespace, };
+		enum { TypeDef_Flags = 0, TypeDef_Name, TypeDef_Namespace, TypeDef_Extends, TypeDef_FieldList, TypeDef_MethodList, };
+		enum { Field_Flags = 0, Field_Name, Field_Signature, };
+		enum { MemberRef_Class = 0, };
+		enum { CustomAttribute_Parent = 0, CustomAttribute_Type, };
+		enum { NestedClass_Nested = 0, NestedClass_Enclosing, };
+		enum { GenericParam_Owner = 2, };
+		enum { TypeSpec_Signature = 0, };
+		enum { Ptr_Target = 0, };	// FieldPtr and MethodPtr
+	}
+
+	template <typename T>
+	[[nodiscard]]
+	static T Peek(span<std::byte const> Data, size_t iOffset) noexcept
+	{
+		T ret{};
+
+		if (iOffset <= Data.size() && sizeof(T) <= Data.size() - iOffset)
+			std::memcpy(&ret, Data.data() + iOffset, sizeof(T));
+
+		return ret;
+	}
+
+	// II.23.2 Blobs and signatures. Consumes the value from the front of Data.
+	[[nodiscard]]
+	static bool ReadCompressed(span<std::byte const>* pData, uint32_t* pret) noexcept
+	{
+		auto& Data = *pData;
+
+		if (Data.empty())
+			return false;
+
+		if (auto const b0 = std::to_integer<uint32_t>(Data[0]); (b0 & 0x80) == 0)
+		{
+			*pret = b0;
+			Data = Data.subspan(1);
+		}
+		else if ((b0 & 0xC0) == 0x80 && Data.size() >= 2)
+		{
+			*pret = (b0 & 0x3F) << 8 | std::to_integer<uint32_t>(Data[1]);
+			Data = Data.subspan(2);
+		}
+		else if ((b0 & 0xE0) == 0xC0 && Data.size() >= 4)
+		{
+			*pret = (b0 & 0x1F) << 24 | std::to_integer<uint32_t>(Data[1]) << 16 | std::to_integer<uint32_t>(Data[2]) << 8 | std::to_integer<uint32_t>(Data[3]);
+			Data = Data.subspan(4);
+		}
+		else
+			return false;
+
+		return true;
+	}
+
+	struct type_sig_t final
+	{
+		uint8_t m_iElementType{};
+		uint32_t m_iTypeDefOrRef{};	// Encoded token. Valid for CLASS and VALUETYPE, or the generic definition of GENERICINST.
+		uint8_t m_iArgElementType{};	// The first argument of GENERICINST.
+		uint32_t m_iArgTypeDefOrRef{};
+	};
+
+	[[nodiscard]]
+	static bool ReadType(span<std::byte const>* pData, uint8_t* piElementType, uint32_t* piTypeDefOrRef) noexcept
+	{
+		auto& Data = *pData;
+		uint32_t iDiscard{};
+
+		while (!Data.empty() && (Data[0] == std::byte{ ELEMENT_TYPE_CMOD_OPT } || Data[0] == std::byte{ ELEMENT_TYPE_CMOD_REQD }))
+		{
+			Data = Data.subspan(1);
+			if (!ReadCompressed(&Data, &iDiscard))
+				return false;
+		}
+
+		if (Data.empty())
+			return false;
+
+		*piElementType = std::to_integer<uint8_t>(Data[0]);
+		Data = Data.subspan(1);
+
+		switch (*piElementType)
+		{
+		case ELEMENT_TYPE_CLASS:
+		case ELEMENT_TYPE_VALUETYPE:
+			return ReadCompressed(&Data, piTypeDefOrRef);
+
+		case ELEMENT_TYPE_GENERICINST:
+			return Data.size() > 1 && (Data = Data.subspan(1), ReadCompressed(&Data, piTypeDefOrRef));
+
+		default:
+			return true;
+		}
+	}
+
+	// Only the shape of the type is needed, everything after the first generic argument is ignored.
+	[[nodiscard]]
+	static bool ParseTypeSig(span<std::byte const> Data, type_sig_t* pret) noexcept
+	{
+		if (!ReadType(&Data, &pret->m_iElementType, &pret->m_iTypeDefOrRef))
+			return false;
+
+		if (uint32_t iArgCount{}; pret->m_iElementType == ELEMENT_TYPE_GENERICINST)
+			return ReadCompressed(&Data, &iArgCount) && iArgCount > 0 && ReadType(&Data, &pret->m_iArgElementType, &pret->m_iArgTypeDefOrRef);
+
+		return true;
+	}
+
+	class module_t final
+	{
+	public:
+		explicit module_t(fs::path const& hPath) noexcept;
+
+		[[nodiscard]] explicit operator bool() const noexcept { return m_bValid; }
+
+		[[nodiscard]] uint32_t Rows(ETable t) const noexcept { return m_Tables[t].m_iRows; }
+		[[nodiscard]] uint32_t Get(ETable t, uint32_t iRow, size_t iColumn) const noexcept;	// 1-based row as tokens are.
+		[[nodiscard]] std::pair<ETable, uint32_t> Decode(ECoded c, uint32_t iValue) const noexcept;
+		[[nodiscard]] string_view String(uint32_t iOffset) const noexcept;
+		[[nodiscard]] span<std::byte const> Blob(uint32_t iOffset) const noexcept;
+
+		// Resolves the indirection of the uncompressed '#-' stream.
+		[[nodiscard]] uint32_t Deref(ETable tPtr, uint32_t iIndex) const noexcept { return Rows(tPtr) ? Get(tPtr, iIndex, Col::Ptr_Target) : iIndex; }
+
+	private:
+		struct table_t final
+		{
+			std::byte const* m_pBase{};
+			uint32_t m_iRows{};
+			uint32_t m_iRowSize{};
+			std::array<uint8_t, MAX_COLUMNS> m_Offsets{};
+			std::array<uint8_t, MAX_COLUMNS> m_Sizes{};
+		};
+
+		mapped_file_t m_File{};
+		span<std::byte const> m_Strings{};
+		span<std::byte const> m_Blob{};
+		std::array<table_t, TABLE_COUNT + 1> m_Tables{};	// The extra one is always empty.
+		bool m_bValid{};
+	};
+
+	module_t::module_t(fs::path const& hPath) noexcept
+		: m_File{ hPath }
+	{
+		auto const Image = m_File.Data();
+
+		// II.25 File format extensions to PE
+		if (Peek<uint16_t>(Image, 0) != 0x5A4D)	// MZ
+			return;
+
+		auto const iPE = Peek<uint32_t>(Image, 0x3C);
+		if (Peek<uint32_t>(Image, iPE) != 0x00004550)	// PE\0\0
+			return;
+
+		auto const iSectionCount = Peek<uint16_t>(Image, iPE + 6);
+		auto const iOptionalHeader = size_t{ iPE } + 24;
+		auto const iSectionHeaders = iOptionalHeader + Peek<uint16_t>(Image, iPE + 20);
+		auto const bPE32Plus = Peek<uint16_t>(Image, iOptionalHeader) == 0x20B;
+		auto const iDirectoryCount = Peek<uint32_t>(Image, iOptionalHeader + (bPE32Plus ? 108 : 92));
+		auto const iDirectories = iOptionalHeader + (bPE32Plus ? 112 : 96);
+
+		if (iDirectoryCount <= 14)	// No CLI header, i.e. a native DLL.
+			return;
+
+		auto const fnRvaToOffset = [&](uint32_t iRva) noexcept -> size_t
+		{
+			for (size_t i = 0; i < iSectionCount; ++i)
+			{
+				auto const iSection = iSectionHeaders + i * 40;
+				auto const iVirtualSize = Peek<uint32_t>(Image, iSection + 8);
+				auto const iVirtualAddress = Peek<uint32_t>(Image, iSection + 12);
+				auto const iRawSize = Peek<uint32_t>(Image, iSection + 16);
+				auto const iRawPointer = Peek<uint32_t>(Image, iSection + 20);
+
+				if (iRva >= iVirtualAddress && iRva - iVirtualAddress < std::max(iVirtualSize, iRawSize))
+					return size_t{ iRva } - iVirtualAddress + iRawPointer;
+			}
+
+			return SIZE_MAX;
+		};
+
+		auto const iCliHeaderRva = Peek<uint32_t>(Image, iDirectories + 14 * 8);
+		if (iCliHeaderRva == 0)
+			return;
+
+		auto const iCliHeader = fnRvaToOffset(iCliHeaderRva);
+		auto const iMetadata = fnRvaToOffset(Peek<uint32_t>(Image, iCliHeader + 8));
+		auto const iMetadataSize = Peek<uint32_t>(Image, iCliHeader + 12);
+
+		if (iMetadata >= Image.size() || iMetadataSize > Image.size() - iMetadata)
+			return;
+
+		// II.24.2.1 Metadata root
+		auto const Root = Image.subspan(iMetadata, iMetadataSize);
+		if (Peek<uint32_t>(Root, 0) != 0x424A5342)	// BSJB
+			return;
+
+		auto iCursor = size_t{ 16 } + ((Peek<uint32_t>(Root, 12) + 3) & ~3u);
+		auto const iStreamCount = Peek<uint16_t>(Root, iCursor + 2);
+		iCursor += 4;
+
+		span<std::byte const> Tables{};
+
+		for (uint16_t i = 0; i < iStreamCount && iCursor + 8 < Root.size(); ++i)
+		{
+			auto const iOffset = Peek<uint32_t>(Root, iCursor);
+			auto const iSize = Peek<uint32_t>(Root, iCursor + 4);
+			auto const szName = string_view{ reinterpret_cast<char const*>(Root.data() + iCursor + 8), strnlen(reinterpret_cast<char const*>(Root.data() + iCursor + 8), Root.size() - iCursor - 8) };
+			iCursor += 8 + ((szName.length() + 4) & ~size_t{ 3 });
+
+			if (iOffset > Root.size() || iSize > Root.size() - iOffset)
+				return;
+
+			auto const Stream = Root.subspan(iOffset, iSize);
+
+			if (szName == "#~" || szName == "#-")
+				Tables = Stream;
+			else if (szName == "#Strings")
+				m_Strings = Stream;
+			else if (szName == "#Blob")
+				m_Blob = Stream;
+		}
+
+		// II.24.2.6 #~ stream
+		auto const iHeapSizes = std::to_integer<uint8_t>(Peek<std::byte>(Tables, 6));
+		auto const iValid = Peek<uint64_t>(Tables, 8);
+		auto const iStringIndexSize = uint8_t(iHeapSizes & 0x01 ? 4 : 2);
+		auto const iGuidIndexSize = uint8_t(iHeapSizes & 0x02 ? 4 : 2);
+		auto const iBlobIndexSize = uint8_t(iHeapSizes & 0x04 ? 4 : 2);
+
+		if (Tables.size() < 24 || (iValid >> TABLE_COUNT) != 0)	// Tables in portable PDB are never seen in assemblies.
+			return;
+
+		iCursor = 24;
+		for (uint8_t t = 0; t < TABLE_COUNT; ++t)
+		{
+			if (iValid & (uint64_t{ 1 } << t))
+			{
+				m_Tables[t].m_iRows = Peek<uint32_t>(Tables, iCursor);
+				iCursor += 4;
+			}
+		}
+
+		if (iHeapSizes & 0x40)	// Extra data after the row counts, only in EnC images.
+			iCursor += 4;
+
+		auto const fnColumnSize = [&](column_t col) noexcept -> uint8_t
+		{
+			switch (col.m_Kind)
+			{
+			case EColumn::U16:
+				return 2;
+			case EColumn::U32:
+				return 4;
+			case EColumn::String:
+				return iStringIndexSize;
+			case EColumn::Guid:
+				return iGuidIndexSize;
+			case EColumn::Blob:
+				return iBlobIndexSize;
+			case EColumn::Index:
+				return m_Tables[col.m_iTarget].m_iRows < (1u << 16) ? 2 : 4;
+			case EColumn::Coded:
+			{
+				auto const& Coded = CODED_INDICES[col.m_iTarget];
+				auto const iMaxRows = std::ranges::max(span{ Coded.m_Tables, Coded.m_iCount } | std::views::transform([&](ETable t) noexcept { return m_Tables[t].m_iRows; }));
+
+				return iMaxRows < (1u << (16 - Coded.m_iTagBits)) ? 2 : 4;
+			}
+			default:
+				return 0;
+			}
+		};
+
+		for (uint8_t t = 0; t < TABLE_COUNT; ++t)
+		{
+			auto& Table = m_Tables[t];
+
+			for (size_t c = 0; c < MAX_COLUMNS; ++c)
+			{
+				Table.m_Offsets[c] = static_cast<uint8_t>(Table.m_iRowSize);
+				Table.m_Sizes[c] = fnColumnSize(LAYOUTS[t][c]);
+				Table.m_iRowSize += Table.m_Sizes[c];
+			}
+
+			if (iCursor > Tables.size() || uint64_t{ Table.m_iRows } * Table.m_iRowSize > Tables.size() - iCursor)
+				return;
+
+			Table.m_pBase = Tables.data() + iCursor;
+			iCursor += size_t{ Table.m_iRows } * Table.m_iRowSize;
+		}
+
+		m_bValid = true;
+	}
+
+	uint32_t module_t::Get(ETable t, uint32_t iRow, size_t iColumn) const noexcept
+	{
+		auto const& Table = m_Tables[t];
+
+		if (iRow == 0 || iRow > Table.m_iRows) [[unlikely]]
+			return 0;
+
+		auto const p = Table.m_pBase + size_t{ iRow - 1 } * Table.m_iRowSize + Table.m_Offsets[iColumn];
+
+		if (Table.m_Sizes[iColumn] == 2)
+		{
+			uint16_t ret{};
+			std::memcpy(&ret, p, sizeof(ret));
+			return ret;
+		}
+		else
+		{
+			uint32_t ret{};
+			std::memcpy(&ret, p, sizeof(ret));
+			return ret;
+		}
+	}
+
+	std::pair<ETable, uint32_t> module_t::Decode(ECoded c, uint32_t iValue) const noexcept
+	{
+		auto const& Coded = CODED_INDICES[c];
+		auto const iTag = iValue & ((1u << Coded.m_iTagBits) - 1);
+
+		return { iTag < Coded.m_iCount ? Coded.m_Tables[iTag] : TABLE_COUNT, iValue >> Coded.m_iTagBits };
+	}
+
+	string_view module_t::String(uint32_t iOffset) const noexcept
+	{
+		if (iOffset >= m_Strings.size())
+			return {};
+
+		string_view const ret{ reinterpret_cast<char const*>(m_Strings.data()) + iOffset, m_Strings.size() - iOffset };
+		return ret.substr(0, ret.find('\0'));
+	}
+
+	span<std::byte const> module_t::Blob(uint32_t iOffset) const noexcept
+	{
+		if (iOffset >= m_Blob.size())
+			return {};
+
+		auto Data = m_Blob.subspan(iOffset);
+
+		if (uint32_t iLength{}; ReadCompressed(&Data, &iLength) && iLength <= Data.size())
+			return Data.first(iLength);
+
+		return {};
+	}
+}
+
+using namespace Metadata;
+
+struct assembly_t final
+{
+	explicit assembly_t(fs::path const& hPath) noexcept;
+
+	fs::path m_Path;
+	module_t m_Module;
+	vector<string> m_FullNames{};	// Indexed by TypeDef row. Nested ones are "Outer+Inner", same as System.Type::FullName.
+	vector<string_view> m_Namespaces{};	// Indexed by TypeDef row. Nested ones take the namespace of the outermost type.
+	vector<bool> m_IsGeneric{};	// Indexed by TypeDef row.
+	vector<bool> m_MustTranslate{};	// Indexed by Field row.
+};
+
+struct type_handle_t final
+{
+	assembly_t const* m_pAssembly{};
+	uint32_t m_iRow{};	// TypeDef
+};
+
+using type_index_t = std::unordered_map<string_view, type_handle_t>;
+
+[[nodiscard]]
+static string TypeRefFullName(module_t const& m, uint32_t iRow) noexcept
+{
+	string ret{};
+
+	// Walk outward from the innermost nested type.
+	for (uint32_t iDepth = 0; iRow != 0 && iDepth < 64; ++iDepth)
+	{
+		auto const szName = m.String(m.Get(TypeRef, iRow, Col::TypeRef_Name));
+		auto const [tScope, iScope] = m.Decode(ResolutionScope, m.Get(TypeRef, iRow, Col::TypeRef_ResolutionScope));
+
+		ret.insert(0, szName);
+
+		if (tScope != TypeRef)
+		{
+			if (auto const szNamespace = m.String(m.Get(TypeRef, iRow, Col::TypeRef_Namespace)); !szNamespace.empty())
+				ret.insert(0, string{ szNamespace } + '.');
+
+			break;
+		}
+
+		ret.insert(0, 1, '+');
+		iRow = iScope;
+	}
+
+	return ret;
+}
+
+[[nodiscard]]
+static string TypeFullName(assembly_t const& asmb, ETable t, uint32_t iRow) noexcept
+{
+	switch (t)
+	{
+	case TypeDef:
+		return iRow < asmb.m_FullNames.size() ? asmb.m_FullNames[iRow] : string{};
+
+	case TypeRef:
+		return TypeRefFullName(asmb.m_Module, iRow);
+
+	case TypeSpec:
+	{
+		// Not as System.Type::FullName, which appends assembly qualified arguments. Naming the generic definition is enough for our purpose.
+		if (type_sig_t sig{}; ParseTypeSig(asmb.m_Module.Blob(asmb.m_Module.Get(TypeSpec, iRow, Col::TypeSpec_Signature)), &sig)
+			&& sig.m_iElementType == ELEMENT_TYPE_GENERICINST)
+		{
+			auto const [tDef, iDef] = asmb.m_Module.Decode(TypeDefOrRef, sig.m_iTypeDefOrRef);
+			return tDef != TypeSpec ? TypeFullName(asmb, tDef, iDef) : string{};
+		}
+
+		return {};
+	}
+
+	default:
+		return {};
+	}
+}
+
+[[nodiscard]]
+static string_view TypeShortName(module_t const& m, ETable t, uint32_t iRow) noexcept
+{
+	switch (t)
+	{
+	case TypeDef:
+		return m.String(m.Get(TypeDef, iRow, Col::TypeDef_Name));
+	case TypeRef:
+		return m.String(m.Get(TypeRef, iRow, Col::TypeRef_Name));
+	default:
+		return {};
+	}
+}
+
+[[nodiscard]]
+static uint32_t MethodOwner(module_t const& m, uint32_t iMethod) noexcept
+{
+	// Method lists of TypeDef are given as positions in MethodPtr, if there is one.
+	if (auto const iPtrCount = m.Rows(MethodPtr); iPtrCount > 0)
+	{
+		for (uint32_t i = 1; i <= iPtrCount; ++i)
+		{
+			if (m.Get(MethodPtr, i, Col::Ptr_Target) == iMethod)
+			{
+				iMethod = i;
+				break;
+			}
+		}
+	}
+
+	// The last one starts before it. Those with an empty list share the start of their successor.
+	auto const Rows = std::views::iota(1u, m.Rows(TypeDef) + 1);
+	auto const it = std::ranges::upper_bound(Rows, iMethod, {}, [&](uint32_t iRow) noexcept { return m.Get(TypeDef, iRow, Col::TypeDef_MethodList); });
+
+	return it == Rows.begin() ? 0 : *std::ranges::prev(it);
+}
+
+[[nodiscard]]
+static std::pair<uint32_t, uint32_t> FieldRange(module_t const& m, uint32_t iTypeDef) noexcept
+{
+	auto const iEnd = (m.Rows(FieldPtr) ? m.Rows(FieldPtr) : m.Rows(Field)) + 1;
+	auto const iFirst = m.Get(TypeDef, iTypeDef, Col::TypeDef_FieldList);
+	auto const iLast = iTypeDef < m.Rows(TypeDef) ? m.Get(TypeDef, iTypeDef + 1, Col::TypeDef_FieldList) : iEnd;
+
+	return { std::min(iFirst, iEnd), std::clamp(iLast, std::min(iFirst, iEnd), iEnd) };
+}
+
+assembly_t::assembly_t(fs::path const& hPath) noexcept
+	: m_Path{ hPath }, m_Module{ hPath }
+{
+	RWPHG_TRACE_SCOPE_ARG("LoadAssembly", hPath);
+
+	if (!m_Module)
+		return;
+
+	auto const& m = m_Module;
+	auto const iTypeCount = m.Rows(TypeDef);
+
+	vector<uint32_t> Enclosing(iTypeCount + 1, 0);
+	for (uint32_t i = 1; i <= m.Rows(NestedClass); ++i)
+	{
+		if (auto const iNested = m.Get(NestedClass, i, Col::NestedClass_Nested); iNested <= iTypeCount)
+			Enclosing[iNested] = m.Get(NestedClass, i, Col::NestedClass_Enclosing);
+	}
+
+	m_FullNames.resize(iTypeCount + 1);
+	m_Namespaces.resize(iTypeCount + 1);
+
+	for (uint32_t i = 1; i <= iTypeCount; ++i)
+	{
+		auto& szFullName = m_FullNames[i];
+		auto iOuter = i;
+
+		szFullName = m.String(m.Get(TypeDef, i, Col::TypeDef_Name));
+
+		for (uint32_t iDepth = 0; Enclosing[iOuter] != 0 && Enclosing[iOuter] <= iTypeCount && iDepth < 64; ++iDepth)
+		{
+			iOuter = Enclosing[iOuter];
+			szFullName.insert(0, string{ m.String(m.Get(TypeDef, iOuter, Col::TypeDef_Name)) } + '+');
+		}
+
+		m_Namespaces[i] = m.String(m.Get(TypeDef, iOuter, Col::TypeDef_Namespace));
+
+		if (!m_Namespaces[i].empty())
+			szFullName.insert(0, string{ m_Namespaces[i] } + '.');
+	}
+
+	// Nested types of a generic type own copies of the outer generic parameters, just as System.Type::IsGenericType reports.
+	m_IsGeneric.resize(iTypeCount + 1);
+	for (uint32_t i = 1; i <= m.Rows(GenericParam); ++i)
+	{
+		if (auto const [t, iRow] = m.Decode(TypeOrMethodDef, m.Get(GenericParam, i, Col::GenericParam_Owner)); t == TypeDef && iRow <= iTypeCount)
+			m_IsGeneric[iRow] = true;
+	}
+
+	m_MustTranslate.resize(m.Rows(Field) + 1);
+	for (uint32_t i = 1; i <= m.Rows(CustomAttribute); ++i)
+	{
+		auto const [tParent, iParent] = m.Decode(HasCustomAttribute, m.Get(CustomAttribute, i, Col::CustomAttribute_Parent));
+		if (tParent != Field || iParent >= m_MustTranslate.size())
+			continue;
+
+		string szAttribute{};
+
+		switch (auto const [tCtor, iCtor] = m.Decode(CustomAttributeType, m.Get(CustomAttribute, i, Col::CustomAttribute_Type)); tCtor)
+		{
+		case MemberRef:
+		{
+			auto const [tClass, iClass] = m.Decode(MemberRefParent, m.Get(MemberRef, iCtor, Col::MemberRef_Class));
+			szAttribute = TypeFullName(*this, tClass, iClass);
+			break;
+		}
+
+		case MethodDef:
+			szAttribute = TypeFullName(*this, TypeDef, MethodOwner(m, iCtor));
+			break;
+
+		default:
+			break;
+		}
+
+		if (szAttribute.contains("MustTranslate"))
+			m_MustTranslate[iParent] = true;
+	}
+}
+
+struct base_class_t final
+{
+	string m_szFullName{};
+	type_handle_t m_Mod{};	// Where to continue climbing.
+	class_schema_t const* m_pVanilla{};	// Where the climbing ends. Vanilla schema has the whole hierarchy flattened already.
+};
+
+[[nodiscard]]
+static base_class_t BaseClassOf(type_handle_t const& hType, type_index_t const& Index) noexcept
+{
+	auto const& asmb = *hType.m_pAssembly;
+	auto const& m = asmb.m_Module;
+	auto [t, iRow] = m.Decode(TypeDefOrRef, m.Get(TypeDef, hType.m_iRow, Col::TypeDef_Extends));
+
+	if (iRow == 0)
+		return {};
+
+	// Generic base classes are climbed through their generic definition.
+	if (type_sig_t sig{}; t == TypeSpec
+		&& ParseTypeSig(m.Blob(m.Get(TypeSpec, iRow, Col::TypeSpec_Signature)), &sig)
+		&& sig.m_iElementType == ELEMENT_TYPE_GENERICINST)
+	{
+		std::tie(t, iRow) = m.Decode(TypeDefOrRef, sig.m_iTypeDefOrRef);
+	}
+
+	base_class_t ret{ .m_szFullName{ TypeFullName(asmb, t, iRow) } };
+
+	if (t == TypeDef)
+		ret.m_Mod = { &asmb, iRow };
+	else if (auto const it = Index.find(ret.m_szFullName); it != Index.end())
+		ret.m_Mod = it->second;
+	else
+		ret.m_pVanilla = gRimWorldClasses.find(ret.m_szFullName);
+
+	return ret;
+}
+
+struct candidate_t final
+{
+	string_view m_szReflected{};
+	string_view m_szField{};
+	string m_szType{};
+};
+
+static void ParseTypes(assembly_t const& dll, type_index_t const& Index, classinfo_dict_t* pret) noexcept
+{
+	auto const& m = dll.m_Module;
+
+	vector<candidate_t> ArrayCandidates{};
+	vector<candidate_t> ObjectCandidates{};
+
+	for (uint32_t iType = 1; iType <= m.Rows(TypeDef); ++iType)
+	{
+		if (dll.m_IsGeneric[iType])
+			continue;
+
+		auto const& szFullName = dll.m_FullNames[iType];
+		auto Base = BaseClassOf({ &dll, iType }, Index);
+
+		auto&& [iter, bNewEntry] = pret->try_emplace(
+			szFullName,
+			class_info_t{
+				.m_Namespace{ string{ dll.m_Namespaces[iType] } },
+				.m_Name{ string{ m.String(m.Get(TypeDef, iType, Col::TypeDef_Name)) } },
+				.m_Base{ Base.m_szFullName },
+			}
+		);
+
+		if (!bNewEntry)
+		{
+			Log::Print(ELogLevel::Warning, "Duplicated name of '{}'\n", szFullName);
+			continue;
+		}
+
+		auto& info = iter->second;
+
+		// Same as BindingFlags::Instance | BindingFlags::Public | BindingFlags::NonPublic: all of its own, but no private ones from the base classes.
+		// Prevent RulePack gets filtered. It has private [MustTranslate] fields like RulePack::rulesStrings. Seriously, why?
+		type_handle_t hCurrent{ &dll, iType };
+
+		for (uint32_t iDepth = 0; hCurrent.m_pAssembly != nullptr && iDepth < 64; ++iDepth)
+		{
+			auto const& Declaring = *hCurrent.m_pAssembly;
+			auto const& dm = Declaring.m_Module;
+			auto const [iFirst, iLast] = FieldRange(dm, hCurrent.m_iRow);
+
+			for (auto i = iFirst; i < iLast; ++i)
+			{
+				auto const iField = dm.Deref(FieldPtr, i);
+				auto const iFlags = dm.Get(Field, iField, Col::Field_Flags);
+
+				if ((iFlags & fdStatic) || (iDepth > 0 && (iFlags & fdFieldAccessMask) == fdPrivate))
+					continue;
+
+				auto const szField = dm.String(dm.Get(Field, iField, Col::Field_Name));
+
+				type_sig_t sig{};
+				if (auto Signature = dm.Blob(dm.Get(Field, iField, Col::Field_Signature));
+					Signature.empty() || Signature[0] != std::byte{ FIELD } || !ParseTypeSig(Signature.subspan(1), &sig))
+				{
+					Log::Print(ELogLevel::Warning, "Members of type '{}' cannot be parse!\n", szFullName);
+					continue;
+				}
+
+				if (iField < Declaring.m_MustTranslate.size() && Declaring.m_MustTranslate[iField])
+				{
+					if (sig.m_iElementType == ELEMENT_TYPE_GENERICINST || sig.m_iElementType == ELEMENT_TYPE_SZARRAY || sig.m_iElementType == ELEMENT_TYPE_ARRAY)
+						info.m_ArraysMustTranslate.emplace(szField);
+					else
+						info.m_MustTranslates.emplace(szField);
+				}
+				else if (sig.m_iElementType == ELEMENT_TYPE_GENERICINST)
+				{
+					auto const [tDef, iDef] = dm.Decode(TypeDefOrRef, sig.m_iTypeDefOrRef);
+
+					// Elements other than plain classes could never be found in either dictionary.
+					if (TypeShortName(dm, tDef, iDef) == "List`1"
+						&& (sig.m_iArgElementType == ELEMENT_TYPE_CLASS || sig.m_iArgElementType == ELEMENT_TYPE_VALUETYPE))
+					{
+						auto const [tArg, iArg] = dm.Decode(TypeDefOrRef, sig.m_iArgTypeDefOrRef);
+						ArrayCandidates.emplace_back(szFullName, szField, TypeFullName(Declaring, tArg, iArg));
+					}
+				}
+				else if (sig.m_iElementType == ELEMENT_TYPE_CLASS || sig.m_iElementType == ELEMENT_TYPE_VALUETYPE)
+				{
+					// System.Reflection.Assembly::GetType() only looks for types defined in the very assembly.
+					if (auto const [tType, iTypeRow] = dm.Decode(TypeDefOrRef, sig.m_iTypeDefOrRef); tType == TypeDef && &Declaring == &dll)
+						ObjectCandidates.emplace_back(szFullName, szField, dll.m_FullNames[iTypeRow]);
+				}
+			}
+
+			// The objects of vanilla are never defined in our assembly, hence only arrays are inherited.
+			if (Base.m_pVanilla != nullptr)
+			{
+				info.m_MustTranslates.insert_range(Base.m_pVanilla->m_MustTranslates);
+				info.m_ArraysMustTranslate.insert_range(Base.m_pVanilla->m_ArraysMustTranslate);
+
+				for (auto&& [szField, szType] : Base.m_pVanilla->m_ObjectArrays)
+					ArrayCandidates.emplace_back(szFullName, szField, string{ szType });
+			}
+
+			if (hCurrent = Base.m_Mod; hCurrent.m_pAssembly != nullptr)
+				Base = BaseClassOf(hCurrent, Index);
+		}
+
+		// Although in C# it make sense that everything derived from object.
+		if (info.m_Base == "System.Object")
+			info.m_Base.clear();
+
+		// It's a class without any translation entry. #POTENTIAL_BUG could cause objects with only translatable object be removed.
+		if (info.m_MustTranslates.size() == 0 && info.m_ArraysMustTranslate.size() == 0)
+			pret->erase(iter);
+	}
+
+	for (auto&& [Candidates, pDest] : {
+		std::pair{ &ArrayCandidates, &class_info_t::m_ObjectArrays },
+		std::pair{ &ObjectCandidates, &class_info_t::m_Objects },
+		})
+	{
+		for (auto&& [szReflected, szField, szType] : *Candidates)
+		{
+			// Make sure both elem and refl are either in the return list or in base game.
+			if (!pret->contains(szType) && !gRimWorldClasses.contains(szType))
+				continue;
+
+			if (auto const it = pret->find(szReflected); it != pret->end())
+				(it->second.*pDest).try_emplace(string{ szField }, std::move(szType));
+		}
+	}
+}
+
+void GetModClasses(fs::path const& ModDir, classinfo_dict_t* pret) noexcept
+{
+	RWPHG_TRACE_SCOPE("GetModClasses");
+	std::error_code ec{};
+
+	if (!fs::exists(ModDir / L"Assemblies", ec))
+		return;
+
+	std::deque<assembly_t> Assemblies{};	// Names in the index are referring to them.
+
+	for (auto&& dll :
+		fs::recursive_directory_iterator(ModDir, ec)	// perhaps all modules rather than stuff in "Assemblies/"?
+		| std::views::transform(&fs::directory_entry::path)
+		| std::views::filter([](fs::path const& pth) noexcept { return pth.has_extension() && pth.extension() == ".dll"; })
+		)
+	{
+		if (!Assemblies.emplace_back(dll).m_Module)
+		{
+			Log::Print(ELogLevel::Info, Style::Skipping, "Not a .NET assembly: {0}\n", dll.u8string());
+			Assemblies.pop_back();
+		}
+	}
+
+	Log::Print(
+		ELogLevel::Info, Style::Skipping, "{0} assembl{2} loaded from '{1}'\n",
+		Assemblies.size(), ModDir.u8string(), Assemblies.size() < 2 ? "y" : "ies"
+	);
+
+	// Base classes could come from any assembly of this mod, as long as CLR could resolve it.
+	type_index_t Index{};
+	for (auto&& asmb : Assemblies)
+	{
+		for (uint32_t i = 1; i < asmb.m_FullNames.size(); ++i)
+			Index.try_emplace(asmb.m_FullNames[i], type_handle_t{ &asmb, i });
+	}
+
+	for (auto&& asmb : Assemblies)
+	{
+		RWPHG_TRACE_SCOPE_ARG("ParseTypes", asmb.m_Path);
+		ParseTypes(asmb, Index, pret);
+	}
+
+	Log::Print(
+		ELogLevel::Info, Style::Positive,
+		"{0} types loaded from mod.\n", pret->size()
+	);
+	Log::Print(ELogLevel::Info, "\n");
+}
@@ -1,8 +1,16 @@
 ﻿#include "Precompiled.hpp"
+#include "BinaryStream.hpp"
+#include "CRCRecords.hpp"
+#include "FileWriter.hpp"
+#include "Log.hpp"
+#include "MappedFile.hpp"
 #include "Mod.hpp"
+#include "Stats.hpp"
+#include "Trace.hpp"
 
 import Application;
 import CRC64;
+import EditDistance;
 import HashExtension;
 import Style;
 
@@ -20,10 +28,10 @@ using std::span;
 using std::string;
 using std::string_view;
 using std::vector;
+using std::wstring;
 using std::wstring_view;
 
 using cppcoro::generator;
-using cppcoro::recursive_generator;
 
 enum struct EDecision
 {
@@ -34,11 +42,13 @@ enum struct EDecision
 	Created,
 };
 
+// An entry read back from a localization file. The source texts are kept column by column instead, see source_texts_t.
 struct translation_t final
 {
 	fs::path m_TargetFile{};
 	string m_Identifier{};
 	string m_Text{};
+	uint32_t m_iFile{ UINT32_MAX };	// Id of m_TargetFile in gFiles, if any source text is meant for it.
 
 	[[nodiscard]]
 	inline wstring_view GetCSharpClass() const& noexcept	// we are returning a view. It must be called from a lvalue.
@@ -62,15 +72,272 @@ struct translation_t final
 	}
 };
 
-struct tr_view_t final
+// Every target file met is interned once, entries refer to it with a 32-bit id rather than each owning a path.
+// Paths never move once in, hence views of them stay valid. The table starts over with each mod, so that -batch and -serve do not keep every file they ever met.
+struct file_table_t final
+{
+	[[nodiscard]]
+	uint32_t Intern(fs::path const& hPath) noexcept	// Safe to call from the extraction workers.
+	{
+		if (auto const iFile = Find(hPath.native()); iFile)
+			return *iFile;
+
+		std::unique_lock Lock{ m_Lock };
+
+		if (auto const it = m_Ids.find(hPath.native()); it != m_Ids.end())	// Interned by another worker in the meantime.
+			return it->second;
+
+		auto const iFile = static_cast<uint32_t>(m_Paths.size());
+		m_Ids.try_emplace(m_Paths.emplace_back(hPath).native(), iFile);
+
+		return iFile;
+	}
+
+	[[nodiscard]]
+	optional<uint32_t> Find(wstring_view wcsPath) const noexcept
+	{
+		std::shared_lock Lock{ m_Lock };
+
+		if (auto const it = m_Ids.find(wcsPath); it != m_Ids.end())
+			return it->second;
+
+		return std::nullopt;
+	}
+
+	[[nodiscard]]
+	fs::path const& operator[](uint32_t iFile) const noexcept
+	{
+		std::shared_lock Lock{ m_Lock };
+		return m_Paths[iFile];
+	}
+
+	[[nodiscard]]
+	size_t size() const noexcept
+	{
+		std::shared_lock Lock{ m_Lock };
+		return m_Paths.size();
+	}
+
+	[[nodiscard]]
+	vector<fs::path> Paths() const noexcept	// Indexed by id.
+	{
+		std::shared_lock Lock{ m_Lock };
+		return m_Paths | std::ranges::to<vector>();
+	}
+
+	// Every id given so far is void afterwards. Whoever keeps any of them compares the generation to tell.
+	void clear() noexcept
+	{
+		std::unique_lock Lock{ m_Lock };
+		m_Ids.clear();
+		m_Paths.clear();
+		m_Ranks.clear();
+		++m_iGeneration;
+	}
+
+	// Ranks every id by its path, once the extraction is over and before any sorted view is built. Adding ids later keeps the order of those before.
+	void Rank() noexcept
+	{
+		std::shared_lock Lock{ m_Lock };
+
+		auto ByPath = std::views::iota(uint32_t{}, static_cast<uint32_t>(m_Paths.size())) | std::ranges::to<vector>();
+		std::ranges::sort(ByPath, {}, [this](uint32_t iFile) noexcept -> wstring_view { return m_Paths[iFile].native(); });
+
+		m_Ranks.resize(ByPath.size());
+		for (uint32_t i = 0; i < ByPath.size(); ++i)
+			m_Ranks[ByPath[i]] = i;
+	}
+
+	// No lock: ranks are only altered by Rank() and clear(), with no sorted view in use. Ids never ranked go last, by id.
+	[[nodiscard]]
+	size_t RankOf(uint32_t iFile) const noexcept
+	{
+		return iFile < m_Ranks.size() ? m_Ranks[iFile] : m_Ranks.size() + iFile;
+	}
+
+	[[nodiscard]]
+	uint32_t Generation() const noexcept
+	{
+		std::shared_lock Lock{ m_Lock };
+		return m_iGeneration;
+	}
+
+private:
+	std::deque<fs::path> m_Paths{};
+	std::unordered_map<wstring_view, uint32_t> m_Ids{};	// views into m_Paths
+	vector<uint32_t> m_Ranks{};	// by id
+	uint32_t m_iGeneration{};
+	mutable std::shared_mutex m_Lock{};
+};
+
+inline file_table_t gFiles;
+
+// Owns the bytes of the identifiers and texts extracted. Strings are packed one after another into blocks, each with its null terminator.
+// Blocks never move nor shrink, so the views handed out stay valid for as long as any arena holds the block, copies share the blocks they came with.
+// There is an arena per source file, hence the blocks start small and double up to a cap.
+struct string_arena_t final
+{
+	static constexpr size_t FIRST_BLOCK_SIZE = 4 * 1024;
+	static constexpr size_t MAX_BLOCK_SIZE = 256 * 1024;
+
+	string_arena_t() noexcept = default;
+	string_arena_t(string_arena_t const& rhs) noexcept : m_Blocks{ rhs.m_Blocks } {}	// The copy starts a block of its own, rather than writing after rhs.
+	string_arena_t(string_arena_t&& rhs) noexcept
+		: m_Blocks{ std::move(rhs.m_Blocks) }, m_pCursor{ std::exchange(rhs.m_pCursor, nullptr) }, m_iLeft{ std::exchange(rhs.m_iLeft, 0) }, m_iNextBlockSize{ std::exchange(rhs.m_iNextBlockSize, FIRST_BLOCK_SIZE) } {}
+
+	string_arena_t& operator=(string_arena_t const& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			clear();
+			m_Blocks = rhs.m_Blocks;
+		}
+
+		return *this;
+	}
+
+	string_arena_t& operator=(string_arena_t&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			m_Blocks = std::move(rhs.m_Blocks);
+			m_pCursor = std::exchange(rhs.m_pCursor, nullptr);
+			m_iLeft = std::exchange(rhs.m_iLeft, 0);
+			m_iNextBlockSize = std::exchange(rhs.m_iNextBlockSize, FIRST_BLOCK_SIZE);
+		}
+
+		return *this;
+	}
+
+	[[nodiscard]]
+	string_view Store(string_view sz) noexcept
+	{
+		if (sz.empty())
+			return ""sv;	// Still null-terminated.
+
+		auto const iBytes = sz.size() + 1;
+
+		// A string too long for a block gets one of its own, the current block goes on.
+		if (iBytes > MAX_BLOCK_SIZE)
+			return Copy(m_Blocks.emplace_back(std::make_shared_for_overwrite<char[]>(iBytes)).get(), sz);
+
+		if (iBytes > m_iLeft)
+		{
+			while (m_iNextBlockSize < iBytes)
+				m_iNextBlockSize *= 2;
+
+			m_pCursor = m_Blocks.emplace_back(std::make_shared_for_overwrite<char[]>(m_iNextBlockSize)).get();
+			m_iLeft = m_iNextBlockSize;
+			m_iNextBlockSize = std::min(m_iNextBlockSize * 2, MAX_BLOCK_SIZE);
+		}
+
+		auto const ret = Copy(m_pCursor, sz);
+		m_pCursor += iBytes;
+		m_iLeft -= iBytes;
+
+		return ret;
+	}
+
+	// Views into rhs stay valid through this one as well.
+	void Share(string_arena_t const& rhs) noexcept
+	{
+		m_Blocks.append_range(rhs.m_Blocks);
+	}
+
+	void Share(string_arena_t&& rhs) noexcept
+	{
+		m_Blocks.append_range(rhs.m_Blocks | std::views::as_rvalue);
+		rhs.clear();
+	}
+
+	void clear() noexcept
+	{
+		m_Blocks.clear();
+		m_pCursor = nullptr;
+		m_iLeft = 0;
+		m_iNextBlockSize = FIRST_BLOCK_SIZE;
+	}
+
+private:
+	[[nodiscard]]
+	static string_view Copy(char* p, string_view sz) noexcept
+	{
+		std::ranges::copy(sz, p);
+		p[sz.size()] = '\0';
+
+		return { p, sz.size() };
+	}
+
+	vector<std::shared_ptr<char[]>> m_Blocks{};
+	char* m_pCursor{};
+	size_t m_iLeft{};
+	size_t m_iNextBlockSize{ FIRST_BLOCK_SIZE };
+};
+
+// Source texts, column by column. Row i is the i-th entry in the order of extraction.
+// The file of an entry is its id in gFiles, and its strings are views into the arena, hence adding a row allocates nothing of its own.
+struct source_texts_t final
 {
-	tr_view_t() noexcept = default;
-	tr_view_t(auto&& TargetFile, auto&& Identifier) noexcept
-		: m_TargetFile{ std::forward<decltype(TargetFile)>(TargetFile) }, m_Identifier{ std::forward<decltype(Identifier)>(Identifier) } {}
-	tr_view_t(translation_t const& t) noexcept
-		: tr_view_t(t.m_TargetFile.native(), t.m_Identifier) {}
+	struct row_t final
+	{
+		uint32_t m_iFile{};
+		string_view m_Identifier{};
+		string_view m_Text{};
+	};
+
+	vector<uint32_t> m_Files{};
+	vector<string_view> m_Identifiers{};	// Null-terminated, into m_Arena.
+	vector<string_view> m_Texts{};			// Null-terminated, into m_Arena.
+	string_arena_t m_Arena{};
+
+	[[nodiscard]] size_t size() const noexcept { return m_Files.size(); }
+	[[nodiscard]] bool empty() const noexcept { return m_Files.empty(); }
+	[[nodiscard]] row_t operator[](size_t i) const noexcept { return { m_Files[i], m_Identifiers[i], m_Texts[i] }; }
+	[[nodiscard]] auto Rows() const noexcept { return std::views::iota(size_t{}, size()) | std::views::transform([this](size_t i) noexcept { return (*this)[i]; }); }
+
+	void clear() noexcept
+	{
+		m_Files.clear();
+		m_Identifiers.clear();
+		m_Texts.clear();
+		m_Arena.clear();
+	}
+
+	void reserve(size_t n) noexcept
+	{
+		m_Files.reserve(n);
+		m_Identifiers.reserve(n);
+		m_Texts.reserve(n);
+	}
+
+	void emplace_back(uint32_t iFile, string_view szIdentifier, string_view szText) noexcept
+	{
+		m_Files.push_back(iFile);
+		m_Identifiers.push_back(m_Arena.Store(szIdentifier));
+		m_Texts.push_back(m_Arena.Store(szText));
+	}
 
-	wstring_view m_TargetFile{};
+	// No string is copied either way, only the blocks are shared or taken over.
+	void append_range(source_texts_t const& rhs) noexcept
+	{
+		m_Files.append_range(rhs.m_Files);
+		m_Identifiers.append_range(rhs.m_Identifiers);
+		m_Texts.append_range(rhs.m_Texts);
+		m_Arena.Share(rhs.m_Arena);
+	}
+
+	void append_range(source_texts_t&& rhs) noexcept
+	{
+		m_Files.append_range(rhs.m_Files);
+		m_Identifiers.append_range(rhs.m_Identifiers);
+		m_Texts.append_range(rhs.m_Texts);
+		m_Arena.Share(std::move(rhs.m_Arena));
+	}
+};
+
+struct tr_view_t final
+{
+	uint32_t m_iFile{};
 	string_view m_Identifier{};
 
 	constexpr auto operator<=> (tr_view_t const&) const noexcept = default;
@@ -86,32 +353,147 @@ namespace std
 	};
 }
 
-using xmls_t = std::map<fs::path, XMLDocument, std::less<>>;
-using sorted_loc_view_t = std::map<wstring_view, dict_view_t, std::less<>>;
+struct sv_hash_t final
+{
+	using is_transparent = int;
+
+	[[nodiscard]]	/*#UPDATE_AT_CPP23 static*/
+	size_t operator() (string_view sz) const noexcept
+	{
+		return std::hash<string_view>{}(sz);
+	}
+};
+
+struct mod_schema_t final
+{
+	std::deque<string> m_FolderNames{};
+	vector<string_view> m_Fields{};
+	vector<field_type_t> m_FieldTypes{};
+	vector<class_schema_t> m_Classes{};	// Sorted by m_FullName, just like gModClasses.
+};
+
+using class_lookup_t = std::unordered_map<string_view, class_schema_t const*, sv_hash_t, std::equal_to<>>;	// views into gRimWorldClasses and gModSchema
+// Target files in the order of their paths, as they are written and printed, yet keyed by id. Paths are compared once in gFiles.Rank(), not here.
+struct file_less_t final
+{
+	[[nodiscard]]	/*#UPDATE_AT_CPP23 static*/
+	bool operator() (uint32_t lhs, uint32_t rhs) const noexcept
+	{
+		return gFiles.RankOf(lhs) < gFiles.RankOf(rhs);
+	}
+};
+
+using sorted_loc_view_t = std::map<uint32_t, dict_view_t, file_less_t>;
 using dirty_entries_t = std::unordered_set<tr_view_t>;
 using txt_crc_dict_t = std::map<fs::path, uint64_t, sv_iless_t>;
+using file_set_t = std::unordered_set<uint32_t>;	// ids in gFiles
+using translation_memory_t = std::unordered_map<uint64_t, string>;	// CRC of an English text, to the translation it is given the most.
 
-inline vector<translation_t> gAllSourceTexts;
+inline source_texts_t gAllSourceTexts;
 inline sorted_loc_view_t gSortedSourceTexts;
-inline xmls_t gAllLocFiles;
-inline dirty_entries_t gDirtyEntries;
-inline txt_crc_dict_t gStringFillerCRC;
+
+inline mod_schema_t gModSchema;	// views into gModClasses
+inline class_lookup_t gClassLookup;
+inline std::atomic<uint64_t> gClassLookupHits;
+inline std::atomic<uint64_t> gClassLookupMisses;
 
 inline void ResetGlobals() noexcept
 {
 	gAllSourceTexts.clear();
 	gSortedSourceTexts.clear();
-	gAllLocFiles.clear();
-	gDirtyEntries.clear();
-	gStringFillerCRC.clear();
+
+	// The same mod again keeps its ids, -watch holds on to its batches from one run to the next.
+	static fs::path LastModDir{};
+
+	if (std::exchange(LastModDir, Path::ModDirectory) != Path::ModDirectory)
+		gFiles.clear();
 }
 
+// Everything owned by one target language, so that several of them could be processed at once over the same source texts.
+// Source texts are extracted against Path::Lang, i.e. the first language. Keys of the sorted view and of the sets below stay as such,
+// only the disk accesses are redirected to the folder of this language through Target().
+struct lang_context_t final
+{
+	explicit lang_context_t(fs::path LangDir) noexcept
+		: m_Directory{ std::move(LangDir) }, m_Strings{ m_Directory / L"Strings" }, m_CRC{ m_Directory / L"CRCRecords.RWPHG" }, m_LegacyCRC{ m_Directory / L"CRC.RWPHG" } {}
+
+	fs::path m_Directory{};
+	fs::path m_Strings{};
+	fs::path m_CRC{};
+	fs::path m_LegacyCRC{};
+
+	dirty_entries_t m_DirtyEntries{};
+	txt_crc_dict_t m_StringFillerCRC{};
+	file_set_t m_UnchangedFiles{};	// Both the English entries and the localization file are as the last run left them.
+	translation_memory_t m_Memory{};	// -tm only.
+	string m_Log{};	// Held output of a concurrent run.
+
+	[[nodiscard]]
+	fs::path Target(wstring_view wcsSourceFile, fs::path const& SourceLangDir = Path::Lang::Directory) const noexcept
+	{
+		// All of them are built by appending onto the language folder, a plain prefix swap is enough.
+		if (wcsSourceFile.starts_with(SourceLangDir.native()))
+			return m_Directory.native() + wstring{ wcsSourceFile.substr(SourceLangDir.native().size()) };
+
+		return m_Directory / fs::path{ wcsSourceFile }.lexically_relative(SourceLangDir);
+	}
+};
+
 size_t std::hash<::tr_view_t>::operator()(::tr_view_t const& t) const noexcept
 {
-	return HashCombine(t.m_TargetFile, t.m_Identifier);
+	return HashCombine(t.m_iFile, t.m_Identifier);
+}
+
+struct file_crc_memo_t final
+{
+	uintmax_t m_iSize{};
+	fs::file_time_type m_LastWriteTime{};
+	uint64_t m_iCRC{};
+};
+
+struct path_hash_t final
+{
+	[[nodiscard]]	/*#UPDATE_AT_CPP23 static*/
+	size_t operator() (fs::path const& hPath) const noexcept
+	{
+		return fs::hash_value(hPath);
+	}
+};
+
+// Lives through the entire run rather than being reset with the others. A file is hashed again only if it was touched in between.
+inline std::unordered_map<fs::path, file_crc_memo_t, path_hash_t> gFileCRCMemo;
+inline std::mutex gFileCRCMemoLock;
+
+uint64_t CheckFileCRC(fs::path const& hPath) noexcept
+{
+	std::error_code ec{};
+	auto const Key = hPath.lexically_normal();
+	auto const iSize = fs::file_size(Key, ec);
+	auto const LastWriteTime = ec ? fs::file_time_type{} : fs::last_write_time(Key, ec);
+
+	if (ec)
+		return CRC64::CheckFile(Key.c_str());
+
+	{
+		std::scoped_lock Lock{ gFileCRCMemoLock };
+
+		if (auto const it = gFileCRCMemo.find(Key);
+			it != gFileCRCMemo.end() && it->second.m_iSize == iSize && it->second.m_LastWriteTime == LastWriteTime)
+		{
+			return it->second.m_iCRC;
+		}
+	}
+
+	// Hashing outside the lock. Racing on the same file costs nothing but a duplicated work.
+	auto const crc = CRC64::CheckFile(Key.c_str());
+
+	std::scoped_lock Lock{ gFileCRCMemoLock };
+	gFileCRCMemo.insert_or_assign(Key, file_crc_memo_t{ iSize, LastWriteTime, crc });
+
+	return crc;
 }
 
-void Path::Resolve(string_view path_to_mod, string_view target_lang) noexcept
+void Path::Resolve(fs::path const& path_to_mod, string_view target_lang) noexcept
 {
 	static constexpr auto fnSetupOptional =
 		+[](std::optional<path>& op, path&& obj) noexcept /*static #UPDATE_AT_CPP23*/
@@ -133,12 +515,30 @@ void Path::Resolve(string_view path_to_mod, string_view target_lang) noexcept
 	Lang::DefInjected = Lang::Directory / L"DefInjected";
 	Lang::Keyed = Lang::Directory / L"Keyed";
 	Lang::Strings = Lang::Directory / L"Strings";
-	Lang::CRC = Lang::Directory / L"CRC.RWPHG";
+	Lang::CRC = Lang::Directory / L"CRCRecords.RWPHG";
+	Lang::LegacyCRC = Lang::Directory / L"CRC.RWPHG";
+	Lang::SchemaCache = Lang::Directory / L"Schema.RWPHG";
+	Lang::ExtractionCache = Lang::Directory / L"Extraction.RWPHG";
 
 	fnSetupOptional(Source::Keyed, ModDirectory / L"Languages" / L"English" / L"Keyed");
 	fnSetupOptional(Source::Strings, ModDirectory / L"Languages" / L"English" / L"Strings");
 }
 
+fs::path Path::FromUtf8(string_view sz) noexcept
+{
+	// std::u8string_view is unavailable under /Zc:char8_t-, hence the deprecated factory.
+	try
+	{
+#pragma warning(suppress: 4996)
+		return fs::u8path(sz);
+	}
+	catch (...)
+	{
+		// Malformed UTF-8, taken as-is rather than terminating.
+		return fs::path{ sz };
+	}
+}
+
 fs::path Path::RelativeToLang(fs::path const& hPath) noexcept
 {
 	static std::error_code ec{};
@@ -155,43 +555,123 @@ void Path::ClearDebugFiles() noexcept
 		| std::views::filter([](auto&& elem) noexcept { return elem.stem().native().ends_with(L"_RWPHG_DEBUG"); })	// Windows only.
 		)
 	{
-		fmt::print("Cleaning DEBUG file: {0}\n", fmt::styled(hPath.u8string(), Style::Debug));
+		Log::Print(ELogLevel::Info, "Cleaning DEBUG file: {0}\n", fmt::styled(hPath.u8string(), Style::Debug));
 		fs::remove(hPath);
 	}
 
-	fmt::print("\n");
+	Log::Print(ELogLevel::Info, "\n");
 }
 
-[[nodiscard]]
-static class_info_t const* SearchClassName(string_view szClassName) noexcept
+static void FreezeModClasses(classinfo_dict_t const& dict = gModClasses, mod_schema_t* pret = &gModSchema) noexcept
 {
-	// Attempt directly search first
-	for (auto&& dict : ALL_DICTS)
-		if (auto const iter = dict->find(szClassName); iter != dict->cend())
-			return std::addressof(iter->second);	// #UPDATE_AT_CPP26 __cpp_lib_associative_heterogeneous_insertion 202311L at()
+	// Spans are pointing into these vectors, hence they must be reserved in full before anything goes in.
+	size_t iFieldCount = 0, iFieldTypeCount = 0;
 
-	// Then with all potential namespaces.
-	for (auto&& szNamespace : gAllNamespaces)
+	for (auto&& info : dict | std::views::values)
+	{
+		iFieldCount += info.m_MustTranslates.size() + info.m_ArraysMustTranslate.size();
+		iFieldTypeCount += info.m_ObjectArrays.size() + info.m_Objects.size();
+	}
+
+	*pret = {};
+	pret->m_Fields.reserve(iFieldCount);
+	pret->m_FieldTypes.reserve(iFieldTypeCount);
+	pret->m_Classes.reserve(dict.size());
+
+	auto const fnFields =
+		[&](str_set_t const& Fields) noexcept
+		{
+			auto const iOffset = pret->m_Fields.size();
+			pret->m_Fields.append_range(Fields);
+
+			return span<string_view const>{ pret->m_Fields }.subspan(iOffset);
+		};
+
+	auto const fnFieldTypes =
+		[&](dictionary_t const& FieldTypes) noexcept
+		{
+			auto const iOffset = pret->m_FieldTypes.size();
+
+			for (auto&& [szField, szType] : FieldTypes)
+				pret->m_FieldTypes.push_back({ szField, szType });
+
+			return span<field_type_t const>{ pret->m_FieldTypes }.subspan(iOffset);
+		};
+
+	for (auto&& [szFullName, info] : dict)
 	{
-		auto const szPotentialName = std::format("{}.{}", szNamespace, szClassName);
+		// For classes overriding vanilla ones, the namespace part can be dropped.
+		string_view szFolderName{};
 
-		for (auto&& dict : ALL_DICTS)
-			if (dict->contains(szPotentialName))
-				return &dict->at(szPotentialName);
+		if (auto szName = info.FullName(); auto const pVanilla = gRimWorldClasses.find(szName))
+			szFolderName = pVanilla->m_Name;
+		else
+			szFolderName = pret->m_FolderNames.emplace_back(std::move(szName));
+
+		pret->m_Classes.push_back({
+			.m_FullName{ szFullName },
+			.m_Namespace{ info.m_Namespace },
+			.m_Name{ info.m_Name },
+			.m_Base{ info.m_Base },
+			.m_FolderName{ szFolderName },
+			.m_MustTranslates{ fnFields(info.m_MustTranslates) },
+			.m_ArraysMustTranslate{ fnFields(info.m_ArraysMustTranslate) },
+			.m_ObjectArrays{ fnFieldTypes(info.m_ObjectArrays) },
+			.m_Objects{ fnFieldTypes(info.m_Objects) },
+		});
 	}
+}
 
-	return nullptr;
+void BuildClassLookupCache() noexcept
+{
+	FreezeModClasses();
+
+	gClassLookup.clear();
+	gClassLookupHits = 0;
+	gClassLookupMisses = 0;
+
+	span<class_schema_t const> const AllClasses[] = { gRimWorldClasses.m_Classes, gModSchema.m_Classes, };
+
+	// Same priority as searching name by name: exact full names come first, vanilla before mod.
+	for (auto&& Classes : AllClasses)
+		for (auto&& info : Classes)
+			gClassLookup.try_emplace(info.m_FullName, &info);
+
+	// Then names with their namespace dropped, following the order of namespaces.
+	for (auto&& szNamespace : gAllNamespaces)
+	{
+		auto const szPrefix = std::format("{}.", szNamespace);
+
+		for (auto&& Classes : AllClasses)
+		{
+			for (auto it = std::ranges::lower_bound(Classes, string_view{ szPrefix }, {}, &class_schema_t::m_FullName);
+				it != Classes.end() && it->m_FullName.starts_with(szPrefix);
+				++it)
+			{
+				gClassLookup.try_emplace(it->m_FullName.substr(szPrefix.length()), std::addressof(*it));
+			}
+		}
+	}
 }
 
 [[nodiscard]]
-static string GetClassFolderName(class_info_t const& info) noexcept
+static class_schema_t const* SearchClassName(string_view szClassName) noexcept
 {
-	auto szFullName = info.FullName();
+	// The table holds every name that could be resolved, so a name absent from it is a negative result.
+	if (auto const iter = gClassLookup.find(szClassName); iter != gClassLookup.cend())
+	{
+		gClassLookupHits.fetch_add(1, std::memory_order_relaxed);
+		return iter->second;
+	}
 
-	if (auto it = gRimWorldClasses.find(szFullName); it != gRimWorldClasses.cend())
-		return it->second.m_Name;	// for vanilla classes, the namespace part can be dropped.
+	gClassLookupMisses.fetch_add(1, std::memory_order_relaxed);
+	return nullptr;
+}
 
-	return szFullName;
+[[nodiscard]]
+static string_view GetClassFolderName(class_schema_t const& info) noexcept
+{
+	return info.m_FolderName;
 }
 
 // Placeholder Generator:
@@ -233,45 +713,91 @@ static generator<fs::path> GetAllXmlSourceFiles(fs::path const& hModFolder = Pat
 	co_return;
 }
 
-[[nodiscard]]
-static recursive_generator<translation_t> ExtractAllEntriesFromObject(
-	string szPrevIdentifier, string_view szTypeName, wstring_view szFileName, XMLElement* def,
-	optional<string>&& FolderOverride = std::nullopt/* for list elems as they are meant to place in same folder as their declarer */,
+struct extraction_frame_t final
+{
+	class_schema_t const* m_pClassInfo{};	// For list frame, this is the class of its elements.
+	XMLElement* m_pCursor{};			// Next field to visit, or the next <li/> for list frame.
+	size_t m_iIdentifierLength{};		// The length of identifier of this frame in the shared buffer.
+	uint_fast16_t m_iListIndex{};
+	bool m_bIsList{};
+};
+
+static void ExtractAllEntriesFromObject(
+	string_view szDefName, string_view szTypeName, wstring_view szFileName, XMLElement* def, source_texts_t* pret,
 	fs::path const& DefInjected = Path::Lang::DefInjected
 ) noexcept
 {
-	auto const pClassInfo = SearchClassName(szTypeName);
+	// Objects and list elems are meant to place in same folder as their declarer, which is the def itself.
+	// The stack and the identifier buffer are reused across all defs, so that no allocation is made per nesting level.
+	// Every frame only appends to the identifier of its parent, hence truncating back to its own length restores it.
+
+	thread_local vector<extraction_frame_t> Stack{};
+	thread_local string szIdentifier{};
+
+	auto const pDefInfo = SearchClassName(szTypeName);
+	if (!pDefInfo) [[unlikely]]
+		return;
+
+	auto const iTargetFile = gFiles.Intern(DefInjected / GetClassFolderName(*pDefInfo) / szFileName);
 
-	for (auto field = def->FirstChildElement(); field; field = field->NextSiblingElement())
+	Stack.clear();
+	szIdentifier.assign(szDefName);
+	Stack.push_back({ .m_pClassInfo{ pDefInfo }, .m_pCursor{ def->FirstChildElement() }, .m_iIdentifierLength{ szIdentifier.size() }, });
+
+	while (!Stack.empty())
 	{
-		string_view szFieldName{ field->Name() };
-		string szThisIdentifier = std::format("{}.{}", szPrevIdentifier, szFieldName);
+		auto& Frame = Stack.back();
+		auto const field = Frame.m_pCursor;
+
+		if (!field)
+		{
+			Stack.pop_back();
+			continue;
+		}
+
+		szIdentifier.resize(Frame.m_iIdentifierLength);
+
+		// Everything wrapped in <li/> would be considered as one individual object.
+		if (Frame.m_bIsList)
+		{
+			Frame.m_pCursor = field->NextSiblingElement("li");
+			std::format_to(std::back_inserter(szIdentifier), ".{}", Frame.m_iListIndex++);
+
+			Stack.push_back({ .m_pClassInfo{ Frame.m_pClassInfo }, .m_pCursor{ field->FirstChildElement() }, .m_iIdentifierLength{ szIdentifier.size() }, });
+			continue;
+		}
+
+		Frame.m_pCursor = field->NextSiblingElement();
+
+		auto const pClassInfo = Frame.m_pClassInfo;
+		auto const iPrevIdentifierLength = Frame.m_iIdentifierLength;	// The buffer may grow, so never keep a view of it.
+		string_view const szFieldName{ field->Name() };
+
+		szIdentifier += '.';
+		szIdentifier += szFieldName;
 
 		// Case 1: this is a key we should translate!
-		if (pClassInfo->m_MustTranslates.contains(szFieldName))
+		if (pClassInfo->IsMustTranslate(szFieldName))
 		{
 			[[unlikely]]
 			if (!field->GetText())
 			{
-				fmt::print(
-					Style::Warning,
+				Log::Print(
+					ELogLevel::Warning, Style::Warning,
 					"Field applied with [MustTranslate] {}::{}::{} was found empty in instance '{}'.\n",
-					pClassInfo->m_Namespace, pClassInfo->m_Name, szFieldName, szPrevIdentifier
+					pClassInfo->m_Namespace, pClassInfo->m_Name, szFieldName, string_view{ szIdentifier }.substr(0, iPrevIdentifierLength)
 				);
 			}
 			else
 			{
-				co_yield{
-					DefInjected / FolderOverride.value_or(GetClassFolderName(*pClassInfo)) / szFileName,
-					std::move(szThisIdentifier), field->GetText(),
-				};
-
+				pret->emplace_back(iTargetFile, szIdentifier, field->GetText());
 			}
 		}
 
 		// Case 2: this is an array of strings!
-		else if (pClassInfo->m_ArraysMustTranslate.contains(szFieldName))
+		else if (pClassInfo->IsArrayMustTranslate(szFieldName))
 		{
+			auto const iFieldIdentifierLength = szIdentifier.size();
 			uint_fast16_t idx = 0;
 
 			for (auto li = field->FirstChildElement("li"); li; li = li->NextSiblingElement("li"), ++idx)
@@ -279,63 +805,45 @@ static recursive_generator<translation_t> ExtractAllEntriesFromObject(
 				[[unlikely]]
 				if (!li->GetText())
 				{
-					fmt::print(
-						Style::Warning,
+					Log::Print(
+						ELogLevel::Warning, Style::Warning,
 						"Field applied with [MustTranslate] {}::{}::{}[{}] was found empty in instance '{}'.\n",
-						pClassInfo->m_Namespace, pClassInfo->m_Name, szFieldName, idx, szPrevIdentifier
+						pClassInfo->m_Namespace, pClassInfo->m_Name, szFieldName, idx, string_view{ szIdentifier }.substr(0, iPrevIdentifierLength)
 					);
 				}
 				else
 				{
-					co_yield{
-						DefInjected / FolderOverride.value_or(GetClassFolderName(*pClassInfo)) / szFileName,
-						std::format("{}.{}", szThisIdentifier, idx), li->GetText(),
-					};
+					szIdentifier.resize(iFieldIdentifierLength);
+					std::format_to(std::back_inserter(szIdentifier), ".{}", idx);
+
+					pret->emplace_back(iTargetFile, szIdentifier, li->GetText());
 				}
 			}
 		}
 
 		// Case 3: this is an array of objects!
-		else if (auto const iter = pClassInfo->m_ObjectArrays.find(szFieldName); iter != pClassInfo->m_ObjectArrays.cend())
+		else if (auto const szElemType = pClassInfo->ObjectArrayType(szFieldName); !szElemType.empty())
 		{
-			uint_fast16_t idx = 0;
-
-			for (auto li = field->FirstChildElement("li"); li; li = li->NextSiblingElement("li"), ++idx)
-			{
-				// Everything wrapped in <li/> would be considered as one individual object.
-				co_yield ExtractAllEntriesFromObject(
-					std::format("{}.{}", szThisIdentifier, idx),
-					iter->second,
-					szFileName,
-					li,
-
-					// The object in List<> must kept in same file as its declarer.
-					optional<string>{ std::in_place, FolderOverride.value_or(GetClassFolderName(*pClassInfo)), }
-				);
-			}
+			if (auto const pElemInfo = SearchClassName(szElemType); pElemInfo)
+				Stack.push_back({ .m_pClassInfo{ pElemInfo }, .m_pCursor{ field->FirstChildElement("li") }, .m_iIdentifierLength{ szIdentifier.size() }, .m_bIsList{ true }, });
 		}
 
 		// Case 4: this is an object that contains a translatable field!
-		else if (auto const iter = pClassInfo->m_Objects.find(szFieldName); iter != pClassInfo->m_Objects.cend())
+		else if (auto const szObjectType = pClassInfo->ObjectType(szFieldName); !szObjectType.empty())
 		{
-			co_yield ExtractAllEntriesFromObject(
-				szThisIdentifier,	// no need for indexing, function will append at its head.
-				iter->second,
-				szFileName,
-				field,	// the field is the entry itself, not further finding.
-
-				// The object in List<> must kept in same file as its declarer.
-				optional<string>{ std::in_place, FolderOverride.value_or(GetClassFolderName(*pClassInfo)), }
-			);
+			// the field is the entry itself, not further finding.
+			if (auto const pObjectInfo = SearchClassName(szObjectType); pObjectInfo)
+				Stack.push_back({ .m_pClassInfo{ pObjectInfo }, .m_pCursor{ field->FirstChildElement() }, .m_iIdentifierLength{ szIdentifier.size() }, });
 		}
 
 		// Default: Do nothing. This is not a field that can be translated.
 	}
 }
 
-[[nodiscard]]
-static recursive_generator<translation_t> ExtractAllEntriesFromFile(fs::path const& file, fs::path const& Keyed = Path::Lang::Keyed) noexcept
+static void ExtractAllEntriesFromFile(fs::path const& file, source_texts_t* pret, fs::path const& Keyed = Path::Lang::Keyed) noexcept
 {
+	RWPHG_TRACE_SCOPE_ARG("Parse", file);
+
 	XMLDocument xml;
 	xml.LoadFile(file.u8string().c_str());
 
@@ -347,11 +855,13 @@ static recursive_generator<translation_t> ExtractAllEntriesFromFile(fs::path con
 		for (auto def = defs->FirstChildElement(); def; def = def->NextSiblingElement())
 		{
 			if (auto defName = def->FirstChildElement("defName"); defName)
-				co_yield ExtractAllEntriesFromObject(defName->GetText(), def->Name(), szFileName, def);
+				ExtractAllEntriesFromObject(defName->GetText(), def->Name(), szFileName, def, pret);
 		}
 	}
 
 	// Keyed #UNTESTED
+	optional<uint32_t> iKeyedFile{};
+
 	for (auto LanguageData = xml.FirstChildElement("LanguageData");
 		LanguageData != nullptr;
 		LanguageData = LanguageData->NextSiblingElement("LanguageData"))
@@ -362,57 +872,405 @@ static recursive_generator<translation_t> ExtractAllEntriesFromFile(fs::path con
 		{
 			auto const pszText = entry->GetText();
 
-			co_yield{
-				Keyed / szFileName,
-				entry->Name(), pszText == nullptr ? "" : pszText,
-			};
+			if (!iKeyedFile)
+				iKeyedFile = gFiles.Intern(Keyed / szFileName);
+
+			pret->emplace_back(
+				*iKeyedFile,
+				entry->Name(), pszText == nullptr ? "" : pszText
+			);
 		}
 	}
 }
 
-[[nodiscard]]
-static recursive_generator<translation_t> GetAllTranslationEntries() noexcept
+// Extraction cache layout, all integers are little-endian:
+//	char[8]		magic
+//	u32			format version
+//	u64			schema hash
+//	u32			count of source files, then for each:
+//		str		path relative to mod directory
+//		u64		CRC64 of the source file
+//		u32		count of target files, then wstr for each: path relative to language directory
+//		u32		count of entries, then for each: u32 index of target file, str identifier, str text
+// where str is a u32 length followed by UTF-8 bytes, and wstr is a u32 length followed by native wchar_t units.
+
+inline constexpr char EXTRACTION_CACHE_MAGIC[8] = { 'R', 'W', 'P', 'H', 'G', 'E', 'X', 'T', };
+inline constexpr uint32_t EXTRACTION_CACHE_VERSION = 1;	// Bump it whenever the extraction itself changes.
+
+struct extraction_cache_entry_t final
 {
-	for (auto&& file : GetAllXmlSourceFiles())
-		co_yield ExtractAllEntriesFromFile(file);
-}
+	uint64_t m_iCRC{};
+	source_texts_t m_Entries{};
+};
 
+using extraction_cache_t = std::unordered_map<string, extraction_cache_entry_t, sv_hash_t, std::equal_to<>>;	// keyed by path relative to mod directory.
+
+// Anything that could alter the output of ExtractAllEntriesFromFile() with a given file content.
 [[nodiscard]]
-static sorted_loc_view_t GetSortedLocView(span<translation_t const> source = gAllSourceTexts) noexcept
+static uint64_t GetSchemaHash(classinfo_dict_t const& dict = gModClasses, sv_set_t const& Namespaces = gAllNamespaces) noexcept
 {
-	sorted_loc_view_t ret{};
+	binary_writer_t writer{};
 
-	for (auto&& [hPath, szEntry, szWords] : source)
-	{
-		auto&&[iter, bNewEntry] = ret[hPath.native()].try_emplace(szEntry, szWords);
+	// Vanilla classes are compiled in. Their very content is hashed, the application version is only by date and wraps around.
+	// A change in the extraction itself is up to EXTRACTION_CACHE_VERSION.
+	writer.Write(SchemaCache::DigestVanillaClasses());
+	writer.Write(string_view{ RIMWORLD_ASSEMBLY_VERSION });
 
-		if (!bNewEntry) [[unlikely]]
-			fmt::print(
-				Style::Warning, "[Warning] Entry '{}' appears twice in file '{}'.\n\tText '{}' was therefore discarded.",
-				szEntry, Path::RelativeToLang(hPath).u8string(), szWords
-			);
-	}
+	writer.Write(static_cast<uint32_t>(Namespaces.size()));
+	for (auto&& szNamespace : Namespaces)
+		writer.Write(szNamespace);
 
-	return ret;
+	writer.m_Buffer.append_range(SchemaCache::Serialize(dict));
+
+	return CRC64::CheckStream(writer.m_Buffer.data(), writer.m_Buffer.size());
 }
 
 [[nodiscard]]
-static EDecision ProcessXml(XMLDocument* xml, wstring_view wcsFile, dict_view_t const& EnglishTexts, dirty_entries_t const& DirtyEntries = gDirtyEntries, fs::path const& ModDir = Path::ModDirectory) noexcept
+static extraction_cache_t LoadExtractionCache(uint64_t iSchemaHash, fs::path const& hFile = Path::Lang::ExtractionCache, fs::path const& LangDir = Path::Lang::Directory) noexcept
 {
-	//	If a file already exists:
-	//		Remove all dirty entries
+	mapped_file_t const File{ hFile };
+	if (!File)
+		return {};
+
+	auto const Content = File.Data();
+	if (!std::ranges::starts_with(Content, std::as_bytes(span{ EXTRACTION_CACHE_MAGIC })))
+		return {};
+
+	binary_reader_t reader{ .m_Data{ Content.subspan(sizeof(EXTRACTION_CACHE_MAGIC)) } };
+
+	if (reader.Read<uint32_t>() != EXTRACTION_CACHE_VERSION || reader.Read<uint64_t>() != iSchemaHash)
+	{
+		Log::Print(ELogLevel::Verbose, Style::Skipping, "Extraction cache '{}' is outdated.\n", hFile.u8string());
+		return {};
+	}
+
+	extraction_cache_t ret{};
+	vector<uint32_t> Targets{};
+	auto const iFileCount = reader.Read<uint32_t>();
+
+	for (uint32_t i = 0; i < iFileCount && !reader.m_bBad; ++i)
+	{
+		string szSource{ reader.ReadString() };
+		extraction_cache_entry_t Entry{ .m_iCRC = reader.Read<uint64_t>(), };
+
+		Targets.clear();
+		for (auto iTargetCount = reader.Read<uint32_t>(); iTargetCount > 0 && !reader.m_bBad; --iTargetCount)
+			Targets.push_back(gFiles.Intern(LangDir / reader.ReadWString()));
+
+		auto const iEntryCount = reader.Read<uint32_t>();
+		Entry.m_Entries.reserve(reader.m_bBad ? 0 : std::min<size_t>(iEntryCount, reader.m_Data.size()));
+
+		for (uint32_t j = 0; j < iEntryCount && !reader.m_bBad; ++j)
+		{
+			auto const iTarget = reader.Read<uint32_t>();
+			auto const szIdentifier = reader.ReadString();
+			auto const szText = reader.ReadString();
+
+			if (iTarget >= Targets.size()) [[unlikely]]
+			{
+				reader.m_bBad = true;
+				break;
+			}
+
+			Entry.m_Entries.emplace_back(Targets[iTarget], szIdentifier, szText);
+		}
+
+		ret.try_emplace(std::move(szSource), std::move(Entry));
+	}
+
+	if (reader.m_bBad) [[unlikely]]
+	{
+		Log::Print(ELogLevel::Warning, Style::Warning, "Bad extraction cache file: '{}'\n", hFile.u8string());
+		return {};
+	}
+
+	return ret;
+}
+
+// Under -serve, the extraction cache of every mod served stays in memory as well, keyed by its file. The file is still written for the runs to come.
+// gFiles starts over with each mod, hence the paths its ids stood for are kept along, to give them again once the mod is back.
+struct resident_extraction_cache_t final
+{
+	uint64_t m_iSchemaHash{};
+	extraction_cache_t m_Cache{};
+	vector<fs::path> m_Files{};
+	uint32_t m_iFilesGeneration{};
+};
+
+inline std::map<fs::path, resident_extraction_cache_t> gResidentExtractionCaches;
+
+static void SaveExtractionCache(
+	uint64_t iSchemaHash, span<fs::path const> Files, span<uint64_t const> CRCs, span<source_texts_t const> Batches,
+	fs::path const& hFile = Path::Lang::ExtractionCache, fs::path const& ModDir = Path::ModDirectory, fs::path const& LangDir = Path::Lang::Directory
+) noexcept
+{
+	binary_writer_t writer{};
+	writer.m_Buffer.append_range(std::as_bytes(span{ EXTRACTION_CACHE_MAGIC }));
+	writer.Write(EXTRACTION_CACHE_VERSION);
+	writer.Write(iSchemaHash);
+	writer.Write(static_cast<uint32_t>(Files.size()));
+
+	vector<uint32_t> Targets{};
+	vector<uint32_t> Indices{};
+
+	for (size_t i = 0; i < Files.size(); ++i)
+	{
+		writer.Write(string_view{ Files[i].lexically_relative(ModDir).u8string() });
+		writer.Write(CRCs[i]);
+
+		// A source file rarely spreads into more than a handful of target files.
+		Targets.clear();
+		Indices.clear();
+
+		for (auto&& iFile : Batches[i].m_Files)
+		{
+			auto const it = std::ranges::find(Targets, iFile);
+			Indices.push_back(static_cast<uint32_t>(it - Targets.begin()));
+
+			if (it == Targets.end())
+				Targets.push_back(iFile);
+		}
+
+		writer.Write(static_cast<uint32_t>(Targets.size()));
+		for (auto&& iTarget : Targets)
+			writer.Write(wstring_view{ gFiles[iTarget].lexically_relative(LangDir).native() });
+
+		writer.Write(static_cast<uint32_t>(Batches[i].size()));
+		for (auto&& [iTarget, szIdentifier, szText] : std::views::zip(Indices, Batches[i].m_Identifiers, Batches[i].m_Texts))
+		{
+			writer.Write(iTarget);
+			writer.Write(string_view{ szIdentifier });
+			writer.Write(string_view{ szText });
+		}
+	}
+
+	std::error_code ec{};
+	fs::create_directories(hFile.parent_path(), ec);
+
+	WriteFileIfChanged(hFile, writer.m_Buffer);
+}
+
+#ifdef _DEBUG
+// Counted since the last print, i.e. over one extraction whether serial or parallel, or over the files -watch parsed again.
+static void PrintClassLookupCounts() noexcept
+{
+	Log::Print(ELogLevel::Info, Style::Debug, "Class lookup: {} hits, {} misses.\n", gClassLookupHits.exchange(0), gClassLookupMisses.exchange(0));
+}
+#endif
+
+// Entries of every source file on its own, in the order of discovery.
+struct source_batches_t final
+{
+	uint64_t m_iSchemaHash{};
+	vector<fs::path> m_Files{};
+	vector<uint64_t> m_CRCs{};
+	vector<source_texts_t> m_Batches{};
+};
+
+[[nodiscard]]
+static source_batches_t ExtractSourceBatches(uint32_t iJobs = gJobs, fs::path const& ModDir = Path::ModDirectory) noexcept
+{
+	auto Files =
+		[]() noexcept
+		{
+			RWPHG_STAT_SCOPE(Discovery);
+			RWPHG_TRACE_SCOPE("Discovery");
+			auto ret = GetAllXmlSourceFiles() | std::ranges::to<vector>();
+			RWPHG_STAT_ADD(Discovery, Files, ret.size());
+
+			return ret;
+		}();
+
+	RWPHG_STAT_SCOPE(Extraction);
+	RWPHG_TRACE_SCOPE("ExtractSourceBatches");
+	auto const iSchemaHash = GetSchemaHash();
+	auto Cache =
+		[&]() noexcept
+		{
+			if (auto const it = gResidentExtractionCaches.find(Path::Lang::ExtractionCache);
+				it != gResidentExtractionCaches.end() && it->second.m_iSchemaHash == iSchemaHash)
+			{
+				if (auto& Resident = it->second; Resident.m_iFilesGeneration != gFiles.Generation())
+				{
+					auto const Ids = Resident.m_Files | std::views::transform([](fs::path const& hPath) noexcept { return gFiles.Intern(hPath); }) | std::ranges::to<vector>();
+
+					for (auto&& Entry : Resident.m_Cache | std::views::values)
+					{
+						for (auto& iFile : Entry.m_Entries.m_Files)
+							iFile = Ids[iFile];
+					}
+				}
+
+				return std::move(it->second.m_Cache);
+			}
+
+			return LoadExtractionCache(iSchemaHash);
+		}();
+	auto const iCachedCount = Cache.size();
+
+	vector<source_texts_t> Batches(Files.size());
+	vector<uint64_t> CRCs(Files.size());
+	vector<size_t> Misses{};
+
+	// Same content under the same schema, same entries. No need to parse it again.
+	for (size_t i = 0; i < Files.size(); ++i)
+	{
+		CRCs[i] = CheckFileCRC(Files[i]);
+
+		if (auto const it = Cache.find(Files[i].lexically_relative(ModDir).u8string()); it != Cache.end() && it->second.m_iCRC == CRCs[i])
+			Batches[i] = std::move(it->second.m_Entries);
+		else
+		{
+			Misses.push_back(i);
+			RWPHG_STAT_ADD(Extraction, Bytes, Stats::FileSize(Files[i]));
+		}
+	}
+
+	RWPHG_STAT_ADD(Extraction, Files, Misses.size());	// Parsed ones only, the rest came from the cache.
+
+	if (iJobs <= 1)
+	{
+		for (auto&& idx : Misses)
+			ExtractAllEntriesFromFile(Files[idx], &Batches[idx]);
+	}
+	else
+	{
+		// Every file is parsed and walked on its own, hence no synchronization is needed except the file index.
+		// Each worker fills the batch of the file it picked up, so that the merge below is in the exact order of the serial path.
+
+		Log::Flush();	// Anything printed so far goes before the output of workers.
+
+		std::atomic<size_t> iNext{};
+		auto const iWorkerCount = std::min<size_t>(iJobs, Misses.size());
+		vector<std::jthread> Workers{};
+		Workers.reserve(iWorkerCount);
+
+		for (size_t i = 0; i < iWorkerCount; ++i)
+		{
+			Workers.emplace_back(
+				[&]() noexcept
+				{
+					for (auto idx = iNext++; idx < Misses.size(); idx = iNext++)
+						ExtractAllEntriesFromFile(Files[Misses[idx]], &Batches[Misses[idx]]);
+				}
+			);
+		}
+	}	// jthread joins on destruction.
+
+	if (auto const iReused = Files.size() - Misses.size(); iReused > 0)
+		Log::Print(ELogLevel::Verbose, Style::Info, "{} of {} source files reused from extraction cache.\n", iReused, Files.size());
+
+#ifdef _DEBUG
+	PrintClassLookupCounts();
+#endif
+
+	// Every hit was in the cache, so equal counts with no miss means nothing was added or removed either.
+	if (!Misses.empty() || iCachedCount != Files.size())
+		SaveExtractionCache(iSchemaHash, Files, CRCs, Batches);
+
+	if (gResident)
+	{
+		// A copy, the batches go on to the caller.
+		auto& Resident = gResidentExtractionCaches[Path::Lang::ExtractionCache];
+		Resident.m_iSchemaHash = iSchemaHash;
+		Resident.m_Cache.clear();
+		Resident.m_Files = gFiles.Paths();
+		Resident.m_iFilesGeneration = gFiles.Generation();
+
+		for (size_t i = 0; i < Files.size(); ++i)
+			Resident.m_Cache.try_emplace(Files[i].lexically_relative(ModDir).u8string(), extraction_cache_entry_t{ .m_iCRC = CRCs[i], .m_Entries = Batches[i], });
+	}
+
+	return { .m_iSchemaHash = iSchemaHash, .m_Files = std::move(Files), .m_CRCs = std::move(CRCs), .m_Batches = std::move(Batches), };
+}
+
+[[nodiscard]]
+static source_texts_t ExtractAllSourceTexts(uint32_t iJobs = gJobs) noexcept
+{
+	auto Sources = ExtractSourceBatches(iJobs);
+
+	source_texts_t ret{};
+	ret.reserve(std::ranges::fold_left(Sources.m_Batches | std::views::transform(&source_texts_t::size), size_t{}, std::plus<>{}));
+
+	for (auto&& Batch : Sources.m_Batches)
+		ret.append_range(std::move(Batch));
+
+	RWPHG_STAT_ADD(Extraction, Entries, ret.size());
+
+	return ret;
+}
+
+[[nodiscard]]
+static sorted_loc_view_t GetSortedLocView(source_texts_t const& source = gAllSourceTexts) noexcept
+{
+	RWPHG_STAT_SCOPE(SortLocView);
+	RWPHG_TRACE_SCOPE("GetSortedLocView");
+	gFiles.Rank();	// Every file of the source texts is interned by now.
+
+	sorted_loc_view_t ret{};
+
+	// The dict of a file is looked up once, every entry after that goes straight to it.
+	vector<dict_view_t*> ByFile(gFiles.size());
+
+	for (auto&& [iFile, szEntry, szWords] : source.Rows())
+	{
+		auto& pDict = ByFile[iFile];
+		if (!pDict)
+			pDict = &ret[iFile];
+
+		auto&&[iter, bNewEntry] = pDict->try_emplace(szEntry, szWords);
+
+		if (!bNewEntry) [[unlikely]]
+			Log::Print(
+				ELogLevel::Warning, Style::Warning, "[Warning] Entry '{}' appears twice in file '{}'.\n\tText '{}' was therefore discarded.",
+				szEntry, Path::RelativeToLang(gFiles[iFile]).u8string(), szWords
+			);
+	}
+
+	RWPHG_STAT_ADD(SortLocView, Files, ret.size());
+	RWPHG_STAT_ADD(SortLocView, Entries, source.size());
+
+	return ret;
+}
+
+struct xml_result_t final
+{
+	EDecision m_Decision{ EDecision::NoOp };
+	string m_Log{};	// Styled output of this file, printed by the caller in the order of files.
+};
+
+[[nodiscard]]
+static xml_result_t ProcessXml(XMLDocument* xml, uint32_t iFile, string_view szFile, dict_view_t const& EnglishTexts, dirty_entries_t const& DirtyEntries, translation_memory_t const& Memory) noexcept
+{
+	//	If a file already exists:
+	//		Remove all dirty entries
 	//		Insert all new entries
 	//	Else:
 	//		Insert all entries known
 
-	thread_local static EDecision LastAction = EDecision::NoOp;
+	xml_result_t ret{};
+
+	// A new entry starts from the English, unless the same English is translated somewhere else already.
+	auto const fnInsert =
+		[&](XMLElement* LanguageData, string_view entry, string_view text) noexcept
+		{
+			auto const itMemory = Memory.empty() ? Memory.cend() : Memory.find(CRC64::CheckStream((std::byte const*)text.data(), text.size()));
+
+			if (itMemory != Memory.cend())
+			{
+				Log::FormatTo(&ret.m_Log, ELogLevel::Info, Style::Info, "Inserting entry \"{}\" from memory\n", entry);
+				LanguageData->InsertNewChildElement(entry.data())->SetText(itMemory->second.c_str());
+			}
+			else
+			{
+				Log::FormatTo(&ret.m_Log, ELogLevel::Info, Style::Info, "Inserting entry \"{}\"\n", entry);
+				LanguageData->InsertNewChildElement(entry.data())->SetText(text.data());
+			}
+		};
 
 	// Couldn't find this entry? Good, it's a new file.
 	auto LanguageData = xml->FirstChildElement("LanguageData");
 
-	// For printing
-	auto const szFile = fs::relative(wcsFile, ModDir).u8string();
-
 	if (LanguageData)
 	{
 		// Sort all entries out.
@@ -422,7 +1280,7 @@ static EDecision ProcessXml(XMLDocument* xml, wstring_view wcsFile, dict_view_t
 
 		for (auto i = LanguageData->FirstChildElement(); i; i = i->NextSiblingElement())
 		{
-			if (DirtyEntries.contains({ wcsFile, i->Name() }))	// Is dirty?
+			if (DirtyEntries.contains({ iFile, i->Name() }))	// Is dirty?
 				dirty.emplace_back(i);
 			else if (!EnglishTexts.contains(i->Name()))	// A dead entry?
 				dead.emplace_back(i);
@@ -434,14 +1292,14 @@ static EDecision ProcessXml(XMLDocument* xml, wstring_view wcsFile, dict_view_t
 		auto const bIsSkipping = dirty.empty() && dead.empty() && existed.size() == EnglishTexts.size();
 		if (bIsSkipping)
 		{
-			fmt::print(Style::Skipping, "{1}Skipping: {0}\n", szFile, LastAction == EDecision::Skipped ? "" : "\n");
-			LastAction = EDecision::Skipped;
+			Log::FormatTo(&ret.m_Log, ELogLevel::Info, Style::Skipping, "Skipping: {}\n", szFile);
+			ret.m_Decision = EDecision::Skipped;
 		}
 		else
 		{
-			fmt::print(Style::Action, "\nPatching File: ");
-			fmt::print(Style::Name, "{}\n", szFile);
-			LastAction = EDecision::Patched;
+			Log::FormatTo(&ret.m_Log, ELogLevel::Info, Style::Action, "\nPatching File: ");
+			Log::FormatTo(&ret.m_Log, ELogLevel::Info, Style::Name, "{}\n", szFile);
+			ret.m_Decision = EDecision::Patched;
 		}
 #pragma endregion File Conclusion
 
@@ -449,13 +1307,13 @@ static EDecision ProcessXml(XMLDocument* xml, wstring_view wcsFile, dict_view_t
 
 		for (auto&& entry : dirty)
 		{
-			fmt::print(Style::Info, "Deleting altered entry \"{}\"\n", entry->Name());
+			Log::FormatTo(&ret.m_Log, ELogLevel::Info, Style::Info, "Deleting altered entry \"{}\"\n", entry->Name());
 			LanguageData->DeleteChild(entry);
 		}
 
 		for (auto&& entry : dead)
 		{
-			fmt::print(Style::Info, "Removing unreferenced entry \"{}\"\n", entry->Name());
+			Log::FormatTo(&ret.m_Log, ELogLevel::Info, Style::Info, "Removing unreferenced entry \"{}\"\n", entry->Name());
 			LanguageData->DeleteChild(entry);
 		}
 
@@ -475,214 +1333,307 @@ static EDecision ProcessXml(XMLDocument* xml, wstring_view wcsFile, dict_view_t
 				if (existed.contains(entry))
 					continue;
 
-				fmt::print(Style::Info, "Inserting entry \"{}\"\n", entry);
-				LanguageData->InsertNewChildElement(entry.data())->SetText(text.data());
+				fnInsert(LanguageData, entry, text);
 			}
 		}
 	}
 	else
 	{
-		fmt::print(Style::Action, "\nCreating File: ");
-		fmt::print(Style::Name, "{}\n", szFile);
-		LastAction = EDecision::Created;
+		Log::FormatTo(&ret.m_Log, ELogLevel::Info, Style::Action, "\nCreating File: ");
+		Log::FormatTo(&ret.m_Log, ELogLevel::Info, Style::Name, "{}\n", szFile);
+		ret.m_Decision = EDecision::Created;
 
 		LanguageData = xml->NewElement("LanguageData");
 		xml->InsertEndChild(LanguageData);
 
 		for (auto&& [entry, text] : EnglishTexts)
-		{
-			fmt::print(Style::Info, "Inserting entry \"{}\"\n", entry);
-			LanguageData->InsertNewChildElement(entry.data())->SetText(text.data());
-		}
+			fnInsert(LanguageData, entry, text);
 	}
 
-	return LastAction;
+	return ret;
 }
 
-static void ProcessEveryXml(xmls_t* pret = &gAllLocFiles, sorted_loc_view_t const& SortedLocView = gSortedSourceTexts) noexcept
+// Load, patch and save one localization file. The document lives and dies here.
+[[nodiscard]]
+static xml_result_t ProcessXmlFile(uint32_t iFile, dict_view_t const& EnglishTexts, lang_context_t const& Lang, fs::path const& ModDir = Path::ModDirectory) noexcept
 {
-	auto& ret = *pret;
+	auto const hPath = Lang.Target(gFiles[iFile].native());
+	auto const szFile = fs::relative(hPath, ModDir).u8string();	// For printing
 
-	for (auto&& [wcsPath, EnglishTexts] : SortedLocView)
+	// Nothing to patch for sure, not even worth a DOM.
+	if (Lang.m_UnchangedFiles.contains(iFile))
 	{
-		auto&& [iter, bNewEntry] = ret.try_emplace(wcsPath);
-		auto&& [hPath, xml] = *iter;
+		xml_result_t ret{ .m_Decision = EDecision::Skipped, };
+		Log::FormatTo(&ret.m_Log, ELogLevel::Info, Style::Skipping, "Skipping: {}\n", szFile);
 
-		if (fs::exists(hPath))
-		{
-			xml.LoadFile(hPath.u8string().c_str());
-		}
-		else
-		{
-			if (auto const ParentPath = hPath.parent_path(); !fs::exists(ParentPath))
-				fs::create_directories(ParentPath);
+		return ret;
+	}
 
-			xml.InsertFirstChild(xml.NewDeclaration());
-			xml.SetBOM(true);
-		}
+	RWPHG_TRACE_SCOPE_ARG("ProcessXmlFile", hPath);
+	XMLDocument xml;
 
-		switch (ProcessXml(&xml, wcsPath, EnglishTexts))
-		{
-		case EDecision::Created:
-		case EDecision::Patched:
+	if (fs::exists(hPath))
+	{
+		xml.LoadFile(hPath.u8string().c_str());
+	}
+	else
+	{
+		// Other workers may be creating the same folder, hence the error code is ignored.
+		std::error_code ec{};
+		fs::create_directories(hPath.parent_path(), ec);
+
+		xml.InsertFirstChild(xml.NewDeclaration());
+		xml.SetBOM(true);
+	}
+
+	auto ret = ProcessXml(&xml, iFile, szFile, EnglishTexts, Lang.m_DirtyEntries, Lang.m_Memory);
+
+	switch (ret.m_Decision)
+	{
+	case EDecision::Created:
+	case EDecision::Patched:
+	{
+		RWPHG_TRACE_SCOPE_ARG("Save", hPath);
 #ifdef _DEBUG
-			xml.SaveFile(
-				std::format("{}\\{}{}", hPath.parent_path().u8string(), hPath.stem().u8string(), "_RWPHG_DEBUG.xml").c_str()
-			);
+		if (SaveXmlIfChanged(xml, hPath.parent_path() / (hPath.stem().native() + L"_RWPHG_DEBUG.xml")) == EWriteResult::Written)
 #else
-			xml.SaveFile(hPath.u8string().c_str());
+		if (SaveXmlIfChanged(xml, hPath) == EWriteResult::Written)
 #endif
-			break;
+			RWPHG_STAT_ADD(ProcessXml, Written, 1);
+		break;
+	}
 
-		default:
-			break;
-		}
+	default:
+		break;
+	}
+
+	return ret;
+}
+
+static void PrintXmlResult(xml_result_t const& Result, EDecision* pLastDecision) noexcept
+{
+	if (Result.m_Log.empty())	// Filtered out by the log level.
+		return;
+
+	// Consecutive 'Skipping' lines are grouped together.
+	if (Result.m_Decision == EDecision::Skipped && *pLastDecision != EDecision::Skipped)
+		Log::Write("\n");
+
+	Log::Write(Result.m_Log);
+	*pLastDecision = Result.m_Decision;
+}
+
+static void ProcessEveryXml(lang_context_t const& Lang, sorted_loc_view_t const& SortedLocView = gSortedSourceTexts, uint32_t iJobs = gJobs) noexcept
+{
+	RWPHG_STAT_SCOPE(ProcessXml);
+	RWPHG_TRACE_SCOPE("ProcessEveryXml");
+	RWPHG_STAT_ADD(ProcessXml, Files, SortedLocView.size());
+	RWPHG_STAT_ADD(ProcessXml, Entries, std::ranges::fold_left(SortedLocView | std::views::values | std::views::transform(&dict_view_t::size), size_t{}, std::plus<>{}));
+
+	EDecision LastDecision = EDecision::NoOp;
+
+	if (iJobs <= 1)
+	{
+		for (auto&& [iFile, EnglishTexts] : SortedLocView)
+			PrintXmlResult(ProcessXmlFile(iFile, EnglishTexts, Lang), &LastDecision);
+
+		return;
+	}
+
+	// Each target file is a key of its own in the view, so the tasks share nothing but read-only data.
+	// Results are printed as soon as every file before them is done, keeping the output identical to the serial path.
+
+	struct task_t final
+	{
+		sorted_loc_view_t::const_pointer m_pSource{};
+		xml_result_t m_Result{};
+		std::atomic<bool> m_bDone{};
+	};
+
+	vector<task_t> Tasks(SortedLocView.size());
+	for (auto&& [Task, Source] : std::views::zip(Tasks, SortedLocView))
+		Task.m_pSource = std::addressof(Source);
+
+	std::atomic<size_t> iNext{};
+	auto const iWorkerCount = std::min<size_t>(iJobs, Tasks.size());
+	vector<std::jthread> Workers{};
+	Workers.reserve(iWorkerCount);
+
+	for (size_t i = 0; i < iWorkerCount; ++i)
+	{
+		Workers.emplace_back(
+			[&]() noexcept
+			{
+				for (auto idx = iNext++; idx < Tasks.size(); idx = iNext++)
+				{
+					auto& Task = Tasks[idx];
+
+					// Whatever else the file prints, e.g. a failed write, goes along with its result to the caller,
+					// hence into the output held for the language when there are several of them, rather than straight out.
+					Log::Hold();
+					Task.m_Result = ProcessXmlFile(Task.m_pSource->first, Task.m_pSource->second, Lang);
+					Task.m_Result.m_Log += Log::Release();
+
+					Task.m_bDone.store(true, std::memory_order_release);
+					Task.m_bDone.notify_one();
+				}
+			}
+		);
+	}
+
+	for (auto&& Task : Tasks)
+	{
+		Task.m_bDone.wait(false, std::memory_order_acquire);
+		PrintXmlResult(Task.m_Result, &LastDecision);
 	}
 }
 
 static void LoadCRC(
-	fs::path const&				prev_records = Path::Lang::CRC,
+	lang_context_t*				pLang,
 	sorted_loc_view_t const&	MappedSourceTexts = gSortedSourceTexts,
-	dirty_entries_t*			pret = &gDirtyEntries,
-	txt_crc_dict_t*				txt_crc_dict = &gStringFillerCRC,
-	fs::path const&				LangDir = Path::Lang::Directory,
+	fs::path const&				SourceLangDir = Path::Lang::Directory,
 	optional<fs::path> const&	pStringsDir = Path::Source::Strings
 ) noexcept
 {
-	auto const prev_records_str = prev_records.u8string();
+	RWPHG_STAT_SCOPE(LoadCRC);
+	RWPHG_TRACE_SCOPE("LoadCRC");
+
+	auto const& prev_records = pLang->m_CRC;
+	auto const& legacy_records = pLang->m_LegacyCRC;
+	auto const pret = &pLang->m_DirtyEntries;
+	auto const pUnchanged = &pLang->m_UnchangedFiles;
+	auto const txt_crc_dict = &pLang->m_StringFillerCRC;
+
+	auto Records = CRCRecords::Open(prev_records);
+
+	if (!Records && fs::exists(legacy_records))
+	{
+		Log::Print(ELogLevel::Info, Style::Info, "Migrating legacy CRC record '{}'.\n", fmt::styled(legacy_records.u8string(), Style::Name));
+		Records = CRCRecords::Open(legacy_records);
+	}
 
-	if (!fs::exists(prev_records))
+	if (!Records)
 	{
-		fmt::print(Style::Warning, "CRC checksum record '{}", fmt::styled(prev_records_str, Style::Name));	// fmtlib cannot restore to main style after any alteration.
-		fmt::print(Style::Warning, "' no found.\nSkipping dirt check.\n\n");
+		Log::Print(ELogLevel::Warning, Style::Warning, "CRC checksum record '{}", fmt::styled(prev_records.u8string(), Style::Name));	// fmtlib cannot restore to main style after any alteration.
+		Log::Print(ELogLevel::Warning, Style::Warning, "' no found.\nSkipping dirt check.\n\n");
 		return;
 	}
 
-	XMLDocument xml;
-	if (auto err = xml.LoadFile(prev_records_str.c_str()); err != XML_SUCCESS) [[unlikely]]
-		fmt::print(Style::Error, "XMLDocument::LoadFile returns: {0} ({1})\n", XMLDocument::ErrorIDToName(err), std::to_underlying(err));
+	RWPHG_STAT_ADD(LoadCRC, Files, Records.Header().m_iFileCount);
+	RWPHG_STAT_ADD(LoadCRC, Entries, Records.Header().m_iRecordCount);
+	RWPHG_STAT_ADD(LoadCRC, Bytes, Records.Data().size());
 
-	auto const Records = xml.FirstChildElement("Records");
-	auto const StringFillers = xml.FirstChildElement("StringFillers");
 	uint32_t iCount = 0;
-	sv_set_t DeadFiles{};	// in case some files get warned like crazy.
 
-	if (!Records)
+	for (size_t iFile = 0; iFile < Records.Header().m_iFileCount; ++iFile)
 	{
-		fmt::print(Style::Warning, "Bad record file: missing entry 'Records'.\n");
-		goto LAB_SKIP_RECORDS;
-	}
+		auto const [szPrevFile, PrevRollUp, PrevTargetCRC] = Records.File(iFile);
+		auto const PrevEntries = Records.RecordsOf(iFile);
+		fs::path const PrevFile{ SourceLangDir / szPrevFile };	// no matter whether or not the translation exists, the m_TargetingFile is always pointing to the supposely file.
 
-	for (auto Record = Records->FirstChildElement(); Record; Record = Record->NextSiblingElement(), ++iCount)
-	{
-		string_view const szPrevFile{ Record->Attribute("File") };
-		fs::path const PrevFile{ LangDir / szPrevFile };	// no matter whether or not the translation exists, the m_TargetingFile is always pointing to the supposely file.
-		string_view const PrevIdentifier{ Record->Attribute("Identifier") };
-		uint64_t const PrevCRC{ Record->Unsigned64Attribute("CRC") };
+		iCount += static_cast<uint32_t>(std::ranges::size(PrevEntries));
 
-		auto const itCurFile = MappedSourceTexts.find(PrevFile);
+		// A file no source text is meant for was never interned at all.
+		auto const iCurFile = gFiles.Find(PrevFile.native());
+		auto const itCurFile = iCurFile ? MappedSourceTexts.find(*iCurFile) : MappedSourceTexts.cend();
 		if (itCurFile == MappedSourceTexts.cend())
 		{
-			if (!DeadFiles.contains(szPrevFile))
-			{
-				fmt::print(Style::Info, "Dead file: {}\n", szPrevFile);
-				DeadFiles.emplace(szPrevFile);
-			}
-
+			Log::Print(ELogLevel::Info, Style::Info, "Dead file: {}\n", szPrevFile);
 			continue;
 		}
 
+		// Same roll-up, same sorted (identifier, CRC) pairs: nothing altered, added or removed in this file.
 		auto const& CurIdentifiers = itCurFile->second;
-		auto const itCurIdentifier = CurIdentifiers.find(PrevIdentifier);
-		if (itCurIdentifier == CurIdentifiers.cend())
+		uint64_t CurRollUp = 0;
+
+		for (auto&& [CurIdentifier, CurText] : CurIdentifiers)
+			CurRollUp = CRCRecords::RollUp(CurRollUp, CurIdentifier, CRC64::CheckStream((std::byte*)CurText.data(), CurText.size()));
+
+		if (CurRollUp == PrevRollUp)
 		{
-			fmt::print(Style::Info, "Dead entry '{}' found in file '{}'\n", PrevIdentifier, szPrevFile);
+			if (PrevTargetCRC != 0 && CheckFileCRC(pLang->m_Directory / szPrevFile) == PrevTargetCRC)
+				pUnchanged->emplace(*iCurFile);
+
 			continue;
 		}
 
-		auto const& CurText = itCurIdentifier->second;
-		auto const CurCRC = CRC64::CheckStream((std::byte*)CurText.data(), CurText.size());
-		if (PrevCRC != CurCRC)
+		for (auto&& [_, PrevIdentifier, PrevCRC] : PrevEntries)
 		{
-			fmt::print(Style::Skipping, "Dirt entry found: {}\\{}\n", szPrevFile, PrevIdentifier);
+			auto const itCurIdentifier = CurIdentifiers.find(PrevIdentifier);
+			if (itCurIdentifier == CurIdentifiers.cend())
+			{
+				Log::Print(ELogLevel::Info, Style::Info, "Dead entry '{}' found in file '{}'\n", PrevIdentifier, szPrevFile);
+				continue;
+			}
+
+			auto const& CurText = itCurIdentifier->second;
+			auto const CurCRC = CRC64::CheckStream((std::byte*)CurText.data(), CurText.size());
+			if (PrevCRC != CurCRC)
+			{
+				Log::Print(ELogLevel::Info, Style::Skipping, "Dirt entry found: {}\\{}\n", szPrevFile, PrevIdentifier);
 
-			// The compare result view must be built on top of current identifier.
-			// 1. the object lifetime of prev series is about the end.
-			// 2. we are going to searching with current text.
-			pret->emplace(itCurFile->first, itCurIdentifier->first);
+				// The compare result view must be built on top of current identifier.
+				// 1. the object lifetime of prev series is about the end.
+				// 2. we are going to searching with current text.
+				pret->emplace(*iCurFile, itCurIdentifier->first);
+			}
 		}
 	}
 
-LAB_SKIP_RECORDS:;
-
 	if (pStringsDir)
 	{
-		if (!StringFillers)
-		{
-			fmt::print(Style::Warning, "Bad record file: missing entry 'StringFillers'.\n");
-			goto LAB_END;
-		}
+		if (!Records.HasStringFillers())
+			Log::Print(ELogLevel::Warning, Style::Warning, "Bad record file: missing entry 'StringFillers'.\n");
 
-		for (auto StringFiller = StringFillers->FirstChildElement(); StringFiller; StringFiller = StringFiller->NextSiblingElement(), ++iCount)
+		for (auto&& [szFile, iCRC] : Records.Fillers())
 		{
-			txt_crc_dict->try_emplace(
-				*pStringsDir / StringFiller->Attribute("File"),
-				StringFiller->Unsigned64Attribute("CRC")
-			);
+			txt_crc_dict->try_emplace(*pStringsDir / szFile, iCRC);
+			++iCount;
 		}
 	}
-	else if (!pStringsDir && StringFillers)
-	{
-		fmt::print(Style::Warning, "String filler records found, but no string filler exists in current version anymore.\n");
-		goto LAB_END;
-	}
+	else if (Records.HasStringFillers())
+		Log::Print(ELogLevel::Warning, Style::Warning, "String filler records found, but no string filler exists in current version anymore.\n");
 
-LAB_END:;
-	fmt::print(Style::Positive, "{} CRC record{} retrieved and compared.\n\n", iCount, iCount < 2 ? "" : "s");
+	Log::Print(ELogLevel::Info, Style::Positive, "{} CRC record{} retrieved and compared, {} file{} unchanged.\n\n", iCount, iCount < 2 ? "" : "s", pUnchanged->size(), pUnchanged->size() < 2 ? "" : "s");
 }
 
-static void SaveCRC(
-	fs::path const&				save_to = Path::Lang::CRC,
-	span<translation_t const>	source = gAllSourceTexts,
+static bool SaveCRC(
+	fs::path const&				save_to,
+	lang_context_t const&		Lang,
+	source_texts_t const&		source = gAllSourceTexts,
+	fs::path const&				SourceLangDir = Path::Lang::Directory,
 	optional<fs::path> const&	pStringFillerFolder = Path::Source::Strings
 ) noexcept
 {
-	XMLDocument xml;
-	xml.InsertFirstChild(xml.NewDeclaration());
-	xml.SetBOM(true);
+	RWPHG_STAT_SCOPE(SaveCRC);
+	RWPHG_TRACE_SCOPE("SaveCRC");
 
-	auto const Version = xml.NewElement("Version");
-	xml.InsertEndChild(Version);
-	Version->SetAttribute("Major", APP_VERSION.m_major);
-	Version->SetAttribute("Minor", APP_VERSION.m_minor);
-	Version->SetAttribute("Revision", APP_VERSION.m_revision);
-	Version->SetAttribute("Build", BUILD_NUMBER);
-	Version->SetAttribute("Checksum", APP_VERSION_COMPILED);
-
-	auto const Timestamp = xml.NewElement("Timestamp");
-	xml.InsertEndChild(Timestamp);
-	auto const t = fmt::gmtime(std::time(nullptr));
-	Timestamp->SetAttribute("GMT", true);
-	Timestamp->SetAttribute("Date", fmt::format("{:%Y-%m-%d}", t).c_str());
-	Timestamp->SetAttribute("Time", fmt::format("{:%H:%M:%S}", t).c_str());
+	CRCRecords::table_t Table{
+		.m_iAppVersion = APP_VERSION_COMPILED,
+		.m_iBuild = BUILD_NUMBER,
+		.m_iTimestamp = static_cast<int64_t>(std::time(nullptr)),
+	};
 
-	auto const Records = xml.NewElement("Records");
-	xml.InsertEndChild(Records);
+	// The relative path of a target file is computed once, on its first entry. The rest go by its id.
+	vector<CRCRecords::table_t::file_t*> ByFile(gFiles.size());
 
-	for (auto&& [File, Identifier, Text] : source)
+	for (auto&& [iFile, Identifier, Text] : source.Rows())
 	{
-		auto const Record = Records->InsertNewChildElement("Record");
+		auto& pFile = ByFile[iFile];
+
+		if (!pFile)
+		{
+			auto const RelPath = fs::relative(gFiles[iFile], SourceLangDir);
+			pFile = &Table.m_Records[RelPath.u8string()];
+			pFile->m_iTargetCRC = CheckFileCRC(Lang.m_Directory / RelPath);	// Called after ProcessEveryXml(), this is what we left on disk.
+		}
 
-		Record->SetAttribute("File", Path::RelativeToLang(File).u8string().c_str());
-		Record->SetAttribute("Identifier", Identifier.c_str());
-		Record->SetAttribute("CRC", CRC64::CheckStream((std::byte*)Text.data(), Text.size()));
+		pFile->m_Entries.emplace_back(Identifier, CRC64::CheckStream((std::byte*)Text.data(), Text.size()));
 	}
 
 	if (pStringFillerFolder)
 	{
-		// Do not leave an empty node in the document.
-		auto const StringFillers = xml.NewElement("StringFillers");
-		xml.InsertEndChild(StringFillers);
+		auto& Fillers = Table.m_StringFillers.emplace();
 
 		for (auto&& hPath :
 			fs::recursive_directory_iterator(*pStringFillerFolder)
@@ -691,46 +1642,53 @@ static void SaveCRC(
 			| std::views::filter([](auto&& path) noexcept { return path.has_extension() && _wcsicmp(path.extension().c_str(), L".txt") == 0; })
 			)
 		{
-			auto const StringFiller = StringFillers->InsertNewChildElement("StringFiller");
-
-			StringFiller->SetAttribute("File", fs::relative(hPath, *pStringFillerFolder).u8string().c_str());
-			StringFiller->SetAttribute("CRC", CRC64::CheckFile(hPath.c_str()));
+			Fillers.emplace_back(fs::relative(hPath, *pStringFillerFolder).u8string(), CheckFileCRC(hPath));
 		}
 	}
 
-	xml.SaveFile(save_to.u8string().c_str());
+	RWPHG_STAT_ADD(SaveCRC, Files, Table.m_Records.size());
+	RWPHG_STAT_ADD(SaveCRC, Entries, source.size());
+
+	CRCRecords::view_t const Records{ std::move(Table).Serialize() };
+	RWPHG_STAT_ADD(SaveCRC, Bytes, Records.Data().size());
+
+	return CRCRecords::Save(save_to, Records);
 }
 
-static void ProcessEveryTxt(optional<fs::path> const& pStringFillerSourceDir = Path::Source::Strings, fs::path const& StringFillerDestDir = Path::Lang::Strings, txt_crc_dict_t const& dict = gStringFillerCRC) noexcept
+static void ProcessEveryTxt(lang_context_t const& Lang, optional<fs::path> const& pStringFillerSourceDir = Path::Source::Strings) noexcept
 {
 	if (!pStringFillerSourceDir)
 		return;
 
+	RWPHG_STAT_SCOPE(ProcessTxt);
+	RWPHG_TRACE_SCOPE("ProcessEveryTxt");
+
+	auto const& StringFillerDestDir = Lang.m_Strings;
 	bool bEndingSentence = true;
-	fmt::print(Style::Action, "\nInspecting all string filler files...\n");
+	Log::Print(ELogLevel::Info, Style::Action, "\nInspecting all string filler files...\n");
 
 	// Handle deletion and alteration.
-	for (auto&& [PrevFile, PrevCRC] : dict)
+	for (auto&& [PrevFile, PrevCRC] : Lang.m_StringFillerCRC)
 	{
 		auto const szPrevFile = fs::relative(PrevFile, *pStringFillerSourceDir).u8string();
 
 		if (!fs::exists(PrevFile))
 		{
 			bEndingSentence = false;
-			fmt::print(Style::Info, "File removed in current version: {}\n", fmt::styled(szPrevFile, Style::Name));
+			Log::Print(ELogLevel::Info, Style::Info, "File removed in current version: {}\n", fmt::styled(szPrevFile, Style::Name));
 
-			if (fs::exists(Path::Lang::Strings / szPrevFile))
-				fmt::print(Style::Skipping, "\tIt is also suggested to remove the corresponding file from your localization folder.\n");
+			if (fs::exists(StringFillerDestDir / szPrevFile))
+				Log::Print(ELogLevel::Info, Style::Skipping, "\tIt is also suggested to remove the corresponding file from your localization folder.\n");
 
 			continue;
 		}
 
-		auto const CurCRC = CRC64::CheckFile(PrevFile.c_str());
+		auto const CurCRC = CheckFileCRC(PrevFile);
 
 		if (CurCRC != PrevCRC)
 		{
 			bEndingSentence = false;
-			fmt::print(Style::Info, "Dirty file: {}\n", fmt::styled(szPrevFile, Style::Name));	// that's all we can do - a warning.
+			Log::Print(ELogLevel::Info, Style::Info, "Dirty file: {}\n", fmt::styled(szPrevFile, Style::Name));	// that's all we can do - a warning.
 		}
 	}
 
@@ -744,36 +1702,275 @@ static void ProcessEveryTxt(optional<fs::path> const& pStringFillerSourceDir = P
 	{
 		auto const RelPath = fs::relative(hPath, *pStringFillerSourceDir).u8string();
 		auto const Corresponding = StringFillerDestDir / RelPath;
+		RWPHG_STAT_ADD(ProcessTxt, Files, 1);
 
 		if (!fs::exists(Corresponding))
 		{
 			bEndingSentence = false;
-			fmt::print(Style::Info, "File without corresponding localization: {}\n", fmt::styled(RelPath, Style::Name));
+			Log::Print(ELogLevel::Info, Style::Info, "File without corresponding localization: {}\n", fmt::styled(RelPath, Style::Name));
 		}
 	}
 
 	if (bEndingSentence)
-		fmt::print(Style::Positive, "Inspection finished without any notable info. (Up-to-date)\n");
+		Log::Print(ELogLevel::Info, Style::Positive, "Inspection finished without any notable info. (Up-to-date)\n");
 }
 
-void ProcessMod() noexcept
+// -tm: every translated entry of the language, keyed by the CRC of the English it was translated from.
+// That is the one in the CRC records, i.e. the English of the last run, or the current one for entries the records know nothing of.
+// An entry still holding its English is a placeholder, not a translation. Among different translations of the same English, the most common one wins, then the first met.
+// Each localization file is read once, one after another, nothing is looked up per entry but the records.
+static void BuildTranslationMemory(
+	lang_context_t*				pLang,
+	sorted_loc_view_t const&	MappedSourceTexts = gSortedSourceTexts,
+	fs::path const&				SourceLangDir = Path::Lang::Directory
+) noexcept
 {
-	ResetGlobals();
+	RWPHG_STAT_SCOPE(TranslationMemory);
+	RWPHG_TRACE_SCOPE("BuildTranslationMemory");
 
-	if (gAllSourceTexts.empty())
-		gAllSourceTexts = GetAllTranslationEntries() | std::ranges::to<vector>();
+	auto Records = CRCRecords::Open(pLang->m_CRC);
+	if (!Records)
+		Records = CRCRecords::Open(pLang->m_LegacyCRC);
 
-	if (gSortedSourceTexts.empty())
-		gSortedSourceTexts = GetSortedLocView();
+	std::unordered_map<uint64_t, vector<pair<string, uint32_t>>> Votes{};
+	uint64_t iTranslated = 0;
 
-	LoadCRC();
-	ProcessEveryXml();
-	ProcessEveryTxt();
-	SaveCRC(
+	for (XMLDocument xml; auto&& [iFile, EnglishTexts] : MappedSourceTexts)
+	{
+		auto const& SourceFile = gFiles[iFile];
+		auto const hTarget = pLang->Target(SourceFile.native(), SourceLangDir);
+		auto const pf = _wfopen(hTarget.c_str(), L"rb");
+
+		if (pf == nullptr)
+			continue;
+
+		xml.LoadFile(pf);
+		fclose(pf);
+
+		RWPHG_STAT_ADD(TranslationMemory, Files, 1);
+		auto const szRelPath = SourceFile.lexically_relative(SourceLangDir).u8string();
+
+		for (auto LanguageData = xml.FirstChildElement("LanguageData"); LanguageData; LanguageData = LanguageData->NextSiblingElement("LanguageData"))
+		{
+			for (auto i = LanguageData->FirstChildElement(); i; i = i->NextSiblingElement())
+			{
+				if (!i->Name() || !i->GetText())
+					continue;
+
+				string_view const szText{ i->GetText() };
+				auto iEnglishCRC = Records ? Records.Find(szRelPath, i->Name()) : std::nullopt;
+
+				if (!iEnglishCRC)
+				{
+					auto const itEnglish = EnglishTexts.find(i->Name());
+					if (itEnglish == EnglishTexts.cend())
+						continue;
+
+					iEnglishCRC = CRC64::CheckStream((std::byte const*)itEnglish->second.data(), itEnglish->second.size());
+				}
+
+				if (*iEnglishCRC == CRC64::CheckStream((std::byte const*)szText.data(), szText.size()))
+					continue;
+
+				auto& Candidates = Votes[*iEnglishCRC];
+
+				if (auto const it = std::ranges::find(Candidates, szText, &pair<string, uint32_t>::first); it != Candidates.end())
+					++it->second;
+				else
+					Candidates.emplace_back(szText, 1);
+
+				++iTranslated;
+			}
+		}
+	}
+
+	pLang->m_Memory.clear();
+	pLang->m_Memory.reserve(Votes.size());
+
+	for (auto&& [iEnglishCRC, Candidates] : Votes)
+		pLang->m_Memory.try_emplace(iEnglishCRC, std::move(std::ranges::max_element(Candidates, {}, &pair<string, uint32_t>::second)->first));
+
+	RWPHG_STAT_ADD(TranslationMemory, Entries, iTranslated);
+	Log::Print(ELogLevel::Info, Style::Info, "Translation memory: {} English texts from {} translated entries.\n", pLang->m_Memory.size(), iTranslated);
+}
+
+// CRC records always cover every source text, only the localization files in SortedLocView are patched.
+static void ProcessLanguage(lang_context_t* pLang, uint32_t iJobs, sorted_loc_view_t const& SortedLocView = gSortedSourceTexts, bool bStringFillers = true) noexcept
+{
+	LoadCRC(pLang);
+
+	if (gTranslationMemory)
+		BuildTranslationMemory(pLang);
+
+	ProcessEveryXml(*pLang, SortedLocView, iJobs);
+	ProcessEveryTxt(*pLang, bStringFillers ? Path::Source::Strings : std::nullopt);
 #ifdef _DEBUG
-		Path::Lang::Directory / L"CRC_RWPHG_DEBUG.XML"
+	SaveCRC(pLang->m_Directory / L"CRC_RWPHG_DEBUG.XML", *pLang);
+#else
+	if (SaveCRC(pLang->m_CRC, *pLang) && fs::exists(pLang->m_LegacyCRC))
+	{
+		std::error_code ec{};
+		fs::remove(pLang->m_LegacyCRC, ec);
+		Log::Print(ELogLevel::Info, Style::Info, "Legacy CRC record '{}' is superseded and removed.\n", fmt::styled(pLang->m_LegacyCRC.u8string(), Style::Name));
+	}
 #endif
-	);
+}
+
+size_t ProcessMod(span<string_view const> OtherLangs) noexcept
+{
+	RWPHG_TRACE_SCOPE("ProcessMod");
+	ResetGlobals();
+
+	// Source side, done once no matter how many languages are there.
+	if (gAllSourceTexts.empty())
+		gAllSourceTexts = ExtractAllSourceTexts();
+
+	if (gSortedSourceTexts.empty())
+		gSortedSourceTexts = GetSortedLocView();
+
+	vector<lang_context_t> Langs{};
+	Langs.reserve(OtherLangs.size() + 1);
+	Langs.emplace_back(Path::Lang::Directory);
+
+	for (auto&& szLang : OtherLangs)
+	{
+		// Two workers on the same folder would be writing the same files.
+		if (fs::path LangDir = Path::ModDirectory / L"Languages" / szLang; !std::ranges::contains(Langs, LangDir, &lang_context_t::m_Directory))
+			Langs.emplace_back(std::move(LangDir));
+	}
+
+	if (Langs.size() == 1)
+	{
+		ProcessLanguage(&Langs.front(), gJobs);
+		return gAllSourceTexts.size();
+	}
+
+	// Languages share nothing but read-only source texts and the memoized file CRCs, which is locked.
+	// Each one holds its output and prints it as a whole once every language before it is done, in the order given.
+
+	Log::Flush();
+
+	auto const iJobsEach = std::max<uint32_t>(gJobs / static_cast<uint32_t>(Langs.size()), 1);
+	vector<std::atomic<bool>> Done(Langs.size());
+	vector<std::jthread> Workers{};
+	Workers.reserve(Langs.size());
+
+	for (auto&& [Lang, bDone] : std::views::zip(Langs, Done))
+	{
+		Workers.emplace_back(
+			[&Lang, &bDone, iJobsEach]() noexcept
+			{
+				Log::Hold();
+				Log::Print(ELogLevel::Info, Style::Action, "\nLanguage: ");
+				Log::Print(ELogLevel::Info, Style::Name, "{}\n\n", Lang.m_Directory.filename().u8string());
+
+				ProcessLanguage(&Lang, iJobsEach);
+
+				Lang.m_Log = Log::Release();
+				bDone.store(true, std::memory_order_release);
+				bDone.notify_one();
+			}
+		);
+	}
+
+	for (auto&& [Lang, bDone] : std::views::zip(Langs, Done))
+	{
+		bDone.wait(false, std::memory_order_acquire);
+		Log::Write(Lang.m_Log);
+	}
+
+	return gAllSourceTexts.size();
+}
+
+size_t ProcessWatchedMod(bool bFirstRun, bool bStringsChanged) noexcept
+{
+	RWPHG_TRACE_SCOPE("ProcessWatchedMod");
+
+	// Sources by file, as the last call left them.
+	static source_batches_t Sources{};
+
+	lang_context_t Lang{ Path::Lang::Directory };
+
+	if (bFirstRun)
+	{
+		ResetGlobals();
+		Sources = ExtractSourceBatches();
+
+		for (auto&& Batch : Sources.m_Batches)
+			gAllSourceTexts.append_range(Batch);
+
+		gSortedSourceTexts = GetSortedLocView();
+		ProcessLanguage(&Lang, gJobs);
+
+		return gSortedSourceTexts.size();
+	}
+
+	// Discovery again, cheap next to the parsing, for the files added or removed to take the place a full run would give them.
+	// Memoized file CRCs only read the files whose size or write time moved, the rest keep their entries from the last call.
+	source_batches_t Next{ .m_iSchemaHash = Sources.m_iSchemaHash, .m_Files = GetAllXmlSourceFiles() | std::ranges::to<vector>(), };
+	Next.m_CRCs.resize(Next.m_Files.size());
+	Next.m_Batches.resize(Next.m_Files.size());
+
+	std::map<fs::path, size_t> Previous{};
+	for (auto&& [i, File] : Sources.m_Files | std::views::enumerate)
+		Previous.try_emplace(File, static_cast<size_t>(i));
+
+	vector<bool> Kept(Sources.m_Files.size());
+	std::set<uint32_t> Affected{};	// Localization files fed by a source altered, whether before or after.
+
+	for (size_t i = 0; i < Next.m_Files.size(); ++i)
+	{
+		Next.m_CRCs[i] = CheckFileCRC(Next.m_Files[i]);
+
+		if (auto const it = Previous.find(Next.m_Files[i]); it != Previous.end() && Sources.m_CRCs[it->second] == Next.m_CRCs[i])
+		{
+			Next.m_Batches[i] = std::move(Sources.m_Batches[it->second]);
+			Kept[it->second] = true;
+			continue;
+		}
+
+		Log::Print(ELogLevel::Verbose, Style::Info, "Extracting: {}\n", Next.m_Files[i].lexically_relative(Path::ModDirectory).u8string());
+		ExtractAllEntriesFromFile(Next.m_Files[i], &Next.m_Batches[i]);
+		RWPHG_STAT_ADD(Extraction, Files, 1);
+
+		Affected.insert_range(Next.m_Batches[i].m_Files);
+	}
+
+	for (auto&& [bKept, Batch] : std::views::zip(Kept, Sources.m_Batches))
+	{
+		if (!bKept)
+		{
+			Affected.insert_range(Batch.m_Files);
+		}
+	}
+
+#ifdef _DEBUG
+	PrintClassLookupCounts();
+#endif
+
+	Sources = std::move(Next);
+
+	if (Affected.empty() && !bStringsChanged)
+		return 0;
+
+	SaveExtractionCache(Sources.m_iSchemaHash, Sources.m_Files, Sources.m_CRCs, Sources.m_Batches);
+
+	// Everything else stays as it is: the sorted view is rebuilt over the new texts, then cut down to the files affected.
+	ResetGlobals();
+	for (auto&& Batch : Sources.m_Batches)
+		gAllSourceTexts.append_range(Batch);
+
+	gSortedSourceTexts = GetSortedLocView();
+
+	sorted_loc_view_t AffectedView{};
+	for (auto&& iFile : Affected)
+	{
+		if (auto const it = gSortedSourceTexts.find(iFile); it != gSortedSourceTexts.end())
+			AffectedView.insert(*it);
+	}
+
+	ProcessLanguage(&Lang, gJobs, AffectedView, bStringsChanged);
+	return AffectedView.size();
 }
 
 // noxref mode:
@@ -787,7 +1984,7 @@ void NoXRef() noexcept
 	ResetGlobals();
 
 	if (gAllSourceTexts.empty())
-		gAllSourceTexts = GetAllTranslationEntries() | std::ranges::to<vector>();
+		gAllSourceTexts = ExtractAllSourceTexts();
 
 	if (gSortedSourceTexts.empty())
 		gSortedSourceTexts = GetSortedLocView();
@@ -797,10 +1994,16 @@ void NoXRef() noexcept
 		| std::views::filter(std::not_fn(mfnIsDir))	// is NOT dir.
 		| std::views::transform(&fs::directory_entry::path)
 		| std::views::filter([](auto&& path) noexcept { return path.has_extension() && _wcsicmp(path.extension().c_str(), L".xml") == 0; })
-		| std::views::filter([](auto&& path) noexcept { return !gSortedSourceTexts.contains(path.native()); })
+		| std::views::filter(
+			[](auto&& path) noexcept
+			{
+				auto const iFile = gFiles.Find(path.native());	// Never interned if no source text is meant for it.
+				return !iFile || !gSortedSourceTexts.contains(*iFile);
+			}
+		)
 		)
 	{
-		fmt::print("{}\n", fs::relative(hPath, Path::Lang::Directory).u8string());
+		Log::Print(ELogLevel::Info, "{}\n", fs::relative(hPath, Path::Lang::Directory).u8string());
 	}
 }
 
@@ -837,9 +2040,10 @@ static auto ExtractAllLastTranslation(sorted_loc_view_t const& SortedSourceView
 	std::deque<translation_t> LastTranslations{};	// using vector will cause the address stored in view being invalidated after few insertions.
 	sorted_loc_view_t SortedLastTranslations{};	// the ownership of this view belongs to 'LastTranslations'
 
-	for (XMLDocument xml; auto&& file : SortedSourceView | std::views::keys)
+	for (XMLDocument xml; auto&& iFile : SortedSourceView | std::views::keys)
 	{
-		auto const pf = _wfopen(file.data(), L"rb");
+		auto const& file = gFiles[iFile];
+		auto const pf = _wfopen(file.c_str(), L"rb");
 
 		if (pf == nullptr)
 			continue;
@@ -854,8 +2058,8 @@ static auto ExtractAllLastTranslation(sorted_loc_view_t const& SortedSourceView
 				if (!i->Name() || !i->GetText())
 					continue;
 
-				auto const& tr = LastTranslations.emplace_back(file, i->Name(), i->GetText());
-				SortedLastTranslations[tr.m_TargetFile.native()].try_emplace(tr.m_Identifier, tr.m_Text);
+				auto const& tr = LastTranslations.emplace_back(file, i->Name(), i->GetText(), iFile);
+				SortedLastTranslations[iFile].try_emplace(tr.m_Identifier, tr.m_Text);
 			}
 		}
 	}
@@ -863,6 +2067,24 @@ static auto ExtractAllLastTranslation(sorted_loc_view_t const& SortedSourceView
 	return pair{ std::move(LastTranslations), std::move(SortedLastTranslations) };
 }
 
+[[nodiscard]]
+static vector<fs::path> GetUnreferencedFiles(sorted_loc_view_t const& SortedSourceView = gSortedSourceTexts, fs::path const& LangDir = Path::Lang::Directory) noexcept
+{
+	return
+		fs::recursive_directory_iterator(LangDir)
+		| std::views::filter(std::not_fn(mfnIsDir))	// is NOT dir. #UPDATE_AT_CPP26 __cpp_lib_not_fn >= 202306L
+		| std::views::transform(&fs::directory_entry::path)
+		| std::views::filter([](auto&& path) noexcept { return path.has_extension() && _wcsicmp(path.extension().c_str(), L".xml") == 0; })
+		| std::views::filter(
+			[&](auto&& path) noexcept
+			{
+				auto const iFile = gFiles.Find(path.native());	// Never interned if no source text is meant for it.
+				return !iFile || !SortedSourceView.contains(*iFile);
+			}
+		)
+		| std::ranges::to<vector>();
+}
+
 [[nodiscard]]
 static bool SimiliarFit(wstring_view const& lhs, wstring_view const& rhs) noexcept
 {
@@ -901,107 +2123,423 @@ void FileMergingSuggestion(bool bShouldWrite) noexcept
 	ResetGlobals();
 
 	if (gAllSourceTexts.empty())
-		gAllSourceTexts = GetAllTranslationEntries() | std::ranges::to<vector>();
+		gAllSourceTexts = ExtractAllSourceTexts();
 
 	if (gSortedSourceTexts.empty())
 		gSortedSourceTexts = GetSortedLocView();
 
-	auto const UselessFiles =
-		fs::recursive_directory_iterator(Path::Lang::Directory)
-		| std::views::filter(std::not_fn(mfnIsDir))	// is NOT dir. #UPDATE_AT_CPP26 __cpp_lib_not_fn >= 202306L
-		| std::views::transform(&fs::directory_entry::path)
-		| std::views::filter([](auto&& path) noexcept { return path.has_extension() && _wcsicmp(path.extension().c_str(), L".xml") == 0; })
-		| std::views::filter([](auto&& path) noexcept { return !gSortedSourceTexts.contains(path.native()); })
-		| std::ranges::to<vector>();
+	auto const UselessFiles = GetUnreferencedFiles();
 
 	auto const [LastTranslations, SortedLastTranslations] = ExtractAllLastTranslation();
 	auto const Untranslated = GetAllUntranslated(gSortedSourceTexts, SortedLastTranslations);
 
-	for (auto&& NoXRefFile : UselessFiles)
+	// Every unreferenced file is read once, into an index by identifier. Candidates of an identifier are in the order of the files.
+	auto const NoXRefEntries = UselessFiles | std::views::transform(&ExtractExistingTranslationFromFile) | std::ranges::to<vector>();
+	std::unordered_map<string_view, vector<pair<uint32_t, translation_t const*>>, sv_hash_t, std::equal_to<>> Index{};
+
+	for (auto&& [iFile, Entries] : NoXRefEntries | std::views::enumerate)
+	{
+		for (auto&& Entry : Entries)
+			Index[Entry.m_Identifier].emplace_back(static_cast<uint32_t>(iFile), &Entry);
+	}
+
+	struct merge_t final
+	{
+		uint32_t m_iFrom{};
+		string_view m_EnglishText{};
+		translation_t const* m_pTranslation{};
+	};
+
+	vector<merge_t> Merges{};
+
+	// One lookup per missing entry, then one load and one save per target file, no matter how many files it takes from.
+	for (auto&& [iMissingFile, MissingEntries] : Untranslated)
 	{
-		auto const NoXRefEntries = ExtractExistingTranslationFromFile(NoXRefFile);
-		auto const CurFileName = fs::_Parse_filename(NoXRefFile.native());
-		[[maybe_unused]] bool bHandled = false;
+		wstring_view const wcsMissingFile{ gFiles[iMissingFile].native() };
+		auto const MissingFileName = fs::_Parse_filename(wcsMissingFile);
+		Merges.clear();
 
-		for (auto&& [wcsMissingFile, MissingEntries] : Untranslated)
+		for (auto&& [missing_id, en_text] : MissingEntries)
 		{
-			// Have same filename but in diff dir??
-			if (!SimiliarFit(fs::_Parse_filename(wcsMissingFile), CurFileName))
+			auto const it = Index.find(missing_id);
+			if (it == Index.end())
 				continue;
 
-			auto const iKeyMaxLen = std::ranges::max(MissingEntries | std::views::keys, {}, &string_view::length).length();
-			auto const iEnTxtMaxLen = std::ranges::max(MissingEntries | std::views::values, {}, &string_view::length).length() + (size_t)2;	// #UPDATE_AT_CPP23 ssz literal
+			// Have same filename but in diff dir??
+			auto const itFrom = std::ranges::find_if(
+				it->second,
+				[&](auto&& Candidate) noexcept { return SimiliarFit(MissingFileName, fs::_Parse_filename(UselessFiles[Candidate.first].native())); }
+			);
 
-			XMLDocument xml;
-			XMLElement* LanguageData = nullptr;
+			if (itFrom != it->second.end())
+				Merges.emplace_back(itFrom->first, en_text, itFrom->second);
+		}
 
-			if (auto const f = _wfopen(wcsMissingFile.data(), L"rb"); f != nullptr)
+		if (Merges.empty())
+			continue;
+
+		std::ranges::stable_sort(Merges, {}, &merge_t::m_iFrom);	// Grouped by the file they come from, still in order of identifier within.
+
+		auto const iKeyMaxLen = std::ranges::max(MissingEntries | std::views::keys, {}, &string_view::length).length();
+		auto const iEnTxtMaxLen = std::ranges::max(MissingEntries | std::views::values, {}, &string_view::length).length() + (size_t)2;	// #UPDATE_AT_CPP23 ssz literal
+
+		XMLDocument xml;
+		XMLElement* LanguageData = nullptr;
+
+		if (auto const f = _wfopen(wcsMissingFile.data(), L"rb"); f != nullptr)
+		{
+			xml.LoadFile(f);
+			fclose(f);
+
+			LanguageData = xml.FirstChildElement("LanguageData");
+		}
+		else	// new file
+		{
+			xml.InsertFirstChild(xml.NewDeclaration());
+			xml.SetBOM(true);
+
+			LanguageData = xml.NewElement("LanguageData");
+			xml.InsertEndChild(LanguageData);
+		}
+
+		for (auto&& Group : Merges | std::views::chunk_by([](merge_t const& lhs, merge_t const& rhs) noexcept { return lhs.m_iFrom == rhs.m_iFrom; }))
+		{
+			auto const& NoXRefFile = UselessFiles[Group.front().m_iFrom];
+
+			LanguageData->InsertNewComment(fmt::format("Merging from file '{}' at {:%Y-%m-%d}", Path::RelativeToLang(NoXRefFile), ch::system_clock::now()).c_str());
+
+			Log::Print(ELogLevel::Info, Style::Info, "\nUnreferenced file {} has the following translations which would fit into {}\n",
+				fmt::styled(Path::RelativeToLang(NoXRefFile), Style::Name),
+				fmt::styled(Path::RelativeToLang(wcsMissingFile), Style::Name)
+			);
+
+			for (auto&& [iFrom, en_text, pTranslation] : Group)
 			{
-				xml.LoadFile(f);
-				fclose(f);
+				Log::Print(ELogLevel::Info, Style::Info, u8"{}\n",
+					fmt::format(u8R"([{0:<{3}}] (EN){1:>{4}?} => {2:?})", pTranslation->m_Identifier, en_text, pTranslation->m_Text, iKeyMaxLen, iEnTxtMaxLen)
+				);
 
-				LanguageData = xml.FirstChildElement("LanguageData");
+				LanguageData
+					->InsertNewChildElement(pTranslation->m_Identifier.c_str())
+					->SetText(pTranslation->m_Text.c_str());
 			}
-			else	// new file
-			{
-				xml.InsertFirstChild(xml.NewDeclaration());
-				xml.SetBOM(true);
+		}
+
+		if (bShouldWrite)
+		{
+#ifdef _DEBUG
+			SaveXmlIfChanged(xml, fs::path{ fs::_Parse_parent_path(wcsMissingFile) } / (std::wstring{ fs::_Parse_stem(wcsMissingFile) } + L"_RWPHG_DEBUG.xml"));
+#else
+			SaveXmlIfChanged(xml, wcsMissingFile);
+#endif
+		}
+	}
+}
+
+// Fuzzy merging mode:
+//	Orphans are the translations whose identifier is gone from the English of their file, and everything in a file no longer referenced.
+//	They are only paired with missing entries in the same Def type folder and of the same field path, e.g. after a defName rename.
+//	A candidate must share enough q-grams of the name with the missing entry for the threshold to be reachable at all, only those left are scored.
+//	An orphan whose English text, as the CRC records remember it, equals the current one of the missing entry needs only half of the threshold.
+//	Pairs are then taken from the best down, each orphan and each missing entry at most once.
+
+inline constexpr size_t FUZZY_GRAM = 3;
+inline constexpr size_t FUZZY_MAX_POSTING = 4096;	// Grams more common than that are not counted, the count required is lowered to make up for it.
+
+struct fuzzy_entry_t final
+{
+	wstring_view m_File{};
+	string_view m_Identifier{};
+	string_view m_Name{};		// The part compared: defName for DefInjected, the whole key for Keyed.
+	string_view m_Text{};		// Translation of an orphan, English of a missing entry.
+	uint64_t m_iEnglishCRC{};	// 0 if unknown.
+};
+
+struct fuzzy_bucket_t final
+{
+	vector<uint32_t> m_Orphans{};
+	std::unordered_map<uint32_t, vector<uint32_t>> m_Grams{};		// Orphans containing the gram, without duplicates.
+	std::unordered_map<uint64_t, vector<uint32_t>> m_ByEnglish{};
+};
+
+struct fuzzy_pair_t final
+{
+	uint32_t m_iMissing{};
+	uint32_t m_iOrphan{};
+	float m_flScore{};
+	bool m_bSameEnglish{};
+};
+
+[[nodiscard]]
+static pair<string, string_view> FuzzyBucketOf(fs::path const& RelPath, string_view szIdentifier) noexcept
+{
+	// "DefInjected/ThingDef|label", or just "Keyed".
+	auto it = RelPath.begin();
+	string szBucket{ it != RelPath.end() ? it->u8string() : string{} };
+
+	if (szBucket == "DefInjected" && ++it != RelPath.end() && std::next(it) != RelPath.end())
+	{
+		szBucket += '/';
+		szBucket += it->u8string();
+	}
+
+	if (auto const iDot = szIdentifier.find('.'); iDot != string_view::npos)
+	{
+		szBucket += '|';
+		szBucket += szIdentifier.substr(iDot + 1);
+
+		return { std::move(szBucket), szIdentifier.substr(0, iDot) };
+	}
+
+	return { std::move(szBucket), szIdentifier };
+}
+
+[[nodiscard]]
+static uint32_t FuzzyGram(string_view sz, size_t i) noexcept
+{
+	constexpr auto ToLower = [](char c) noexcept { return static_cast<uint32_t>(static_cast<uint8_t>((c >= 'A' && c <= 'Z') ? c + 0x20 : c)); };	// Same folding as the distance.
+
+	return (ToLower(sz[i]) << 16) | (ToLower(sz[i + 1]) << 8) | ToLower(sz[i + 2]);
+}
+
+void FuzzyMergingSuggestion(float flThreshold, bool bShouldWrite) noexcept
+{
+	ResetGlobals();
+
+	if (gAllSourceTexts.empty())
+		gAllSourceTexts = ExtractAllSourceTexts();
+
+	if (gSortedSourceTexts.empty())
+		gSortedSourceTexts = GetSortedLocView();
+
+	flThreshold = std::clamp(flThreshold, 0.05f, 1.f);
+
+	auto const [LastTranslations, SortedLastTranslations] = ExtractAllLastTranslation();
+	auto const Untranslated = GetAllUntranslated(gSortedSourceTexts, SortedLastTranslations);
+	auto const NoXRefEntries = GetUnreferencedFiles() | std::views::transform(&ExtractExistingTranslationFromFile) | std::ranges::to<vector>();
+	auto Records = CRCRecords::Open(Path::Lang::CRC);
+	if (!Records)
+		Records = CRCRecords::Open(Path::Lang::LegacyCRC);
+
+	vector<fuzzy_entry_t> Orphans{};
+	vector<fuzzy_entry_t> Missing{};
+	std::unordered_map<string, fuzzy_bucket_t, sv_hash_t, std::equal_to<>> Buckets{};
 
-				LanguageData = xml.NewElement("LanguageData");
-				xml.InsertEndChild(LanguageData);
+	// Entries of a file come in a row, so is the relative path computed once per file.
+	wstring_view wcsLastFile{};
+	fs::path LastRelPath{};
+	string szLastRelPath{};
+
+	auto const fnRelPath =
+		[&](wstring_view wcsFile) noexcept -> fs::path const&
+		{
+			if (wcsFile != wcsLastFile)
+			{
+				wcsLastFile = wcsFile;
+				LastRelPath = Path::RelativeToLang(fs::path{ wcsFile });
+				szLastRelPath = LastRelPath.u8string();
 			}
 
-			vector<string> records{};
+			return LastRelPath;
+		};
+
+	auto const fnAddOrphan =
+		[&](translation_t const& Entry) noexcept
+		{
+			auto [szBucket, Name] = FuzzyBucketOf(fnRelPath(Entry.m_TargetFile.native()), Entry.m_Identifier);
+			auto const iEnglishCRC = Records ? Records.Find(szLastRelPath, Entry.m_Identifier).value_or(0) : 0;
+			auto const iOrphan = static_cast<uint32_t>(Orphans.size());
+			auto& Bucket = Buckets[std::move(szBucket)];
+
+			Orphans.emplace_back(Entry.m_TargetFile.native(), Entry.m_Identifier, Name, Entry.m_Text, iEnglishCRC);
+			Bucket.m_Orphans.push_back(iOrphan);
 
-			// any key we are in need is presenting in the noxref file entries?
-			for (auto&& [missing_id, en_text] : MissingEntries)
+			for (size_t i = 0; i + FUZZY_GRAM <= Name.size(); ++i)
 			{
-				auto it = std::ranges::find(NoXRefEntries, missing_id, &translation_t::m_Identifier);
-				if (it == NoXRefEntries.cend())
-					continue;
+				if (auto& Posting = Bucket.m_Grams[FuzzyGram(Name, i)]; Posting.empty() || Posting.back() != iOrphan)
+					Posting.push_back(iOrphan);
+			}
 
-				if (records.empty())	// first inserted item!
-					LanguageData->InsertNewComment(fmt::format("Merging from file '{}' at {:%Y-%m-%d}", Path::RelativeToLang(wcsMissingFile), ch::system_clock::now()).c_str());
+			if (iEnglishCRC)
+				Bucket.m_ByEnglish[iEnglishCRC].push_back(iOrphan);
+		};
 
-				records.emplace_back(
-					fmt::format(u8R"([{0:<{3}}] (EN){1:>{4}?} => {2:?})", it->m_Identifier, en_text, it->m_Text, iKeyMaxLen, iEnTxtMaxLen)
-				);
+	for (auto&& Entry : LastTranslations)
+	{
+		if (auto const it = gSortedSourceTexts.find(Entry.m_iFile); it == gSortedSourceTexts.end() || !it->second.contains(Entry.m_Identifier))
+			fnAddOrphan(Entry);
+	}
 
-				LanguageData
-					->InsertNewChildElement(it->m_Identifier.c_str())
-					->SetText(it->m_Text.c_str());
+	for (auto&& Entry : NoXRefEntries | std::views::join)
+		fnAddOrphan(Entry);
+
+	for (auto&& [iFile, MissingEntries] : Untranslated)
+	{
+		for (auto&& [szIdentifier, szEnglish] : MissingEntries)
+			Missing.emplace_back(gFiles[iFile].native(), szIdentifier, string_view{}, szEnglish, CRC64::CheckStream((std::byte const*)szEnglish.data(), szEnglish.size()));
+	}
+
+	Log::Print(ELogLevel::Info, Style::Info, "{} orphaned translations, {} missing entries.\n", Orphans.size(), Missing.size());
+
+	vector<fuzzy_pair_t> Pairs{};
+	vector<uint32_t> Counts(Orphans.size());
+	vector<uint32_t> Touched{}, Candidates{}, Distances{};
+	vector<string_view> Names{};
+
+	for (auto&& [iMissing, Entry] : Missing | std::views::enumerate)
+	{
+		auto [szBucket, Name] = FuzzyBucketOf(fnRelPath(Entry.m_File), Entry.m_Identifier);
+		auto const itBucket = Buckets.find(szBucket);
+		if (itBucket == Buckets.end())
+			continue;
+
+		auto const& Bucket = itBucket->second;
+		Entry.m_Name = Name;
+
+		// Distance is at most (1 - t) * max(m, n), where n is at most m / t. A name of m bytes has m - q + 1 grams, an edit spoils q of them at most.
+		auto const m = Name.size();
+		// The epsilon keeps float rounding from cutting off a bound that is a whole number.
+		auto const iMaxEdits = static_cast<size_t>((1.f - flThreshold) * m / flThreshold + 1e-4f);
+		auto const iMinLength = m > iMaxEdits ? m - iMaxEdits : 0;
+		auto const iMaxLength = static_cast<size_t>(m / flThreshold + 1e-4f);
+		auto iRequired = static_cast<ptrdiff_t>(m + 1) - static_cast<ptrdiff_t>(FUZZY_GRAM) - static_cast<ptrdiff_t>(FUZZY_GRAM * iMaxEdits);
+
+		Touched.clear();
+		Candidates.clear();
+
+		for (size_t i = 0; i + FUZZY_GRAM <= m; ++i)
+		{
+			auto const itPosting = Bucket.m_Grams.find(FuzzyGram(Name, i));
+			if (itPosting == Bucket.m_Grams.end())
+				continue;
+
+			if (itPosting->second.size() > FUZZY_MAX_POSTING)
+			{
+				--iRequired;
+				continue;
+			}
 
-				bHandled = true;
+			for (auto&& iOrphan : itPosting->second)
+			{
+				if (Counts[iOrphan]++ == 0)
+					Touched.push_back(iOrphan);
 			}
+		}
+
+		auto const fnLengthFits = [&](uint32_t iOrphan) noexcept { return Orphans[iOrphan].m_Name.size() >= iMinLength && Orphans[iOrphan].m_Name.size() <= iMaxLength; };
 
-			// something actually patched.
-			if (!records.empty())
+		if (iRequired > 0)
+		{
+			for (auto&& iOrphan : Touched)
 			{
-				fmt::print(Style::Info, "\nUnreferenced file {} has the following translations which would fit into {}\n",
-					fmt::styled(Path::RelativeToLang(NoXRefFile), Style::Name),
-					fmt::styled(Path::RelativeToLang(wcsMissingFile), Style::Name)
-				);
+				if (Counts[iOrphan] >= static_cast<size_t>(iRequired) && fnLengthFits(iOrphan))
+					Candidates.push_back(iOrphan);
+			}
+		}
+		else	// Too short, or too lax a threshold, for the grams to tell anything.
+			Candidates.append_range(Bucket.m_Orphans | std::views::filter(fnLengthFits));
 
-				for (auto&& record : records)
-					fmt::print(Style::Info, u8"{}\n", record);
+		for (auto&& iOrphan : Touched)
+			Counts[iOrphan] = 0;
 
-				if (bShouldWrite)
-				{
+		// Same English as back then, the rename is all what happened most likely. These skip the gram filter.
+		if (auto const it = Bucket.m_ByEnglish.find(Entry.m_iEnglishCRC); it != Bucket.m_ByEnglish.end())
+			Candidates.append_range(it->second);
+
+		if (Candidates.empty())
+			continue;
+
+		std::ranges::sort(Candidates);
+		Candidates.erase(std::ranges::unique(Candidates).begin(), Candidates.end());
+
+		Names.assign_range(Candidates | std::views::transform([&](uint32_t iOrphan) noexcept { return Orphans[iOrphan].m_Name; }));
+		Distances.resize(Candidates.size());
+		EditDistance::Batch(Name, Names, Distances.data());
+
+		for (auto&& [iOrphan, iDistance] : std::views::zip(Candidates, Distances))
+		{
+			auto const iLonger = std::max(m, Orphans[iOrphan].m_Name.size());
+			auto const flScore = iLonger ? 1.f - static_cast<float>(iDistance) / static_cast<float>(iLonger) : 1.f;
+			auto const bSameEnglish = Entry.m_iEnglishCRC != 0 && Orphans[iOrphan].m_iEnglishCRC == Entry.m_iEnglishCRC;	// 0 is unknown, not a match.
+
+			if (flScore >= (bSameEnglish ? flThreshold / 2 : flThreshold))
+				Pairs.emplace_back(static_cast<uint32_t>(iMissing), iOrphan, flScore, bSameEnglish);
+		}
+	}
+
+	std::ranges::sort(
+		Pairs,
+		[](fuzzy_pair_t const& lhs, fuzzy_pair_t const& rhs) noexcept
+		{
+			return std::tuple{ !lhs.m_bSameEnglish, -lhs.m_flScore, lhs.m_iMissing, lhs.m_iOrphan } < std::tuple{ !rhs.m_bSameEnglish, -rhs.m_flScore, rhs.m_iMissing, rhs.m_iOrphan };
+		}
+	);
+
+	vector<bool> MissingTaken(Missing.size()), OrphanTaken(Orphans.size());
+	vector<fuzzy_pair_t> Accepted{};
+
+	for (auto&& Pair : Pairs)
+	{
+		if (MissingTaken[Pair.m_iMissing] || OrphanTaken[Pair.m_iOrphan])
+			continue;
+
+		MissingTaken[Pair.m_iMissing] = OrphanTaken[Pair.m_iOrphan] = true;
+		Accepted.push_back(Pair);
+	}
+
+	std::ranges::sort(Accepted, {}, &fuzzy_pair_t::m_iMissing);	// Back into the order of the files.
+
+	for (auto&& Group : Accepted | std::views::chunk_by([&](fuzzy_pair_t const& lhs, fuzzy_pair_t const& rhs) noexcept { return Missing[lhs.m_iMissing].m_File == Missing[rhs.m_iMissing].m_File; }))
+	{
+		auto const wcsMissingFile = Missing[Group.front().m_iMissing].m_File;
+
+		XMLDocument xml;
+		XMLElement* LanguageData = nullptr;
+
+		if (auto const f = _wfopen(wcsMissingFile.data(), L"rb"); f != nullptr)
+		{
+			xml.LoadFile(f);
+			fclose(f);
+
+			LanguageData = xml.FirstChildElement("LanguageData");
+		}
+		else	// new file
+		{
+			xml.InsertFirstChild(xml.NewDeclaration());
+			xml.SetBOM(true);
+
+			LanguageData = xml.NewElement("LanguageData");
+			xml.InsertEndChild(LanguageData);
+		}
+
+		LanguageData->InsertNewComment(fmt::format("Fuzzy merging at {:%Y-%m-%d}", ch::system_clock::now()).c_str());
+		Log::Print(ELogLevel::Info, Style::Info, "\nFuzzy matches for {}\n", fmt::styled(Path::RelativeToLang(wcsMissingFile), Style::Name));
+
+		for (auto&& [iMissing, iOrphan, flScore, bSameEnglish] : Group)
+		{
+			auto const& To = Missing[iMissing];
+			auto const& From = Orphans[iOrphan];
+
+			Log::Print(ELogLevel::Info, Style::Info, "[{}] <= [{}] from {}, {:.2f}", To.m_Identifier, From.m_Identifier, Path::RelativeToLang(From.m_File), flScore);
+			Log::Print(ELogLevel::Info, bSameEnglish ? Style::Positive : Style::Info, "{}\n", bSameEnglish ? " (same English)" : "");
+
+			LanguageData
+				->InsertNewChildElement(string{ To.m_Identifier }.c_str())
+				->SetText(string{ From.m_Text }.c_str());
+		}
+
+		if (bShouldWrite)
+		{
 #ifdef _DEBUG
-					xml.SaveFile(
-						fmt::format("{}\\{}{}", fs::path{ fs::_Parse_parent_path(wcsMissingFile) }, fs::path{ fs::_Parse_stem(wcsMissingFile) }, "_RWPHG_DEBUG.xml").c_str()
-					);
+			SaveXmlIfChanged(xml, fs::path{ fs::_Parse_parent_path(wcsMissingFile) } / (std::wstring{ fs::_Parse_stem(wcsMissingFile) } + L"_RWPHG_DEBUG.xml"));
 #else
-					if (auto const f = _wfopen(wcsMissingFile.data(), L"w"); f != nullptr)
-					{
-						xml.SaveFile(f);
-						fclose(f);
-					}
-					else
-						fmt::print(Style::Error, "[::FileMergingSuggestion] Unable to save file \"{}\"", fs::path{ wcsMissingFile });
+			SaveXmlIfChanged(xml, wcsMissingFile);
 #endif
-				}
-			}
 		}
 	}
+
+	Log::Print(
+		ELogLevel::Warning, Style::Positive, "\n{} of {} missing entries matched, {} candidate pair{} scored above {:.2f}.\n",
+		Accepted.size(), Missing.size(), Pairs.size(), Pairs.size() < 2 ? "" : "s", flThreshold
+	);
 }
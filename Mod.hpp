@@ -14,6 +14,14 @@
 #include <ranges>
 #endif
 
+#ifndef _SPAN_
+#include <span>
+#endif
+
+#ifndef _THREAD_
+#include <thread>
+#endif
+
 
 
 namespace Path
@@ -25,6 +33,9 @@ namespace Path
 	namespace Lang
 	{
 		inline path CRC;	// File
+		inline path LegacyCRC;	// File, XML form of the CRC records, migrated on load.
+		inline path SchemaCache;	// File
+		inline path ExtractionCache;	// File
 
 		inline path Directory;	// Dir
 		inline path DefInjected;// Dir
@@ -38,11 +49,31 @@ namespace Path
 		inline std::optional<path> Strings;	// Dir;
 	}
 
-	void Resolve(std::string_view path_to_mod, std::string_view target_lang) noexcept;
+	void Resolve(path const& path_to_mod, std::string_view target_lang) noexcept;
+	[[nodiscard]] path FromUtf8(std::string_view sz) noexcept;	// Narrow strings are taken in the code page of the system otherwise.
 	path RelativeToLang(path const& hPath) noexcept;
 	void ClearDebugFiles() noexcept;
 }
 
+namespace SchemaCache
+{
+	// Relative path and CRC64 of every assembly in mod, sorted.
+	using assembly_digests_t = std::vector<std::pair<std::string, uint64_t>>;
+
+	// Which one filled the classes. The two may not agree on every class, hence they never share a cache.
+	enum struct EReader : uint8_t
+	{
+		Metadata,
+		Reflection,
+	};
+
+	[[nodiscard]] assembly_digests_t DigestModAssemblies(std::filesystem::path const& ModDir = Path::ModDirectory) noexcept;
+	[[nodiscard]] std::vector<std::byte> Serialize(classinfo_dict_t const& dict) noexcept;
+	[[nodiscard]] uint64_t DigestVanillaClasses() noexcept;	// CRC64 of the content of gRimWorldClasses, computed once.
+	[[nodiscard]] bool Load(std::filesystem::path const& hFile, assembly_digests_t const& Digests, EReader Reader, classinfo_dict_t* pret) noexcept;
+	void Save(std::filesystem::path const& hFile, assembly_digests_t const& Digests, EReader Reader, classinfo_dict_t const& dict) noexcept;
+}
+
 struct sv_iless_t final
 {
 	using is_transparent = int;
@@ -71,10 +102,14 @@ struct sv_iless_t final
 inline constexpr auto cast_to_sv = [](auto&&... args) /*#UPDATE_AT_CPP23 static*/ noexcept { return std::string_view{ std::forward<decltype(args)>(args)... }; };
 inline constexpr auto as_string_view = std::views::transform(cast_to_sv);
 
-#include "RimWorldClasses.hpp" //inline classinfo_dict_t gRimWorldClasses;
+#include "RimWorldClasses.hpp" //inline constexpr static_classinfo_dict_t gRimWorldClasses;
 inline classinfo_dict_t gModClasses;
-inline sv_set_t gAllNamespaces{ std::from_range, gRimWorldClasses | std::views::values | std::views::transform(&class_info_t::m_Namespace) };
-inline constexpr classinfo_dict_t const* ALL_DICTS[] = { &gRimWorldClasses, &gModClasses, };
+inline sv_set_t gAllNamespaces;	// Vanilla ones are merged in along with the mod ones.
+
+inline uint32_t gJobs = std::max(std::thread::hardware_concurrency(), 1u);	// Worker count of the extraction stage. 1 for the serial path.
+inline bool gUseReflection = false;	// Fallback to CPPCLI.cpp in case the metadata reader misses something.
+inline bool gTranslationMemory = false;	// Set by -tm. New entries are filled with a translation of the same English from elsewhere in the language, if any.
+inline bool gResident = false;	// Set by -serve. Schemas and extraction caches of the mods served stay in memory between requests.
 
 inline void CheckStringForXML(std::string* s) noexcept
 {
@@ -87,6 +122,10 @@ inline void CheckStringForXML(std::string* s) noexcept
 	}
 }
 
-extern void ProcessMod() noexcept;
+[[nodiscard]] extern uint64_t CheckFileCRC(std::filesystem::path const& hPath) noexcept;	// Memoized for the whole run, keyed by path, size and last write time.
+extern void BuildClassLookupCache() noexcept;	// Must be called once gModClasses and gAllNamespaces are settled. gModClasses must not be altered afterwards.
+extern size_t ProcessMod(std::span<std::string_view const> OtherLangs = {}) noexcept;	// Sources are extracted once for the language resolved by Path::Resolve() and all the others. Returns the count of source entries.
+extern size_t ProcessWatchedMod(bool bFirstRun, bool bStringsChanged) noexcept;	// -watch, the language of Path::Resolve() only. After a full first run, only the sources altered since the last call are parsed, and only the localization files they feed are patched. Returns the count of files patched.
 extern void NoXRef() noexcept;
 extern void FileMergingSuggestion(bool bShouldWrite) noexcept;
+extern void FuzzyMergingSuggestion(float flThreshold, bool bShouldWrite) noexcept;	// flThreshold is the least similarity of names, 1 - distance / longer length.
@@ -1,656 +1,3321 @@
+#pragma once
+
+// Generated by CSharpExecutable. Do not edit.
+
 inline constexpr char RIMWORLD_ASSEMBLY_VERSION[] = "1.5.8909.13066";
 
-inline classinfo_dict_t const gRimWorldClasses
+namespace RimWorldSchema
 {
-	{ "RimWorld.AbilityCategoryDef"                                  , { "RimWorld"     , "AbilityCategoryDef"                                  , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.AbilityDef"                                          , { "RimWorld"     , "AbilityDef"                                          , "Verse.Def"                                              , { "confirmationDialogText", "label", "description", "ignoreConfigErrors" }, {}, { { "requiredMemes", "RimWorld.MemeDef" } }, { { "category", "RimWorld.AbilityCategoryDef" }, { "verbProperties", "Verse.VerbProperties" }, { "hotKey", "Verse.KeyBindingDef" }, { "jobDef", "Verse.JobDef" }, { "warmupMote", "Verse.ThingDef" }, { "warmupEffecter", "Verse.EffecterDef" }, { "emittedFleck", "Verse.FleckDef" }, { "warmupStartSound", "Verse.SoundDef" }, { "warmupSound", "Verse.SoundDef" }, { "warmupPreEndSound", "Verse.SoundDef" }, { "groupDef", "RimWorld.AbilityGroupDef" } }, }, },
-	{ "RimWorld.AbilityGroupDef"                                     , { "RimWorld"     , "AbilityGroupDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.AnomalyPlaystyleDef"                                 , { "RimWorld"     , "AnomalyPlaystyleDef"                                 , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.ApparelRequirement"                                  , { "RimWorld"     , "ApparelRequirement"                                  , ""                                                       , { "groupLabel" }, {}, { { "bodyPartGroupsMatchAny", "Verse.BodyPartGroupDef" }, { "requiredDefs", "Verse.ThingDef" } }, {}, }, },
-	{ "RimWorld.BabyPlayDef"                                         , { "RimWorld"     , "BabyPlayDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "jobDef", "Verse.JobDef" } }, }, },
-	{ "RimWorld.BackstoryDef"                                        , { "RimWorld"     , "BackstoryDef"                                        , "Verse.Def"                                              , { "title", "titleFemale", "titleShort", "titleShortFemale", "label", "description", "ignoreConfigErrors" }, {}, { { "cachedDisabledWorkTypes", "Verse.WorkTypeDef" } }, { { "bodyTypeGlobal", "RimWorld.BodyTypeDef" }, { "bodyTypeFemale", "RimWorld.BodyTypeDef" }, { "bodyTypeMale", "RimWorld.BodyTypeDef" }, { "nameMaker", "Verse.RulePackDef" } }, }, },
-	{ "RimWorld.BeardDef"                                            , { "RimWorld"     , "BeardDef"                                            , "RimWorld.StyleItemDef"                                  , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "overrideShaderTypeDef", "Verse.ShaderTypeDef" }, { "requiredGene", "Verse.GeneDef" }, { "requiredMutant", "RimWorld.MutantDef" } }, }, },
-	{ "RimWorld.BillRepeatModeDef"                                   , { "RimWorld"     , "BillRepeatModeDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.BillStoreModeDef"                                    , { "RimWorld"     , "BillStoreModeDef"                                    , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.BiomeDef"                                            , { "RimWorld"     , "BiomeDef"                                            , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "soundsAmbient", "Verse.SoundDef" }, { "allowedPackAnimals", "Verse.ThingDef" }, { "cachedWildPlants", "Verse.ThingDef" } }, { { "foragedFood", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.BodyTypeDef"                                         , { "RimWorld"     , "BodyTypeDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.BossDef"                                             , { "RimWorld"     , "BossDef"                                             , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "kindDef", "Verse.PawnKindDef" } }, }, },
-	{ "RimWorld.BossgroupDef"                                        , { "RimWorld"     , "BossgroupDef"                                        , "Verse.Def"                                              , { "leaderDescription", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "boss", "RimWorld.BossDef" }, { "quest", "RimWorld.QuestScriptDef" }, { "rewardDef", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.ChemicalDef"                                         , { "RimWorld"     , "ChemicalDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "addictionHediff", "Verse.HediffDef" }, { "toleranceHediff", "Verse.HediffDef" } }, }, },
-	{ "RimWorld.ColorDef"                                            , { "RimWorld"     , "ColorDef"                                            , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.ComplexLayoutDef"                                    , { "RimWorld"     , "ComplexLayoutDef"                                    , "RimWorld.LayoutDef"                                     , { "label", "description", "ignoreConfigErrors" }, {}, { { "roomDefs", "RimWorld.LayoutRoomDef" } }, { { "rewardThingSetMakerDef", "RimWorld.ThingSetMakerDef" } }, }, },
-	{ "RimWorld.ComplexThreatDef"                                    , { "RimWorld"     , "ComplexThreatDef"                                    , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "faction", "RimWorld.FactionDef" } }, }, },
-	{ "RimWorld.CompProperties_AbilityConvert"                       , { "RimWorld"     , "CompProperties_AbilityConvert"                       , "RimWorld.CompProperties_AbilityEffect"                  , { "successMessage", "failMessage" }, {}, {}, { { "failedThoughtInitiator", "RimWorld.ThoughtDef" }, { "failedThoughtRecipient", "RimWorld.ThoughtDef" }, { "clamorType", "Verse.ClamorDef" }, { "sound", "Verse.SoundDef" }, { "soundMale", "Verse.SoundDef" }, { "soundFemale", "Verse.SoundDef" }, { "messageType", "Verse.MessageTypeDef" } }, }, },
-	{ "RimWorld.CompProperties_AbilityCounsel"                       , { "RimWorld"     , "CompProperties_AbilityCounsel"                       , "RimWorld.CompProperties_AbilityEffect"                  , { "successMessage", "successMessageNoNegativeThought", "failMessage" }, {}, {}, { { "failedThoughtRecipient", "RimWorld.ThoughtDef" }, { "clamorType", "Verse.ClamorDef" }, { "sound", "Verse.SoundDef" }, { "soundMale", "Verse.SoundDef" }, { "soundFemale", "Verse.SoundDef" }, { "messageType", "Verse.MessageTypeDef" } }, }, },
-	{ "RimWorld.CompProperties_AbilityReassure"                      , { "RimWorld"     , "CompProperties_AbilityReassure"                      , "RimWorld.CompProperties_AbilityEffect"                  , { "successMessage" }, {}, {}, { { "clamorType", "Verse.ClamorDef" }, { "sound", "Verse.SoundDef" }, { "soundMale", "Verse.SoundDef" }, { "soundFemale", "Verse.SoundDef" }, { "messageType", "Verse.MessageTypeDef" } }, }, },
-	{ "RimWorld.CompProperties_Activity"                             , { "RimWorld"     , "CompProperties_Activity"                             , "Verse.CompProperties"                                   , { "letterTitle", "letterDesc" }, {}, {}, { { "letterDef", "Verse.LetterDef" } }, }, },
-	{ "RimWorld.CompProperties_Analyzable"                           , { "RimWorld"     , "CompProperties_Analyzable"                           , "RimWorld.CompProperties_Interactable"                   , { "progressedLetterLabel", "completedLetterLabel", "completedLetter", "repeatCompletedLetterLabel", "repeatCompletedLetter", "jobString", "activatingStringPending", "activatingString", "activateLabelString", "activateDescString", "guiLabelString", "onCooldownString", "inspectString", "messageCompletedString", "messageCooldownEnded" }, { "progressedLetters" }, {}, { { "progressedLetterDef", "Verse.LetterDef" }, { "completedLetterDef", "Verse.LetterDef" }, { "repeatCompletedLetterDef", "Verse.LetterDef" }, { "activateStat", "RimWorld.StatDef" }, { "fleckOnUsed", "Verse.FleckDef" }, { "cooldownFleck", "Verse.FleckDef" }, { "soundActivate", "Verse.SoundDef" }, { "interactionEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.CompProperties_ApparelReloadable"                    , { "RimWorld"     , "CompProperties_ApparelReloadable"                    , "RimWorld.CompProperties_ApparelVerbOwnerCharged"        , { "cooldownGerund", "chargeNoun" }, {}, {}, { { "ammoDef", "Verse.ThingDef" }, { "soundReload", "Verse.SoundDef" }, { "hotKey", "Verse.KeyBindingDef" } }, }, },
-	{ "RimWorld.CompProperties_ApparelVerbOwnerCharged"              , { "RimWorld"     , "CompProperties_ApparelVerbOwnerCharged"              , "RimWorld.CompProperties_ApparelVerbOwner"               , { "chargeNoun" }, {}, {}, { { "hotKey", "Verse.KeyBindingDef" } }, }, },
-	{ "RimWorld.CompProperties_AssignableToPawn"                     , { "RimWorld"     , "CompProperties_AssignableToPawn"                     , "Verse.CompProperties"                                   , { "noAssignablePawnsDesc" }, {}, {}, {}, }, },
-	{ "RimWorld.CompProperties_BiosculpterPod_AgeReversalCycle"      , { "RimWorld"     , "CompProperties_BiosculpterPod_AgeReversalCycle"      , "RimWorld.CompProperties_BiosculpterPod_BaseCycle"       , { "label", "description" }, {}, { { "requiredResearch", "Verse.ResearchProjectDef" } }, { { "gainThoughtOnCompletion", "RimWorld.ThoughtDef" } }, }, },
-	{ "RimWorld.CompProperties_BiosculpterPod_BaseCycle"             , { "RimWorld"     , "CompProperties_BiosculpterPod_BaseCycle"             , "Verse.CompProperties"                                   , { "label", "description" }, {}, { { "requiredResearch", "Verse.ResearchProjectDef" } }, { { "gainThoughtOnCompletion", "RimWorld.ThoughtDef" } }, }, },
-	{ "RimWorld.CompProperties_BiosculpterPod_HealingCycle"          , { "RimWorld"     , "CompProperties_BiosculpterPod_HealingCycle"          , "RimWorld.CompProperties_BiosculpterPod_BaseCycle"       , { "label", "description" }, {}, { { "bodyPartsToRestore", "Verse.BodyPartDef" }, { "conditionsToPossiblyCure", "Verse.HediffDef" }, { "requiredResearch", "Verse.ResearchProjectDef" } }, { { "gainThoughtOnCompletion", "RimWorld.ThoughtDef" } }, }, },
-	{ "RimWorld.CompProperties_BiosculpterPod_PleasureCycle"         , { "RimWorld"     , "CompProperties_BiosculpterPod_PleasureCycle"         , "RimWorld.CompProperties_BiosculpterPod_BaseCycle"       , { "label", "description" }, {}, { { "requiredResearch", "Verse.ResearchProjectDef" } }, { { "gainThoughtOnCompletion", "RimWorld.ThoughtDef" } }, }, },
-	{ "RimWorld.CompProperties_Chimera"                              , { "RimWorld"     , "CompProperties_Chimera"                              , "Verse.CompProperties"                                   , { "simpleAnimalLabel" }, {}, {}, {}, }, },
-	{ "RimWorld.CompProperties_CompAnalyzableBiosignature"           , { "RimWorld"     , "CompProperties_CompAnalyzableBiosignature"           , "RimWorld.CompProperties_Analyzable"                     , { "progressedLetterLabel", "completedLetterLabel", "completedLetter", "repeatCompletedLetterLabel", "repeatCompletedLetter", "jobString", "activatingStringPending", "activatingString", "activateLabelString", "activateDescString", "guiLabelString", "onCooldownString", "inspectString", "messageCompletedString", "messageCooldownEnded" }, { "progressedLetters" }, {}, { { "progressedLetterDef", "Verse.LetterDef" }, { "completedLetterDef", "Verse.LetterDef" }, { "repeatCompletedLetterDef", "Verse.LetterDef" }, { "activateStat", "RimWorld.StatDef" }, { "fleckOnUsed", "Verse.FleckDef" }, { "cooldownFleck", "Verse.FleckDef" }, { "soundActivate", "Verse.SoundDef" }, { "interactionEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.CompProperties_CompAnalyzableUnlockResearch"         , { "RimWorld"     , "CompProperties_CompAnalyzableUnlockResearch"         , "RimWorld.CompProperties_Analyzable"                     , { "progressedLetterLabel", "completedLetterLabel", "completedLetter", "repeatCompletedLetterLabel", "repeatCompletedLetter", "jobString", "activatingStringPending", "activatingString", "activateLabelString", "activateDescString", "guiLabelString", "onCooldownString", "inspectString", "messageCompletedString", "messageCooldownEnded" }, { "progressedLetters" }, {}, { { "progressedLetterDef", "Verse.LetterDef" }, { "completedLetterDef", "Verse.LetterDef" }, { "repeatCompletedLetterDef", "Verse.LetterDef" }, { "activateStat", "RimWorld.StatDef" }, { "fleckOnUsed", "Verse.FleckDef" }, { "cooldownFleck", "Verse.FleckDef" }, { "soundActivate", "Verse.SoundDef" }, { "interactionEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.CompProperties_DestroyAfterDelay"                    , { "RimWorld"     , "CompProperties_DestroyAfterDelay"                    , "Verse.CompProperties"                                   , { "countdownLabel" }, {}, {}, {}, }, },
-	{ "RimWorld.CompProperties_Devourer"                             , { "RimWorld"     , "CompProperties_Devourer"                             , "Verse.CompProperties"                                   , { "messageDigested", "messageEmerged", "messageEmergedCorpse", "messageDigestionCompleted", "digestingInspector" }, {}, {}, {}, }, },
-	{ "RimWorld.CompProperties_DisableUnnaturalCorpse"               , { "RimWorld"     , "CompProperties_DisableUnnaturalCorpse"               , "RimWorld.CompProperties_Interactable"                   , { "jobString", "activatingStringPending", "activatingString", "activateLabelString", "activateDescString", "guiLabelString", "onCooldownString", "inspectString", "messageCompletedString", "messageCooldownEnded" }, {}, {}, { { "activateStat", "RimWorld.StatDef" }, { "fleckOnUsed", "Verse.FleckDef" }, { "cooldownFleck", "Verse.FleckDef" }, { "soundActivate", "Verse.SoundDef" }, { "interactionEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.CompProperties_EquippableAbilityReloadable"          , { "RimWorld"     , "CompProperties_EquippableAbilityReloadable"          , "RimWorld.CompProperties_EquippableAbility"              , { "chargeNoun", "cooldownGerund" }, {}, {}, { { "ammoDef", "Verse.ThingDef" }, { "soundReload", "Verse.SoundDef" }, { "abilityDef", "RimWorld.AbilityDef" } }, }, },
-	{ "RimWorld.CompProperties_GiveThoughtToAllMapPawnsOnDestroy"    , { "RimWorld"     , "CompProperties_GiveThoughtToAllMapPawnsOnDestroy"    , "Verse.CompProperties"                                   , { "message" }, {}, {}, { { "thought", "RimWorld.ThoughtDef" } }, }, },
-	{ "RimWorld.CompProperties_GoldenCube"                           , { "RimWorld"     , "CompProperties_GoldenCube"                           , "RimWorld.CompProperties_Interactable"                   , { "letterDeactivatedLabel", "letterDeactivatedDesc", "letterDeactivatedAppend", "jobString", "activatingStringPending", "activatingString", "activateLabelString", "activateDescString", "guiLabelString", "onCooldownString", "inspectString", "messageCompletedString", "messageCooldownEnded" }, {}, {}, { { "activateStat", "RimWorld.StatDef" }, { "fleckOnUsed", "Verse.FleckDef" }, { "cooldownFleck", "Verse.FleckDef" }, { "soundActivate", "Verse.SoundDef" }, { "interactionEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.CompProperties_GrayStatue"                           , { "RimWorld"     , "CompProperties_GrayStatue"                           , "Verse.CompProperties"                                   , { "letterLabel", "letterText" }, {}, {}, { { "letterDef", "Verse.LetterDef" } }, }, },
-	{ "RimWorld.CompProperties_GrayStatueGas"                        , { "RimWorld"     , "CompProperties_GrayStatueGas"                        , "RimWorld.CompProperties_GrayStatue"                     , { "letterLabel", "letterText" }, {}, {}, { { "letterDef", "Verse.LetterDef" } }, }, },
-	{ "RimWorld.CompProperties_GrayStatueTeleporter"                 , { "RimWorld"     , "CompProperties_GrayStatueTeleporter"                 , "RimWorld.CompProperties_GrayStatue"                     , { "letterLabel", "letterText" }, {}, {}, { { "letterDef", "Verse.LetterDef" } }, }, },
-	{ "RimWorld.CompProperties_HasSources"                           , { "RimWorld"     , "CompProperties_HasSources"                           , "Verse.CompProperties"                                   , { "inspectStringLabel" }, {}, {}, {}, }, },
-	{ "RimWorld.CompProperties_HoldingPlatformTarget"                , { "RimWorld"     , "CompProperties_HoldingPlatformTarget"                , "Verse.CompProperties"                                   , { "capturedLetterLabel", "capturedLetterText" }, {}, {}, { { "heldPawnKind", "Verse.PawnKindDef" } }, }, },
-	{ "RimWorld.CompProperties_InspectString"                        , { "RimWorld"     , "CompProperties_InspectString"                        , "Verse.CompProperties"                                   , { "inspectString" }, {}, {}, {}, }, },
-	{ "RimWorld.CompProperties_InspectStringStatValue"               , { "RimWorld"     , "CompProperties_InspectStringStatValue"               , "RimWorld.CompProperties_InspectString"                  , { "inspectString" }, {}, {}, { { "stat", "RimWorld.StatDef" } }, }, },
-	{ "RimWorld.CompProperties_Interactable"                         , { "RimWorld"     , "CompProperties_Interactable"                         , "Verse.CompProperties"                                   , { "jobString", "activatingStringPending", "activatingString", "activateLabelString", "activateDescString", "guiLabelString", "onCooldownString", "inspectString", "messageCompletedString", "messageCooldownEnded" }, {}, {}, { { "activateStat", "RimWorld.StatDef" }, { "fleckOnUsed", "Verse.FleckDef" }, { "cooldownFleck", "Verse.FleckDef" }, { "soundActivate", "Verse.SoundDef" }, { "interactionEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.CompProperties_LabyrinthDoor"                        , { "RimWorld"     , "CompProperties_LabyrinthDoor"                        , "RimWorld.CompProperties_Interactable"                   , { "jobString", "activatingStringPending", "activatingString", "activateLabelString", "activateDescString", "guiLabelString", "onCooldownString", "inspectString", "messageCompletedString", "messageCooldownEnded" }, {}, {}, { { "activateStat", "RimWorld.StatDef" }, { "fleckOnUsed", "Verse.FleckDef" }, { "cooldownFleck", "Verse.FleckDef" }, { "soundActivate", "Verse.SoundDef" }, { "interactionEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.CompProperties_LeavingsLetter"                       , { "RimWorld"     , "CompProperties_LeavingsLetter"                       , "Verse.CompProperties"                                   , { "letterLabel", "letterText" }, {}, {}, { { "letterDef", "Verse.LetterDef" }, { "leavingsFilter", "Verse.ThingFilter" } }, }, },
-	{ "RimWorld.CompProperties_MechPowerCell"                        , { "RimWorld"     , "CompProperties_MechPowerCell"                        , "Verse.CompProperties"                                   , { "labelOverride", "tooltipOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.CompProperties_NeuralSupercharger"                   , { "RimWorld"     , "CompProperties_NeuralSupercharger"                   , "RimWorld.CompProperties_Rechargeable"                   , { "jobString" }, {}, {}, { { "effectCharged", "Verse.EffecterDef" }, { "chargedSoundDef", "Verse.SoundDef" }, { "dischargeSoundDef", "Verse.SoundDef" } }, }, },
-	{ "RimWorld.CompProperties_Nociosphere"                          , { "RimWorld"     , "CompProperties_Nociosphere"                          , "RimWorld.CompProperties_Interactable"                   , { "onslaughtInspectText", "becomingUnstableInspectText", "unstableInspectText", "unstableWarning", "leftLetterLabel", "leftLetterText", "onslaughtEndedMessage", "departingMessage", "jobString", "activatingStringPending", "activatingString", "activateLabelString", "activateDescString", "guiLabelString", "onCooldownString", "inspectString", "messageCompletedString", "messageCooldownEnded" }, {}, {}, { { "activateStat", "RimWorld.StatDef" }, { "fleckOnUsed", "Verse.FleckDef" }, { "cooldownFleck", "Verse.FleckDef" }, { "soundActivate", "Verse.SoundDef" }, { "interactionEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.CompProperties_ObeliskDeactivationInteractor"        , { "RimWorld"     , "CompProperties_ObeliskDeactivationInteractor"        , "RimWorld.CompProperties_Interactable"                   , { "jobString", "activatingStringPending", "activatingString", "activateLabelString", "activateDescString", "guiLabelString", "onCooldownString", "inspectString", "messageCompletedString", "messageCooldownEnded" }, {}, {}, { { "activateStat", "RimWorld.StatDef" }, { "fleckOnUsed", "Verse.FleckDef" }, { "cooldownFleck", "Verse.FleckDef" }, { "soundActivate", "Verse.SoundDef" }, { "interactionEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.CompProperties_ObeliskLabyrinth"                     , { "RimWorld"     , "CompProperties_ObeliskLabyrinth"                     , "RimWorld.CompProperties_Interactable"                   , { "messageActivating", "jobString", "activatingStringPending", "activatingString", "activateLabelString", "activateDescString", "guiLabelString", "onCooldownString", "inspectString", "messageCompletedString", "messageCooldownEnded" }, {}, {}, { { "activateStat", "RimWorld.StatDef" }, { "fleckOnUsed", "Verse.FleckDef" }, { "cooldownFleck", "Verse.FleckDef" }, { "soundActivate", "Verse.SoundDef" }, { "interactionEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.CompProperties_ObeliskTriggerInteractor"             , { "RimWorld"     , "CompProperties_ObeliskTriggerInteractor"             , "RimWorld.CompProperties_Interactable"                   , { "jobString", "activatingStringPending", "activatingString", "activateLabelString", "activateDescString", "guiLabelString", "onCooldownString", "inspectString", "messageCompletedString", "messageCooldownEnded" }, {}, {}, { { "activateStat", "RimWorld.StatDef" }, { "fleckOnUsed", "Verse.FleckDef" }, { "cooldownFleck", "Verse.FleckDef" }, { "soundActivate", "Verse.SoundDef" }, { "interactionEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.CompProperties_ProximityLetter"                      , { "RimWorld"     , "CompProperties_ProximityLetter"                      , "Verse.CompProperties"                                   , { "letterLabel", "letterText" }, {}, {}, { { "letterDef", "Verse.LetterDef" } }, }, },
-	{ "RimWorld.CompProperties_Refuelable"                           , { "RimWorld"     , "CompProperties_Refuelable"                           , "Verse.CompProperties"                                   , { "fuelLabel", "fuelGizmoLabel", "outOfFuelMessage" }, {}, {}, { { "fuelFilter", "Verse.ThingFilter" } }, }, },
-	{ "RimWorld.CompProperties_Schedule"                             , { "RimWorld"     , "CompProperties_Schedule"                             , "Verse.CompProperties"                                   , { "offMessage" }, {}, {}, {}, }, },
-	{ "RimWorld.CompProperties_StatEntry"                            , { "RimWorld"     , "CompProperties_StatEntry"                            , "Verse.CompProperties"                                   , { "statLabel", "reportText" }, {}, {}, { { "statCategoryDef", "RimWorld.StatCategoryDef" } }, }, },
-	{ "RimWorld.CompProperties_StopManhunter"                        , { "RimWorld"     , "CompProperties_StopManhunter"                        , "RimWorld.CompProperties_AbilityEffect"                  , { "successMessage" }, {}, {}, { { "clamorType", "Verse.ClamorDef" }, { "sound", "Verse.SoundDef" }, { "soundMale", "Verse.SoundDef" }, { "soundFemale", "Verse.SoundDef" }, { "messageType", "Verse.MessageTypeDef" } }, }, },
-	{ "RimWorld.CompProperties_Studiable"                            , { "RimWorld"     , "CompProperties_Studiable"                            , "Verse.CompProperties"                                   , { "completedLetterTitle", "completedLetterText", "completedMessage" }, {}, {}, { { "knowledgeCategory", "RimWorld.KnowledgeCategoryDef" }, { "completedLetterDef", "Verse.LetterDef" } }, }, },
-	{ "RimWorld.CompProperties_StudiableMonolith"                    , { "RimWorld"     , "CompProperties_StudiableMonolith"                    , "RimWorld.CompProperties_Studiable"                      , { "completedLetterTitle", "completedLetterText", "completedMessage" }, {}, {}, { { "knowledgeCategory", "RimWorld.KnowledgeCategoryDef" }, { "completedLetterDef", "Verse.LetterDef" } }, }, },
-	{ "RimWorld.CompProperties_TempControl"                          , { "RimWorld"     , "CompProperties_TempControl"                          , "Verse.CompProperties"                                   , { "inspectString" }, {}, {}, {}, }, },
-	{ "RimWorld.CompProperties_Transmute"                            , { "RimWorld"     , "CompProperties_Transmute"                            , "RimWorld.CompProperties_AbilityEffect"                  , { "failedMessage" }, {}, { { "outcomeItems", "Verse.ThingDef" }, { "outcomeStuff", "Verse.ThingDef" } }, { { "clamorType", "Verse.ClamorDef" }, { "sound", "Verse.SoundDef" }, { "soundMale", "Verse.SoundDef" }, { "soundFemale", "Verse.SoundDef" }, { "messageType", "Verse.MessageTypeDef" } }, }, },
-	{ "RimWorld.CompProperties_Usable"                               , { "RimWorld"     , "CompProperties_Usable"                               , "Verse.CompProperties"                                   , { "useLabel", "useMessage" }, {}, { { "allowedMutants", "RimWorld.MutantDef" } }, { { "useJob", "Verse.JobDef" }, { "userMustHaveHediff", "Verse.HediffDef" }, { "floatMenuFactionIcon", "RimWorld.FactionDef" }, { "warmupMote", "Verse.ThingDef" }, { "finalizeMote", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.ConceptDef"                                          , { "RimWorld"     , "ConceptDef"                                          , "Verse.Def"                                              , { "helpText", "helpTextController", "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.CultureDef"                                          , { "RimWorld"     , "CultureDef"                                          , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "pawnNameMaker", "Verse.RulePackDef" }, { "pawnNameMakerFemale", "Verse.RulePackDef" }, { "ideoNameMaker", "Verse.RulePackDef" }, { "deityNameMaker", "Verse.RulePackDef" }, { "deityTypeMaker", "Verse.RulePackDef" }, { "leaderTitleMaker", "Verse.RulePackDef" }, { "festivalNameMaker", "Verse.RulePackDef" } }, }, },
-	{ "RimWorld.DebugTabMenuDef"                                     , { "RimWorld"     , "DebugTabMenuDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.DeityNameType"                                       , { "RimWorld"     , "DeityNameType"                                       , ""                                                       , { "type" }, {}, {}, {}, }, },
-	{ "RimWorld.DifficultyDef"                                       , { "RimWorld"     , "DifficultyDef"                                       , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.DrugPolicyDef"                                       , { "RimWorld"     , "DrugPolicyDef"                                       , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.EntityCategoryDef"                                   , { "RimWorld"     , "EntityCategoryDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.EntityCodexEntryDef"                                 , { "RimWorld"     , "EntityCodexEntryDef"                                 , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "linkedThings", "Verse.ThingDef" }, { "linkedIncidents", "RimWorld.IncidentDef" }, { "discoveredResearchProjects", "Verse.ResearchProjectDef" }, { "provocationIncidents", "RimWorld.IncidentDef" }, { "hideInPlaystyles", "RimWorld.AnomalyPlaystyleDef" } }, { { "category", "RimWorld.EntityCategoryDef" }, { "useDescriptionFrom", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.ExpansionDef"                                        , { "RimWorld"     , "ExpansionDef"                                        , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.ExpectationDef"                                      , { "RimWorld"     , "ExpectationDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.FactionDef"                                          , { "RimWorld"     , "FactionDef"                                          , "Verse.Def"                                              , { "fixedName", "pawnSingular", "pawnsPlural", "leaderTitle", "leaderTitleFemale", "royalFavorLabel", "ideoDescription", "label", "description", "ignoreConfigErrors" }, {}, { { "startingResearchTags", "Verse.ResearchProjectTagDef" }, { "startingTechprintsResearchTags", "Verse.ResearchProjectTagDef" }, { "fixedLeaderKinds", "Verse.PawnKindDef" }, { "caravanTraderKinds", "RimWorld.TraderKindDef" }, { "visitorTraderKinds", "RimWorld.TraderKindDef" }, { "baseTraderKinds", "RimWorld.TraderKindDef" }, { "disallowedRaidStrategies", "RimWorld.RaidStrategyDef" }, { "disallowedRaidAgeRestrictions", "RimWorld.RaidAgeRestrictionDef" }, { "permanentEnemyToEveryoneExcept", "RimWorld.FactionDef" }, { "royalTitleInheritanceRelations", "RimWorld.PawnRelationDef" }, { "allowedCultures", "RimWorld.CultureDef" }, { "requiredMemes", "RimWorld.MemeDef" }, { "allowedMemes", "RimWorld.MemeDef" }, { "disallowedMemes", "RimWorld.MemeDef" }, { "disallowedPrecepts", "RimWorld.PreceptDef" }, { "styles", "Verse.StyleCategoryDef" }, { "forcedMemes", "RimWorld.MemeDef" }, { "royalTitlesAwardableInSeniorityOrderForReading", "RimWorld.RoyalTitleDef" }, { "royalTitlesAllInSeniorityOrderForReading", "RimWorld.RoyalTitleDef" } }, { { "factionNameMaker", "Verse.RulePackDef" }, { "settlementNameMaker", "Verse.RulePackDef" }, { "playerInitialSettlementNameMaker", "Verse.RulePackDef" }, { "basicMemberKind", "Verse.PawnKindDef" }, { "dropPodActive", "Verse.ThingDef" }, { "dropPodIncoming", "Verse.ThingDef" }, { "replacesFaction", "RimWorld.FactionDef" }, { "apparelStuffFilter", "Verse.ThingFilter" }, { "raidLootMaker", "RimWorld.ThingSetMakerDef" } }, }, },
-	{ "RimWorld.FeatureDef"                                          , { "RimWorld"     , "FeatureDef"                                          , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "rootBiomes", "RimWorld.BiomeDef" }, { "acceptableBiomes", "RimWorld.BiomeDef" } }, { { "nameMaker", "Verse.RulePackDef" } }, }, },
-	{ "RimWorld.FleshTypeDef"                                        , { "RimWorld"     , "FleshTypeDef"                                        , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "ateDirect", "RimWorld.ThoughtDef" }, { "ateAsIngredient", "RimWorld.ThoughtDef" }, { "corpseCategory", "Verse.ThingCategoryDef" }, { "damageEffecter", "Verse.EffecterDef" } }, }, },
-	{ "RimWorld.FurDef"                                              , { "RimWorld"     , "FurDef"                                              , "RimWorld.StyleItemDef"                                  , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "overrideShaderTypeDef", "Verse.ShaderTypeDef" }, { "requiredGene", "Verse.GeneDef" }, { "requiredMutant", "RimWorld.MutantDef" } }, }, },
-	{ "RimWorld.GatheringDef"                                        , { "RimWorld"     , "GatheringDef"                                        , "Verse.Def"                                              , { "letterTitle", "letterText", "calledOffMessage", "finishedMessage", "label", "description", "ignoreConfigErrors" }, {}, { { "gatherSpotDefs", "Verse.ThingDef" }, { "requiredTitleAny", "RimWorld.RoyalTitleDef" } }, { { "duty", "Verse.AI.DutyDef" } }, }, },
-	{ "RimWorld.GauranlenTreeModeDef"                                , { "RimWorld"     , "GauranlenTreeModeDef"                                , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "requiredMemes", "RimWorld.MemeDef" }, { "displayedStats", "RimWorld.StatDef" } }, { { "previousStage", "RimWorld.GauranlenTreeModeDef" }, { "pawnKindDef", "Verse.PawnKindDef" } }, }, },
-	{ "RimWorld.GeneTemplateDef"                                     , { "RimWorld"     , "GeneTemplateDef"                                     , "Verse.Def"                                              , { "labelShortAdj", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "displayCategory", "Verse.GeneCategoryDef" } }, }, },
-	{ "RimWorld.GoodwillSituationDef"                                , { "RimWorld"     , "GoodwillSituationDef"                                , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "meme", "RimWorld.MemeDef" }, { "otherMeme", "RimWorld.MemeDef" } }, }, },
-	{ "RimWorld.HairDef"                                             , { "RimWorld"     , "HairDef"                                             , "RimWorld.StyleItemDef"                                  , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "overrideShaderTypeDef", "Verse.ShaderTypeDef" }, { "requiredGene", "Verse.GeneDef" }, { "requiredMutant", "RimWorld.MutantDef" } }, }, },
-	{ "RimWorld.HediffGiverSetDef"                                   , { "RimWorld"     , "HediffGiverSetDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.HibernatableStateDef"                                , { "RimWorld"     , "HibernatableStateDef"                                , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.HistoryAutoRecorderDef"                              , { "RimWorld"     , "HistoryAutoRecorderDef"                              , "Verse.Def"                                              , { "graphLabelY", "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.HistoryAutoRecorderGroupDef"                         , { "RimWorld"     , "HistoryAutoRecorderGroupDef"                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "historyAutoRecorderDefs", "RimWorld.HistoryAutoRecorderDef" } }, {}, }, },
-	{ "RimWorld.HistoryEventDef"                                     , { "RimWorld"     , "HistoryEventDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.IdeoColorDef"                                        , { "RimWorld"     , "IdeoColorDef"                                        , "RimWorld.IdeoSymbolPartDef"                             , { "label", "description", "ignoreConfigErrors" }, {}, { { "memes", "RimWorld.MemeDef" }, { "cultures", "RimWorld.CultureDef" } }, { { "colorDef", "RimWorld.ColorDef" } }, }, },
-	{ "RimWorld.IdeoFoundationDef"                                   , { "RimWorld"     , "IdeoFoundationDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.IdeoIconDef"                                         , { "RimWorld"     , "IdeoIconDef"                                         , "RimWorld.IdeoSymbolPartDef"                             , { "label", "description", "ignoreConfigErrors" }, {}, { { "memes", "RimWorld.MemeDef" }, { "cultures", "RimWorld.CultureDef" } }, {}, }, },
-	{ "RimWorld.IdeoPresetCategoryDef"                               , { "RimWorld"     , "IdeoPresetCategoryDef"                               , "Verse.Def"                                              , { "groupLabel", "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.IdeoPresetDef"                                       , { "RimWorld"     , "IdeoPresetDef"                                       , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "memes", "RimWorld.MemeDef" } }, { { "categoryDef", "RimWorld.IdeoPresetCategoryDef" } }, }, },
-	{ "RimWorld.IdeoSymbolPack"                                      , { "RimWorld"     , "IdeoSymbolPack"                                      , ""                                                       , { "ideoName", "theme", "adjective", "member" }, {}, {}, {}, }, },
-	{ "RimWorld.IdeoSymbolPartDef"                                   , { "RimWorld"     , "IdeoSymbolPartDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "memes", "RimWorld.MemeDef" }, { "cultures", "RimWorld.CultureDef" } }, {}, }, },
-	{ "RimWorld.IncidentCategoryDef"                                 , { "RimWorld"     , "IncidentCategoryDef"                                 , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "tale", "RimWorld.TaleDef" } }, }, },
-	{ "RimWorld.IncidentDef"                                         , { "RimWorld"     , "IncidentDef"                                         , "Verse.Def"                                              , { "letterText", "letterLabel", "diseaseLethalLetterText", "label", "description", "ignoreConfigErrors" }, {}, { { "targetTags", "RimWorld.IncidentTargetTagDef" }, { "allowedBiomes", "RimWorld.BiomeDef" }, { "disallowedBiomes", "RimWorld.BiomeDef" }, { "letterHyperlinkHediffDefs", "Verse.HediffDef" }, { "diseasePartsToAffect", "Verse.BodyPartDef" }, { "cachedRefireCheckIncidents", "RimWorld.IncidentDef" } }, { { "category", "RimWorld.IncidentCategoryDef" }, { "tale", "RimWorld.TaleDef" }, { "codexEntry", "RimWorld.EntityCodexEntryDef" }, { "letterDef", "Verse.LetterDef" }, { "pawnKind", "Verse.PawnKindDef" }, { "pawnHediff", "Verse.HediffDef" }, { "gameCondition", "Verse.GameConditionDef" }, { "diseaseIncident", "Verse.HediffDef" }, { "mechClusterBuilding", "Verse.ThingDef" }, { "questScriptDef", "RimWorld.QuestScriptDef" }, { "treeDef", "Verse.ThingDef" }, { "treeGenStepDef", "Verse.GenStepDef" } }, }, },
-	{ "RimWorld.IncidentTargetTagDef"                                , { "RimWorld"     , "IncidentTargetTagDef"                                , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.InfectionPathwayDef"                                 , { "RimWorld"     , "InfectionPathwayDef"                                 , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.IngestibleProperties"                                , { "RimWorld"     , "IngestibleProperties"                                , ""                                                       , { "ingestCommandString", "ingestReportString", "ingestReportStringEat" }, {}, {}, { { "parent", "Verse.ThingDef" }, { "tasteThought", "RimWorld.ThoughtDef" }, { "specialThoughtDirect", "RimWorld.ThoughtDef" }, { "specialThoughtAsIngredient", "RimWorld.ThoughtDef" }, { "ateEvent", "RimWorld.HistoryEventDef" }, { "ingestEffect", "Verse.EffecterDef" }, { "ingestEffectEat", "Verse.EffecterDef" }, { "ingestSound", "Verse.SoundDef" }, { "joyKind", "RimWorld.JoyKindDef" }, { "sourceDef", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.InspirationDef"                                      , { "RimWorld"     , "InspirationDef"                                      , "Verse.Def"                                              , { "beginLetter", "beginLetterLabel", "endMessage", "baseInspectLine", "label", "description", "ignoreConfigErrors" }, {}, { { "requiredNonDisabledStats", "RimWorld.StatDef" }, { "requiredNonDisabledWorkTypes", "Verse.WorkTypeDef" }, { "requiredAnyNonDisabledWorkType", "Verse.WorkTypeDef" }, { "requiredCapacities", "Verse.PawnCapacityDef" }, { "associatedSkills", "RimWorld.SkillDef" } }, { { "beginLetterDef", "Verse.LetterDef" } }, }, },
-	{ "RimWorld.InstructionDef"                                      , { "RimWorld"     , "InstructionDef"                                      , "Verse.Def"                                              , { "text", "textController", "rejectInputMessage", "onMapInstruction", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "eventTagInitiateSource", "RimWorld.InstructionDef" }, { "concept", "RimWorld.ConceptDef" }, { "thingDef", "Verse.ThingDef" }, { "recipeDef", "Verse.RecipeDef" }, { "giveOnActivateDef", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.InteractionDef"                                      , { "RimWorld"     , "InteractionDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "interactionMote", "Verse.ThingDef" }, { "initiatorThought", "RimWorld.ThoughtDef" }, { "initiatorXpGainSkill", "RimWorld.SkillDef" }, { "recipientThought", "RimWorld.ThoughtDef" }, { "recipientXpGainSkill", "RimWorld.SkillDef" }, { "logRulesInitiator", "Verse.Grammar.RulePack" }, { "logRulesRecipient", "Verse.Grammar.RulePack" } }, }, },
-	{ "RimWorld.IssueDef"                                            , { "RimWorld"     , "IssueDef"                                            , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AcceptRole"                                 , { "RimWorld"     , "JobGiver_AcceptRole"                                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "soundDefMale", "Verse.SoundDef" }, { "soundDefFemale", "Verse.SoundDef" } }, }, },
-	{ "RimWorld.JobGiver_ActivityDormant"                            , { "RimWorld"     , "JobGiver_ActivityDormant"                            , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIAbilityFight"                             , { "RimWorld"     , "JobGiver_AIAbilityFight"                             , "RimWorld.JobGiver_AIFightEnemy"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "ability", "RimWorld.AbilityDef" } }, }, },
-	{ "RimWorld.JobGiver_AIBreaching"                                , { "RimWorld"     , "JobGiver_AIBreaching"                                , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AICastAbility"                              , { "RimWorld"     , "JobGiver_AICastAbility"                              , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "ability", "RimWorld.AbilityDef" } }, }, },
-	{ "RimWorld.JobGiver_AICastAbilityOnSelf"                        , { "RimWorld"     , "JobGiver_AICastAbilityOnSelf"                        , "RimWorld.JobGiver_AICastAbility"                        , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "ability", "RimWorld.AbilityDef" } }, }, },
-	{ "RimWorld.JobGiver_AICastAnimalWarcall"                        , { "RimWorld"     , "JobGiver_AICastAnimalWarcall"                        , "RimWorld.JobGiver_AICastAbility"                        , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "ability", "RimWorld.AbilityDef" } }, }, },
-	{ "RimWorld.JobGiver_AIDefendEscortee"                           , { "RimWorld"     , "JobGiver_AIDefendEscortee"                           , "RimWorld.JobGiver_AIDefendPawn"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIDefendMaster"                             , { "RimWorld"     , "JobGiver_AIDefendMaster"                             , "RimWorld.JobGiver_AIDefendPawn"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIDefendOverseer"                           , { "RimWorld"     , "JobGiver_AIDefendOverseer"                           , "RimWorld.JobGiver_AIDefendPawn"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIDefendPawn"                               , { "RimWorld"     , "JobGiver_AIDefendPawn"                               , "RimWorld.JobGiver_AIFightEnemy"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIDefendPoint"                              , { "RimWorld"     , "JobGiver_AIDefendPoint"                              , "RimWorld.JobGiver_AIFightEnemy"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIDefendSelf"                               , { "RimWorld"     , "JobGiver_AIDefendSelf"                               , "RimWorld.JobGiver_AIDefendPawn"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIFightEnemies"                             , { "RimWorld"     , "JobGiver_AIFightEnemies"                             , "RimWorld.JobGiver_AIFightEnemy"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIFightEnemy"                               , { "RimWorld"     , "JobGiver_AIFightEnemy"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIFollowEscortee"                           , { "RimWorld"     , "JobGiver_AIFollowEscortee"                           , "RimWorld.JobGiver_AIFollowPawn"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIFollowMaster"                             , { "RimWorld"     , "JobGiver_AIFollowMaster"                             , "RimWorld.JobGiver_AIFollowPawn"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIFollowOverseer"                           , { "RimWorld"     , "JobGiver_AIFollowOverseer"                           , "RimWorld.JobGiver_AIFollowPawn"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIFollowPawn"                               , { "RimWorld"     , "JobGiver_AIFollowPawn"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIGotoNearestHostile"                       , { "RimWorld"     , "JobGiver_AIGotoNearestHostile"                       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIJumpEscapeEnemies"                        , { "RimWorld"     , "JobGiver_AIJumpEscapeEnemies"                        , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "ability", "RimWorld.AbilityDef" } }, }, },
-	{ "RimWorld.JobGiver_AIJumpToJobRescueTarget"                    , { "RimWorld"     , "JobGiver_AIJumpToJobRescueTarget"                    , "RimWorld.JobGiver_AIJumpToJobTarget"                    , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "ability", "RimWorld.AbilityDef" } }, }, },
-	{ "RimWorld.JobGiver_AIJumpToJobTarget"                          , { "RimWorld"     , "JobGiver_AIJumpToJobTarget"                          , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "ability", "RimWorld.AbilityDef" } }, }, },
-	{ "RimWorld.JobGiver_AIReleaseMechs"                             , { "RimWorld"     , "JobGiver_AIReleaseMechs"                             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIResurrectTarget"                          , { "RimWorld"     , "JobGiver_AIResurrectTarget"                          , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "ability", "RimWorld.AbilityDef" } }, }, },
-	{ "RimWorld.JobGiver_AISapper"                                   , { "RimWorld"     , "JobGiver_AISapper"                                   , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AISkipToJobTarget"                          , { "RimWorld"     , "JobGiver_AISkipToJobTarget"                          , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "ability", "RimWorld.AbilityDef" } }, }, },
-	{ "RimWorld.JobGiver_AITrashBuildingsDistant"                    , { "RimWorld"     , "JobGiver_AITrashBuildingsDistant"                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AITrashColonyClose"                         , { "RimWorld"     , "JobGiver_AITrashColonyClose"                         , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AITrashDutyFocus"                           , { "RimWorld"     , "JobGiver_AITrashDutyFocus"                           , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIWaitAmbush"                               , { "RimWorld"     , "JobGiver_AIWaitAmbush"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AIWaitWithOverseer"                         , { "RimWorld"     , "JobGiver_AIWaitWithOverseer"                         , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AnimalFlee"                                 , { "RimWorld"     , "JobGiver_AnimalFlee"                                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_AnimaLinking"                               , { "RimWorld"     , "JobGiver_AnimaLinking"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Autofeed"                                   , { "RimWorld"     , "JobGiver_Autofeed"                                   , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Berserk"                                    , { "RimWorld"     , "JobGiver_Berserk"                                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Berserk_Warcall"                            , { "RimWorld"     , "JobGiver_Berserk_Warcall"                            , "RimWorld.JobGiver_Berserk"                              , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_BestowingCeremony"                          , { "RimWorld"     , "JobGiver_BestowingCeremony"                          , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Binge"                                      , { "RimWorld"     , "JobGiver_Binge"                                      , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_BingeDrug"                                  , { "RimWorld"     , "JobGiver_BingeDrug"                                  , "RimWorld.JobGiver_Binge"                                , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_BingeFood"                                  , { "RimWorld"     , "JobGiver_BingeFood"                                  , "RimWorld.JobGiver_Binge"                                , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Blind"                                      , { "RimWorld"     , "JobGiver_Blind"                                      , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_BringBabyToSafety"                          , { "RimWorld"     , "JobGiver_BringBabyToSafety"                          , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ChimeraAttackNearbyHumans"                  , { "RimWorld"     , "JobGiver_ChimeraAttackNearbyHumans"                  , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ConcertOrganizerPlayInstrument"             , { "RimWorld"     , "JobGiver_ConcertOrganizerPlayInstrument"             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ConfigurableHostilityResponse"              , { "RimWorld"     , "JobGiver_ConfigurableHostilityResponse"              , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_CreateAndEnterCocoon"                       , { "RimWorld"     , "JobGiver_CreateAndEnterCocoon"                       , "RimWorld.JobGiver_CreateAndEnterDryadHolder"            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_CreateAndEnterDryadHolder"                  , { "RimWorld"     , "JobGiver_CreateAndEnterDryadHolder"                  , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_CreateAndEnterHealingPod"                   , { "RimWorld"     , "JobGiver_CreateAndEnterHealingPod"                   , "RimWorld.JobGiver_CreateAndEnterDryadHolder"            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_CubeSculpting"                              , { "RimWorld"     , "JobGiver_CubeSculpting"                              , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Dance"                                      , { "RimWorld"     , "JobGiver_Dance"                                      , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_DeliverPawnToAltar"                         , { "RimWorld"     , "JobGiver_DeliverPawnToAltar"                         , "RimWorld.JobGiver_GotoTravelDestination"                , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "jobDef", "Verse.JobDef" } }, }, },
-	{ "RimWorld.JobGiver_DeliverPawnToBed"                           , { "RimWorld"     , "JobGiver_DeliverPawnToBed"                           , "RimWorld.JobGiver_GotoTravelDestination"                , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "jobDef", "Verse.JobDef" } }, }, },
-	{ "RimWorld.JobGiver_DeliverPawnToCell"                          , { "RimWorld"     , "JobGiver_DeliverPawnToCell"                          , "RimWorld.JobGiver_GotoTravelDestination"                , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "jobDef", "Verse.JobDef" } }, }, },
-	{ "RimWorld.JobGiver_DeliverPawnToPsychicRitualCell"             , { "RimWorld"     , "JobGiver_DeliverPawnToPsychicRitualCell"             , "RimWorld.JobGiver_DeliverPawnToCell"                    , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "jobDef", "Verse.JobDef" } }, }, },
-	{ "RimWorld.JobGiver_DoLovin"                                    , { "RimWorld"     , "JobGiver_DoLovin"                                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_DropRandomGearOrApparel"                    , { "RimWorld"     , "JobGiver_DropRandomGearOrApparel"                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_DropUnusedInventory"                        , { "RimWorld"     , "JobGiver_DropUnusedInventory"                        , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_DropWeapon"                                 , { "RimWorld"     , "JobGiver_DropWeapon"                                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Duel"                                       , { "RimWorld"     , "JobGiver_Duel"                                       , "RimWorld.JobGiver_AIFightEnemies"                       , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_DuelPickupWeapon"                           , { "RimWorld"     , "JobGiver_DuelPickupWeapon"                           , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_DyeHair"                                    , { "RimWorld"     , "JobGiver_DyeHair"                                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_EatAtCannibalPlatter"                       , { "RimWorld"     , "JobGiver_EatAtCannibalPlatter"                       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_EatInGatheringArea"                         , { "RimWorld"     , "JobGiver_EatInGatheringArea"                         , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_EatRandom"                                  , { "RimWorld"     , "JobGiver_EatRandom"                                  , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_EnterPortal"                                , { "RimWorld"     , "JobGiver_EnterPortal"                                , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_EnterTransporter"                           , { "RimWorld"     , "JobGiver_EnterTransporter"                           , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_EscapingHoldingPlatform"                    , { "RimWorld"     , "JobGiver_EscapingHoldingPlatform"                    , "RimWorld.JobGiver_AIFightEnemies"                       , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ExtinguishSelf"                             , { "RimWorld"     , "JobGiver_ExtinguishSelf"                             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_FightFiresNearPoint"                        , { "RimWorld"     , "JobGiver_FightFiresNearPoint"                        , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_FireStartingSpree"                          , { "RimWorld"     , "JobGiver_FireStartingSpree"                          , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_FleeAllPawns"                               , { "RimWorld"     , "JobGiver_FleeAllPawns"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_FleeDanger"                                 , { "RimWorld"     , "JobGiver_FleeDanger"                                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_FleeFire"                                   , { "RimWorld"     , "JobGiver_FleeFire"                                   , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_FleeForDistance"                            , { "RimWorld"     , "JobGiver_FleeForDistance"                            , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_FleeImmediateThreat"                        , { "RimWorld"     , "JobGiver_FleeImmediateThreat"                        , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_FleePotentialExplosion"                     , { "RimWorld"     , "JobGiver_FleePotentialExplosion"                     , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_FollowRoper"                                , { "RimWorld"     , "JobGiver_FollowRoper"                                , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ForceSleepNow"                              , { "RimWorld"     , "JobGiver_ForceSleepNow"                              , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GatherOfferingsForPsychicRitual"            , { "RimWorld"     , "JobGiver_GatherOfferingsForPsychicRitual"            , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetAgeReversal"                             , { "RimWorld"     , "JobGiver_GetAgeReversal"                             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetDeathrest"                               , { "RimWorld"     , "JobGiver_GetDeathrest"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetEnergy"                                  , { "RimWorld"     , "JobGiver_GetEnergy"                                  , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetEnergy_Charger"                          , { "RimWorld"     , "JobGiver_GetEnergy_Charger"                          , "RimWorld.JobGiver_GetEnergy"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetEnergy_SelfShutdown"                     , { "RimWorld"     , "JobGiver_GetEnergy_SelfShutdown"                     , "RimWorld.JobGiver_GetEnergy"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetFood"                                    , { "RimWorld"     , "JobGiver_GetFood"                                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetHemogen"                                 , { "RimWorld"     , "JobGiver_GetHemogen"                                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetJoy"                                     , { "RimWorld"     , "JobGiver_GetJoy"                                     , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetJoyInBed"                                , { "RimWorld"     , "JobGiver_GetJoyInBed"                                , "RimWorld.JobGiver_GetJoy"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetJoyInGatheringArea"                      , { "RimWorld"     , "JobGiver_GetJoyInGatheringArea"                      , "RimWorld.JobGiver_GetJoy"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetNeuralSupercharge"                       , { "RimWorld"     , "JobGiver_GetNeuralSupercharge"                       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GetRest"                                    , { "RimWorld"     , "JobGiver_GetRest"                                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GiveSpeech"                                 , { "RimWorld"     , "JobGiver_GiveSpeech"                                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "soundDefMale", "Verse.SoundDef" }, { "soundDefFemale", "Verse.SoundDef" } }, }, },
-	{ "RimWorld.JobGiver_GiveSpeechFacingTarget"                     , { "RimWorld"     , "JobGiver_GiveSpeechFacingTarget"                     , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "soundDefMale", "Verse.SoundDef" }, { "soundDefFemale", "Verse.SoundDef" } }, }, },
-	{ "RimWorld.JobGiver_GotoAndStandSociallyActive"                 , { "RimWorld"     , "JobGiver_GotoAndStandSociallyActive"                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_GotoTravelDestination"                      , { "RimWorld"     , "JobGiver_GotoTravelDestination"                      , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "jobDef", "Verse.JobDef" } }, }, },
-	{ "RimWorld.JobGiver_HateChant"                                  , { "RimWorld"     , "JobGiver_HateChant"                                  , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Haul"                                       , { "RimWorld"     , "JobGiver_Haul"                                       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_HaulCorpseToPublicPlace"                    , { "RimWorld"     , "JobGiver_HaulCorpseToPublicPlace"                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_HaulToPortal"                               , { "RimWorld"     , "JobGiver_HaulToPortal"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_HiveDefense"                                , { "RimWorld"     , "JobGiver_HiveDefense"                                , "RimWorld.JobGiver_AIFightEnemies"                       , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_IdleJoy"                                    , { "RimWorld"     , "JobGiver_IdleJoy"                                    , "RimWorld.JobGiver_GetJoy"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_InducePrisonerToEscape"                     , { "RimWorld"     , "JobGiver_InducePrisonerToEscape"                     , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_InduceSlaveToRebel"                         , { "RimWorld"     , "JobGiver_InduceSlaveToRebel"                         , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_InsultingSpree"                             , { "RimWorld"     , "JobGiver_InsultingSpree"                             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_JumpInWater"                                , { "RimWorld"     , "JobGiver_JumpInWater"                                , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_KeepLyingDown"                              , { "RimWorld"     , "JobGiver_KeepLyingDown"                              , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Kidnap"                                     , { "RimWorld"     , "JobGiver_Kidnap"                                     , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_LayDownAwake"                               , { "RimWorld"     , "JobGiver_LayDownAwake"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_LayDownResting"                             , { "RimWorld"     , "JobGiver_LayDownResting"                             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_LayEgg"                                     , { "RimWorld"     , "JobGiver_LayEgg"                                     , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Learn"                                      , { "RimWorld"     , "JobGiver_Learn"                                      , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_LoadTransporters"                           , { "RimWorld"     , "JobGiver_LoadTransporters"                           , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_MaintainHives"                              , { "RimWorld"     , "JobGiver_MaintainHives"                              , "RimWorld.JobGiver_AIFightEnemies"                       , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Manhunter"                                  , { "RimWorld"     , "JobGiver_Manhunter"                                  , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ManTurrets"                                 , { "RimWorld"     , "JobGiver_ManTurrets"                                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ManTurretsNearPoint"                        , { "RimWorld"     , "JobGiver_ManTurretsNearPoint"                        , "RimWorld.JobGiver_ManTurrets"                           , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ManTurretsNearSelf"                         , { "RimWorld"     , "JobGiver_ManTurretsNearSelf"                         , "RimWorld.JobGiver_ManTurrets"                           , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_MarryAdjacentPawn"                          , { "RimWorld"     , "JobGiver_MarryAdjacentPawn"                          , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Mate"                                       , { "RimWorld"     , "JobGiver_Mate"                                       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Meditate"                                   , { "RimWorld"     , "JobGiver_Meditate"                                   , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_MeditateInBed"                              , { "RimWorld"     , "JobGiver_MeditateInBed"                              , "RimWorld.JobGiver_Meditate"                             , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_MergeIntoGaumakerPod"                       , { "RimWorld"     , "JobGiver_MergeIntoGaumakerPod"                       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_MetalhorrorFight"                           , { "RimWorld"     , "JobGiver_MetalhorrorFight"                           , "RimWorld.JobGiver_AIFightEnemy"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_MineRandom"                                 , { "RimWorld"     , "JobGiver_MineRandom"                                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_MoveDrugsToInventory"                       , { "RimWorld"     , "JobGiver_MoveDrugsToInventory"                       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_MurderousRage"                              , { "RimWorld"     , "JobGiver_MurderousRage"                              , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_NociosphereDepart"                          , { "RimWorld"     , "JobGiver_NociosphereDepart"                          , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_NociosphereFight"                           , { "RimWorld"     , "JobGiver_NociosphereFight"                           , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_NociosphereSkip"                            , { "RimWorld"     , "JobGiver_NociosphereSkip"                            , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_NPCCastNonCombatAbilities"                  , { "RimWorld"     , "JobGiver_NPCCastNonCombatAbilities"                  , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Nuzzle"                                     , { "RimWorld"     , "JobGiver_Nuzzle"                                     , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_OptimizeApparel"                            , { "RimWorld"     , "JobGiver_OptimizeApparel"                            , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PackAnimalFollowColonists"                  , { "RimWorld"     , "JobGiver_PackAnimalFollowColonists"                  , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PackFood"                                   , { "RimWorld"     , "JobGiver_PackFood"                                   , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PatientGoToBed"                             , { "RimWorld"     , "JobGiver_PatientGoToBed"                             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PickUpOpportunisticWeapon"                  , { "RimWorld"     , "JobGiver_PickUpOpportunisticWeapon"                  , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PlayTargetInstrument"                       , { "RimWorld"     , "JobGiver_PlayTargetInstrument"                       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PlayWithGoldenCube"                         , { "RimWorld"     , "JobGiver_PlayWithGoldenCube"                         , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PrepareCaravan_CollectPawns"                , { "RimWorld"     , "JobGiver_PrepareCaravan_CollectPawns"                , "RimWorld.JobGiver_PrepareCaravan_RopePawns"             , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PrepareCaravan_GatherDownedPawns"           , { "RimWorld"     , "JobGiver_PrepareCaravan_GatherDownedPawns"           , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PrepareCaravan_GatherItems"                 , { "RimWorld"     , "JobGiver_PrepareCaravan_GatherItems"                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PrepareCaravan_GatherPawns"                 , { "RimWorld"     , "JobGiver_PrepareCaravan_GatherPawns"                 , "RimWorld.JobGiver_PrepareCaravan_RopePawns"             , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PrepareCaravan_RopePawns"                   , { "RimWorld"     , "JobGiver_PrepareCaravan_RopePawns"                   , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PrepareSkylantern"                          , { "RimWorld"     , "JobGiver_PrepareSkylantern"                          , "RimWorld.JobGiver_GotoAndStandSociallyActive"           , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "def", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.JobGiver_PrisonerEscape"                             , { "RimWorld"     , "JobGiver_PrisonerEscape"                             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PrisonerGetDressed"                         , { "RimWorld"     , "JobGiver_PrisonerGetDressed"                         , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_PrisonerWaitInsteadOfEscaping"              , { "RimWorld"     , "JobGiver_PrisonerWaitInsteadOfEscaping"              , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ReachOutside"                               , { "RimWorld"     , "JobGiver_ReachOutside"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ReactToCloseMeleeThreat"                    , { "RimWorld"     , "JobGiver_ReactToCloseMeleeThreat"                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ReleaseEntity"                              , { "RimWorld"     , "JobGiver_ReleaseEntity"                              , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Reload"                                     , { "RimWorld"     , "JobGiver_Reload"                                     , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_RescueNearby"                               , { "RimWorld"     , "JobGiver_RescueNearby"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ReturnedCaravan_PenAnimals"                 , { "RimWorld"     , "JobGiver_ReturnedCaravan_PenAnimals"                 , "RimWorld.JobGiver_PrepareCaravan_RopePawns"             , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ReturnToGauranlenTree"                      , { "RimWorld"     , "JobGiver_ReturnToGauranlenTree"                      , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_RevenantAttack"                             , { "RimWorld"     , "JobGiver_RevenantAttack"                             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_RevenantEscape"                             , { "RimWorld"     , "JobGiver_RevenantEscape"                             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_RevenantSleep"                              , { "RimWorld"     , "JobGiver_RevenantSleep"                              , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_RevenantWander"                             , { "RimWorld"     , "JobGiver_RevenantWander"                             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Sacrifice"                                  , { "RimWorld"     , "JobGiver_Sacrifice"                                  , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SatifyChemicalDependency"                   , { "RimWorld"     , "JobGiver_SatifyChemicalDependency"                   , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SatisfyChemicalNeed"                        , { "RimWorld"     , "JobGiver_SatisfyChemicalNeed"                        , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Scarify"                                    , { "RimWorld"     , "JobGiver_Scarify"                                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SeekAllowedArea"                            , { "RimWorld"     , "JobGiver_SeekAllowedArea"                            , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SeekSafeTemperature"                        , { "RimWorld"     , "JobGiver_SeekSafeTemperature"                        , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SelfShutdown"                               , { "RimWorld"     , "JobGiver_SelfShutdown"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SelfTend"                                   , { "RimWorld"     , "JobGiver_SelfTend"                                   , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ShamblerFight"                              , { "RimWorld"     , "JobGiver_ShamblerFight"                              , "RimWorld.JobGiver_AIFightEnemy"                         , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_ShamblerWander"                             , { "RimWorld"     , "JobGiver_ShamblerWander"                             , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SightstealerAttack"                         , { "RimWorld"     , "JobGiver_SightstealerAttack"                         , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SlaughterEntity"                            , { "RimWorld"     , "JobGiver_SlaughterEntity"                            , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SlaughterRandomAnimal"                      , { "RimWorld"     , "JobGiver_SlaughterRandomAnimal"                      , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SocialFighting"                             , { "RimWorld"     , "JobGiver_SocialFighting"                             , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SpectateDutySpectateRect"                   , { "RimWorld"     , "JobGiver_SpectateDutySpectateRect"                   , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_SpectateInCircleDuty"                       , { "RimWorld"     , "JobGiver_SpectateInCircleDuty"                       , "RimWorld.JobGiver_SpectateDutySpectateRect"             , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_StandAndBeSociallyActive"                   , { "RimWorld"     , "JobGiver_StandAndBeSociallyActive"                   , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_StandAndStare"                              , { "RimWorld"     , "JobGiver_StandAndStare"                              , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_StartRoaming"                               , { "RimWorld"     , "JobGiver_StartRoaming"                               , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Steal"                                      , { "RimWorld"     , "JobGiver_Steal"                                      , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_TakeCombatEnhancingDrug"                    , { "RimWorld"     , "JobGiver_TakeCombatEnhancingDrug"                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_TakeCountToInventory"                       , { "RimWorld"     , "JobGiver_TakeCountToInventory"                       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "def", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.JobGiver_TakeDrugsForDrugPolicy"                     , { "RimWorld"     , "JobGiver_TakeDrugsForDrugPolicy"                     , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_TakeForInventoryStock"                      , { "RimWorld"     , "JobGiver_TakeForInventoryStock"                      , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_TakeWoundedGuest"                           , { "RimWorld"     , "JobGiver_TakeWoundedGuest"                           , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_Tantrum"                                    , { "RimWorld"     , "JobGiver_Tantrum"                                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_UnloadMyLordCarriers"                       , { "RimWorld"     , "JobGiver_UnloadMyLordCarriers"                       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_UnloadYourInventory"                        , { "RimWorld"     , "JobGiver_UnloadYourInventory"                        , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_UnnaturalCorpseAttack"                      , { "RimWorld"     , "JobGiver_UnnaturalCorpseAttack"                      , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_UnnaturalCorpseIdle"                        , { "RimWorld"     , "JobGiver_UnnaturalCorpseIdle"                        , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_UnnaturalCorpseSkip"                        , { "RimWorld"     , "JobGiver_UnnaturalCorpseSkip"                        , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_UnnaturalCorpseSkipBackup"                  , { "RimWorld"     , "JobGiver_UnnaturalCorpseSkipBackup"                  , "RimWorld.JobGiver_UnnaturalCorpseSkip"                  , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_UnnaturalCorpseTowardVictimDirection"       , { "RimWorld"     , "JobGiver_UnnaturalCorpseTowardVictimDirection"       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_UnnaturalCorpseUnstuck"                     , { "RimWorld"     , "JobGiver_UnnaturalCorpseUnstuck"                     , "RimWorld.JobGiver_UnnaturalCorpseSkip"                  , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_WanderColony"                               , { "RimWorld"     , "JobGiver_WanderColony"                               , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_WanderControlGroupTarget"                   , { "RimWorld"     , "JobGiver_WanderControlGroupTarget"                   , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_WanderHive"                                 , { "RimWorld"     , "JobGiver_WanderHive"                                 , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_WanderInGatheringArea"                      , { "RimWorld"     , "JobGiver_WanderInGatheringArea"                      , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JobGiver_WanderOverseer"                             , { "RimWorld"     , "JobGiver_WanderOverseer"                             , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "RimWorld.JoyGiverDef"                                         , { "RimWorld"     , "JoyGiverDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "thingDefs", "Verse.ThingDef" }, { "requiredCapacities", "Verse.PawnCapacityDef" } }, { { "jobDef", "Verse.JobDef" }, { "joyKind", "RimWorld.JoyKindDef" } }, }, },
-	{ "RimWorld.JoyKindDef"                                          , { "RimWorld"     , "JoyKindDef"                                          , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "titleRequiredAny", "RimWorld.RoyalTitleDef" } }, {}, }, },
-	{ "RimWorld.KnowledgeCategoryDef"                                , { "RimWorld"     , "KnowledgeCategoryDef"                                , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "overflowCategory", "RimWorld.KnowledgeCategoryDef" } }, }, },
-	{ "RimWorld.LayoutDef"                                           , { "RimWorld"     , "LayoutDef"                                           , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "roomDefs", "RimWorld.LayoutRoomDef" } }, {}, }, },
-	{ "RimWorld.LayoutRoomDef"                                       , { "RimWorld"     , "LayoutRoomDef"                                       , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "floorTypes", "Verse.TerrainDef" } }, { { "sketchResolverDef", "RimWorld.SketchResolverDef" } }, }, },
-	{ "RimWorld.LearningDesireDef"                                   , { "RimWorld"     , "LearningDesireDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "jobDef", "Verse.JobDef" } }, }, },
-	{ "RimWorld.LifeStageDef"                                        , { "RimWorld"     , "LifeStageDef"                                        , "Verse.Def"                                              , { "adjective", "customMoodTipString", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "thinkTreeMainOverride", "Verse.ThinkTreeDef" }, { "thinkTreeConstantOverride", "Verse.ThinkTreeDef" } }, }, },
-	{ "RimWorld.MainButtonDef"                                       , { "RimWorld"     , "MainButtonDef"                                       , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "hotKey", "Verse.KeyBindingDef" } }, }, },
-	{ "RimWorld.MapMeshFlagDef"                                      , { "RimWorld"     , "MapMeshFlagDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.MeditationFocusDef"                                  , { "RimWorld"     , "MeditationFocusDef"                                  , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.MemeDef"                                             , { "RimWorld"     , "MemeDef"                                             , "Verse.Def"                                              , { "worshipRoomLabel", "label", "description", "ignoreConfigErrors" }, { "symbolPacks" }, { { "requireAnyRitualSeat", "Verse.ThingDef" }, { "factionWhitelist", "RimWorld.FactionDef" }, { "fixedDeityNameTypes", "RimWorld.DeityNameType" }, { "replacementPatterns", "RimWorld.RitualPatternDef" }, { "consumableBuildings", "Verse.ThingDef" }, { "startingResearchProjects", "Verse.ResearchProjectDef" }, { "addDesignators", "Verse.BuildableDef" }, { "addDesignatorGroups", "Verse.DesignatorDropdownGroupDef" }, { "cachedAllDesignatorBuildables", "Verse.BuildableDef" } }, { { "groupDef", "RimWorld.MemeGroupDef" }, { "generalRules", "Verse.Grammar.RulePack" }, { "deityNameMakerOverride", "Verse.RulePackDef" }, { "deityTypeMakerOverride", "Verse.RulePackDef" } }, }, },
-	{ "RimWorld.MemeGroupDef"                                        , { "RimWorld"     , "MemeGroupDef"                                        , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.MonolithLevelDef"                                    , { "RimWorld"     , "MonolithLevelDef"                                    , "Verse.Def"                                              , { "monolithLabel", "monolithDescription", "levelInspectText", "extraQuestDescription", "activateGizmoText", "activateFloatMenuText", "activateGizmoDescription", "pawnSentToActivateMessage", "monolithCanBeActivatedText", "activateQuestText", "activatableLetterLabel", "activatableLetterText", "activatedLetterText", "label", "description", "ignoreConfigErrors" }, {}, { { "incidentsOnReached", "RimWorld.IncidentDef" }, { "unreachableDuringConditions", "Verse.GameConditionDef" } }, { { "monolithStudyCategory", "RimWorld.KnowledgeCategoryDef" }, { "entityCatagoryCompletionRequired", "RimWorld.EntityCategoryDef" }, { "activateSound", "Verse.SoundDef" }, { "activatedSound", "Verse.SoundDef" } }, }, },
-	{ "RimWorld.MusicSequenceDef"                                    , { "RimWorld"     , "MusicSequenceDef"                                    , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "songs", "Verse.SongDef" } }, { { "song", "Verse.SongDef" }, { "nextSequence", "RimWorld.MusicSequenceDef" } }, }, },
-	{ "RimWorld.MusicTransitionDef"                                  , { "RimWorld"     , "MusicTransitionDef"                                  , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "sequence", "RimWorld.MusicSequenceDef" } }, }, },
-	{ "RimWorld.MutantCount"                                         , { "RimWorld"     , "MutantCount"                                         , "RimWorld.StartingPawnCount"                             , { "description" }, {}, {}, { { "mutant", "RimWorld.MutantDef" } }, }, },
-	{ "RimWorld.MutantDef"                                           , { "RimWorld"     , "MutantDef"                                           , "Verse.Def"                                              , { "namePrefix", "deathLetter", "deathLetterExtra", "label", "description", "ignoreConfigErrors" }, {}, { { "disablesGenes", "Verse.GeneDef" }, { "enabledNeeds", "RimWorld.NeedDef" }, { "forcedHeadTypes", "Verse.HeadTypeDef" }, { "drugWhitelist", "Verse.ThingDef" }, { "removesHediffs", "Verse.HediffDef" }, { "verbs", "Verse.VerbProperties" }, { "tools", "Verse.Tool" }, { "abilities", "RimWorld.AbilityDef" }, { "abilityWhitelist", "RimWorld.AbilityDef" }, { "cachedDisabledWorkTypes", "Verse.WorkTypeDef" } }, { { "hediff", "Verse.HediffDef" }, { "thinkTree", "Verse.ThinkTreeDef" }, { "thinkTreeConstant", "Verse.ThinkTreeDef" }, { "codexEntry", "RimWorld.EntityCodexEntryDef" }, { "relativeTurnedThought", "RimWorld.ThoughtDef" }, { "standingAnimation", "Verse.AnimationDef" }, { "bloodDef", "Verse.ThingDef" }, { "bloodSmearDef", "Verse.ThingDef" }, { "knowledgeCategory", "RimWorld.KnowledgeCategoryDef" }, { "soundCall", "Verse.SoundDef" }, { "soundAttack", "Verse.SoundDef" }, { "soundWounded", "Verse.SoundDef" }, { "soundDeath", "Verse.SoundDef" }, { "soundAngry", "Verse.SoundDef" }, { "defaultFaction", "RimWorld.FactionDef" } }, }, },
-	{ "RimWorld.NeedDef"                                             , { "RimWorld"     , "NeedDef"                                             , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "titleRequiredAny", "RimWorld.RoyalTitleDef" }, { "hediffRequiredAny", "Verse.HediffDef" }, { "nullifyingPrecepts", "RimWorld.PreceptDef" } }, {}, }, },
-	{ "RimWorld.PawnColumnDef"                                       , { "RimWorld"     , "PawnColumnDef"                                       , "Verse.Def"                                              , { "headerTip", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "trainable", "RimWorld.TrainableDef" }, { "workType", "Verse.WorkTypeDef" } }, }, },
-	{ "RimWorld.PawnExpectationsQualityOffset"                       , { "RimWorld"     , "PawnExpectationsQualityOffset"                       , ""                                                       , { "labelOverride" }, {}, {}, { { "expectation", "RimWorld.ExpectationDef" } }, }, },
-	{ "RimWorld.PawnGroupKindDef"                                    , { "RimWorld"     , "PawnGroupKindDef"                                    , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.PawnRelationDef"                                     , { "RimWorld"     , "PawnRelationDef"                                     , "Verse.Def"                                              , { "labelFemale", "label", "description", "ignoreConfigErrors" }, {}, { { "soldThoughts", "RimWorld.ThoughtDef" } }, { { "diedThought", "RimWorld.ThoughtDef" }, { "diedThoughtFemale", "RimWorld.ThoughtDef" }, { "lostThought", "RimWorld.ThoughtDef" }, { "lostThoughtFemale", "RimWorld.ThoughtDef" }, { "killedThought", "RimWorld.ThoughtDef" }, { "killedThoughtFemale", "RimWorld.ThoughtDef" } }, }, },
-	{ "RimWorld.PawnsArrivalModeDef"                                 , { "RimWorld"     , "PawnsArrivalModeDef"                                 , "Verse.Def"                                              , { "textEnemy", "textFriendly", "textWillArrive", "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.PawnTableDef"                                        , { "RimWorld"     , "PawnTableDef"                                        , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "columns", "RimWorld.PawnColumnDef" } }, {}, }, },
-	{ "RimWorld.PitGateIncidentDef"                                  , { "RimWorld"     , "PitGateIncidentDef"                                  , "Verse.Def"                                              , { "disableEnteringReason", "letterText", "letterLabel", "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.PreceptComp"                                         , { "RimWorld"     , "PreceptComp"                                         , ""                                                       , { "description" }, {}, {}, { { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_Apparel"                                 , { "RimWorld"     , "PreceptComp_Apparel"                                 , "RimWorld.PreceptComp"                                   , { "description" }, {}, {}, { { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_Apparel_Desired"                         , { "RimWorld"     , "PreceptComp_Apparel_Desired"                         , "RimWorld.PreceptComp_Apparel"                           , { "description" }, {}, {}, { { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_Apparel_DesiredStrong"                   , { "RimWorld"     , "PreceptComp_Apparel_DesiredStrong"                   , "RimWorld.PreceptComp_Apparel"                           , { "description" }, {}, {}, { { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_BedThought"                              , { "RimWorld"     , "PreceptComp_BedThought"                              , "RimWorld.PreceptComp_Thought"                           , { "description" }, { "thoughtStageDescriptions" }, {}, { { "thought", "RimWorld.ThoughtDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_DevelopmentPoints"                       , { "RimWorld"     , "PreceptComp_DevelopmentPoints"                       , "RimWorld.PreceptComp"                                   , { "eventLabel", "description" }, {}, {}, { { "eventDef", "RimWorld.HistoryEventDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_GoodwillSituation"                       , { "RimWorld"     , "PreceptComp_GoodwillSituation"                       , "RimWorld.PreceptComp"                                   , { "description" }, {}, {}, { { "goodwillSituation", "RimWorld.GoodwillSituationDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_KnowsMemoryThought"                      , { "RimWorld"     , "PreceptComp_KnowsMemoryThought"                      , "RimWorld.PreceptComp_Thought"                           , { "description" }, { "thoughtStageDescriptions" }, {}, { { "eventDef", "RimWorld.HistoryEventDef" }, { "removesThought", "RimWorld.ThoughtDef" }, { "thought", "RimWorld.ThoughtDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_MentalBreak"                             , { "RimWorld"     , "PreceptComp_MentalBreak"                             , "RimWorld.PreceptComp"                                   , { "description" }, {}, {}, { { "mentalBreakDef", "Verse.MentalBreakDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_SelfTookMemoryThought"                   , { "RimWorld"     , "PreceptComp_SelfTookMemoryThought"                   , "RimWorld.PreceptComp_Thought"                           , { "description" }, { "thoughtStageDescriptions" }, {}, { { "eventDef", "RimWorld.HistoryEventDef" }, { "thought", "RimWorld.ThoughtDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_SituationalThought"                      , { "RimWorld"     , "PreceptComp_SituationalThought"                      , "RimWorld.PreceptComp_Thought"                           , { "description" }, { "thoughtStageDescriptions" }, {}, { { "thought", "RimWorld.ThoughtDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_Thought"                                 , { "RimWorld"     , "PreceptComp_Thought"                                 , "RimWorld.PreceptComp"                                   , { "description" }, { "thoughtStageDescriptions" }, {}, { { "thought", "RimWorld.ThoughtDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_UnwillingToDo"                           , { "RimWorld"     , "PreceptComp_UnwillingToDo"                           , "RimWorld.PreceptComp"                                   , { "description" }, {}, { { "nullifyingHediffs", "Verse.HediffDef" } }, { { "eventDef", "RimWorld.HistoryEventDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_UnwillingToDo_Chance"                    , { "RimWorld"     , "PreceptComp_UnwillingToDo_Chance"                    , "RimWorld.PreceptComp_UnwillingToDo"                     , { "description" }, {}, { { "nullifyingHediffs", "Verse.HediffDef" } }, { { "eventDef", "RimWorld.HistoryEventDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_UnwillingToDo_Gendered"                  , { "RimWorld"     , "PreceptComp_UnwillingToDo_Gendered"                  , "RimWorld.PreceptComp_UnwillingToDo"                     , { "description" }, {}, { { "nullifyingHediffs", "Verse.HediffDef" } }, { { "eventDef", "RimWorld.HistoryEventDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptComp_UnwillingToDo_WithDef"                   , { "RimWorld"     , "PreceptComp_UnwillingToDo_WithDef"                   , "RimWorld.PreceptComp_UnwillingToDo"                     , { "description" }, {}, { { "nullifyingHediffs", "Verse.HediffDef" } }, { { "buildingDef", "Verse.ThingDef" }, { "eventDef", "RimWorld.HistoryEventDef" }, { "preceptDef", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.PreceptDef"                                          , { "RimWorld"     , "PreceptDef"                                          , "Verse.Def"                                              , { "tipLabelOverride", "extraTextPawnDeathLetter", "label", "description", "ignoreConfigErrors" }, {}, { { "comps", "RimWorld.PreceptComp" }, { "opposedWorkTypes", "Verse.WorkTypeDef" }, { "associatedMemes", "RimWorld.MemeDef" }, { "conflictingMemes", "RimWorld.MemeDef" }, { "requiredMemes", "RimWorld.MemeDef" }, { "buildingMinExpectations", "RimWorld.ExpectationDef" }, { "grantedAbilities", "RimWorld.AbilityDef" }, { "roleEffects", "RimWorld.RoleEffect" } }, { { "issue", "RimWorld.IssueDef" }, { "takeNameFrom", "RimWorld.PreceptDef" }, { "alsoAdds", "RimWorld.PreceptDef" }, { "nameMaker", "Verse.RulePackDef" }, { "ritualPatternBase", "RimWorld.RitualPatternDef" }, { "defaultDrugPolicyOverride", "RimWorld.DrugPolicyDef" }, { "apparelPreceptSwapDef", "RimWorld.PreceptDef" }, { "useCooldownFromAbilityGroupDef", "RimWorld.AbilityGroupDef" }, { "sourcePawnRoleDef", "RimWorld.PreceptDef" }, { "sourceAbilityDef", "RimWorld.AbilityDef" } }, }, },
-	{ "RimWorld.PrisonerInteractionModeDef"                          , { "RimWorld"     , "PrisonerInteractionModeDef"                          , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.PsychicRitualDef"                                    , { "RimWorld"     , "PsychicRitualDef"                                    , "Verse.Def"                                              , { "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, { { "rolesBackingList", "RimWorld.PsychicRitualRoleDef" } }, { { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_BloodRain"                          , { "RimWorld"     , "PsychicRitualDef_BloodRain"                          , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_Brainwipe"                          , { "RimWorld"     , "PsychicRitualDef_Brainwipe"                          , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_Chronophagy"                        , { "RimWorld"     , "PsychicRitualDef_Chronophagy"                        , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_ImbueDeathRefusal"                  , { "RimWorld"     , "PsychicRitualDef_ImbueDeathRefusal"                  , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_InvocationCircle"                   , { "RimWorld"     , "PsychicRitualDef_InvocationCircle"                   , "RimWorld.PsychicRitualDef"                              , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_NeurosisPulse"                      , { "RimWorld"     , "PsychicRitualDef_NeurosisPulse"                      , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_Philophagy"                         , { "RimWorld"     , "PsychicRitualDef_Philophagy"                         , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_PleasurePulse"                      , { "RimWorld"     , "PsychicRitualDef_PleasurePulse"                      , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_Psychophagy"                        , { "RimWorld"     , "PsychicRitualDef_Psychophagy"                        , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_SkipAbduction"                      , { "RimWorld"     , "PsychicRitualDef_SkipAbduction"                      , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_SkipAbductionPlayer"                , { "RimWorld"     , "PsychicRitualDef_SkipAbductionPlayer"                , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_SummonAnimals"                      , { "RimWorld"     , "PsychicRitualDef_SummonAnimals"                      , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_SummonFleshbeasts"                  , { "RimWorld"     , "PsychicRitualDef_SummonFleshbeasts"                  , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_SummonFleshbeastsPlayer"            , { "RimWorld"     , "PsychicRitualDef_SummonFleshbeastsPlayer"            , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_SummonPitGate"                      , { "RimWorld"     , "PsychicRitualDef_SummonPitGate"                      , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_SummonShamblers"                    , { "RimWorld"     , "PsychicRitualDef_SummonShamblers"                    , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualDef_VoidProvocation"                    , { "RimWorld"     , "PsychicRitualDef_VoidProvocation"                    , "RimWorld.PsychicRitualDef_InvocationCircle"             , { "outcomeDescription", "letterAICompleteLabel", "letterAICompleteText", "letterAIArrivedText", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "invokerRole", "RimWorld.PsychicRitualRoleDef" }, { "chanterRole", "RimWorld.PsychicRitualRoleDef" }, { "targetRole", "RimWorld.PsychicRitualRoleDef" }, { "defenderRole", "RimWorld.PsychicRitualRoleDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "RimWorld.PsychicRitualRoleDef"                                , { "RimWorld"     , "PsychicRitualRoleDef"                                , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.PsychicRitualRoleDef_DeathRefusalTarget"             , { "RimWorld"     , "PsychicRitualRoleDef_DeathRefusalTarget"             , "RimWorld.PsychicRitualRoleDef"                          , { "psychicRitualLeaveReason_MaxDeathRefusal", "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.QuestScriptDef"                                      , { "RimWorld"     , "QuestScriptDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "questDescriptionRules", "Verse.Grammar.RulePack" }, { "questNameRules", "Verse.Grammar.RulePack" }, { "questDescriptionAndNameRules", "Verse.Grammar.RulePack" }, { "questContentRules", "Verse.Grammar.RulePack" }, { "questAvailableLetterDef", "Verse.LetterDef" }, { "successHistoryEvent", "RimWorld.HistoryEventDef" }, { "failedOrExpiredHistoryEvent", "RimWorld.HistoryEventDef" }, { "epicParent", "RimWorld.QuestScriptDef" } }, }, },
-	{ "RimWorld.RaidAgeRestrictionDef"                               , { "RimWorld"     , "RaidAgeRestrictionDef"                               , "Verse.Def"                                              , { "arrivalTextExtra", "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.RaidStrategyDef"                                     , { "RimWorld"     , "RaidStrategyDef"                                     , "Verse.Def"                                              , { "arrivalTextFriendly", "arrivalTextEnemy", "letterLabelEnemy", "letterLabelFriendly", "label", "description", "ignoreConfigErrors" }, {}, { { "arriveModes", "RimWorld.PawnsArrivalModeDef" } }, {}, }, },
-	{ "RimWorld.RecordDef"                                           , { "RimWorld"     , "RecordDef"                                           , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "measuredTimeJobs", "Verse.JobDef" } }, {}, }, },
-	{ "RimWorld.RenderSkipFlagDef"                                   , { "RimWorld"     , "RenderSkipFlagDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.ResearchTabDef"                                      , { "RimWorld"     , "ResearchTabDef"                                      , "Verse.Def"                                              , { "generalTitle", "generalDescription", "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualAttachableOutcomeEffectDef"                    , { "RimWorld"     , "RitualAttachableOutcomeEffectDef"                    , "Verse.Def"                                              , { "letterInfoText", "effectDesc", "label", "description", "ignoreConfigErrors" }, {}, { { "requiredMemeAny", "RimWorld.MemeDef" }, { "allowedRituals", "RimWorld.RitualPatternDef" }, { "disallowedRituals", "RimWorld.RitualPatternDef" } }, { { "requiredFaction", "RimWorld.FactionDef" } }, }, },
-	{ "RimWorld.RitualBehaviorDef"                                   , { "RimWorld"     , "RitualBehaviorDef"                                   , "Verse.Def"                                              , { "letterTitle", "letterText", "spectatorsLabel", "spectatorGerund", "label", "description", "ignoreConfigErrors" }, {}, { { "roles", "RimWorld.RitualRole" }, { "soundDefsPerEnhancerCount", "Verse.SoundDef" } }, { { "spectatorFilter", "RimWorld.RitualSpectatorFilter" } }, }, },
-	{ "RimWorld.RitualObligationTargetFilterDef"                     , { "RimWorld"     , "RitualObligationTargetFilterDef"                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "thingDefs", "Verse.ThingDef" } }, {}, }, },
-	{ "RimWorld.RitualOutcomeComp"                                   , { "RimWorld"     , "RitualOutcomeComp"                                   , ""                                                       , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_AtLeastOneSpectator"               , { "RimWorld"     , "RitualOutcomeComp_AtLeastOneSpectator"               , "RimWorld.RitualOutcomeComp_ParticipantCount"            , { "labelNotMet", "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_BuildingOfAnyDefPresent"           , { "RimWorld"     , "RitualOutcomeComp_BuildingOfAnyDefPresent"           , "RimWorld.RitualOutcomeComp_BuildingsPresent"            , { "label", "labelAbstract" }, {}, { { "defs", "Verse.ThingDef" } }, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_BuildingOfDefPresent"              , { "RimWorld"     , "RitualOutcomeComp_BuildingOfDefPresent"              , "RimWorld.RitualOutcomeComp_BuildingsPresent"            , { "label", "labelAbstract" }, {}, {}, { { "def", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.RitualOutcomeComp_BuildingOfDefUsed"                 , { "RimWorld"     , "RitualOutcomeComp_BuildingOfDefUsed"                 , "RimWorld.RitualOutcomeComp_QualitySingleOffset"         , { "label", "labelAbstract" }, {}, {}, { { "def", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.RitualOutcomeComp_BuildingsPresent"                  , { "RimWorld"     , "RitualOutcomeComp_BuildingsPresent"                  , "RimWorld.RitualOutcomeComp_QualitySingleOffset"         , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_DestroyConsumableBuilding"         , { "RimWorld"     , "RitualOutcomeComp_DestroyConsumableBuilding"         , "RimWorld.RitualOutcomeComp"                             , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_DuelistDied"                       , { "RimWorld"     , "RitualOutcomeComp_DuelistDied"                       , "RimWorld.RitualOutcomeComp_QualitySingleOffset"         , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_Indoors"                           , { "RimWorld"     , "RitualOutcomeComp_Indoors"                           , "RimWorld.RitualOutcomeComp_QualitySingleOffset"         , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_LovedOnePresent"                   , { "RimWorld"     , "RitualOutcomeComp_LovedOnePresent"                   , "RimWorld.RitualOutcomeComp_Quality"                     , { "labelNotMet", "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_NumActiveLoudspeakers"             , { "RimWorld"     , "RitualOutcomeComp_NumActiveLoudspeakers"             , "RimWorld.RitualOutcomeComp_Quality"                     , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_NumParticipantsWithTag"            , { "RimWorld"     , "RitualOutcomeComp_NumParticipantsWithTag"            , "RimWorld.RitualOutcomeComp_Quality"                     , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_NumPlayedDrums"                    , { "RimWorld"     , "RitualOutcomeComp_NumPlayedDrums"                    , "RimWorld.RitualOutcomeComp_Quality"                     , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_ParticipantCount"                  , { "RimWorld"     , "RitualOutcomeComp_ParticipantCount"                  , "RimWorld.RitualOutcomeComp_Quality"                     , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_PawnAge"                           , { "RimWorld"     , "RitualOutcomeComp_PawnAge"                           , "RimWorld.RitualOutcomeComp_QualitySingleOffset"         , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_PawnExpectations"                  , { "RimWorld"     , "RitualOutcomeComp_PawnExpectations"                  , "RimWorld.RitualOutcomeComp_QualitySingleOffset"         , { "label", "labelAbstract" }, {}, { { "offsetPerExpectation", "RimWorld.PawnExpectationsQualityOffset" } }, { { "slaveExpectationCached", "RimWorld.PawnExpectationsQualityOffset" } }, }, },
-	{ "RimWorld.RitualOutcomeComp_PawnSkill"                         , { "RimWorld"     , "RitualOutcomeComp_PawnSkill"                         , "RimWorld.RitualOutcomeComp_Quality"                     , { "label", "labelAbstract" }, {}, {}, { { "skillDef", "RimWorld.SkillDef" } }, }, },
-	{ "RimWorld.RitualOutcomeComp_PawnStatScaled"                    , { "RimWorld"     , "RitualOutcomeComp_PawnStatScaled"                    , "RimWorld.RitualOutcomeComp_QualitySingleOffset"         , { "label", "labelAbstract" }, {}, {}, { { "statDef", "RimWorld.StatDef" } }, }, },
-	{ "RimWorld.RitualOutcomeComp_Quality"                           , { "RimWorld"     , "RitualOutcomeComp_Quality"                           , "RimWorld.RitualOutcomeComp"                             , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_QualitySingleOffset"               , { "RimWorld"     , "RitualOutcomeComp_QualitySingleOffset"               , "RimWorld.RitualOutcomeComp_Quality"                     , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_RitualSeatPresent"                 , { "RimWorld"     , "RitualOutcomeComp_RitualSeatPresent"                 , "RimWorld.RitualOutcomeComp_BuildingsPresent"            , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_RitualTargetDefs"                  , { "RimWorld"     , "RitualOutcomeComp_RitualTargetDefs"                  , "RimWorld.RitualOutcomeComp_QualitySingleOffset"         , { "expectedThingLabelTip", "label", "labelAbstract" }, {}, { { "defs", "Verse.ThingDef" } }, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_RoleChangeParticipants"            , { "RimWorld"     , "RitualOutcomeComp_RoleChangeParticipants"            , "RimWorld.RitualOutcomeComp_ParticipantCount"            , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_RolePresentNotSubstituted"         , { "RimWorld"     , "RitualOutcomeComp_RolePresentNotSubstituted"         , "RimWorld.RitualOutcomeComp_QualitySingleOffset"         , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeComp_RoomStat"                          , { "RimWorld"     , "RitualOutcomeComp_RoomStat"                          , "RimWorld.RitualOutcomeComp_Quality"                     , { "label", "labelAbstract" }, {}, {}, { { "statDef", "Verse.RoomStatDef" } }, }, },
-	{ "RimWorld.RitualOutcomeComp_TargetThingStat"                   , { "RimWorld"     , "RitualOutcomeComp_TargetThingStat"                   , "RimWorld.RitualOutcomeComp_Quality"                     , { "label", "labelAbstract" }, {}, {}, { { "statDef", "RimWorld.StatDef" } }, }, },
-	{ "RimWorld.RitualOutcomeComp_WeaponUsed"                        , { "RimWorld"     , "RitualOutcomeComp_WeaponUsed"                        , "RimWorld.RitualOutcomeComp_QualitySingleOffset"         , { "label", "labelAbstract" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomeEffectDef"                              , { "RimWorld"     , "RitualOutcomeEffectDef"                              , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, { "extraPredictedOutcomeDescriptions", "extraInfoLines" }, { { "outcomeChances", "RimWorld.RitualOutcomePossibility" }, { "extraOutcomeDescriptions", "RimWorld.RitualOutcomeEffectDef+ExtraOutcomeChanceDescription" }, { "comps", "RimWorld.RitualOutcomeComp" } }, { { "memoryDef", "RimWorld.ThoughtDef" }, { "effecter", "Verse.EffecterDef" }, { "fleckDef", "Verse.FleckDef" }, { "filthDefToSpawn", "Verse.ThingDef" }, { "bestOutcomeCached", "RimWorld.RitualOutcomePossibility" }, { "worstOutcomeCached", "RimWorld.RitualOutcomePossibility" } }, }, },
-	{ "RimWorld.RitualOutcomeEffectDef+ExtraOutcomeChanceDescription", { "RimWorld"     , "ExtraOutcomeChanceDescription"                       , ""                                                       , { "description" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualOutcomePossibility"                            , { "RimWorld"     , "RitualOutcomePossibility"                            , ""                                                       , { "label", "description", "potentialExtraOutcomeDesc" }, {}, {}, { { "memory", "RimWorld.ThoughtDef" } }, }, },
-	{ "RimWorld.RitualPatternDef"                                    , { "RimWorld"     , "RitualPatternDef"                                    , "Verse.Def"                                              , { "ritualExpectedDesc", "ritualExpectedDescNoAdjective", "shortDescOverride", "descOverride", "ritualExplanation", "beginRitualOverride", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "nameMaker", "Verse.RulePackDef" }, { "ritualObligationTargetFilter", "RimWorld.RitualObligationTargetFilterDef" }, { "ritualTargetFilter", "RimWorld.RitualTargetFilterDef" }, { "ritualBehavior", "RimWorld.RitualBehaviorDef" }, { "ritualOutcomeEffect", "RimWorld.RitualOutcomeEffectDef" } }, }, },
-	{ "RimWorld.RitualRole"                                          , { "RimWorld"     , "RitualRole"                                          , ""                                                       , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRole_Mother"                                   , { "RimWorld"     , "RitualRole_Mother"                                   , "RimWorld.RitualRoleForced"                              , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleAnimal"                                    , { "RimWorld"     , "RitualRoleAnimal"                                    , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleAnimaLinker"                               , { "RimWorld"     , "RitualRoleAnimaLinker"                               , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleBehavior"                                  , { "RimWorld"     , "RitualRoleBehavior"                                  , ""                                                       , { "jobReportOverride" }, {}, {}, { { "dutyDef", "Verse.AI.DutyDef" }, { "speakerInteraction", "RimWorld.InteractionDef" } }, }, },
-	{ "RimWorld.RitualRoleBlindingTarget"                            , { "RimWorld"     , "RitualRoleBlindingTarget"                            , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleColonist"                                  , { "RimWorld"     , "RitualRoleColonist"                                  , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "requiredWorkType", "Verse.WorkTypeDef" }, { "usedSkill", "RimWorld.SkillDef" }, { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleColonistConnectable"                       , { "RimWorld"     , "RitualRoleColonistConnectable"                       , "RimWorld.RitualRoleColonist"                            , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "requiredWorkType", "Verse.WorkTypeDef" }, { "usedSkill", "RimWorld.SkillDef" }, { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleConvertee"                                 , { "RimWorld"     , "RitualRoleConvertee"                                 , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleForced"                                    , { "RimWorld"     , "RitualRoleForced"                                    , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleIdeoRoleChanger"                           , { "RimWorld"     , "RitualRoleIdeoRoleChanger"                           , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleOrganizer"                                 , { "RimWorld"     , "RitualRoleOrganizer"                                 , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRolePrisoner"                                  , { "RimWorld"     , "RitualRolePrisoner"                                  , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRolePrisonerOrSlave"                           , { "RimWorld"     , "RitualRolePrisonerOrSlave"                           , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleScarificationTarget"                       , { "RimWorld"     , "RitualRoleScarificationTarget"                       , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleTag"                                       , { "RimWorld"     , "RitualRoleTag"                                       , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualRoleWarden"                                    , { "RimWorld"     , "RitualRoleWarden"                                    , "RimWorld.RitualRole"                                    , { "label", "categoryLabel", "missingDesc", "noCandidatesGizmoDesc", "customChildDisallowMessage" }, {}, {}, { { "precept", "RimWorld.PreceptDef" } }, }, },
-	{ "RimWorld.RitualSpectatorFilter"                               , { "RimWorld"     , "RitualSpectatorFilter"                               , ""                                                       , { "description" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualSpectatorFilter_NatureFocus"                   , { "RimWorld"     , "RitualSpectatorFilter_NatureFocus"                   , "RimWorld.RitualSpectatorFilter"                         , { "description" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualSpectatorFilter_WillWitnessExecution"          , { "RimWorld"     , "RitualSpectatorFilter_WillWitnessExecution"          , "RimWorld.RitualSpectatorFilter"                         , { "description" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualStageAction_Message"                           , { "RimWorld"     , "RitualStageAction_Message"                           , "RimWorld.RitualStageAction"                             , { "text" }, {}, {}, { { "messageTypeDef", "Verse.MessageTypeDef" } }, }, },
-	{ "RimWorld.RitualTargetFilterDef"                               , { "RimWorld"     , "RitualTargetFilterDef"                               , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.RitualVisualEffectDef"                               , { "RimWorld"     , "RitualVisualEffectDef"                               , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.RiverDef"                                            , { "RimWorld"     , "RiverDef"                                            , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "degradeChild", "RimWorld.RiverDef" } }, }, },
-	{ "RimWorld.RoadDef"                                             , { "RimWorld"     , "RoadDef"                                             , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "pathingMode", "RimWorld.RoadPathingDef" } }, }, },
-	{ "RimWorld.RoadPathingDef"                                      , { "RimWorld"     , "RoadPathingDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.RoadWorldLayerDef"                                   , { "RimWorld"     , "RoadWorldLayerDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.RoleEffect"                                          , { "RimWorld"     , "RoleEffect"                                          , ""                                                       , { "label" }, {}, {}, {}, }, },
-	{ "RimWorld.RoleEffect_GiveThoughtOnTend"                        , { "RimWorld"     , "RoleEffect_GiveThoughtOnTend"                        , "RimWorld.RoleEffect"                                    , { "label" }, {}, {}, { { "thoughtDef", "RimWorld.ThoughtDef" } }, }, },
-	{ "RimWorld.RoleEffect_HuntingRevengeChanceFactor"               , { "RimWorld"     , "RoleEffect_HuntingRevengeChanceFactor"               , "RimWorld.RoleEffect"                                    , { "label" }, {}, {}, {}, }, },
-	{ "RimWorld.RoleEffect_NoMeleeWeapons"                           , { "RimWorld"     , "RoleEffect_NoMeleeWeapons"                           , "RimWorld.RoleEffect"                                    , { "label" }, {}, {}, {}, }, },
-	{ "RimWorld.RoleEffect_NoRangedWeapons"                          , { "RimWorld"     , "RoleEffect_NoRangedWeapons"                          , "RimWorld.RoleEffect"                                    , { "label" }, {}, {}, {}, }, },
-	{ "RimWorld.RoleEffect_PawnStatFactor"                           , { "RimWorld"     , "RoleEffect_PawnStatFactor"                           , "RimWorld.RoleEffect_PawnStatModifier"                   , { "label" }, {}, {}, { { "statDef", "RimWorld.StatDef" } }, }, },
-	{ "RimWorld.RoleEffect_PawnStatModifier"                         , { "RimWorld"     , "RoleEffect_PawnStatModifier"                         , "RimWorld.RoleEffect"                                    , { "label" }, {}, {}, { { "statDef", "RimWorld.StatDef" } }, }, },
-	{ "RimWorld.RoleEffect_PawnStatOffset"                           , { "RimWorld"     , "RoleEffect_PawnStatOffset"                           , "RimWorld.RoleEffect_PawnStatModifier"                   , { "label" }, {}, {}, { { "statDef", "RimWorld.StatDef" } }, }, },
-	{ "RimWorld.RoleEffect_ProductionQualityOffset"                  , { "RimWorld"     , "RoleEffect_ProductionQualityOffset"                  , "RimWorld.RoleEffect"                                    , { "label" }, {}, {}, {}, }, },
-	{ "RimWorld.RoyalTitleDef"                                       , { "RimWorld"     , "RoyalTitleDef"                                       , "Verse.Def"                                              , { "labelFemale", "label", "description", "ignoreConfigErrors" }, {}, { { "requiredApparel", "RimWorld.ApparelRequirement" }, { "permits", "RimWorld.RoyalTitlePermitDef" }, { "disabledJoyKinds", "RimWorld.JoyKindDef" }, { "grantedAbilities", "RimWorld.AbilityDef" }, { "satisfyingMealsCached", "Verse.ThingDef" }, { "satisfyingMealsNoDrugsCached", "Verse.ThingDef" } }, { { "minExpectation", "RimWorld.ExpectationDef" }, { "awardThought", "RimWorld.ThoughtDef" }, { "lostThought", "RimWorld.ThoughtDef" }, { "replaceOnRecruited", "RimWorld.RoyalTitleDef" } }, }, },
-	{ "RimWorld.RoyalTitlePermitDef"                                 , { "RimWorld"     , "RoyalTitlePermitDef"                                 , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "minTitle", "RimWorld.RoyalTitleDef" }, { "faction", "RimWorld.FactionDef" }, { "prerequisite", "RimWorld.RoyalTitlePermitDef" } }, }, },
-	{ "RimWorld.RuleDef"                                             , { "RimWorld"     , "RuleDef"                                             , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.Scenario"                                            , { "RimWorld"     , "Scenario"                                            , ""                                                       , { "name", "summary", "description" }, {}, {}, {}, }, },
-	{ "RimWorld.ScenarioDef"                                         , { "RimWorld"     , "ScenarioDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "scenario", "RimWorld.Scenario" } }, }, },
-	{ "RimWorld.ScenPart_ConfigPage_ConfigureStartingPawns_Mutants"  , { "RimWorld"     , "ScenPart_ConfigPage_ConfigureStartingPawns_Mutants"  , "RimWorld.ScenPart_ConfigPage_ConfigureStartingPawnsBase", { "customSummary" }, {}, { { "mutantCounts", "RimWorld.MutantCount" } }, { { "def", "RimWorld.ScenPartDef" } }, }, },
-	{ "RimWorld.ScenPart_ConfigPage_ConfigureStartingPawns_Xenotypes", { "RimWorld"     , "ScenPart_ConfigPage_ConfigureStartingPawns_Xenotypes", "RimWorld.ScenPart_ConfigPage_ConfigureStartingPawnsBase", { "customSummary" }, {}, { { "xenotypeCounts", "RimWorld.XenotypeCount" } }, { { "def", "RimWorld.ScenPartDef" } }, }, },
-	{ "RimWorld.ScenPartDef"                                         , { "RimWorld"     , "ScenPartDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "gameCondition", "Verse.GameConditionDef" }, { "genStep", "Verse.GenStepDef" } }, }, },
-	{ "RimWorld.ShipJobDef"                                          , { "RimWorld"     , "ShipJobDef"                                          , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.SitePartDef"                                         , { "RimWorld"     , "SitePartDef"                                         , "Verse.Def"                                              , { "approachOrderString", "approachingReportString", "arrivedLetter", "arrivedLetterLabelPart", "label", "description", "ignoreConfigErrors" }, {}, { { "arrivedLetterHediffHyperlinks", "Verse.HediffDef" }, { "extraGenSteps", "Verse.GenStepDef" } }, { { "conditionCauserDef", "Verse.ThingDef" }, { "arrivedLetterDef", "Verse.LetterDef" } }, }, },
-	{ "RimWorld.SketchResolverDef"                                   , { "RimWorld"     , "SketchResolverDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.SkillDef"                                            , { "RimWorld"     , "SkillDef"                                            , "Verse.Def"                                              , { "skillLabel", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "generalRules", "Verse.Grammar.RulePack" }, { "lessonInteraction", "RimWorld.InteractionDef" } }, }, },
-	{ "RimWorld.SlaveInteractionModeDef"                             , { "RimWorld"     , "SlaveInteractionModeDef"                             , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.StageFailTrigger"                                    , { "RimWorld"     , "StageFailTrigger"                                    , ""                                                       , { "desc" }, {}, {}, {}, }, },
-	{ "RimWorld.StageFailTrigger_NoPoweredLoudspeakers"              , { "RimWorld"     , "StageFailTrigger_NoPoweredLoudspeakers"              , "RimWorld.StageFailTrigger"                              , { "desc" }, {}, {}, { { "onlyIfTargetIsOfDef", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.StageFailTrigger_NoThingPresent"                     , { "RimWorld"     , "StageFailTrigger_NoThingPresent"                     , "RimWorld.StageFailTrigger"                              , { "desc" }, {}, {}, { { "onlyIfTargetIsOfDef", "Verse.ThingDef" }, { "thingDef", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.StageFailTrigger_PawnAlive"                          , { "RimWorld"     , "StageFailTrigger_PawnAlive"                          , "RimWorld.StageFailTrigger"                              , { "desc" }, {}, {}, {}, }, },
-	{ "RimWorld.StageFailTrigger_PawnAsleep"                         , { "RimWorld"     , "StageFailTrigger_PawnAsleep"                         , "RimWorld.StageFailTrigger"                              , { "desc" }, {}, {}, {}, }, },
-	{ "RimWorld.StageFailTrigger_TargetNotLit"                       , { "RimWorld"     , "StageFailTrigger_TargetNotLit"                       , "RimWorld.StageFailTrigger"                              , { "desc" }, {}, {}, { { "onlyIfTargetIsOfDef", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.StageFailTrigger_TargetPawnUnreachable"              , { "RimWorld"     , "StageFailTrigger_TargetPawnUnreachable"              , "RimWorld.StageFailTrigger"                              , { "desc" }, {}, {}, {}, }, },
-	{ "RimWorld.StageFailTrigger_TargetThingMissing"                 , { "RimWorld"     , "StageFailTrigger_TargetThingMissing"                 , "RimWorld.StageFailTrigger"                              , { "desc" }, {}, {}, { { "onlyIfTargetIsOfDef", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.StageFailTrigger_TargetUnpowered"                    , { "RimWorld"     , "StageFailTrigger_TargetUnpowered"                    , "RimWorld.StageFailTrigger"                              , { "desc" }, {}, {}, { { "onlyIfTargetIsOfDef", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.StatCategoryDef"                                     , { "RimWorld"     , "StatCategoryDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.StatDef"                                             , { "RimWorld"     , "StatDef"                                             , "Verse.Def"                                              , { "offsetLabel", "formatString", "formatStringUnfinalized", "statFactorsExplanationHeader", "label", "description", "ignoreConfigErrors" }, {}, { { "showIfHediffsPresent", "Verse.HediffDef" }, { "showOnPawnKind", "Verse.PawnKindDef" }, { "statFactors", "RimWorld.StatDef" }, { "postProcessStatFactors", "RimWorld.StatDef" } }, { { "category", "RimWorld.StatCategoryDef" }, { "disableIfSkillDisabled", "RimWorld.SkillDef" } }, }, },
-	{ "RimWorld.StatPart_OverseerStatOffset"                         , { "RimWorld"     , "StatPart_OverseerStatOffset"                         , "RimWorld.StatPart"                                      , { "label" }, {}, {}, { { "stat", "RimWorld.StatDef" }, { "parentStat", "RimWorld.StatDef" } }, }, },
-	{ "RimWorld.StatPart_RoomStat"                                   , { "RimWorld"     , "StatPart_RoomStat"                                   , "RimWorld.StatPart"                                      , { "customLabel" }, {}, {}, { { "roomStat", "Verse.RoomStatDef" }, { "parentStat", "RimWorld.StatDef" } }, }, },
-	{ "RimWorld.StorytellerDef"                                      , { "RimWorld"     , "StorytellerDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "forcedDifficulty", "RimWorld.DifficultyDef" } }, }, },
-	{ "RimWorld.StudyNote"                                           , { "RimWorld"     , "StudyNote"                                           , ""                                                       , { "label", "text" }, {}, {}, {}, }, },
-	{ "RimWorld.StuffCategoryDef"                                    , { "RimWorld"     , "StuffCategoryDef"                                    , "Verse.Def"                                              , { "noun", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "destroySoundSmall", "Verse.SoundDef" }, { "destroySoundMedium", "Verse.SoundDef" }, { "destroySoundLarge", "Verse.SoundDef" } }, }, },
-	{ "RimWorld.StyleItemCategoryDef"                                , { "RimWorld"     , "StyleItemCategoryDef"                                , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "cachedStyleItems", "RimWorld.StyleItemDef" } }, {}, }, },
-	{ "RimWorld.StyleItemDef"                                        , { "RimWorld"     , "StyleItemDef"                                        , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "category", "RimWorld.StyleItemCategoryDef" }, { "overrideShaderTypeDef", "Verse.ShaderTypeDef" }, { "requiredGene", "Verse.GeneDef" }, { "requiredMutant", "RimWorld.MutantDef" } }, }, },
-	{ "RimWorld.SurgeryOutcome"                                      , { "RimWorld"     , "SurgeryOutcome"                                      , ""                                                       , { "letterLabel", "letterText" }, {}, {}, {}, }, },
-	{ "RimWorld.SurgeryOutcome_Death"                                , { "RimWorld"     , "SurgeryOutcome_Death"                                , "RimWorld.SurgeryOutcome"                                , { "letterLabel", "letterText" }, {}, {}, {}, }, },
-	{ "RimWorld.SurgeryOutcome_Failure"                              , { "RimWorld"     , "SurgeryOutcome_Failure"                              , "RimWorld.SurgeryOutcome"                                , { "letterLabel", "letterText" }, {}, {}, {}, }, },
-	{ "RimWorld.SurgeryOutcome_FailureWithHediff"                    , { "RimWorld"     , "SurgeryOutcome_FailureWithHediff"                    , "RimWorld.SurgeryOutcome_Failure"                        , { "letterLabel", "letterText" }, {}, { { "applyToRecipes", "Verse.RecipeDef" } }, { { "failedHediff", "Verse.HediffDef" } }, }, },
-	{ "RimWorld.SurgeryOutcome_HediffWithDuration"                   , { "RimWorld"     , "SurgeryOutcome_HediffWithDuration"                   , "RimWorld.SurgeryOutcome"                                , { "letterLabel", "letterText" }, {}, {}, { { "hediff", "Verse.HediffDef" } }, }, },
-	{ "RimWorld.SurgeryOutcomeEffectDef"                             , { "RimWorld"     , "SurgeryOutcomeEffectDef"                             , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "outcomes", "RimWorld.SurgeryOutcome" } }, {}, }, },
-	{ "RimWorld.SurgeryOutcomeSuccess"                               , { "RimWorld"     , "SurgeryOutcomeSuccess"                               , "RimWorld.SurgeryOutcome"                                , { "letterLabel", "letterText" }, {}, {}, {}, }, },
-	{ "RimWorld.TaleDef"                                             , { "RimWorld"     , "TaleDef"                                             , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "rulePack", "Verse.Grammar.RulePack" } }, }, },
-	{ "RimWorld.TattooDef"                                           , { "RimWorld"     , "TattooDef"                                           , "RimWorld.StyleItemDef"                                  , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "overrideShaderTypeDef", "Verse.ShaderTypeDef" }, { "requiredGene", "Verse.GeneDef" }, { "requiredMutant", "RimWorld.MutantDef" } }, }, },
-	{ "RimWorld.TerrainTemplateDef"                                  , { "RimWorld"     , "TerrainTemplateDef"                                  , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "researchPrerequisites", "Verse.ResearchProjectDef" } }, { { "burnedDef", "Verse.TerrainDef" }, { "designatorDropdown", "Verse.DesignatorDropdownGroupDef" }, { "dominantStyleCategory", "Verse.StyleCategoryDef" } }, }, },
-	{ "RimWorld.ThingSetMakerDef"                                    , { "RimWorld"     , "ThingSetMakerDef"                                    , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.ThoughtDef"                                          , { "RimWorld"     , "ThoughtDef"                                          , "Verse.Def"                                              , { "labelInBracketsExtraForHediff", "label", "description", "ignoreConfigErrors" }, {}, { { "stages", "RimWorld.ThoughtStage" }, { "nullifyingTraits", "RimWorld.TraitDef" }, { "neverNullifyIfAnyTrait", "RimWorld.TraitDef" }, { "nullifyingOwnTales", "RimWorld.TaleDef" }, { "nullifyingPrecepts", "RimWorld.PreceptDef" }, { "nullifyingHediffs", "Verse.HediffDef" }, { "nullifyingGenes", "Verse.GeneDef" }, { "requiredTraits", "RimWorld.TraitDef" }, { "requiredGenes", "Verse.GeneDef" }, { "requiredHediffs", "Verse.HediffDef" }, { "replaceThoughts", "RimWorld.ThoughtDef" } }, { { "nextThought", "RimWorld.ThoughtDef" }, { "producesMemoryThought", "RimWorld.ThoughtDef" }, { "effectMultiplyingStat", "RimWorld.StatDef" }, { "hediff", "Verse.HediffDef" }, { "mentalState", "Verse.MentalStateDef" }, { "gameCondition", "Verse.GameConditionDef" }, { "thoughtToMake", "RimWorld.ThoughtDef" }, { "minExpectation", "RimWorld.ExpectationDef" }, { "minExpectationForNegativeThought", "RimWorld.ExpectationDef" }, { "chemicalDef", "RimWorld.ChemicalDef" }, { "taleDef", "RimWorld.TaleDef" } }, }, },
-	{ "RimWorld.ThoughtStage"                                        , { "RimWorld"     , "ThoughtStage"                                        , ""                                                       , { "label", "labelSocial", "labelAbstract", "description" }, {}, {}, {}, }, },
-	{ "RimWorld.TimeAssignmentDef"                                   , { "RimWorld"     , "TimeAssignmentDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.TraderKindDef"                                       , { "RimWorld"     , "TraderKindDef"                                       , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "faction", "RimWorld.FactionDef" }, { "permitRequiredForTrading", "RimWorld.RoyalTitlePermitDef" } }, }, },
-	{ "RimWorld.TrainableDef"                                        , { "RimWorld"     , "TrainableDef"                                        , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "prerequisites", "RimWorld.TrainableDef" } }, { { "requiredTrainability", "Verse.TrainabilityDef" } }, }, },
-	{ "RimWorld.TraitDef"                                            , { "RimWorld"     , "TraitDef"                                            , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "degreeDatas", "RimWorld.TraitDegreeData" }, { "conflictingTraits", "RimWorld.TraitDef" }, { "conflictingPassions", "RimWorld.SkillDef" }, { "forcedPassions", "RimWorld.SkillDef" }, { "requiredWorkTypes", "Verse.WorkTypeDef" }, { "disabledWorkTypes", "Verse.WorkTypeDef" } }, { { "disableHostilityFromFaction", "RimWorld.FactionDef" } }, }, },
-	{ "RimWorld.TraitDegreeData"                                     , { "RimWorld"     , "TraitDegreeData"                                     , ""                                                       , { "label", "labelMale", "labelFemale", "description" }, {}, { { "disallowedMentalStates", "Verse.MentalStateDef" }, { "disallowedThoughts", "RimWorld.ThoughtDef" }, { "disallowedInspirations", "RimWorld.InspirationDef" }, { "mentalBreakInspirationGainSet", "RimWorld.InspirationDef" }, { "allowedMeditationFocusTypes", "RimWorld.MeditationFocusDef" }, { "disallowedMeditationFocusTypes", "RimWorld.MeditationFocusDef" }, { "theOnlyAllowedMentalBreaks", "Verse.MentalBreakDef" }, { "abilities", "RimWorld.AbilityDef" }, { "needs", "RimWorld.NeedDef" }, { "disablesNeeds", "RimWorld.NeedDef" }, { "affectedIssuesCached", "RimWorld.IssueDef" }, { "agreeableMemesCached", "RimWorld.MemeDef" }, { "disagreeableMemesCached", "RimWorld.MemeDef" } }, { { "thinkTree", "Verse.ThinkTreeDef" }, { "randomMentalState", "Verse.MentalStateDef" }, { "forcedMentalState", "Verse.MentalStateDef" } }, }, },
-	{ "RimWorld.TransferableSorterDef"                               , { "RimWorld"     , "TransferableSorterDef"                               , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.TransportShipDef"                                    , { "RimWorld"     , "TransportShipDef"                                    , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "shipThing", "Verse.ThingDef" }, { "arrivingSkyfaller", "Verse.ThingDef" }, { "leavingSkyfaller", "Verse.ThingDef" }, { "worldObject", "RimWorld.WorldObjectDef" } }, }, },
-	{ "RimWorld.WeaponTraitDef"                                      , { "RimWorld"     , "WeaponTraitDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "equippedHediffs", "Verse.HediffDef" }, { "bondedHediffs", "Verse.HediffDef" } }, { { "bondedThought", "RimWorld.ThoughtDef" }, { "killThought", "RimWorld.ThoughtDef" } }, }, },
-	{ "RimWorld.WorkGiverDef"                                        , { "RimWorld"     , "WorkGiverDef"                                        , "Verse.Def"                                              , { "verb", "gerund", "label", "description", "ignoreConfigErrors" }, {}, { { "requiredCapacities", "Verse.PawnCapacityDef" }, { "fixedBillGiverDefs", "Verse.ThingDef" } }, { { "workType", "Verse.WorkTypeDef" }, { "equivalenceGroup", "RimWorld.WorkGiverEquivalenceGroupDef" }, { "forceMote", "Verse.ThingDef" }, { "forceFleck", "Verse.FleckDef" }, { "scannerDef", "Verse.ThingDef" } }, }, },
-	{ "RimWorld.WorkGiverEquivalenceGroupDef"                        , { "RimWorld"     , "WorkGiverEquivalenceGroupDef"                        , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "RimWorld.WorldObjectDef"                                      , { "RimWorld"     , "WorldObjectDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "IncidentTargetTags", "RimWorld.IncidentTargetTagDef" } }, { { "mapGenerator", "Verse.MapGeneratorDef" } }, }, },
-	{ "RimWorld.XenotypeCount"                                       , { "RimWorld"     , "XenotypeCount"                                       , "RimWorld.StartingPawnCount"                             , { "description" }, {}, {}, { { "xenotype", "RimWorld.XenotypeDef" } }, }, },
-	{ "RimWorld.XenotypeDef"                                         , { "RimWorld"     , "XenotypeDef"                                         , "Verse.Def"                                              , { "descriptionShort", "label", "description", "ignoreConfigErrors" }, {}, { { "genes", "Verse.GeneDef" }, { "forbiddenWeaponClasses", "WeaponClassDef" } }, { { "nameMaker", "Verse.RulePackDef" }, { "nameMakerFemale", "Verse.RulePackDef" }, { "soundDefOnImplant", "Verse.SoundDef" } }, }, },
-	{ "RimWorld.XenotypeIconDef"                                     , { "RimWorld"     , "XenotypeIconDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.AI.DutyDef"                                             , { "Verse.AI"     , "DutyDef"                                             , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.AI.Job"                                                 , { "Verse.AI"     , "Job"                                                 , ""                                                       , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, { { "def", "Verse.JobDef" }, { "plantDefToSow", "Verse.ThingDef" }, { "thingDefToCarry", "Verse.ThingDef" }, { "interaction", "RimWorld.InteractionDef" }, { "speechSoundMale", "Verse.SoundDef" }, { "speechSoundFemale", "Verse.SoundDef" }, { "jobGiverThinkTree", "Verse.ThinkTreeDef" }, { "workGiverDef", "RimWorld.WorkGiverDef" } }, }, },
-	{ "Verse.AI.JobGiver_Carried"                                    , { "Verse.AI"     , "JobGiver_Carried"                                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_ExitMap"                                    , { "Verse.AI"     , "JobGiver_ExitMap"                                    , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_ExitMapBest"                                , { "Verse.AI"     , "JobGiver_ExitMapBest"                                , "Verse.AI.JobGiver_ExitMap"                              , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_ExitMapFollowOverseer"                      , { "Verse.AI"     , "JobGiver_ExitMapFollowOverseer"                      , "Verse.AI.JobGiver_ExitMapBest"                          , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_ExitMapNearDutyTarget"                      , { "Verse.AI"     , "JobGiver_ExitMapNearDutyTarget"                      , "Verse.AI.JobGiver_ExitMap"                              , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_ExitMapPanic"                               , { "Verse.AI"     , "JobGiver_ExitMapPanic"                               , "Verse.AI.JobGiver_ExitMapBest"                          , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_ExitMapRandom"                              , { "Verse.AI"     , "JobGiver_ExitMapRandom"                              , "Verse.AI.JobGiver_ExitMap"                              , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_FightFiresNearConnectedTree"                , { "Verse.AI"     , "JobGiver_FightFiresNearConnectedTree"                , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_ForcedGoto"                                 , { "Verse.AI"     , "JobGiver_ForcedGoto"                                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_Idle"                                       , { "Verse.AI"     , "JobGiver_Idle"                                       , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_IdleError"                                  , { "Verse.AI"     , "JobGiver_IdleError"                                  , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_IdleForever"                                , { "Verse.AI"     , "JobGiver_IdleForever"                                , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_IdleWhileDespawned"                         , { "Verse.AI"     , "JobGiver_IdleWhileDespawned"                         , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_MoveToStandable"                            , { "Verse.AI"     , "JobGiver_MoveToStandable"                            , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_Orders"                                     , { "Verse.AI"     , "JobGiver_Orders"                                     , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_PickupDroppedWeapon"                        , { "Verse.AI"     , "JobGiver_PickupDroppedWeapon"                        , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_RunRandom"                                  , { "Verse.AI"     , "JobGiver_RunRandom"                                  , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_UseStylingStationAutomatic"                 , { "Verse.AI"     , "JobGiver_UseStylingStationAutomatic"                 , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_Wander"                                     , { "Verse.AI"     , "JobGiver_Wander"                                     , "Verse.AI.ThinkNode_JobGiver"                            , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderAnywhere"                             , { "Verse.AI"     , "JobGiver_WanderAnywhere"                             , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderCurrentRoom"                          , { "Verse.AI"     , "JobGiver_WanderCurrentRoom"                          , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderHerd"                                 , { "Verse.AI"     , "JobGiver_WanderHerd"                                 , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderInPen"                                , { "Verse.AI"     , "JobGiver_WanderInPen"                                , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderInRoofedCellsInPen"                   , { "Verse.AI"     , "JobGiver_WanderInRoofedCellsInPen"                   , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderMapEdge"                              , { "Verse.AI"     , "JobGiver_WanderMapEdge"                              , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderNearBreacher"                         , { "Verse.AI"     , "JobGiver_WanderNearBreacher"                         , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderNearConnectedTree"                    , { "Verse.AI"     , "JobGiver_WanderNearConnectedTree"                    , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderNearDutyLocation"                     , { "Verse.AI"     , "JobGiver_WanderNearDutyLocation"                     , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderNearFallbackLocation"                 , { "Verse.AI"     , "JobGiver_WanderNearFallbackLocation"                 , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderNearMaster"                           , { "Verse.AI"     , "JobGiver_WanderNearMaster"                           , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderNearRoamingExit"                      , { "Verse.AI"     , "JobGiver_WanderNearRoamingExit"                      , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderOwnRoom"                              , { "Verse.AI"     , "JobGiver_WanderOwnRoom"                              , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.JobGiver_WanderRoped"                                , { "Verse.AI"     , "JobGiver_WanderRoped"                                , "Verse.AI.JobGiver_Wander"                               , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AI.ThinkNode_JobGiver"                                  , { "Verse.AI"     , "ThinkNode_JobGiver"                                  , "Verse.AI.ThinkNode"                                     , { "reportStringOverride", "crawlingReportStringOverride" }, {}, {}, {}, }, },
-	{ "Verse.AnimationDef"                                           , { "Verse"        , "AnimationDef"                                        , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.ApparelLayerDef"                                        , { "Verse"        , "ApparelLayerDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.BodyDef"                                                , { "Verse"        , "BodyDef"                                             , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "cachedAllParts", "Verse.BodyPartRecord" }, { "cachedPartsVulnerableToFrostbite", "Verse.BodyPartRecord" } }, { { "corePart", "Verse.BodyPartRecord" } }, }, },
-	{ "Verse.BodyPartDef"                                            , { "Verse"        , "BodyPartDef"                                         , "Verse.Def"                                              , { "labelShort", "removeRecipeLabelOverride", "label", "description", "ignoreConfigErrors" }, {}, { { "tags", "Verse.BodyPartTagDef" } }, { { "spawnThingOnRemoved", "Verse.ThingDef" } }, }, },
-	{ "Verse.BodyPartGroupDef"                                       , { "Verse"        , "BodyPartGroupDef"                                    , "Verse.Def"                                              , { "labelShort", "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.BodyPartRecord"                                         , { "Verse"        , "BodyPartRecord"                                      , ""                                                       , { "customLabel" }, {}, { { "parts", "Verse.BodyPartRecord" }, { "groups", "Verse.BodyPartGroupDef" } }, { { "body", "Verse.BodyDef" }, { "def", "Verse.BodyPartDef" }, { "parent", "Verse.BodyPartRecord" } }, }, },
-	{ "Verse.BodyPartTagDef"                                         , { "Verse"        , "BodyPartTagDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.BuildableDef"                                           , { "Verse"        , "BuildableDef"                                        , "Verse.Def"                                              , { "stuffCategorySummary", "label", "description", "ignoreConfigErrors" }, {}, { { "stuffCategories", "RimWorld.StuffCategoryDef" }, { "buildingPrerequisites", "Verse.ThingDef" }, { "researchPrerequisites", "Verse.ResearchProjectDef" } }, { { "dominantStyleCategory", "Verse.StyleCategoryDef" }, { "terrainAffordanceNeeded", "Verse.TerrainAffordanceDef" }, { "repairEffect", "Verse.EffecterDef" }, { "constructEffect", "Verse.EffecterDef" }, { "designationCategory", "Verse.DesignationCategoryDef" }, { "designatorDropdown", "Verse.DesignatorDropdownGroupDef" }, { "designationHotKey", "Verse.KeyBindingDef" }, { "blueprintDef", "Verse.ThingDef" }, { "installBlueprintDef", "Verse.ThingDef" }, { "frameDef", "Verse.ThingDef" } }, }, },
-	{ "Verse.ClamorDef"                                              , { "Verse"        , "ClamorDef"                                           , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.CreepJoinerAggressiveDef"                               , { "Verse"        , "CreepJoinerAggressiveDef"                            , "Verse.CreepJoinerBaseDef"                               , { "message", "letterLabel", "letterDesc", "surgicalInspectionLetterExtra", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "letterDef", "Verse.LetterDef" } }, }, },
-	{ "Verse.CreepJoinerBaseDef"                                     , { "Verse"        , "CreepJoinerBaseDef"                                  , "Verse.Def"                                              , { "surgicalInspectionLetterExtra", "label", "description", "ignoreConfigErrors" }, {}, { { "excludes", "Verse.CreepJoinerBaseDef" }, { "requires", "Verse.CreepJoinerBaseDef" } }, {}, }, },
-	{ "Verse.CreepJoinerBenefitDef"                                  , { "Verse"        , "CreepJoinerBenefitDef"                               , "Verse.CreepJoinerBaseDef"                               , { "letterExtra", "surgicalInspectionLetterExtra", "label", "description", "ignoreConfigErrors" }, {}, { { "hediffs", "Verse.HediffDef" }, { "abilities", "RimWorld.AbilityDef" } }, {}, }, },
-	{ "Verse.CreepJoinerDownsideDef"                                 , { "Verse"        , "CreepJoinerDownsideDef"                              , "Verse.CreepJoinerBaseDef"                               , { "letterLabel", "letterDesc", "surgicalInspectionLetterExtra", "label", "description", "ignoreConfigErrors" }, {}, { { "hediffs", "Verse.HediffDef" }, { "abilities", "RimWorld.AbilityDef" } }, { { "letterDef", "Verse.LetterDef" } }, }, },
-	{ "Verse.CreepJoinerFormKindDef"                                 , { "Verse"        , "CreepJoinerFormKindDef"                              , "Verse.PawnKindDef"                                      , { "letterLabel", "letterPrompt", "labelPlural", "labelMale", "labelMalePlural", "labelFemale", "labelFemalePlural", "label", "description", "ignoreConfigErrors" }, {}, { { "forcedHeadTypes", "Verse.HeadTypeDef" }, { "excludes", "Verse.CreepJoinerBaseDef" }, { "requires", "Verse.CreepJoinerBaseDef" }, { "lifeStages", "Verse.PawnKindLifeStage" }, { "disallowedTraits", "RimWorld.TraitDef" }, { "abilities", "RimWorld.AbilityDef" }, { "fixedChildBackstories", "RimWorld.BackstoryDef" }, { "fixedAdultBackstories", "RimWorld.BackstoryDef" }, { "titleSelectOne", "RimWorld.RoyalTitleDef" }, { "meleeAttackInfectionPathways", "RimWorld.InfectionPathwayDef" }, { "rangedAttackInfectionPathways", "RimWorld.InfectionPathwayDef" }, { "apparelRequired", "Verse.ThingDef" }, { "techHediffsRequired", "Verse.ThingDef" }, { "forcedAddictions", "RimWorld.ChemicalDef" } }, { { "race", "Verse.ThingDef" }, { "defaultFactionType", "RimWorld.FactionDef" }, { "mutant", "RimWorld.MutantDef" }, { "forcedHair", "RimWorld.HairDef" }, { "nameMaker", "Verse.RulePackDef" }, { "nameMakerFemale", "Verse.RulePackDef" }, { "titleRequired", "RimWorld.RoyalTitleDef" }, { "minTitleRequired", "RimWorld.RoyalTitleDef" }, { "weaponStuffOverride", "Verse.ThingDef" }, { "weaponStyleDef", "Verse.ThingStyleDef" }, { "invFoodDef", "Verse.ThingDef" } }, }, },
-	{ "Verse.CreepJoinerRejectionDef"                                , { "Verse"        , "CreepJoinerRejectionDef"                             , "Verse.CreepJoinerBaseDef"                               , { "letterLabel", "letterDesc", "surgicalInspectionLetterExtra", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "letterDef", "Verse.LetterDef" } }, }, },
-	{ "Verse.DamageArmorCategoryDef"                                 , { "Verse"        , "DamageArmorCategoryDef"                              , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "multStat", "RimWorld.StatDef" }, { "armorRatingStat", "RimWorld.StatDef" } }, }, },
-	{ "Verse.DamageDef"                                              , { "Verse"        , "DamageDef"                                           , "Verse.Def"                                              , { "adaptedText", "deathMessage", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "combatLogRules", "Verse.RulePackDef" }, { "stunResistStat", "RimWorld.StatDef" }, { "impactSoundType", "Verse.Sound.ImpactSoundTypeDef" }, { "damageEffecter", "Verse.EffecterDef" }, { "armorCategory", "Verse.DamageArmorCategoryDef" }, { "hediff", "Verse.HediffDef" }, { "hediffSkin", "Verse.HediffDef" }, { "hediffSolid", "Verse.HediffDef" }, { "explosionCellMote", "Verse.ThingDef" }, { "explosionCellFleck", "Verse.FleckDef" }, { "explosionInteriorEffecter", "Verse.EffecterDef" }, { "explosionInteriorMote", "Verse.ThingDef" }, { "explosionInteriorFleck", "Verse.FleckDef" }, { "explosionCenterMote", "Verse.ThingDef" }, { "explosionCenterFleck", "Verse.FleckDef" }, { "explosionCenterEffecter", "Verse.EffecterDef" }, { "explosionCellEffecter", "Verse.EffecterDef" }, { "soundExplosion", "Verse.SoundDef" } }, }, },
-	{ "Verse.Def"                                                    , { "Verse"        , "Def"                                                 , "Verse.Editable"                                         , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.DesignationCategoryDef"                                 , { "Verse"        , "DesignationCategoryDef"                              , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "researchPrerequisites", "Verse.ResearchProjectDef" } }, { { "bindingCatDef", "Verse.KeyBindingCategoryDef" } }, }, },
-	{ "Verse.DesignationDef"                                         , { "Verse"        , "DesignationDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.DesignatorDropdownGroupDef"                             , { "Verse"        , "DesignatorDropdownGroupDef"                          , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.Editable"                                               , { "Verse"        , "Editable"                                            , ""                                                       , {}, {}, {}, {}, }, },
-	{ "Verse.EffecterDef"                                            , { "Verse"        , "EffecterDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.FleckDef"                                               , { "Verse"        , "FleckDef"                                            , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "landSound", "Verse.SoundDef" } }, }, },
-	{ "Verse.GameConditionDef"                                       , { "Verse"        , "GameConditionDef"                                    , "Verse.Def"                                              , { "startMessage", "endMessage", "letterText", "descriptionFuture", "label", "description", "ignoreConfigErrors" }, {}, { { "exclusiveConditions", "Verse.GameConditionDef" }, { "letterHyperlinks", "Verse.ThingDef" }, { "silencedByConditions", "Verse.GameConditionDef" } }, { { "letterDef", "Verse.LetterDef" }, { "weatherDef", "Verse.WeatherDef" } }, }, },
-	{ "Verse.GeneCategoryDef"                                        , { "Verse"        , "GeneCategoryDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.GeneDef"                                                , { "Verse"        , "GeneDef"                                             , "Verse.Def"                                              , { "labelShortAdj", "resourceLabel", "resourceDescription", "label", "description", "ignoreConfigErrors" }, { "customEffectDescriptions" }, { { "abilities", "RimWorld.AbilityDef" }, { "disablesNeeds", "RimWorld.NeedDef" }, { "makeImmuneTo", "Verse.HediffDef" }, { "hediffGiversCannotGive", "Verse.HediffDef" }, { "forcedHeadTypes", "Verse.HeadTypeDef" } }, { { "displayCategory", "Verse.GeneCategoryDef" }, { "fur", "RimWorld.FurDef" }, { "soundCall", "Verse.SoundDef" }, { "soundDeath", "Verse.SoundDef" }, { "soundWounded", "Verse.SoundDef" }, { "causesNeed", "RimWorld.NeedDef" }, { "deathHistoryEvent", "RimWorld.HistoryEventDef" }, { "chemical", "RimWorld.ChemicalDef" }, { "forcedHair", "RimWorld.HairDef" }, { "mentalBreakDef", "Verse.MentalBreakDef" }, { "prerequisite", "Verse.GeneDef" } }, }, },
-	{ "Verse.GeneSymbolPack+WeightedSymbol"                          , { "Verse"        , "WeightedSymbol"                                      , ""                                                       , { "symbol" }, {}, {}, {}, }, },
-	{ "Verse.GenStepDef"                                             , { "Verse"        , "GenStepDef"                                          , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "linkWithSite", "RimWorld.SitePartDef" } }, }, },
-	{ "Verse.Grammar.Rule_String"                                    , { "Verse.Grammar", "Rule_String"                                         , "Verse.Grammar.Rule"                                     , { "output" }, {}, {}, {}, }, },
-	{ "Verse.Grammar.RulePack"                                       , { "Verse.Grammar", "RulePack"                                            , ""                                                       , {}, { "rulesStrings" }, { { "include", "Verse.RulePackDef" } }, {}, }, },
-	{ "Verse.HeadTypeDef"                                            , { "Verse"        , "HeadTypeDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "requiredGenes", "Verse.GeneDef" } }, {}, }, },
-	{ "Verse.HediffCompProperties_CauseMentalState"                  , { "Verse"        , "HediffCompProperties_CauseMentalState"               , "Verse.HediffCompProperties"                             , { "overrideLetterLabel", "overrideLetterDesc" }, {}, {}, { { "animalMentalState", "Verse.MentalStateDef" }, { "animalMentalStateAlias", "Verse.MentalStateDef" }, { "humanMentalState", "Verse.MentalStateDef" }, { "letterDef", "Verse.LetterDef" } }, }, },
-	{ "Verse.HediffCompProperties_Disappears"                        , { "Verse"        , "HediffCompProperties_Disappears"                     , "Verse.HediffCompProperties"                             , { "messageOnDisappear", "letterTextOnDisappear", "letterLabelOnDisappear" }, {}, {}, { { "requiredMentalState", "Verse.MentalStateDef" } }, }, },
-	{ "Verse.HediffCompProperties_DisappearsAndKills"                , { "Verse"        , "HediffCompProperties_DisappearsAndKills"             , "Verse.HediffCompProperties_DisappearsDisableable"       , { "messageOnDisappear", "letterTextOnDisappear", "letterLabelOnDisappear" }, {}, {}, { { "requiredMentalState", "Verse.MentalStateDef" } }, }, },
-	{ "Verse.HediffCompProperties_DisappearsDisableable"             , { "Verse"        , "HediffCompProperties_DisappearsDisableable"          , "Verse.HediffCompProperties_Disappears"                  , { "messageOnDisappear", "letterTextOnDisappear", "letterLabelOnDisappear" }, {}, {}, { { "requiredMentalState", "Verse.MentalStateDef" } }, }, },
-	{ "Verse.HediffCompProperties_FleshbeastEmerge"                  , { "Verse"        , "HediffCompProperties_FleshbeastEmerge"               , "Verse.HediffCompProperties"                             , { "letterLabel", "letterText" }, {}, {}, {}, }, },
-	{ "Verse.HediffCompProperties_GetsPermanent"                     , { "Verse"        , "HediffCompProperties_GetsPermanent"                  , "Verse.HediffCompProperties"                             , { "permanentLabel", "instantlyPermanentLabel" }, {}, {}, {}, }, },
-	{ "Verse.HediffCompProperties_LetterOnDeath"                     , { "Verse"        , "HediffCompProperties_LetterOnDeath"                  , "Verse.HediffCompProperties"                             , { "letterText", "letterLabel" }, {}, {}, { { "letterDef", "Verse.LetterDef" } }, }, },
-	{ "Verse.HediffCompProperties_MessageAboveSeverity"              , { "Verse"        , "HediffCompProperties_MessageAboveSeverity"           , "Verse.HediffCompProperties"                             , { "message" }, {}, {}, { { "messageType", "Verse.MessageTypeDef" } }, }, },
-	{ "Verse.HediffCompProperties_MessageAfterTicks"                 , { "Verse"        , "HediffCompProperties_MessageAfterTicks"              , "Verse.HediffCompProperties"                             , { "message", "letterLabel", "letterText" }, {}, {}, { { "messageType", "Verse.MessageTypeDef" }, { "letterType", "Verse.LetterDef" } }, }, },
-	{ "Verse.HediffCompProperties_MessageBase"                       , { "Verse"        , "HediffCompProperties_MessageBase"                    , "Verse.HediffCompProperties"                             , { "message" }, {}, {}, { { "messageType", "Verse.MessageTypeDef" } }, }, },
-	{ "Verse.HediffCompProperties_MessageOnRemoval"                  , { "Verse"        , "HediffCompProperties_MessageOnRemoval"               , "Verse.HediffCompProperties_MessageBase"                 , { "message" }, {}, {}, { { "messageType", "Verse.MessageTypeDef" } }, }, },
-	{ "Verse.HediffCompProperties_MessageStageIncreased"             , { "Verse"        , "HediffCompProperties_MessageStageIncreased"          , "Verse.HediffCompProperties"                             , { "message" }, {}, {}, { { "messageType", "Verse.MessageTypeDef" } }, }, },
-	{ "Verse.HediffCompProperties_RandomizeSeverityPhases"           , { "Verse"        , "HediffCompProperties_RandomizeSeverityPhases"        , "Verse.HediffCompProperties_Randomizer"                  , { "notifyMessage" }, {}, { { "phases", "Verse.HediffCompProperties_RandomizeSeverityPhases+Phase" } }, {}, }, },
-	{ "Verse.HediffCompProperties_RandomizeSeverityPhases+Phase"     , { "Verse"        , "Phase"                                               , ""                                                       , { "labelPrefix", "descriptionExtra" }, {}, {}, {}, }, },
-	{ "Verse.HediffCompProperties_RandomizeStageWithInterval"        , { "Verse"        , "HediffCompProperties_RandomizeStageWithInterval"     , "Verse.HediffCompProperties_Randomizer"                  , { "notifyMessage" }, {}, {}, {}, }, },
-	{ "Verse.HediffCompProperties_RemoveIfOtherHediff"               , { "Verse"        , "HediffCompProperties_RemoveIfOtherHediff"            , "Verse.HediffCompProperties_MessageBase"                 , { "message" }, {}, { { "hediffs", "Verse.HediffDef" } }, { { "messageType", "Verse.MessageTypeDef" } }, }, },
-	{ "Verse.HediffCompProperties_ReplaceHediff"                     , { "Verse"        , "HediffCompProperties_ReplaceHediff"                  , "Verse.HediffCompProperties"                             , { "message", "letterLabel", "letterDesc" }, {}, {}, { { "messageDef", "Verse.MessageTypeDef" }, { "letterDef", "Verse.LetterDef" } }, }, },
-	{ "Verse.HediffCompProperties_SurgeryInspectable"                , { "Verse"        , "HediffCompProperties_SurgeryInspectable"             , "Verse.HediffCompProperties"                             , { "surgicalDetectionDesc" }, {}, {}, {}, }, },
-	{ "Verse.HediffCompProperties_SurgeryInspectableMetalHorror"     , { "Verse"        , "HediffCompProperties_SurgeryInspectableMetalHorror"  , "Verse.HediffCompProperties_SurgeryInspectable"          , { "surgicalDetectionDesc" }, {}, {}, {}, }, },
-	{ "Verse.HediffDef"                                              , { "Verse"        , "HediffDef"                                           , "Verse.Def"                                              , { "descriptionShort", "overrideTooltip", "extraTooltip", "labelNoun", "battleStateLabel", "labelNounPretty", "targetPrefix", "label", "description", "ignoreConfigErrors" }, {}, { { "stages", "Verse.HediffStage" }, { "disablesNeeds", "RimWorld.NeedDef" }, { "onlyLifeThreateningTo", "Verse.BodyPartDef" }, { "possiblePathways", "Verse.HediffInfectionPathway" }, { "givesInfectionPathways", "RimWorld.InfectionPathwayDef" }, { "allowedMeditationFocusTypes", "RimWorld.MeditationFocusDef" }, { "abilities", "RimWorld.AbilityDef" }, { "removeOnRedressIfNotOfKind", "Verse.PawnKindDef" }, { "reportStringOverrides", "Verse.HediffDef+ReportStringOverride" } }, { { "spawnThingOnRemoved", "Verse.ThingDef" }, { "causesNeed", "RimWorld.NeedDef" }, { "taleOnVisible", "RimWorld.TaleDef" }, { "defaultInstallPart", "Verse.BodyPartDef" }, { "skinShader", "Verse.ShaderTypeDef" } }, }, },
-	{ "Verse.HediffDef+ReportStringOverride"                         , { "Verse"        , "ReportStringOverride"                                , ""                                                       , { "reportString" }, {}, {}, { { "jobDef", "Verse.JobDef" } }, }, },
-	{ "Verse.HediffInfectionPathway"                                 , { "Verse"        , "HediffInfectionPathway"                              , ""                                                       , { "explanation" }, {}, {}, { { "pathwayDef", "RimWorld.InfectionPathwayDef" } }, }, },
-	{ "Verse.HediffStage"                                            , { "Verse"        , "HediffStage"                                         , ""                                                       , { "label", "overrideLabel", "overrideTooltip", "extraTooltip" }, {}, { { "makeImmuneTo", "Verse.HediffDef" } }, { { "tale", "RimWorld.TaleDef" }, { "statOffsetEffectMultiplier", "RimWorld.StatDef" }, { "statFactorEffectMultiplier", "RimWorld.StatDef" }, { "capacityFactorEffectMultiplier", "RimWorld.StatDef" } }, }, },
-	{ "Verse.IdeoStoryPatternDef"                                    , { "Verse"        , "IdeoStoryPatternDef"                                 , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "rules", "Verse.Grammar.RulePack" } }, }, },
-	{ "Verse.ImplementOwnerTypeDef"                                  , { "Verse"        , "ImplementOwnerTypeDef"                               , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.InventoryStockGroupDef"                                 , { "Verse"        , "InventoryStockGroupDef"                              , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "thingDefs", "Verse.ThingDef" } }, { { "defaultThingDef", "Verse.ThingDef" } }, }, },
-	{ "Verse.JobDef"                                                 , { "Verse"        , "JobDef"                                              , "Verse.Def"                                              , { "reportString", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "taleOnCompletion", "RimWorld.TaleDef" }, { "joySkill", "RimWorld.SkillDef" }, { "joyKind", "RimWorld.JoyKindDef" }, { "containerReservationLayer", "Verse.ReservationLayerDef" } }, }, },
-	{ "Verse.KeyBindingCategoryDef"                                  , { "Verse"        , "KeyBindingCategoryDef"                               , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "checkForConflicts", "Verse.KeyBindingCategoryDef" } }, {}, }, },
-	{ "Verse.KeyBindingDef"                                          , { "Verse"        , "KeyBindingDef"                                       , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "category", "Verse.KeyBindingCategoryDef" } }, }, },
-	{ "Verse.LetterDef"                                              , { "Verse"        , "LetterDef"                                           , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "arriveSound", "Verse.SoundDef" } }, }, },
-	{ "Verse.LogEntryDef"                                            , { "Verse"        , "LogEntryDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.ManeuverDef"                                            , { "Verse"        , "ManeuverDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "requiredCapacity", "Verse.ToolCapacityDef" }, { "verb", "Verse.VerbProperties" }, { "combatLogRulesHit", "Verse.RulePackDef" }, { "combatLogRulesDeflect", "Verse.RulePackDef" }, { "combatLogRulesMiss", "Verse.RulePackDef" }, { "combatLogRulesDodge", "Verse.RulePackDef" }, { "logEntryDef", "Verse.LogEntryDef" } }, }, },
-	{ "Verse.MapGeneratorDef"                                        , { "Verse"        , "MapGeneratorDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "genSteps", "Verse.GenStepDef" } }, { { "roofDef", "Verse.RoofDef" } }, }, },
-	{ "Verse.MechWorkModeDef"                                        , { "Verse"        , "MechWorkModeDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.MentalBreakDef"                                         , { "Verse"        , "MentalBreakDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "mentalState", "Verse.MentalStateDef" }, { "requiredTrait", "RimWorld.TraitDef" }, { "requiredGene", "Verse.GeneDef" }, { "requiredPrecept", "RimWorld.PreceptDef" } }, }, },
-	{ "Verse.MentalFitDef"                                           , { "Verse"        , "MentalFitDef"                                        , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "mentalState", "Verse.MentalStateDef" } }, }, },
-	{ "Verse.MentalStateDef"                                         , { "Verse"        , "MentalStateDef"                                      , "Verse.Def"                                              , { "beginLetter", "beginLetterLabel", "recoveryMessage", "baseInspectLine", "label", "description", "ignoreConfigErrors" }, {}, { { "requiredCapacities", "Verse.PawnCapacityDef" }, { "blockInteractionInitiationExcept", "RimWorld.InteractionDef" }, { "blockInteractionRecipientExcept", "RimWorld.InteractionDef" } }, { { "stateEffecter", "Verse.EffecterDef" }, { "tale", "RimWorld.TaleDef" }, { "moodRecoveryThought", "RimWorld.ThoughtDef" }, { "beginLetterDef", "Verse.LetterDef" } }, }, },
-	{ "Verse.MessageTypeDef"                                         , { "Verse"        , "MessageTypeDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "sound", "Verse.SoundDef" } }, }, },
-	{ "Verse.OptionCategoryDef"                                      , { "Verse"        , "OptionCategoryDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.OrderedTakeGroupDef"                                    , { "Verse"        , "OrderedTakeGroupDef"                                 , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.PawnCapacityDef"                                        , { "Verse"        , "PawnCapacityDef"                                     , "Verse.Def"                                              , { "labelMechanoids", "labelAnimals", "labelAnomalyEntity", "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.PawnKindDef"                                            , { "Verse"        , "PawnKindDef"                                         , "Verse.Def"                                              , { "labelPlural", "labelMale", "labelMalePlural", "labelFemale", "labelFemalePlural", "label", "description", "ignoreConfigErrors" }, {}, { { "lifeStages", "Verse.PawnKindLifeStage" }, { "disallowedTraits", "RimWorld.TraitDef" }, { "abilities", "RimWorld.AbilityDef" }, { "fixedChildBackstories", "RimWorld.BackstoryDef" }, { "fixedAdultBackstories", "RimWorld.BackstoryDef" }, { "titleSelectOne", "RimWorld.RoyalTitleDef" }, { "meleeAttackInfectionPathways", "RimWorld.InfectionPathwayDef" }, { "rangedAttackInfectionPathways", "RimWorld.InfectionPathwayDef" }, { "apparelRequired", "Verse.ThingDef" }, { "techHediffsRequired", "Verse.ThingDef" }, { "forcedAddictions", "RimWorld.ChemicalDef" } }, { { "race", "Verse.ThingDef" }, { "defaultFactionType", "RimWorld.FactionDef" }, { "mutant", "RimWorld.MutantDef" }, { "forcedHair", "RimWorld.HairDef" }, { "nameMaker", "Verse.RulePackDef" }, { "nameMakerFemale", "Verse.RulePackDef" }, { "titleRequired", "RimWorld.RoyalTitleDef" }, { "minTitleRequired", "RimWorld.RoyalTitleDef" }, { "weaponStuffOverride", "Verse.ThingDef" }, { "weaponStyleDef", "Verse.ThingStyleDef" }, { "invFoodDef", "Verse.ThingDef" } }, }, },
-	{ "Verse.PawnKindLifeStage"                                      , { "Verse"        , "PawnKindLifeStage"                                   , ""                                                       , { "label", "labelPlural", "labelMale", "labelMalePlural", "labelFemale", "labelFemalePlural" }, {}, {}, {}, }, },
-	{ "Verse.PawnRenderNodeTagDef"                                   , { "Verse"        , "PawnRenderNodeTagDef"                                , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.PawnRenderTreeDef"                                      , { "Verse"        , "PawnRenderTreeDef"                                   , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.PlaceDef"                                               , { "Verse"        , "PlaceDef"                                            , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "placeRules", "Verse.Grammar.RulePack" } }, }, },
-	{ "Verse.RaceProperties"                                         , { "Verse"        , "RaceProperties"                                      , ""                                                       , { "meatLabel" }, {}, { { "hediffGiverSets", "RimWorld.HediffGiverSetDef" }, { "willNeverEat", "Verse.ThingDef" }, { "mechEnabledWorkTypes", "Verse.WorkTypeDef" } }, { { "fleshType", "RimWorld.FleshTypeDef" }, { "bloodDef", "Verse.ThingDef" }, { "bloodSmearDef", "Verse.ThingDef" }, { "thinkTreeMain", "Verse.ThinkTreeDef" }, { "thinkTreeConstant", "Verse.ThinkTreeDef" }, { "dutyBoss", "Verse.AI.DutyDef" }, { "body", "Verse.BodyDef" }, { "renderTree", "Verse.PawnRenderTreeDef" }, { "startingAnimation", "Verse.AnimationDef" }, { "linkedCorpseKind", "Verse.ThingDef" }, { "bulletStaggerEffecterDef", "Verse.EffecterDef" }, { "trainability", "Verse.TrainabilityDef" }, { "nameGenerator", "Verse.RulePackDef" }, { "nameGeneratorFemale", "Verse.RulePackDef" }, { "specificMeatDef", "Verse.ThingDef" }, { "useMeatFrom", "Verse.ThingDef" }, { "useLeatherFrom", "Verse.ThingDef" }, { "leatherDef", "Verse.ThingDef" }, { "soundMeleeHitPawn", "Verse.SoundDef" }, { "soundMeleeHitBuilding", "Verse.SoundDef" }, { "soundMeleeMiss", "Verse.SoundDef" }, { "soundMeleeDodge", "Verse.SoundDef" }, { "soundAmbience", "Verse.SoundDef" }, { "soundMoving", "Verse.SoundDef" }, { "soundEating", "Verse.SoundDef" }, { "knowledgeCategory", "RimWorld.KnowledgeCategoryDef" }, { "meatDef", "Verse.ThingDef" }, { "corpseDef", "Verse.ThingDef" }, { "unnaturalCorpseDef", "Verse.ThingDef" }, { "cachedAnyPawnKind", "Verse.PawnKindDef" } }, }, },
-	{ "Verse.RecipeDef"                                              , { "Verse"        , "RecipeDef"                                           , "Verse.Def"                                              , { "jobString", "successfullyRemovedHediffMessage", "label", "description", "ignoreConfigErrors" }, {}, { { "forceHiddenSpecialFilters", "Verse.SpecialThingFilterDef" }, { "recipeUsers", "Verse.ThingDef" }, { "appliedOnFixedBodyParts", "Verse.BodyPartDef" }, { "appliedOnFixedBodyPartGroups", "Verse.BodyPartGroupDef" }, { "mutantPrerequisite", "RimWorld.MutantDef" }, { "mutantBlacklist", "RimWorld.MutantDef" }, { "memePrerequisitesAny", "RimWorld.MemeDef" }, { "researchPrerequisites", "Verse.ResearchProjectDef" }, { "premultipliedSmallIngredients", "Verse.ThingDef" } }, { { "requiredGiverWorkType", "Verse.WorkTypeDef" }, { "workSpeedStat", "RimWorld.StatDef" }, { "efficiencyStat", "RimWorld.StatDef" }, { "workTableEfficiencyStat", "RimWorld.StatDef" }, { "workTableSpeedStat", "RimWorld.StatDef" }, { "fixedIngredientFilter", "Verse.ThingFilter" }, { "defaultIngredientFilter", "Verse.ThingFilter" }, { "unfinishedThingDef", "Verse.ThingDef" }, { "workSkill", "RimWorld.SkillDef" }, { "effectWorking", "Verse.EffecterDef" }, { "soundWorking", "Verse.SoundDef" }, { "uiIconThing", "Verse.ThingDef" }, { "addsHediff", "Verse.HediffDef" }, { "removesHediff", "Verse.HediffDef" }, { "addsHediffOnFailure", "Verse.HediffDef" }, { "changesHediffLevel", "Verse.HediffDef" }, { "surgeryOutcomeEffect", "RimWorld.SurgeryOutcomeEffectDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" }, { "conceptLearned", "RimWorld.ConceptDef" } }, }, },
-	{ "Verse.RecipeMakerProperties"                                  , { "Verse"        , "RecipeMakerProperties"                               , ""                                                       , { "label" }, {}, { { "recipeUsers", "Verse.ThingDef" }, { "memePrerequisitesAny", "RimWorld.MemeDef" }, { "researchPrerequisites", "Verse.ResearchProjectDef" } }, { { "workSpeedStat", "RimWorld.StatDef" }, { "efficiencyStat", "RimWorld.StatDef" }, { "unfinishedThingDef", "Verse.ThingDef" }, { "defaultIngredientFilter", "Verse.ThingFilter" }, { "workSkill", "RimWorld.SkillDef" }, { "requiredGiverWorkType", "Verse.WorkTypeDef" }, { "effectWorking", "Verse.EffecterDef" }, { "soundWorking", "Verse.SoundDef" }, { "researchPrerequisite", "Verse.ResearchProjectDef" } }, }, },
-	{ "Verse.ResearchProjectDef"                                     , { "Verse"        , "ResearchProjectDef"                                  , "Verse.Def"                                              , { "discoveredLetterTitle", "discoveredLetterText", "label", "description", "ignoreConfigErrors" }, {}, { { "prerequisites", "Verse.ResearchProjectDef" }, { "hiddenPrerequisites", "Verse.ResearchProjectDef" }, { "requiredByThis", "Verse.ResearchProjectDef" }, { "requiredResearchFacilities", "Verse.ThingDef" }, { "tags", "Verse.ResearchProjectTagDef" }, { "requiredAnalyzed", "Verse.ThingDef" }, { "cachedUnlockedDefs", "Verse.Def" } }, { { "requiredResearchBuilding", "Verse.ThingDef" }, { "tab", "RimWorld.ResearchTabDef" }, { "knowledgeCategory", "RimWorld.KnowledgeCategoryDef" }, { "teachConcept", "RimWorld.ConceptDef" }, { "generalRules", "Verse.Grammar.RulePack" }, { "cachedTechprint", "Verse.ThingDef" } }, }, },
-	{ "Verse.ResearchProjectTagDef"                                  , { "Verse"        , "ResearchProjectTagDef"                               , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.ReservationLayerDef"                                    , { "Verse"        , "ReservationLayerDef"                                 , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.RoofDef"                                                , { "Verse"        , "RoofDef"                                             , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "collapseLeavingThingDef", "Verse.ThingDef" }, { "filthLeaving", "Verse.ThingDef" }, { "soundPunchThrough", "Verse.SoundDef" } }, }, },
-	{ "Verse.RoomRoleDef"                                            , { "Verse"        , "RoomRoleDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "relatedStats", "Verse.RoomStatDef" } }, {}, }, },
-	{ "Verse.RoomStatDef"                                            , { "Verse"        , "RoomStatDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "inputStat", "Verse.RoomStatDef" } }, }, },
-	{ "Verse.RulePackDef"                                            , { "Verse"        , "RulePackDef"                                         , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "include", "Verse.RulePackDef" } }, { { "rulePack", "Verse.Grammar.RulePack" } }, }, },
-	{ "Verse.ScatterableDef"                                         , { "Verse"        , "ScatterableDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.ShaderTypeDef"                                          , { "Verse"        , "ShaderTypeDef"                                       , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.SongDef"                                                , { "Verse"        , "SongDef"                                             , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "minRoyalTitle", "RimWorld.RoyalTitleDef" } }, }, },
-	{ "Verse.Sound.ImpactSoundTypeDef"                               , { "Verse.Sound"  , "ImpactSoundTypeDef"                                  , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "soundDef", "Verse.SoundDef" } }, }, },
-	{ "Verse.SoundDef"                                               , { "Verse"        , "SoundDef"                                            , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "sustainStartSound", "Verse.SoundDef" }, { "sustainStopSound", "Verse.SoundDef" }, { "sustainFadeoutStartSound", "Verse.SoundDef" } }, }, },
-	{ "Verse.SpecialThingFilterDef"                                  , { "Verse"        , "SpecialThingFilterDef"                               , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "parentCategory", "Verse.ThingCategoryDef" } }, }, },
-	{ "Verse.StuffAppearanceDef"                                     , { "Verse"        , "StuffAppearanceDef"                                  , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.StyleCategoryDef"                                       , { "Verse"        , "StyleCategoryDef"                                    , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "addDesignators", "Verse.BuildableDef" }, { "addDesignatorGroups", "Verse.DesignatorDropdownGroupDef" }, { "cachedAllDesignatorBuildables", "Verse.BuildableDef" } }, { { "soundOngoingRitual", "Verse.SoundDef" }, { "ritualVisualEffectDef", "RimWorld.RitualVisualEffectDef" } }, }, },
-	{ "Verse.SubcameraDef"                                           , { "Verse"        , "SubcameraDef"                                        , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.TerrainAffordanceDef"                                   , { "Verse"        , "TerrainAffordanceDef"                                , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.TerrainDef"                                             , { "Verse"        , "TerrainDef"                                          , "Verse.BuildableDef"                                     , { "stuffCategorySummary", "label", "description", "ignoreConfigErrors" }, {}, { { "affordances", "Verse.TerrainAffordanceDef" }, { "tools", "Verse.Tool" }, { "stuffCategories", "RimWorld.StuffCategoryDef" }, { "buildingPrerequisites", "Verse.ThingDef" }, { "researchPrerequisites", "Verse.ResearchProjectDef" } }, { { "smoothedTerrain", "Verse.TerrainDef" }, { "colorDef", "RimWorld.ColorDef" }, { "driesTo", "Verse.TerrainDef" }, { "burnedDef", "Verse.TerrainDef" }, { "traversedThought", "RimWorld.ThoughtDef" }, { "destroyEffect", "Verse.EffecterDef" }, { "destroyEffectWater", "Verse.EffecterDef" }, { "pollutionShaderType", "Verse.ShaderTypeDef" }, { "generatedFilth", "Verse.ThingDef" }, { "dominantStyleCategory", "Verse.StyleCategoryDef" }, { "terrainAffordanceNeeded", "Verse.TerrainAffordanceDef" }, { "repairEffect", "Verse.EffecterDef" }, { "constructEffect", "Verse.EffecterDef" }, { "designationCategory", "Verse.DesignationCategoryDef" }, { "designatorDropdown", "Verse.DesignatorDropdownGroupDef" }, { "designationHotKey", "Verse.KeyBindingDef" }, { "blueprintDef", "Verse.ThingDef" }, { "installBlueprintDef", "Verse.ThingDef" }, { "frameDef", "Verse.ThingDef" } }, }, },
-	{ "Verse.ThingCategoryDef"                                       , { "Verse"        , "ThingCategoryDef"                                    , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "childCategories", "Verse.ThingCategoryDef" }, { "childThingDefs", "Verse.ThingDef" }, { "sortedChildThingDefsCached", "Verse.ThingDef" }, { "childSpecialFilters", "Verse.SpecialThingFilterDef" } }, { { "parent", "Verse.ThingCategoryDef" } }, }, },
-	{ "Verse.ThingDef"                                               , { "Verse"        , "ThingDef"                                            , "Verse.BuildableDef"                                     , { "stuffCategorySummary", "label", "description", "ignoreConfigErrors" }, {}, { { "virtualDefs", "Verse.ThingDef" }, { "recipes", "Verse.RecipeDef" }, { "thingCategories", "Verse.ThingCategoryDef" }, { "verbs", "Verse.VerbProperties" }, { "tools", "Verse.Tool" }, { "weaponClasses", "WeaponClassDef" }, { "cachedRelevantStyleCategories", "Verse.StyleCategoryDef" }, { "allRecipesCached", "Verse.RecipeDef" }, { "stuffCategories", "RimWorld.StuffCategoryDef" }, { "buildingPrerequisites", "Verse.ThingDef" }, { "researchPrerequisites", "Verse.ResearchProjectDef" } }, { { "virtualDefParent", "Verse.ThingDef" }, { "recipeMaker", "Verse.RecipeMakerProperties" }, { "minifiedDef", "Verse.ThingDef" }, { "slagDef", "Verse.ThingDef" }, { "interactionCellIcon", "Verse.ThingDef" }, { "filthLeaving", "Verse.ThingDef" }, { "requiresFactionToAcquire", "RimWorld.FactionDef" }, { "orderedTakeGroup", "Verse.OrderedTakeGroupDef" }, { "defaultStuff", "Verse.ThingDef" }, { "storedConceptLearnOpportunity", "RimWorld.ConceptDef" }, { "soundSpawned", "Verse.SoundDef" }, { "soundDrop", "Verse.SoundDef" }, { "soundPickup", "Verse.SoundDef" }, { "soundInteract", "Verse.SoundDef" }, { "soundImpactDefault", "Verse.SoundDef" }, { "soundPlayInstrument", "Verse.SoundDef" }, { "soundOpen", "Verse.SoundDef" }, { "meleeHitSound", "Verse.SoundDef" }, { "entityDefToBuild", "Verse.BuildableDef" }, { "projectileWhenLoaded", "Verse.ThingDef" }, { "ideoBuildingNamerBase", "Verse.RulePackDef" }, { "entityCodexEntry", "RimWorld.EntityCodexEntryDef" }, { "ingestible", "RimWorld.IngestibleProperties" }, { "race", "Verse.RaceProperties" }, { "dominantStyleCategory", "Verse.StyleCategoryDef" }, { "terrainAffordanceNeeded", "Verse.TerrainAffordanceDef" }, { "repairEffect", "Verse.EffecterDef" }, { "constructEffect", "Verse.EffecterDef" }, { "designationCategory", "Verse.DesignationCategoryDef" }, { "designatorDropdown", "Verse.DesignatorDropdownGroupDef" }, { "designationHotKey", "Verse.KeyBindingDef" }, { "blueprintDef", "Verse.ThingDef" }, { "installBlueprintDef", "Verse.ThingDef" }, { "frameDef", "Verse.ThingDef" } }, }, },
-	{ "Verse.ThingFilter"                                            , { "Verse"        , "ThingFilter"                                         , ""                                                       , { "customSummary" }, {}, { { "disallowedSpecialFilters", "Verse.SpecialThingFilterDef" }, { "hiddenSpecialFilters", "Verse.SpecialThingFilterDef" }, { "thingDefs", "Verse.ThingDef" }, { "stuffCategoriesToAllow", "RimWorld.StuffCategoryDef" }, { "allowAllWhoCanMake", "Verse.ThingDef" }, { "disallowedThingDefs", "Verse.ThingDef" } }, { { "overrideRootDef", "Verse.ThingCategoryDef" } }, }, },
-	{ "Verse.ThingStyleDef"                                          , { "Verse"        , "ThingStyleDef"                                       , "Verse.Def"                                              , { "overrideLabel", "label", "description", "ignoreConfigErrors" }, {}, {}, { { "cachedCategory", "Verse.StyleCategoryDef" } }, }, },
-	{ "Verse.ThinkTreeDef"                                           , { "Verse"        , "ThinkTreeDef"                                        , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.TipSetDef"                                              , { "Verse"        , "TipSetDef"                                           , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.Tool"                                                   , { "Verse"        , "Tool"                                                , ""                                                       , { "label", "labelNoLocation" }, {}, { { "capacities", "Verse.ToolCapacityDef" } }, { { "hediff", "Verse.HediffDef" }, { "soundMeleeHit", "Verse.SoundDef" }, { "soundMeleeMiss", "Verse.SoundDef" }, { "linkedBodyPartsGroup", "Verse.BodyPartGroupDef" } }, }, },
-	{ "Verse.ToolCapacityDef"                                        , { "Verse"        , "ToolCapacityDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.TrainabilityDef"                                        , { "Verse"        , "TrainabilityDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "Verse.VerbProperties"                                         , { "Verse"        , "VerbProperties"                                      , ""                                                       , { "label", "mouseTargetingText" }, {}, {}, { { "rangeStat", "RimWorld.StatDef" }, { "soundCast", "Verse.SoundDef" }, { "soundCastTail", "Verse.SoundDef" }, { "soundAiming", "Verse.SoundDef" }, { "impactMote", "Verse.ThingDef" }, { "impactFleck", "Verse.FleckDef" }, { "warmupEffecter", "Verse.EffecterDef" }, { "aimingLineMote", "Verse.ThingDef" }, { "aimingChargeMote", "Verse.ThingDef" }, { "aimingTargetMote", "Verse.ThingDef" }, { "aimingTargetEffecter", "Verse.EffecterDef" }, { "linkedBodyPartsGroup", "Verse.BodyPartGroupDef" }, { "meleeDamageDef", "Verse.DamageDef" }, { "defaultProjectile", "Verse.ThingDef" }, { "beamDamageDef", "Verse.DamageDef" }, { "beamGroundFleckDef", "Verse.FleckDef" }, { "beamEndEffecterDef", "Verse.EffecterDef" }, { "beamMoteDef", "Verse.ThingDef" }, { "beamLineFleckDef", "Verse.FleckDef" }, { "soundCastBeam", "Verse.SoundDef" }, { "sprayEffecterDef", "Verse.EffecterDef" }, { "spawnDef", "Verse.ThingDef" }, { "colonyWideTaleDef", "RimWorld.TaleDef" }, { "bodypartTagTarget", "Verse.BodyPartTagDef" }, { "rangedFireRulepack", "Verse.RulePackDef" }, { "soundLanding", "Verse.SoundDef" }, { "flightEffecterDef", "Verse.EffecterDef" }, { "workModeDef", "Verse.MechWorkModeDef" } }, }, },
-	{ "Verse.WeatherDef"                                             , { "Verse"        , "WeatherDef"                                          , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, { { "ambientSounds", "Verse.SoundDef" } }, { { "weatherThought", "RimWorld.ThoughtDef" } }, }, },
-	{ "Verse.WorkTypeDef"                                            , { "Verse"        , "WorkTypeDef"                                         , "Verse.Def"                                              , { "labelShort", "pawnLabel", "gerundLabel", "verb", "label", "description", "ignoreConfigErrors" }, {}, { { "relevantSkills", "RimWorld.SkillDef" }, { "workGiversByPriority", "RimWorld.WorkGiverDef" } }, {}, }, },
-	{ "Verse.WorldGenStepDef"                                        , { "Verse"        , "WorldGenStepDef"                                     , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "WeaponClassDef"                                               , { ""             , "WeaponClassDef"                                      , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, {}, }, },
-	{ "WeaponClassPairDef"                                           , { ""             , "WeaponClassPairDef"                                  , "Verse.Def"                                              , { "label", "description", "ignoreConfigErrors" }, {}, {}, { { "first", "WeaponClassDef" }, { "second", "WeaponClassDef" } }, }, },
-};
+	inline constexpr char BLOB[] =
+		"RimWorld.AbilityCategoryDef"
+		"RimWorld"
+		"AbilityCategoryDef"
+		"Verse.Def"
+		"description"
+		"ignoreConfigErrors"
+		"label"
+		"RimWorld.AbilityDef"
+		"AbilityDef"
+		"confirmationDialogText"
+		"requiredMemes"
+		"RimWorld.MemeDef"
+		"category"
+		"emittedFleck"
+		"Verse.FleckDef"
+		"groupDef"
+		"RimWorld.AbilityGroupDef"
+		"hotKey"
+		"Verse.KeyBindingDef"
+		"jobDef"
+		"Verse.JobDef"
+		"verbProperties"
+		"Verse.VerbProperties"
+		"warmupEffecter"
+		"Verse.EffecterDef"
+		"warmupMote"
+		"Verse.ThingDef"
+		"warmupPreEndSound"
+		"Verse.SoundDef"
+		"warmupSound"
+		"warmupStartSound"
+		"AbilityGroupDef"
+		"RimWorld.AnomalyPlaystyleDef"
+		"AnomalyPlaystyleDef"
+		"RimWorld.ApparelRequirement"
+		"ApparelRequirement"
+		""
+		"groupLabel"
+		"bodyPartGroupsMatchAny"
+		"Verse.BodyPartGroupDef"
+		"requiredDefs"
+		"RimWorld.BabyPlayDef"
+		"BabyPlayDef"
+		"RimWorld.BackstoryDef"
+		"BackstoryDef"
+		"title"
+		"titleFemale"
+		"titleShort"
+		"titleShortFemale"
+		"cachedDisabledWorkTypes"
+		"Verse.WorkTypeDef"
+		"bodyTypeFemale"
+		"RimWorld.BodyTypeDef"
+		"bodyTypeGlobal"
+		"bodyTypeMale"
+		"nameMaker"
+		"Verse.RulePackDef"
+		"RimWorld.BeardDef"
+		"BeardDef"
+		"RimWorld.StyleItemDef"
+		"overrideShaderTypeDef"
+		"Verse.ShaderTypeDef"
+		"requiredGene"
+		"Verse.GeneDef"
+		"requiredMutant"
+		"RimWorld.MutantDef"
+		"RimWorld.BillRepeatModeDef"
+		"BillRepeatModeDef"
+		"RimWorld.BillStoreModeDef"
+		"BillStoreModeDef"
+		"RimWorld.BiomeDef"
+		"BiomeDef"
+		"allowedPackAnimals"
+		"cachedWildPlants"
+		"soundsAmbient"
+		"foragedFood"
+		"BodyTypeDef"
+		"RimWorld.BossDef"
+		"BossDef"
+		"kindDef"
+		"Verse.PawnKindDef"
+		"RimWorld.BossgroupDef"
+		"BossgroupDef"
+		"leaderDescription"
+		"boss"
+		"quest"
+		"RimWorld.QuestScriptDef"
+		"rewardDef"
+		"RimWorld.ChemicalDef"
+		"ChemicalDef"
+		"addictionHediff"
+		"Verse.HediffDef"
+		"toleranceHediff"
+		"RimWorld.ColorDef"
+		"ColorDef"
+		"RimWorld.CompProperties_AbilityConvert"
+		"CompProperties_AbilityConvert"
+		"RimWorld.CompProperties_AbilityEffect"
+		"failMessage"
+		"successMessage"
+		"clamorType"
+		"Verse.ClamorDef"
+		"failedThoughtInitiator"
+		"RimWorld.ThoughtDef"
+		"failedThoughtRecipient"
+		"messageType"
+		"Verse.MessageTypeDef"
+		"sound"
+		"soundFemale"
+		"soundMale"
+		"RimWorld.CompProperties_AbilityCounsel"
+		"CompProperties_AbilityCounsel"
+		"successMessageNoNegativeThought"
+		"RimWorld.CompProperties_AbilityReassure"
+		"CompProperties_AbilityReassure"
+		"RimWorld.CompProperties_Activity"
+		"CompProperties_Activity"
+		"Verse.CompProperties"
+		"letterDesc"
+		"letterTitle"
+		"letterDef"
+		"Verse.LetterDef"
+		"RimWorld.CompProperties_Analyzable"
+		"CompProperties_Analyzable"
+		"RimWorld.CompProperties_Interactable"
+		"activateDescString"
+		"activateLabelString"
+		"activatingString"
+		"activatingStringPending"
+		"completedLetter"
+		"completedLetterLabel"
+		"guiLabelString"
+		"inspectString"
+		"jobString"
+		"messageCompletedString"
+		"messageCooldownEnded"
+		"onCooldownString"
+		"progressedLetterLabel"
+		"repeatCompletedLetter"
+		"repeatCompletedLetterLabel"
+		"progressedLetters"
+		"activateStat"
+		"RimWorld.StatDef"
+		"completedLetterDef"
+		"cooldownFleck"
+		"fleckOnUsed"
+		"interactionEffecter"
+		"progressedLetterDef"
+		"repeatCompletedLetterDef"
+		"soundActivate"
+		"RimWorld.CompProperties_ApparelReloadable"
+		"CompProperties_ApparelReloadable"
+		"RimWorld.CompProperties_ApparelVerbOwnerCharged"
+		"chargeNoun"
+		"cooldownGerund"
+		"ammoDef"
+		"soundReload"
+		"CompProperties_ApparelVerbOwnerCharged"
+		"RimWorld.CompProperties_ApparelVerbOwner"
+		"RimWorld.CompProperties_AssignableToPawn"
+		"CompProperties_AssignableToPawn"
+		"noAssignablePawnsDesc"
+		"RimWorld.CompProperties_BiosculpterPod_AgeReversalCycle"
+		"CompProperties_BiosculpterPod_AgeReversalCycle"
+		"RimWorld.CompProperties_BiosculpterPod_BaseCycle"
+		"requiredResearch"
+		"Verse.ResearchProjectDef"
+		"gainThoughtOnCompletion"
+		"CompProperties_BiosculpterPod_BaseCycle"
+		"RimWorld.CompProperties_BiosculpterPod_HealingCycle"
+		"CompProperties_BiosculpterPod_HealingCycle"
+		"bodyPartsToRestore"
+		"Verse.BodyPartDef"
+		"conditionsToPossiblyCure"
+		"RimWorld.CompProperties_BiosculpterPod_PleasureCycle"
+		"CompProperties_BiosculpterPod_PleasureCycle"
+		"RimWorld.CompProperties_Chimera"
+		"CompProperties_Chimera"
+		"simpleAnimalLabel"
+		"RimWorld.CompProperties_CompAnalyzableBiosignature"
+		"CompProperties_CompAnalyzableBiosignature"
+		"RimWorld.CompProperties_CompAnalyzableUnlockResearch"
+		"CompProperties_CompAnalyzableUnlockResearch"
+		"RimWorld.CompProperties_DestroyAfterDelay"
+		"CompProperties_DestroyAfterDelay"
+		"countdownLabel"
+		"RimWorld.CompProperties_Devourer"
+		"CompProperties_Devourer"
+		"digestingInspector"
+		"messageDigested"
+		"messageDigestionCompleted"
+		"messageEmerged"
+		"messageEmergedCorpse"
+		"RimWorld.CompProperties_DisableUnnaturalCorpse"
+		"CompProperties_DisableUnnaturalCorpse"
+		"RimWorld.CompProperties_EquippableAbilityReloadable"
+		"CompProperties_EquippableAbilityReloadable"
+		"RimWorld.CompProperties_EquippableAbility"
+		"abilityDef"
+		"RimWorld.CompProperties_GiveThoughtToAllMapPawnsOnDestroy"
+		"CompProperties_GiveThoughtToAllMapPawnsOnDestroy"
+		"message"
+		"thought"
+		"RimWorld.CompProperties_GoldenCube"
+		"CompProperties_GoldenCube"
+		"letterDeactivatedAppend"
+		"letterDeactivatedDesc"
+		"letterDeactivatedLabel"
+		"RimWorld.CompProperties_GrayStatue"
+		"CompProperties_GrayStatue"
+		"letterLabel"
+		"letterText"
+		"RimWorld.CompProperties_GrayStatueGas"
+		"CompProperties_GrayStatueGas"
+		"RimWorld.CompProperties_GrayStatueTeleporter"
+		"CompProperties_GrayStatueTeleporter"
+		"RimWorld.CompProperties_HasSources"
+		"CompProperties_HasSources"
+		"inspectStringLabel"
+		"RimWorld.CompProperties_HoldingPlatformTarget"
+		"CompProperties_HoldingPlatformTarget"
+		"capturedLetterLabel"
+		"capturedLetterText"
+		"heldPawnKind"
+		"RimWorld.CompProperties_InspectString"
+		"CompProperties_InspectString"
+		"RimWorld.CompProperties_InspectStringStatValue"
+		"CompProperties_InspectStringStatValue"
+		"stat"
+		"CompProperties_Interactable"
+		"RimWorld.CompProperties_LabyrinthDoor"
+		"CompProperties_LabyrinthDoor"
+		"RimWorld.CompProperties_LeavingsLetter"
+		"CompProperties_LeavingsLetter"
+		"leavingsFilter"
+		"Verse.ThingFilter"
+		"RimWorld.CompProperties_MechPowerCell"
+		"CompProperties_MechPowerCell"
+		"labelOverride"
+		"tooltipOverride"
+		"RimWorld.CompProperties_NeuralSupercharger"
+		"CompProperties_NeuralSupercharger"
+		"RimWorld.CompProperties_Rechargeable"
+		"chargedSoundDef"
+		"dischargeSoundDef"
+		"effectCharged"
+		"RimWorld.CompProperties_Nociosphere"
+		"CompProperties_Nociosphere"
+		"becomingUnstableInspectText"
+		"departingMessage"
+		"leftLetterLabel"
+		"leftLetterText"
+		"onslaughtEndedMessage"
+		"onslaughtInspectText"
+		"unstableInspectText"
+		"unstableWarning"
+		"RimWorld.CompProperties_ObeliskDeactivationInteractor"
+		"CompProperties_ObeliskDeactivationInteractor"
+		"RimWorld.CompProperties_ObeliskLabyrinth"
+		"CompProperties_ObeliskLabyrinth"
+		"messageActivating"
+		"RimWorld.CompProperties_ObeliskTriggerInteractor"
+		"CompProperties_ObeliskTriggerInteractor"
+		"RimWorld.CompProperties_ProximityLetter"
+		"CompProperties_ProximityLetter"
+		"RimWorld.CompProperties_Refuelable"
+		"CompProperties_Refuelable"
+		"fuelGizmoLabel"
+		"fuelLabel"
+		"outOfFuelMessage"
+		"fuelFilter"
+		"RimWorld.CompProperties_Schedule"
+		"CompProperties_Schedule"
+		"offMessage"
+		"RimWorld.CompProperties_StatEntry"
+		"CompProperties_StatEntry"
+		"reportText"
+		"statLabel"
+		"statCategoryDef"
+		"RimWorld.StatCategoryDef"
+		"RimWorld.CompProperties_StopManhunter"
+		"CompProperties_StopManhunter"
+		"RimWorld.CompProperties_Studiable"
+		"CompProperties_Studiable"
+		"completedLetterText"
+		"completedLetterTitle"
+		"completedMessage"
+		"knowledgeCategory"
+		"RimWorld.KnowledgeCategoryDef"
+		"RimWorld.CompProperties_StudiableMonolith"
+		"CompProperties_StudiableMonolith"
+		"RimWorld.CompProperties_TempControl"
+		"CompProperties_TempControl"
+		"RimWorld.CompProperties_Transmute"
+		"CompProperties_Transmute"
+		"failedMessage"
+		"outcomeItems"
+		"outcomeStuff"
+		"RimWorld.CompProperties_Usable"
+		"CompProperties_Usable"
+		"useLabel"
+		"useMessage"
+		"allowedMutants"
+		"finalizeMote"
+		"floatMenuFactionIcon"
+		"RimWorld.FactionDef"
+		"useJob"
+		"userMustHaveHediff"
+		"RimWorld.ComplexLayoutDef"
+		"ComplexLayoutDef"
+		"RimWorld.LayoutDef"
+		"roomDefs"
+		"RimWorld.LayoutRoomDef"
+		"rewardThingSetMakerDef"
+		"RimWorld.ThingSetMakerDef"
+		"RimWorld.ComplexThreatDef"
+		"ComplexThreatDef"
+		"faction"
+		"RimWorld.ConceptDef"
+		"ConceptDef"
+		"helpText"
+		"helpTextController"
+		"RimWorld.CultureDef"
+		"CultureDef"
+		"deityNameMaker"
+		"deityTypeMaker"
+		"festivalNameMaker"
+		"ideoNameMaker"
+		"leaderTitleMaker"
+		"pawnNameMaker"
+		"pawnNameMakerFemale"
+		"RimWorld.DebugTabMenuDef"
+		"DebugTabMenuDef"
+		"RimWorld.DeityNameType"
+		"DeityNameType"
+		"type"
+		"RimWorld.DifficultyDef"
+		"DifficultyDef"
+		"RimWorld.DrugPolicyDef"
+		"DrugPolicyDef"
+		"RimWorld.EntityCategoryDef"
+		"EntityCategoryDef"
+		"RimWorld.EntityCodexEntryDef"
+		"EntityCodexEntryDef"
+		"discoveredResearchProjects"
+		"hideInPlaystyles"
+		"linkedIncidents"
+		"RimWorld.IncidentDef"
+		"linkedThings"
+		"provocationIncidents"
+		"useDescriptionFrom"
+		"RimWorld.ExpansionDef"
+		"ExpansionDef"
+		"RimWorld.ExpectationDef"
+		"ExpectationDef"
+		"FactionDef"
+		"fixedName"
+		"ideoDescription"
+		"leaderTitle"
+		"leaderTitleFemale"
+		"pawnSingular"
+		"pawnsPlural"
+		"royalFavorLabel"
+		"allowedCultures"
+		"allowedMemes"
+		"baseTraderKinds"
+		"RimWorld.TraderKindDef"
+		"caravanTraderKinds"
+		"disallowedMemes"
+		"disallowedPrecepts"
+		"RimWorld.PreceptDef"
+		"disallowedRaidAgeRestrictions"
+		"RimWorld.RaidAgeRestrictionDef"
+		"disallowedRaidStrategies"
+		"RimWorld.RaidStrategyDef"
+		"fixedLeaderKinds"
+		"forcedMemes"
+		"permanentEnemyToEveryoneExcept"
+		"royalTitleInheritanceRelations"
+		"RimWorld.PawnRelationDef"
+		"royalTitlesAllInSeniorityOrderForReading"
+		"RimWorld.RoyalTitleDef"
+		"royalTitlesAwardableInSeniorityOrderForReading"
+		"startingResearchTags"
+		"Verse.ResearchProjectTagDef"
+		"startingTechprintsResearchTags"
+		"styles"
+		"Verse.StyleCategoryDef"
+		"visitorTraderKinds"
+		"apparelStuffFilter"
+		"basicMemberKind"
+		"dropPodActive"
+		"dropPodIncoming"
+		"factionNameMaker"
+		"playerInitialSettlementNameMaker"
+		"raidLootMaker"
+		"replacesFaction"
+		"settlementNameMaker"
+		"RimWorld.FeatureDef"
+		"FeatureDef"
+		"acceptableBiomes"
+		"rootBiomes"
+		"RimWorld.FleshTypeDef"
+		"FleshTypeDef"
+		"ateAsIngredient"
+		"ateDirect"
+		"corpseCategory"
+		"Verse.ThingCategoryDef"
+		"damageEffecter"
+		"RimWorld.FurDef"
+		"FurDef"
+		"RimWorld.GatheringDef"
+		"GatheringDef"
+		"calledOffMessage"
+		"finishedMessage"
+		"gatherSpotDefs"
+		"requiredTitleAny"
+		"duty"
+		"Verse.AI.DutyDef"
+		"RimWorld.GauranlenTreeModeDef"
+		"GauranlenTreeModeDef"
+		"displayedStats"
+		"pawnKindDef"
+		"previousStage"
+		"RimWorld.GeneTemplateDef"
+		"GeneTemplateDef"
+		"labelShortAdj"
+		"displayCategory"
+		"Verse.GeneCategoryDef"
+		"RimWorld.GoodwillSituationDef"
+		"GoodwillSituationDef"
+		"meme"
+		"otherMeme"
+		"RimWorld.HairDef"
+		"HairDef"
+		"RimWorld.HediffGiverSetDef"
+		"HediffGiverSetDef"
+		"RimWorld.HibernatableStateDef"
+		"HibernatableStateDef"
+		"RimWorld.HistoryAutoRecorderDef"
+		"HistoryAutoRecorderDef"
+		"graphLabelY"
+		"RimWorld.HistoryAutoRecorderGroupDef"
+		"HistoryAutoRecorderGroupDef"
+		"historyAutoRecorderDefs"
+		"RimWorld.HistoryEventDef"
+		"HistoryEventDef"
+		"RimWorld.IdeoColorDef"
+		"IdeoColorDef"
+		"RimWorld.IdeoSymbolPartDef"
+		"cultures"
+		"memes"
+		"colorDef"
+		"RimWorld.IdeoFoundationDef"
+		"IdeoFoundationDef"
+		"RimWorld.IdeoIconDef"
+		"IdeoIconDef"
+		"RimWorld.IdeoPresetCategoryDef"
+		"IdeoPresetCategoryDef"
+		"RimWorld.IdeoPresetDef"
+		"IdeoPresetDef"
+		"categoryDef"
+		"RimWorld.IdeoSymbolPack"
+		"IdeoSymbolPack"
+		"adjective"
+		"ideoName"
+		"member"
+		"theme"
+		"IdeoSymbolPartDef"
+		"RimWorld.IncidentCategoryDef"
+		"IncidentCategoryDef"
+		"tale"
+		"RimWorld.TaleDef"
+		"IncidentDef"
+		"diseaseLethalLetterText"
+		"allowedBiomes"
+		"cachedRefireCheckIncidents"
+		"disallowedBiomes"
+		"diseasePartsToAffect"
+		"letterHyperlinkHediffDefs"
+		"targetTags"
+		"RimWorld.IncidentTargetTagDef"
+		"codexEntry"
+		"diseaseIncident"
+		"gameCondition"
+		"Verse.GameConditionDef"
+		"mechClusterBuilding"
+		"pawnHediff"
+		"pawnKind"
+		"questScriptDef"
+		"treeDef"
+		"treeGenStepDef"
+		"Verse.GenStepDef"
+		"IncidentTargetTagDef"
+		"RimWorld.InfectionPathwayDef"
+		"InfectionPathwayDef"
+		"RimWorld.IngestibleProperties"
+		"IngestibleProperties"
+		"ingestCommandString"
+		"ingestReportString"
+		"ingestReportStringEat"
+		"ateEvent"
+		"ingestEffect"
+		"ingestEffectEat"
+		"ingestSound"
+		"joyKind"
+		"RimWorld.JoyKindDef"
+		"parent"
+		"sourceDef"
+		"specialThoughtAsIngredient"
+		"specialThoughtDirect"
+		"tasteThought"
+		"RimWorld.InspirationDef"
+		"InspirationDef"
+		"baseInspectLine"
+		"beginLetter"
+		"beginLetterLabel"
+		"endMessage"
+		"associatedSkills"
+		"RimWorld.SkillDef"
+		"requiredAnyNonDisabledWorkType"
+		"requiredCapacities"
+		"Verse.PawnCapacityDef"
+		"requiredNonDisabledStats"
+		"requiredNonDisabledWorkTypes"
+		"beginLetterDef"
+		"RimWorld.InstructionDef"
+		"InstructionDef"
+		"onMapInstruction"
+		"rejectInputMessage"
+		"text"
+		"textController"
+		"concept"
+		"eventTagInitiateSource"
+		"giveOnActivateDef"
+		"recipeDef"
+		"Verse.RecipeDef"
+		"thingDef"
+		"RimWorld.InteractionDef"
+		"InteractionDef"
+		"initiatorThought"
+		"initiatorXpGainSkill"
+		"interactionMote"
+		"logRulesInitiator"
+		"Verse.Grammar.RulePack"
+		"logRulesRecipient"
+		"recipientThought"
+		"recipientXpGainSkill"
+		"RimWorld.IssueDef"
+		"IssueDef"
+		"RimWorld.JobGiver_AIAbilityFight"
+		"JobGiver_AIAbilityFight"
+		"RimWorld.JobGiver_AIFightEnemy"
+		"crawlingReportStringOverride"
+		"reportStringOverride"
+		"ability"
+		"RimWorld.JobGiver_AIBreaching"
+		"JobGiver_AIBreaching"
+		"Verse.AI.ThinkNode_JobGiver"
+		"RimWorld.JobGiver_AICastAbility"
+		"JobGiver_AICastAbility"
+		"RimWorld.JobGiver_AICastAbilityOnSelf"
+		"JobGiver_AICastAbilityOnSelf"
+		"RimWorld.JobGiver_AICastAnimalWarcall"
+		"JobGiver_AICastAnimalWarcall"
+		"RimWorld.JobGiver_AIDefendEscortee"
+		"JobGiver_AIDefendEscortee"
+		"RimWorld.JobGiver_AIDefendPawn"
+		"RimWorld.JobGiver_AIDefendMaster"
+		"JobGiver_AIDefendMaster"
+		"RimWorld.JobGiver_AIDefendOverseer"
+		"JobGiver_AIDefendOverseer"
+		"JobGiver_AIDefendPawn"
+		"RimWorld.JobGiver_AIDefendPoint"
+		"JobGiver_AIDefendPoint"
+		"RimWorld.JobGiver_AIDefendSelf"
+		"JobGiver_AIDefendSelf"
+		"RimWorld.JobGiver_AIFightEnemies"
+		"JobGiver_AIFightEnemies"
+		"JobGiver_AIFightEnemy"
+		"RimWorld.JobGiver_AIFollowEscortee"
+		"JobGiver_AIFollowEscortee"
+		"RimWorld.JobGiver_AIFollowPawn"
+		"RimWorld.JobGiver_AIFollowMaster"
+		"JobGiver_AIFollowMaster"
+		"RimWorld.JobGiver_AIFollowOverseer"
+		"JobGiver_AIFollowOverseer"
+		"JobGiver_AIFollowPawn"
+		"RimWorld.JobGiver_AIGotoNearestHostile"
+		"JobGiver_AIGotoNearestHostile"
+		"RimWorld.JobGiver_AIJumpEscapeEnemies"
+		"JobGiver_AIJumpEscapeEnemies"
+		"RimWorld.JobGiver_AIJumpToJobRescueTarget"
+		"JobGiver_AIJumpToJobRescueTarget"
+		"RimWorld.JobGiver_AIJumpToJobTarget"
+		"JobGiver_AIJumpToJobTarget"
+		"RimWorld.JobGiver_AIReleaseMechs"
+		"JobGiver_AIReleaseMechs"
+		"RimWorld.JobGiver_AIResurrectTarget"
+		"JobGiver_AIResurrectTarget"
+		"RimWorld.JobGiver_AISapper"
+		"JobGiver_AISapper"
+		"RimWorld.JobGiver_AISkipToJobTarget"
+		"JobGiver_AISkipToJobTarget"
+		"RimWorld.JobGiver_AITrashBuildingsDistant"
+		"JobGiver_AITrashBuildingsDistant"
+		"RimWorld.JobGiver_AITrashColonyClose"
+		"JobGiver_AITrashColonyClose"
+		"RimWorld.JobGiver_AITrashDutyFocus"
+		"JobGiver_AITrashDutyFocus"
+		"RimWorld.JobGiver_AIWaitAmbush"
+		"JobGiver_AIWaitAmbush"
+		"RimWorld.JobGiver_AIWaitWithOverseer"
+		"JobGiver_AIWaitWithOverseer"
+		"RimWorld.JobGiver_AcceptRole"
+		"JobGiver_AcceptRole"
+		"soundDefFemale"
+		"soundDefMale"
+		"RimWorld.JobGiver_ActivityDormant"
+		"JobGiver_ActivityDormant"
+		"RimWorld.JobGiver_AnimaLinking"
+		"JobGiver_AnimaLinking"
+		"RimWorld.JobGiver_AnimalFlee"
+		"JobGiver_AnimalFlee"
+		"RimWorld.JobGiver_Autofeed"
+		"JobGiver_Autofeed"
+		"RimWorld.JobGiver_Berserk"
+		"JobGiver_Berserk"
+		"RimWorld.JobGiver_Berserk_Warcall"
+		"JobGiver_Berserk_Warcall"
+		"RimWorld.JobGiver_BestowingCeremony"
+		"JobGiver_BestowingCeremony"
+		"RimWorld.JobGiver_Binge"
+		"JobGiver_Binge"
+		"RimWorld.JobGiver_BingeDrug"
+		"JobGiver_BingeDrug"
+		"RimWorld.JobGiver_BingeFood"
+		"JobGiver_BingeFood"
+		"RimWorld.JobGiver_Blind"
+		"JobGiver_Blind"
+		"RimWorld.JobGiver_BringBabyToSafety"
+		"JobGiver_BringBabyToSafety"
+		"RimWorld.JobGiver_ChimeraAttackNearbyHumans"
+		"JobGiver_ChimeraAttackNearbyHumans"
+		"RimWorld.JobGiver_ConcertOrganizerPlayInstrument"
+		"JobGiver_ConcertOrganizerPlayInstrument"
+		"RimWorld.JobGiver_ConfigurableHostilityResponse"
+		"JobGiver_ConfigurableHostilityResponse"
+		"RimWorld.JobGiver_CreateAndEnterCocoon"
+		"JobGiver_CreateAndEnterCocoon"
+		"RimWorld.JobGiver_CreateAndEnterDryadHolder"
+		"JobGiver_CreateAndEnterDryadHolder"
+		"RimWorld.JobGiver_CreateAndEnterHealingPod"
+		"JobGiver_CreateAndEnterHealingPod"
+		"RimWorld.JobGiver_CubeSculpting"
+		"JobGiver_CubeSculpting"
+		"RimWorld.JobGiver_Dance"
+		"JobGiver_Dance"
+		"RimWorld.JobGiver_DeliverPawnToAltar"
+		"JobGiver_DeliverPawnToAltar"
+		"RimWorld.JobGiver_GotoTravelDestination"
+		"RimWorld.JobGiver_DeliverPawnToBed"
+		"JobGiver_DeliverPawnToBed"
+		"RimWorld.JobGiver_DeliverPawnToCell"
+		"JobGiver_DeliverPawnToCell"
+		"RimWorld.JobGiver_DeliverPawnToPsychicRitualCell"
+		"JobGiver_DeliverPawnToPsychicRitualCell"
+		"RimWorld.JobGiver_DoLovin"
+		"JobGiver_DoLovin"
+		"RimWorld.JobGiver_DropRandomGearOrApparel"
+		"JobGiver_DropRandomGearOrApparel"
+		"RimWorld.JobGiver_DropUnusedInventory"
+		"JobGiver_DropUnusedInventory"
+		"RimWorld.JobGiver_DropWeapon"
+		"JobGiver_DropWeapon"
+		"RimWorld.JobGiver_Duel"
+		"JobGiver_Duel"
+		"RimWorld.JobGiver_DuelPickupWeapon"
+		"JobGiver_DuelPickupWeapon"
+		"RimWorld.JobGiver_DyeHair"
+		"JobGiver_DyeHair"
+		"RimWorld.JobGiver_EatAtCannibalPlatter"
+		"JobGiver_EatAtCannibalPlatter"
+		"RimWorld.JobGiver_EatInGatheringArea"
+		"JobGiver_EatInGatheringArea"
+		"RimWorld.JobGiver_EatRandom"
+		"JobGiver_EatRandom"
+		"RimWorld.JobGiver_EnterPortal"
+		"JobGiver_EnterPortal"
+		"RimWorld.JobGiver_EnterTransporter"
+		"JobGiver_EnterTransporter"
+		"RimWorld.JobGiver_EscapingHoldingPlatform"
+		"JobGiver_EscapingHoldingPlatform"
+		"RimWorld.JobGiver_ExtinguishSelf"
+		"JobGiver_ExtinguishSelf"
+		"RimWorld.JobGiver_FightFiresNearPoint"
+		"JobGiver_FightFiresNearPoint"
+		"RimWorld.JobGiver_FireStartingSpree"
+		"JobGiver_FireStartingSpree"
+		"RimWorld.JobGiver_FleeAllPawns"
+		"JobGiver_FleeAllPawns"
+		"RimWorld.JobGiver_FleeDanger"
+		"JobGiver_FleeDanger"
+		"RimWorld.JobGiver_FleeFire"
+		"JobGiver_FleeFire"
+		"RimWorld.JobGiver_FleeForDistance"
+		"JobGiver_FleeForDistance"
+		"RimWorld.JobGiver_FleeImmediateThreat"
+		"JobGiver_FleeImmediateThreat"
+		"RimWorld.JobGiver_FleePotentialExplosion"
+		"JobGiver_FleePotentialExplosion"
+		"RimWorld.JobGiver_FollowRoper"
+		"JobGiver_FollowRoper"
+		"RimWorld.JobGiver_ForceSleepNow"
+		"JobGiver_ForceSleepNow"
+		"RimWorld.JobGiver_GatherOfferingsForPsychicRitual"
+		"JobGiver_GatherOfferingsForPsychicRitual"
+		"RimWorld.JobGiver_GetAgeReversal"
+		"JobGiver_GetAgeReversal"
+		"RimWorld.JobGiver_GetDeathrest"
+		"JobGiver_GetDeathrest"
+		"RimWorld.JobGiver_GetEnergy"
+		"JobGiver_GetEnergy"
+		"RimWorld.JobGiver_GetEnergy_Charger"
+		"JobGiver_GetEnergy_Charger"
+		"RimWorld.JobGiver_GetEnergy_SelfShutdown"
+		"JobGiver_GetEnergy_SelfShutdown"
+		"RimWorld.JobGiver_GetFood"
+		"JobGiver_GetFood"
+		"RimWorld.JobGiver_GetHemogen"
+		"JobGiver_GetHemogen"
+		"RimWorld.JobGiver_GetJoy"
+		"JobGiver_GetJoy"
+		"RimWorld.JobGiver_GetJoyInBed"
+		"JobGiver_GetJoyInBed"
+		"RimWorld.JobGiver_GetJoyInGatheringArea"
+		"JobGiver_GetJoyInGatheringArea"
+		"RimWorld.JobGiver_GetNeuralSupercharge"
+		"JobGiver_GetNeuralSupercharge"
+		"RimWorld.JobGiver_GetRest"
+		"JobGiver_GetRest"
+		"RimWorld.JobGiver_GiveSpeech"
+		"JobGiver_GiveSpeech"
+		"RimWorld.JobGiver_GiveSpeechFacingTarget"
+		"JobGiver_GiveSpeechFacingTarget"
+		"RimWorld.JobGiver_GotoAndStandSociallyActive"
+		"JobGiver_GotoAndStandSociallyActive"
+		"JobGiver_GotoTravelDestination"
+		"RimWorld.JobGiver_HateChant"
+		"JobGiver_HateChant"
+		"RimWorld.JobGiver_Haul"
+		"JobGiver_Haul"
+		"RimWorld.JobGiver_HaulCorpseToPublicPlace"
+		"JobGiver_HaulCorpseToPublicPlace"
+		"RimWorld.JobGiver_HaulToPortal"
+		"JobGiver_HaulToPortal"
+		"RimWorld.JobGiver_HiveDefense"
+		"JobGiver_HiveDefense"
+		"RimWorld.JobGiver_IdleJoy"
+		"JobGiver_IdleJoy"
+		"RimWorld.JobGiver_InducePrisonerToEscape"
+		"JobGiver_InducePrisonerToEscape"
+		"RimWorld.JobGiver_InduceSlaveToRebel"
+		"JobGiver_InduceSlaveToRebel"
+		"RimWorld.JobGiver_InsultingSpree"
+		"JobGiver_InsultingSpree"
+		"RimWorld.JobGiver_JumpInWater"
+		"JobGiver_JumpInWater"
+		"RimWorld.JobGiver_KeepLyingDown"
+		"JobGiver_KeepLyingDown"
+		"RimWorld.JobGiver_Kidnap"
+		"JobGiver_Kidnap"
+		"RimWorld.JobGiver_LayDownAwake"
+		"JobGiver_LayDownAwake"
+		"RimWorld.JobGiver_LayDownResting"
+		"JobGiver_LayDownResting"
+		"RimWorld.JobGiver_LayEgg"
+		"JobGiver_LayEgg"
+		"RimWorld.JobGiver_Learn"
+		"JobGiver_Learn"
+		"RimWorld.JobGiver_LoadTransporters"
+		"JobGiver_LoadTransporters"
+		"RimWorld.JobGiver_MaintainHives"
+		"JobGiver_MaintainHives"
+		"RimWorld.JobGiver_ManTurrets"
+		"JobGiver_ManTurrets"
+		"RimWorld.JobGiver_ManTurretsNearPoint"
+		"JobGiver_ManTurretsNearPoint"
+		"RimWorld.JobGiver_ManTurretsNearSelf"
+		"JobGiver_ManTurretsNearSelf"
+		"RimWorld.JobGiver_Manhunter"
+		"JobGiver_Manhunter"
+		"RimWorld.JobGiver_MarryAdjacentPawn"
+		"JobGiver_MarryAdjacentPawn"
+		"RimWorld.JobGiver_Mate"
+		"JobGiver_Mate"
+		"RimWorld.JobGiver_Meditate"
+		"JobGiver_Meditate"
+		"RimWorld.JobGiver_MeditateInBed"
+		"JobGiver_MeditateInBed"
+		"RimWorld.JobGiver_MergeIntoGaumakerPod"
+		"JobGiver_MergeIntoGaumakerPod"
+		"RimWorld.JobGiver_MetalhorrorFight"
+		"JobGiver_MetalhorrorFight"
+		"RimWorld.JobGiver_MineRandom"
+		"JobGiver_MineRandom"
+		"RimWorld.JobGiver_MoveDrugsToInventory"
+		"JobGiver_MoveDrugsToInventory"
+		"RimWorld.JobGiver_MurderousRage"
+		"JobGiver_MurderousRage"
+		"RimWorld.JobGiver_NPCCastNonCombatAbilities"
+		"JobGiver_NPCCastNonCombatAbilities"
+		"RimWorld.JobGiver_NociosphereDepart"
+		"JobGiver_NociosphereDepart"
+		"RimWorld.JobGiver_NociosphereFight"
+		"JobGiver_NociosphereFight"
+		"RimWorld.JobGiver_NociosphereSkip"
+		"JobGiver_NociosphereSkip"
+		"RimWorld.JobGiver_Nuzzle"
+		"JobGiver_Nuzzle"
+		"RimWorld.JobGiver_OptimizeApparel"
+		"JobGiver_OptimizeApparel"
+		"RimWorld.JobGiver_PackAnimalFollowColonists"
+		"JobGiver_PackAnimalFollowColonists"
+		"RimWorld.JobGiver_PackFood"
+		"JobGiver_PackFood"
+		"RimWorld.JobGiver_PatientGoToBed"
+		"JobGiver_PatientGoToBed"
+		"RimWorld.JobGiver_PickUpOpportunisticWeapon"
+		"JobGiver_PickUpOpportunisticWeapon"
+		"RimWorld.JobGiver_PlayTargetInstrument"
+		"JobGiver_PlayTargetInstrument"
+		"RimWorld.JobGiver_PlayWithGoldenCube"
+		"JobGiver_PlayWithGoldenCube"
+		"RimWorld.JobGiver_PrepareCaravan_CollectPawns"
+		"JobGiver_PrepareCaravan_CollectPawns"
+		"RimWorld.JobGiver_PrepareCaravan_RopePawns"
+		"RimWorld.JobGiver_PrepareCaravan_GatherDownedPawns"
+		"JobGiver_PrepareCaravan_GatherDownedPawns"
+		"RimWorld.JobGiver_PrepareCaravan_GatherItems"
+		"JobGiver_PrepareCaravan_GatherItems"
+		"RimWorld.JobGiver_PrepareCaravan_GatherPawns"
+		"JobGiver_PrepareCaravan_GatherPawns"
+		"JobGiver_PrepareCaravan_RopePawns"
+		"RimWorld.JobGiver_PrepareSkylantern"
+		"JobGiver_PrepareSkylantern"
+		"def"
+		"RimWorld.JobGiver_PrisonerEscape"
+		"JobGiver_PrisonerEscape"
+		"RimWorld.JobGiver_PrisonerGetDressed"
+		"JobGiver_PrisonerGetDressed"
+		"RimWorld.JobGiver_PrisonerWaitInsteadOfEscaping"
+		"JobGiver_PrisonerWaitInsteadOfEscaping"
+		"Verse.AI.JobGiver_Wander"
+		"RimWorld.JobGiver_ReachOutside"
+		"JobGiver_ReachOutside"
+		"RimWorld.JobGiver_ReactToCloseMeleeThreat"
+		"JobGiver_ReactToCloseMeleeThreat"
+		"RimWorld.JobGiver_ReleaseEntity"
+		"JobGiver_ReleaseEntity"
+		"RimWorld.JobGiver_Reload"
+		"JobGiver_Reload"
+		"RimWorld.JobGiver_RescueNearby"
+		"JobGiver_RescueNearby"
+		"RimWorld.JobGiver_ReturnToGauranlenTree"
+		"JobGiver_ReturnToGauranlenTree"
+		"RimWorld.JobGiver_ReturnedCaravan_PenAnimals"
+		"JobGiver_ReturnedCaravan_PenAnimals"
+		"RimWorld.JobGiver_RevenantAttack"
+		"JobGiver_RevenantAttack"
+		"RimWorld.JobGiver_RevenantEscape"
+		"JobGiver_RevenantEscape"
+		"RimWorld.JobGiver_RevenantSleep"
+		"JobGiver_RevenantSleep"
+		"RimWorld.JobGiver_RevenantWander"
+		"JobGiver_RevenantWander"
+		"RimWorld.JobGiver_Sacrifice"
+		"JobGiver_Sacrifice"
+		"RimWorld.JobGiver_SatifyChemicalDependency"
+		"JobGiver_SatifyChemicalDependency"
+		"RimWorld.JobGiver_SatisfyChemicalNeed"
+		"JobGiver_SatisfyChemicalNeed"
+		"RimWorld.JobGiver_Scarify"
+		"JobGiver_Scarify"
+		"RimWorld.JobGiver_SeekAllowedArea"
+		"JobGiver_SeekAllowedArea"
+		"RimWorld.JobGiver_SeekSafeTemperature"
+		"JobGiver_SeekSafeTemperature"
+		"RimWorld.JobGiver_SelfShutdown"
+		"JobGiver_SelfShutdown"
+		"RimWorld.JobGiver_SelfTend"
+		"JobGiver_SelfTend"
+		"RimWorld.JobGiver_ShamblerFight"
+		"JobGiver_ShamblerFight"
+		"RimWorld.JobGiver_ShamblerWander"
+		"JobGiver_ShamblerWander"
+		"RimWorld.JobGiver_SightstealerAttack"
+		"JobGiver_SightstealerAttack"
+		"RimWorld.JobGiver_SlaughterEntity"
+		"JobGiver_SlaughterEntity"
+		"RimWorld.JobGiver_SlaughterRandomAnimal"
+		"JobGiver_SlaughterRandomAnimal"
+		"RimWorld.JobGiver_SocialFighting"
+		"JobGiver_SocialFighting"
+		"RimWorld.JobGiver_SpectateDutySpectateRect"
+		"JobGiver_SpectateDutySpectateRect"
+		"RimWorld.JobGiver_SpectateInCircleDuty"
+		"JobGiver_SpectateInCircleDuty"
+		"RimWorld.JobGiver_StandAndBeSociallyActive"
+		"JobGiver_StandAndBeSociallyActive"
+		"RimWorld.JobGiver_StandAndStare"
+		"JobGiver_StandAndStare"
+		"RimWorld.JobGiver_StartRoaming"
+		"JobGiver_StartRoaming"
+		"RimWorld.JobGiver_Steal"
+		"JobGiver_Steal"
+		"RimWorld.JobGiver_TakeCombatEnhancingDrug"
+		"JobGiver_TakeCombatEnhancingDrug"
+		"RimWorld.JobGiver_TakeCountToInventory"
+		"JobGiver_TakeCountToInventory"
+		"RimWorld.JobGiver_TakeDrugsForDrugPolicy"
+		"JobGiver_TakeDrugsForDrugPolicy"
+		"RimWorld.JobGiver_TakeForInventoryStock"
+		"JobGiver_TakeForInventoryStock"
+		"RimWorld.JobGiver_TakeWoundedGuest"
+		"JobGiver_TakeWoundedGuest"
+		"RimWorld.JobGiver_Tantrum"
+		"JobGiver_Tantrum"
+		"RimWorld.JobGiver_UnloadMyLordCarriers"
+		"JobGiver_UnloadMyLordCarriers"
+		"RimWorld.JobGiver_UnloadYourInventory"
+		"JobGiver_UnloadYourInventory"
+		"RimWorld.JobGiver_UnnaturalCorpseAttack"
+		"JobGiver_UnnaturalCorpseAttack"
+		"RimWorld.JobGiver_UnnaturalCorpseIdle"
+		"JobGiver_UnnaturalCorpseIdle"
+		"RimWorld.JobGiver_UnnaturalCorpseSkip"
+		"JobGiver_UnnaturalCorpseSkip"
+		"RimWorld.JobGiver_UnnaturalCorpseSkipBackup"
+		"JobGiver_UnnaturalCorpseSkipBackup"
+		"RimWorld.JobGiver_UnnaturalCorpseTowardVictimDirection"
+		"JobGiver_UnnaturalCorpseTowardVictimDirection"
+		"RimWorld.JobGiver_UnnaturalCorpseUnstuck"
+		"JobGiver_UnnaturalCorpseUnstuck"
+		"RimWorld.JobGiver_WanderColony"
+		"JobGiver_WanderColony"
+		"RimWorld.JobGiver_WanderControlGroupTarget"
+		"JobGiver_WanderControlGroupTarget"
+		"RimWorld.JobGiver_WanderHive"
+		"JobGiver_WanderHive"
+		"RimWorld.JobGiver_WanderInGatheringArea"
+		"JobGiver_WanderInGatheringArea"
+		"RimWorld.JobGiver_WanderOverseer"
+		"JobGiver_WanderOverseer"
+		"RimWorld.JoyGiverDef"
+		"JoyGiverDef"
+		"thingDefs"
+		"JoyKindDef"
+		"titleRequiredAny"
+		"KnowledgeCategoryDef"
+		"overflowCategory"
+		"LayoutDef"
+		"LayoutRoomDef"
+		"floorTypes"
+		"Verse.TerrainDef"
+		"sketchResolverDef"
+		"RimWorld.SketchResolverDef"
+		"RimWorld.LearningDesireDef"
+		"LearningDesireDef"
+		"RimWorld.LifeStageDef"
+		"LifeStageDef"
+		"customMoodTipString"
+		"thinkTreeConstantOverride"
+		"Verse.ThinkTreeDef"
+		"thinkTreeMainOverride"
+		"RimWorld.MainButtonDef"
+		"MainButtonDef"
+		"RimWorld.MapMeshFlagDef"
+		"MapMeshFlagDef"
+		"RimWorld.MeditationFocusDef"
+		"MeditationFocusDef"
+		"MemeDef"
+		"worshipRoomLabel"
+		"symbolPacks"
+		"addDesignatorGroups"
+		"Verse.DesignatorDropdownGroupDef"
+		"addDesignators"
+		"Verse.BuildableDef"
+		"cachedAllDesignatorBuildables"
+		"consumableBuildings"
+		"factionWhitelist"
+		"fixedDeityNameTypes"
+		"replacementPatterns"
+		"RimWorld.RitualPatternDef"
+		"requireAnyRitualSeat"
+		"startingResearchProjects"
+		"deityNameMakerOverride"
+		"deityTypeMakerOverride"
+		"generalRules"
+		"RimWorld.MemeGroupDef"
+		"MemeGroupDef"
+		"RimWorld.MonolithLevelDef"
+		"MonolithLevelDef"
+		"activatableLetterLabel"
+		"activatableLetterText"
+		"activateFloatMenuText"
+		"activateGizmoDescription"
+		"activateGizmoText"
+		"activateQuestText"
+		"activatedLetterText"
+		"extraQuestDescription"
+		"levelInspectText"
+		"monolithCanBeActivatedText"
+		"monolithDescription"
+		"monolithLabel"
+		"pawnSentToActivateMessage"
+		"incidentsOnReached"
+		"unreachableDuringConditions"
+		"activateSound"
+		"activatedSound"
+		"entityCatagoryCompletionRequired"
+		"monolithStudyCategory"
+		"RimWorld.MusicSequenceDef"
+		"MusicSequenceDef"
+		"songs"
+		"Verse.SongDef"
+		"nextSequence"
+		"song"
+		"RimWorld.MusicTransitionDef"
+		"MusicTransitionDef"
+		"sequence"
+		"RimWorld.MutantCount"
+		"MutantCount"
+		"RimWorld.StartingPawnCount"
+		"mutant"
+		"MutantDef"
+		"deathLetter"
+		"deathLetterExtra"
+		"namePrefix"
+		"abilities"
+		"abilityWhitelist"
+		"disablesGenes"
+		"drugWhitelist"
+		"enabledNeeds"
+		"RimWorld.NeedDef"
+		"forcedHeadTypes"
+		"Verse.HeadTypeDef"
+		"removesHediffs"
+		"tools"
+		"Verse.Tool"
+		"verbs"
+		"bloodDef"
+		"bloodSmearDef"
+		"defaultFaction"
+		"hediff"
+		"relativeTurnedThought"
+		"soundAngry"
+		"soundAttack"
+		"soundCall"
+		"soundDeath"
+		"soundWounded"
+		"standingAnimation"
+		"Verse.AnimationDef"
+		"thinkTree"
+		"thinkTreeConstant"
+		"NeedDef"
+		"hediffRequiredAny"
+		"nullifyingPrecepts"
+		"RimWorld.PawnColumnDef"
+		"PawnColumnDef"
+		"headerTip"
+		"trainable"
+		"RimWorld.TrainableDef"
+		"workType"
+		"RimWorld.PawnExpectationsQualityOffset"
+		"PawnExpectationsQualityOffset"
+		"expectation"
+		"RimWorld.PawnGroupKindDef"
+		"PawnGroupKindDef"
+		"PawnRelationDef"
+		"labelFemale"
+		"soldThoughts"
+		"diedThought"
+		"diedThoughtFemale"
+		"killedThought"
+		"killedThoughtFemale"
+		"lostThought"
+		"lostThoughtFemale"
+		"RimWorld.PawnTableDef"
+		"PawnTableDef"
+		"columns"
+		"RimWorld.PawnsArrivalModeDef"
+		"PawnsArrivalModeDef"
+		"textEnemy"
+		"textFriendly"
+		"textWillArrive"
+		"RimWorld.PitGateIncidentDef"
+		"PitGateIncidentDef"
+		"disableEnteringReason"
+		"RimWorld.PreceptComp"
+		"PreceptComp"
+		"preceptDef"
+		"RimWorld.PreceptComp_Apparel"
+		"PreceptComp_Apparel"
+		"RimWorld.PreceptComp_Apparel_Desired"
+		"PreceptComp_Apparel_Desired"
+		"RimWorld.PreceptComp_Apparel_DesiredStrong"
+		"PreceptComp_Apparel_DesiredStrong"
+		"RimWorld.PreceptComp_BedThought"
+		"PreceptComp_BedThought"
+		"RimWorld.PreceptComp_Thought"
+		"thoughtStageDescriptions"
+		"RimWorld.PreceptComp_DevelopmentPoints"
+		"PreceptComp_DevelopmentPoints"
+		"eventLabel"
+		"eventDef"
+		"RimWorld.PreceptComp_GoodwillSituation"
+		"PreceptComp_GoodwillSituation"
+		"goodwillSituation"
+		"RimWorld.PreceptComp_KnowsMemoryThought"
+		"PreceptComp_KnowsMemoryThought"
+		"removesThought"
+		"RimWorld.PreceptComp_MentalBreak"
+		"PreceptComp_MentalBreak"
+		"mentalBreakDef"
+		"Verse.MentalBreakDef"
+		"RimWorld.PreceptComp_SelfTookMemoryThought"
+		"PreceptComp_SelfTookMemoryThought"
+		"RimWorld.PreceptComp_SituationalThought"
+		"PreceptComp_SituationalThought"
+		"PreceptComp_Thought"
+		"RimWorld.PreceptComp_UnwillingToDo"
+		"PreceptComp_UnwillingToDo"
+		"nullifyingHediffs"
+		"RimWorld.PreceptComp_UnwillingToDo_Chance"
+		"PreceptComp_UnwillingToDo_Chance"
+		"RimWorld.PreceptComp_UnwillingToDo_Gendered"
+		"PreceptComp_UnwillingToDo_Gendered"
+		"RimWorld.PreceptComp_UnwillingToDo_WithDef"
+		"PreceptComp_UnwillingToDo_WithDef"
+		"buildingDef"
+		"PreceptDef"
+		"extraTextPawnDeathLetter"
+		"tipLabelOverride"
+		"associatedMemes"
+		"buildingMinExpectations"
+		"comps"
+		"conflictingMemes"
+		"grantedAbilities"
+		"opposedWorkTypes"
+		"roleEffects"
+		"RimWorld.RoleEffect"
+		"alsoAdds"
+		"apparelPreceptSwapDef"
+		"defaultDrugPolicyOverride"
+		"issue"
+		"ritualPatternBase"
+		"sourceAbilityDef"
+		"sourcePawnRoleDef"
+		"takeNameFrom"
+		"useCooldownFromAbilityGroupDef"
+		"RimWorld.PrisonerInteractionModeDef"
+		"PrisonerInteractionModeDef"
+		"RimWorld.PsychicRitualDef"
+		"PsychicRitualDef"
+		"letterAIArrivedText"
+		"letterAICompleteLabel"
+		"letterAICompleteText"
+		"rolesBackingList"
+		"RimWorld.PsychicRitualRoleDef"
+		"researchPrerequisite"
+		"RimWorld.PsychicRitualDef_BloodRain"
+		"PsychicRitualDef_BloodRain"
+		"RimWorld.PsychicRitualDef_InvocationCircle"
+		"outcomeDescription"
+		"chanterRole"
+		"defenderRole"
+		"invokerRole"
+		"targetRole"
+		"RimWorld.PsychicRitualDef_Brainwipe"
+		"PsychicRitualDef_Brainwipe"
+		"RimWorld.PsychicRitualDef_Chronophagy"
+		"PsychicRitualDef_Chronophagy"
+		"RimWorld.PsychicRitualDef_ImbueDeathRefusal"
+		"PsychicRitualDef_ImbueDeathRefusal"
+		"PsychicRitualDef_InvocationCircle"
+		"RimWorld.PsychicRitualDef_NeurosisPulse"
+		"PsychicRitualDef_NeurosisPulse"
+		"RimWorld.PsychicRitualDef_Philophagy"
+		"PsychicRitualDef_Philophagy"
+		"RimWorld.PsychicRitualDef_PleasurePulse"
+		"PsychicRitualDef_PleasurePulse"
+		"RimWorld.PsychicRitualDef_Psychophagy"
+		"PsychicRitualDef_Psychophagy"
+		"RimWorld.PsychicRitualDef_SkipAbduction"
+		"PsychicRitualDef_SkipAbduction"
+		"RimWorld.PsychicRitualDef_SkipAbductionPlayer"
+		"PsychicRitualDef_SkipAbductionPlayer"
+		"RimWorld.PsychicRitualDef_SummonAnimals"
+		"PsychicRitualDef_SummonAnimals"
+		"RimWorld.PsychicRitualDef_SummonFleshbeasts"
+		"PsychicRitualDef_SummonFleshbeasts"
+		"RimWorld.PsychicRitualDef_SummonFleshbeastsPlayer"
+		"PsychicRitualDef_SummonFleshbeastsPlayer"
+		"RimWorld.PsychicRitualDef_SummonPitGate"
+		"PsychicRitualDef_SummonPitGate"
+		"RimWorld.PsychicRitualDef_SummonShamblers"
+		"PsychicRitualDef_SummonShamblers"
+		"RimWorld.PsychicRitualDef_VoidProvocation"
+		"PsychicRitualDef_VoidProvocation"
+		"PsychicRitualRoleDef"
+		"RimWorld.PsychicRitualRoleDef_DeathRefusalTarget"
+		"PsychicRitualRoleDef_DeathRefusalTarget"
+		"psychicRitualLeaveReason_MaxDeathRefusal"
+		"QuestScriptDef"
+		"epicParent"
+		"failedOrExpiredHistoryEvent"
+		"questAvailableLetterDef"
+		"questContentRules"
+		"questDescriptionAndNameRules"
+		"questDescriptionRules"
+		"questNameRules"
+		"successHistoryEvent"
+		"RaidAgeRestrictionDef"
+		"arrivalTextExtra"
+		"RaidStrategyDef"
+		"arrivalTextEnemy"
+		"arrivalTextFriendly"
+		"letterLabelEnemy"
+		"letterLabelFriendly"
+		"arriveModes"
+		"RimWorld.RecordDef"
+		"RecordDef"
+		"measuredTimeJobs"
+		"RimWorld.RenderSkipFlagDef"
+		"RenderSkipFlagDef"
+		"RimWorld.ResearchTabDef"
+		"ResearchTabDef"
+		"generalDescription"
+		"generalTitle"
+		"RimWorld.RitualAttachableOutcomeEffectDef"
+		"RitualAttachableOutcomeEffectDef"
+		"effectDesc"
+		"letterInfoText"
+		"allowedRituals"
+		"disallowedRituals"
+		"requiredMemeAny"
+		"requiredFaction"
+		"RimWorld.RitualBehaviorDef"
+		"RitualBehaviorDef"
+		"spectatorGerund"
+		"spectatorsLabel"
+		"roles"
+		"RimWorld.RitualRole"
+		"soundDefsPerEnhancerCount"
+		"spectatorFilter"
+		"RimWorld.RitualSpectatorFilter"
+		"RimWorld.RitualObligationTargetFilterDef"
+		"RitualObligationTargetFilterDef"
+		"RimWorld.RitualOutcomeComp"
+		"RitualOutcomeComp"
+		"labelAbstract"
+		"RimWorld.RitualOutcomeComp_AtLeastOneSpectator"
+		"RitualOutcomeComp_AtLeastOneSpectator"
+		"RimWorld.RitualOutcomeComp_ParticipantCount"
+		"labelNotMet"
+		"RimWorld.RitualOutcomeComp_BuildingOfAnyDefPresent"
+		"RitualOutcomeComp_BuildingOfAnyDefPresent"
+		"RimWorld.RitualOutcomeComp_BuildingsPresent"
+		"defs"
+		"RimWorld.RitualOutcomeComp_BuildingOfDefPresent"
+		"RitualOutcomeComp_BuildingOfDefPresent"
+		"RimWorld.RitualOutcomeComp_BuildingOfDefUsed"
+		"RitualOutcomeComp_BuildingOfDefUsed"
+		"RimWorld.RitualOutcomeComp_QualitySingleOffset"
+		"RitualOutcomeComp_BuildingsPresent"
+		"RimWorld.RitualOutcomeComp_DestroyConsumableBuilding"
+		"RitualOutcomeComp_DestroyConsumableBuilding"
+		"RimWorld.RitualOutcomeComp_DuelistDied"
+		"RitualOutcomeComp_DuelistDied"
+		"RimWorld.RitualOutcomeComp_Indoors"
+		"RitualOutcomeComp_Indoors"
+		"RimWorld.RitualOutcomeComp_LovedOnePresent"
+		"RitualOutcomeComp_LovedOnePresent"
+		"RimWorld.RitualOutcomeComp_Quality"
+		"RimWorld.RitualOutcomeComp_NumActiveLoudspeakers"
+		"RitualOutcomeComp_NumActiveLoudspeakers"
+		"RimWorld.RitualOutcomeComp_NumParticipantsWithTag"
+		"RitualOutcomeComp_NumParticipantsWithTag"
+		"RimWorld.RitualOutcomeComp_NumPlayedDrums"
+		"RitualOutcomeComp_NumPlayedDrums"
+		"RitualOutcomeComp_ParticipantCount"
+		"RimWorld.RitualOutcomeComp_PawnAge"
+		"RitualOutcomeComp_PawnAge"
+		"RimWorld.RitualOutcomeComp_PawnExpectations"
+		"RitualOutcomeComp_PawnExpectations"
+		"offsetPerExpectation"
+		"slaveExpectationCached"
+		"RimWorld.RitualOutcomeComp_PawnSkill"
+		"RitualOutcomeComp_PawnSkill"
+		"skillDef"
+		"RimWorld.RitualOutcomeComp_PawnStatScaled"
+		"RitualOutcomeComp_PawnStatScaled"
+		"statDef"
+		"RitualOutcomeComp_Quality"
+		"RitualOutcomeComp_QualitySingleOffset"
+		"RimWorld.RitualOutcomeComp_RitualSeatPresent"
+		"RitualOutcomeComp_RitualSeatPresent"
+		"RimWorld.RitualOutcomeComp_RitualTargetDefs"
+		"RitualOutcomeComp_RitualTargetDefs"
+		"expectedThingLabelTip"
+		"RimWorld.RitualOutcomeComp_RoleChangeParticipants"
+		"RitualOutcomeComp_RoleChangeParticipants"
+		"RimWorld.RitualOutcomeComp_RolePresentNotSubstituted"
+		"RitualOutcomeComp_RolePresentNotSubstituted"
+		"RimWorld.RitualOutcomeComp_RoomStat"
+		"RitualOutcomeComp_RoomStat"
+		"Verse.RoomStatDef"
+		"RimWorld.RitualOutcomeComp_TargetThingStat"
+		"RitualOutcomeComp_TargetThingStat"
+		"RimWorld.RitualOutcomeComp_WeaponUsed"
+		"RitualOutcomeComp_WeaponUsed"
+		"RimWorld.RitualOutcomeEffectDef"
+		"RitualOutcomeEffectDef"
+		"extraInfoLines"
+		"extraPredictedOutcomeDescriptions"
+		"extraOutcomeDescriptions"
+		"RimWorld.RitualOutcomeEffectDef+ExtraOutcomeChanceDescription"
+		"outcomeChances"
+		"RimWorld.RitualOutcomePossibility"
+		"bestOutcomeCached"
+		"effecter"
+		"filthDefToSpawn"
+		"fleckDef"
+		"memoryDef"
+		"worstOutcomeCached"
+		"ExtraOutcomeChanceDescription"
+		"RimWorld.ExtraOutcomeChanceDescription"
+		"RitualOutcomePossibility"
+		"potentialExtraOutcomeDesc"
+		"memory"
+		"RitualPatternDef"
+		"beginRitualOverride"
+		"descOverride"
+		"ritualExpectedDesc"
+		"ritualExpectedDescNoAdjective"
+		"ritualExplanation"
+		"shortDescOverride"
+		"ritualBehavior"
+		"ritualObligationTargetFilter"
+		"ritualOutcomeEffect"
+		"ritualTargetFilter"
+		"RimWorld.RitualTargetFilterDef"
+		"RitualRole"
+		"categoryLabel"
+		"customChildDisallowMessage"
+		"missingDesc"
+		"noCandidatesGizmoDesc"
+		"precept"
+		"RimWorld.RitualRoleAnimaLinker"
+		"RitualRoleAnimaLinker"
+		"RimWorld.RitualRoleAnimal"
+		"RitualRoleAnimal"
+		"RimWorld.RitualRoleBehavior"
+		"RitualRoleBehavior"
+		"jobReportOverride"
+		"dutyDef"
+		"speakerInteraction"
+		"RimWorld.RitualRoleBlindingTarget"
+		"RitualRoleBlindingTarget"
+		"RimWorld.RitualRoleColonist"
+		"RitualRoleColonist"
+		"requiredWorkType"
+		"usedSkill"
+		"RimWorld.RitualRoleColonistConnectable"
+		"RitualRoleColonistConnectable"
+		"RimWorld.RitualRoleConvertee"
+		"RitualRoleConvertee"
+		"RimWorld.RitualRoleForced"
+		"RitualRoleForced"
+		"RimWorld.RitualRoleIdeoRoleChanger"
+		"RitualRoleIdeoRoleChanger"
+		"RimWorld.RitualRoleOrganizer"
+		"RitualRoleOrganizer"
+		"RimWorld.RitualRolePrisoner"
+		"RitualRolePrisoner"
+		"RimWorld.RitualRolePrisonerOrSlave"
+		"RitualRolePrisonerOrSlave"
+		"RimWorld.RitualRoleScarificationTarget"
+		"RitualRoleScarificationTarget"
+		"RimWorld.RitualRoleTag"
+		"RitualRoleTag"
+		"RimWorld.RitualRoleWarden"
+		"RitualRoleWarden"
+		"RimWorld.RitualRole_Mother"
+		"RitualRole_Mother"
+		"RitualSpectatorFilter"
+		"RimWorld.RitualSpectatorFilter_NatureFocus"
+		"RitualSpectatorFilter_NatureFocus"
+		"RimWorld.RitualSpectatorFilter_WillWitnessExecution"
+		"RitualSpectatorFilter_WillWitnessExecution"
+		"RimWorld.RitualStageAction_Message"
+		"RitualStageAction_Message"
+		"RimWorld.RitualStageAction"
+		"messageTypeDef"
+		"RitualTargetFilterDef"
+		"RimWorld.RitualVisualEffectDef"
+		"RitualVisualEffectDef"
+		"RimWorld.RiverDef"
+		"RiverDef"
+		"degradeChild"
+		"RimWorld.RoadDef"
+		"RoadDef"
+		"pathingMode"
+		"RimWorld.RoadPathingDef"
+		"RoadPathingDef"
+		"RimWorld.RoadWorldLayerDef"
+		"RoadWorldLayerDef"
+		"RoleEffect"
+		"RimWorld.RoleEffect_GiveThoughtOnTend"
+		"RoleEffect_GiveThoughtOnTend"
+		"thoughtDef"
+		"RimWorld.RoleEffect_HuntingRevengeChanceFactor"
+		"RoleEffect_HuntingRevengeChanceFactor"
+		"RimWorld.RoleEffect_NoMeleeWeapons"
+		"RoleEffect_NoMeleeWeapons"
+		"RimWorld.RoleEffect_NoRangedWeapons"
+		"RoleEffect_NoRangedWeapons"
+		"RimWorld.RoleEffect_PawnStatFactor"
+		"RoleEffect_PawnStatFactor"
+		"RimWorld.RoleEffect_PawnStatModifier"
+		"RoleEffect_PawnStatModifier"
+		"RimWorld.RoleEffect_PawnStatOffset"
+		"RoleEffect_PawnStatOffset"
+		"RimWorld.RoleEffect_ProductionQualityOffset"
+		"RoleEffect_ProductionQualityOffset"
+		"RoyalTitleDef"
+		"disabledJoyKinds"
+		"permits"
+		"RimWorld.RoyalTitlePermitDef"
+		"requiredApparel"
+		"satisfyingMealsCached"
+		"satisfyingMealsNoDrugsCached"
+		"awardThought"
+		"minExpectation"
+		"replaceOnRecruited"
+		"RoyalTitlePermitDef"
+		"minTitle"
+		"prerequisite"
+		"RimWorld.RuleDef"
+		"RuleDef"
+		"RimWorld.ScenPartDef"
+		"ScenPartDef"
+		"genStep"
+		"RimWorld.ScenPart_ConfigPage_ConfigureStartingPawns_Mutants"
+		"ScenPart_ConfigPage_ConfigureStartingPawns_Mutants"
+		"RimWorld.ScenPart_ConfigPage_ConfigureStartingPawnsBase"
+		"customSummary"
+		"mutantCounts"
+		"RimWorld.ScenPart_ConfigPage_ConfigureStartingPawns_Xenotypes"
+		"ScenPart_ConfigPage_ConfigureStartingPawns_Xenotypes"
+		"xenotypeCounts"
+		"RimWorld.XenotypeCount"
+		"RimWorld.Scenario"
+		"Scenario"
+		"name"
+		"summary"
+		"RimWorld.ScenarioDef"
+		"ScenarioDef"
+		"scenario"
+		"RimWorld.ShipJobDef"
+		"ShipJobDef"
+		"RimWorld.SitePartDef"
+		"SitePartDef"
+		"approachOrderString"
+		"approachingReportString"
+		"arrivedLetter"
+		"arrivedLetterLabelPart"
+		"arrivedLetterHediffHyperlinks"
+		"extraGenSteps"
+		"arrivedLetterDef"
+		"conditionCauserDef"
+		"SketchResolverDef"
+		"SkillDef"
+		"skillLabel"
+		"lessonInteraction"
+		"RimWorld.SlaveInteractionModeDef"
+		"SlaveInteractionModeDef"
+		"RimWorld.StageFailTrigger"
+		"StageFailTrigger"
+		"desc"
+		"RimWorld.StageFailTrigger_NoPoweredLoudspeakers"
+		"StageFailTrigger_NoPoweredLoudspeakers"
+		"onlyIfTargetIsOfDef"
+		"RimWorld.StageFailTrigger_NoThingPresent"
+		"StageFailTrigger_NoThingPresent"
+		"RimWorld.StageFailTrigger_PawnAlive"
+		"StageFailTrigger_PawnAlive"
+		"RimWorld.StageFailTrigger_PawnAsleep"
+		"StageFailTrigger_PawnAsleep"
+		"RimWorld.StageFailTrigger_TargetNotLit"
+		"StageFailTrigger_TargetNotLit"
+		"RimWorld.StageFailTrigger_TargetPawnUnreachable"
+		"StageFailTrigger_TargetPawnUnreachable"
+		"RimWorld.StageFailTrigger_TargetThingMissing"
+		"StageFailTrigger_TargetThingMissing"
+		"RimWorld.StageFailTrigger_TargetUnpowered"
+		"StageFailTrigger_TargetUnpowered"
+		"StatCategoryDef"
+		"StatDef"
+		"formatString"
+		"formatStringUnfinalized"
+		"offsetLabel"
+		"statFactorsExplanationHeader"
+		"postProcessStatFactors"
+		"showIfHediffsPresent"
+		"showOnPawnKind"
+		"statFactors"
+		"disableIfSkillDisabled"
+		"RimWorld.StatPart_OverseerStatOffset"
+		"StatPart_OverseerStatOffset"
+		"RimWorld.StatPart"
+		"parentStat"
+		"RimWorld.StatPart_RoomStat"
+		"StatPart_RoomStat"
+		"customLabel"
+		"roomStat"
+		"RimWorld.StorytellerDef"
+		"StorytellerDef"
+		"forcedDifficulty"
+		"RimWorld.StudyNote"
+		"StudyNote"
+		"RimWorld.StuffCategoryDef"
+		"StuffCategoryDef"
+		"noun"
+		"destroySoundLarge"
+		"destroySoundMedium"
+		"destroySoundSmall"
+		"RimWorld.StyleItemCategoryDef"
+		"StyleItemCategoryDef"
+		"cachedStyleItems"
+		"StyleItemDef"
+		"RimWorld.SurgeryOutcome"
+		"SurgeryOutcome"
+		"RimWorld.SurgeryOutcomeEffectDef"
+		"SurgeryOutcomeEffectDef"
+		"outcomes"
+		"RimWorld.SurgeryOutcomeSuccess"
+		"SurgeryOutcomeSuccess"
+		"RimWorld.SurgeryOutcome_Death"
+		"SurgeryOutcome_Death"
+		"RimWorld.SurgeryOutcome_Failure"
+		"SurgeryOutcome_Failure"
+		"RimWorld.SurgeryOutcome_FailureWithHediff"
+		"SurgeryOutcome_FailureWithHediff"
+		"applyToRecipes"
+		"failedHediff"
+		"RimWorld.SurgeryOutcome_HediffWithDuration"
+		"SurgeryOutcome_HediffWithDuration"
+		"TaleDef"
+		"rulePack"
+		"RimWorld.TattooDef"
+		"TattooDef"
+		"RimWorld.TerrainTemplateDef"
+		"TerrainTemplateDef"
+		"researchPrerequisites"
+		"burnedDef"
+		"designatorDropdown"
+		"dominantStyleCategory"
+		"ThingSetMakerDef"
+		"ThoughtDef"
+		"labelInBracketsExtraForHediff"
+		"neverNullifyIfAnyTrait"
+		"RimWorld.TraitDef"
+		"nullifyingGenes"
+		"nullifyingOwnTales"
+		"nullifyingTraits"
+		"replaceThoughts"
+		"requiredGenes"
+		"requiredHediffs"
+		"requiredTraits"
+		"stages"
+		"RimWorld.ThoughtStage"
+		"chemicalDef"
+		"effectMultiplyingStat"
+		"mentalState"
+		"Verse.MentalStateDef"
+		"minExpectationForNegativeThought"
+		"nextThought"
+		"producesMemoryThought"
+		"taleDef"
+		"thoughtToMake"
+		"ThoughtStage"
+		"labelSocial"
+		"RimWorld.TimeAssignmentDef"
+		"TimeAssignmentDef"
+		"TraderKindDef"
+		"permitRequiredForTrading"
+		"TrainableDef"
+		"prerequisites"
+		"requiredTrainability"
+		"Verse.TrainabilityDef"
+		"TraitDef"
+		"conflictingPassions"
+		"conflictingTraits"
+		"degreeDatas"
+		"RimWorld.TraitDegreeData"
+		"disabledWorkTypes"
+		"forcedPassions"
+		"requiredWorkTypes"
+		"disableHostilityFromFaction"
+		"TraitDegreeData"
+		"labelMale"
+		"affectedIssuesCached"
+		"agreeableMemesCached"
+		"allowedMeditationFocusTypes"
+		"disablesNeeds"
+		"disagreeableMemesCached"
+		"disallowedInspirations"
+		"disallowedMeditationFocusTypes"
+		"disallowedMentalStates"
+		"disallowedThoughts"
+		"mentalBreakInspirationGainSet"
+		"needs"
+		"theOnlyAllowedMentalBreaks"
+		"forcedMentalState"
+		"randomMentalState"
+		"RimWorld.TransferableSorterDef"
+		"TransferableSorterDef"
+		"RimWorld.TransportShipDef"
+		"TransportShipDef"
+		"arrivingSkyfaller"
+		"leavingSkyfaller"
+		"shipThing"
+		"worldObject"
+		"RimWorld.WorldObjectDef"
+		"RimWorld.WeaponTraitDef"
+		"WeaponTraitDef"
+		"bondedHediffs"
+		"equippedHediffs"
+		"bondedThought"
+		"killThought"
+		"RimWorld.WorkGiverDef"
+		"WorkGiverDef"
+		"gerund"
+		"verb"
+		"fixedBillGiverDefs"
+		"equivalenceGroup"
+		"RimWorld.WorkGiverEquivalenceGroupDef"
+		"forceFleck"
+		"forceMote"
+		"scannerDef"
+		"WorkGiverEquivalenceGroupDef"
+		"WorldObjectDef"
+		"IncidentTargetTags"
+		"mapGenerator"
+		"Verse.MapGeneratorDef"
+		"XenotypeCount"
+		"xenotype"
+		"RimWorld.XenotypeDef"
+		"XenotypeDef"
+		"descriptionShort"
+		"forbiddenWeaponClasses"
+		"WeaponClassDef"
+		"genes"
+		"nameMakerFemale"
+		"soundDefOnImplant"
+		"RimWorld.XenotypeIconDef"
+		"XenotypeIconDef"
+		"Verse.AI"
+		"DutyDef"
+		"Verse.AI.Job"
+		"Job"
+		"interaction"
+		"jobGiverThinkTree"
+		"plantDefToSow"
+		"speechSoundFemale"
+		"speechSoundMale"
+		"thingDefToCarry"
+		"workGiverDef"
+		"Verse.AI.JobGiver_Carried"
+		"JobGiver_Carried"
+		"Verse.AI.JobGiver_ExitMap"
+		"JobGiver_ExitMap"
+		"Verse.AI.JobGiver_ExitMapBest"
+		"JobGiver_ExitMapBest"
+		"Verse.AI.JobGiver_ExitMapFollowOverseer"
+		"JobGiver_ExitMapFollowOverseer"
+		"Verse.AI.JobGiver_ExitMapNearDutyTarget"
+		"JobGiver_ExitMapNearDutyTarget"
+		"Verse.AI.JobGiver_ExitMapPanic"
+		"JobGiver_ExitMapPanic"
+		"Verse.AI.JobGiver_ExitMapRandom"
+		"JobGiver_ExitMapRandom"
+		"Verse.AI.JobGiver_FightFiresNearConnectedTree"
+		"JobGiver_FightFiresNearConnectedTree"
+		"Verse.AI.JobGiver_ForcedGoto"
+		"JobGiver_ForcedGoto"
+		"Verse.AI.JobGiver_Idle"
+		"JobGiver_Idle"
+		"Verse.AI.JobGiver_IdleError"
+		"JobGiver_IdleError"
+		"Verse.AI.JobGiver_IdleForever"
+		"JobGiver_IdleForever"
+		"Verse.AI.JobGiver_IdleWhileDespawned"
+		"JobGiver_IdleWhileDespawned"
+		"Verse.AI.JobGiver_MoveToStandable"
+		"JobGiver_MoveToStandable"
+		"Verse.AI.JobGiver_Orders"
+		"JobGiver_Orders"
+		"Verse.AI.JobGiver_PickupDroppedWeapon"
+		"JobGiver_PickupDroppedWeapon"
+		"Verse.AI.JobGiver_RunRandom"
+		"JobGiver_RunRandom"
+		"Verse.AI.JobGiver_UseStylingStationAutomatic"
+		"JobGiver_UseStylingStationAutomatic"
+		"JobGiver_Wander"
+		"Verse.AI.JobGiver_WanderAnywhere"
+		"JobGiver_WanderAnywhere"
+		"Verse.AI.JobGiver_WanderCurrentRoom"
+		"JobGiver_WanderCurrentRoom"
+		"Verse.AI.JobGiver_WanderHerd"
+		"JobGiver_WanderHerd"
+		"Verse.AI.JobGiver_WanderInPen"
+		"JobGiver_WanderInPen"
+		"Verse.AI.JobGiver_WanderInRoofedCellsInPen"
+		"JobGiver_WanderInRoofedCellsInPen"
+		"Verse.AI.JobGiver_WanderMapEdge"
+		"JobGiver_WanderMapEdge"
+		"Verse.AI.JobGiver_WanderNearBreacher"
+		"JobGiver_WanderNearBreacher"
+		"Verse.AI.JobGiver_WanderNearConnectedTree"
+		"JobGiver_WanderNearConnectedTree"
+		"Verse.AI.JobGiver_WanderNearDutyLocation"
+		"JobGiver_WanderNearDutyLocation"
+		"Verse.AI.JobGiver_WanderNearFallbackLocation"
+		"JobGiver_WanderNearFallbackLocation"
+		"Verse.AI.JobGiver_WanderNearMaster"
+		"JobGiver_WanderNearMaster"
+		"Verse.AI.JobGiver_WanderNearRoamingExit"
+		"JobGiver_WanderNearRoamingExit"
+		"Verse.AI.JobGiver_WanderOwnRoom"
+		"JobGiver_WanderOwnRoom"
+		"Verse.AI.JobGiver_WanderRoped"
+		"JobGiver_WanderRoped"
+		"ThinkNode_JobGiver"
+		"Verse.AI.ThinkNode"
+		"Verse"
+		"AnimationDef"
+		"Verse.ApparelLayerDef"
+		"ApparelLayerDef"
+		"Verse.BodyDef"
+		"BodyDef"
+		"cachedAllParts"
+		"Verse.BodyPartRecord"
+		"cachedPartsVulnerableToFrostbite"
+		"corePart"
+		"BodyPartDef"
+		"labelShort"
+		"removeRecipeLabelOverride"
+		"tags"
+		"Verse.BodyPartTagDef"
+		"spawnThingOnRemoved"
+		"BodyPartGroupDef"
+		"BodyPartRecord"
+		"groups"
+		"parts"
+		"body"
+		"BodyPartTagDef"
+		"BuildableDef"
+		"stuffCategorySummary"
+		"buildingPrerequisites"
+		"stuffCategories"
+		"blueprintDef"
+		"constructEffect"
+		"designationCategory"
+		"Verse.DesignationCategoryDef"
+		"designationHotKey"
+		"frameDef"
+		"installBlueprintDef"
+		"repairEffect"
+		"terrainAffordanceNeeded"
+		"Verse.TerrainAffordanceDef"
+		"ClamorDef"
+		"Verse.CreepJoinerAggressiveDef"
+		"CreepJoinerAggressiveDef"
+		"Verse.CreepJoinerBaseDef"
+		"surgicalInspectionLetterExtra"
+		"CreepJoinerBaseDef"
+		"excludes"
+		"requires"
+		"Verse.CreepJoinerBenefitDef"
+		"CreepJoinerBenefitDef"
+		"letterExtra"
+		"hediffs"
+		"Verse.CreepJoinerDownsideDef"
+		"CreepJoinerDownsideDef"
+		"Verse.CreepJoinerFormKindDef"
+		"CreepJoinerFormKindDef"
+		"labelFemalePlural"
+		"labelMalePlural"
+		"labelPlural"
+		"letterPrompt"
+		"apparelRequired"
+		"disallowedTraits"
+		"fixedAdultBackstories"
+		"fixedChildBackstories"
+		"forcedAddictions"
+		"lifeStages"
+		"Verse.PawnKindLifeStage"
+		"meleeAttackInfectionPathways"
+		"rangedAttackInfectionPathways"
+		"techHediffsRequired"
+		"titleSelectOne"
+		"defaultFactionType"
+		"forcedHair"
+		"invFoodDef"
+		"minTitleRequired"
+		"race"
+		"titleRequired"
+		"weaponStuffOverride"
+		"weaponStyleDef"
+		"Verse.ThingStyleDef"
+		"Verse.CreepJoinerRejectionDef"
+		"CreepJoinerRejectionDef"
+		"Verse.DamageArmorCategoryDef"
+		"DamageArmorCategoryDef"
+		"armorRatingStat"
+		"multStat"
+		"Verse.DamageDef"
+		"DamageDef"
+		"adaptedText"
+		"deathMessage"
+		"armorCategory"
+		"combatLogRules"
+		"explosionCellEffecter"
+		"explosionCellFleck"
+		"explosionCellMote"
+		"explosionCenterEffecter"
+		"explosionCenterFleck"
+		"explosionCenterMote"
+		"explosionInteriorEffecter"
+		"explosionInteriorFleck"
+		"explosionInteriorMote"
+		"hediffSkin"
+		"hediffSolid"
+		"impactSoundType"
+		"Verse.Sound.ImpactSoundTypeDef"
+		"soundExplosion"
+		"stunResistStat"
+		"Def"
+		"Verse.Editable"
+		"DesignationCategoryDef"
+		"bindingCatDef"
+		"Verse.KeyBindingCategoryDef"
+		"Verse.DesignationDef"
+		"DesignationDef"
+		"DesignatorDropdownGroupDef"
+		"Editable"
+		"EffecterDef"
+		"FleckDef"
+		"landSound"
+		"GameConditionDef"
+		"descriptionFuture"
+		"startMessage"
+		"exclusiveConditions"
+		"letterHyperlinks"
+		"silencedByConditions"
+		"weatherDef"
+		"Verse.WeatherDef"
+		"GenStepDef"
+		"linkWithSite"
+		"GeneCategoryDef"
+		"GeneDef"
+		"resourceDescription"
+		"resourceLabel"
+		"customEffectDescriptions"
+		"hediffGiversCannotGive"
+		"makeImmuneTo"
+		"causesNeed"
+		"chemical"
+		"deathHistoryEvent"
+		"fur"
+		"Verse.GeneSymbolPack+WeightedSymbol"
+		"WeightedSymbol"
+		"Verse.WeightedSymbol"
+		"symbol"
+		"Verse.Grammar"
+		"RulePack"
+		"rulesStrings"
+		"include"
+		"Verse.Grammar.Rule_String"
+		"Rule_String"
+		"Verse.Grammar.Rule"
+		"output"
+		"HeadTypeDef"
+		"Verse.HediffCompProperties_CauseMentalState"
+		"HediffCompProperties_CauseMentalState"
+		"Verse.HediffCompProperties"
+		"overrideLetterDesc"
+		"overrideLetterLabel"
+		"animalMentalState"
+		"animalMentalStateAlias"
+		"humanMentalState"
+		"Verse.HediffCompProperties_Disappears"
+		"HediffCompProperties_Disappears"
+		"letterLabelOnDisappear"
+		"letterTextOnDisappear"
+		"messageOnDisappear"
+		"requiredMentalState"
+		"Verse.HediffCompProperties_DisappearsAndKills"
+		"HediffCompProperties_DisappearsAndKills"
+		"Verse.HediffCompProperties_DisappearsDisableable"
+		"HediffCompProperties_DisappearsDisableable"
+		"Verse.HediffCompProperties_FleshbeastEmerge"
+		"HediffCompProperties_FleshbeastEmerge"
+		"Verse.HediffCompProperties_GetsPermanent"
+		"HediffCompProperties_GetsPermanent"
+		"instantlyPermanentLabel"
+		"permanentLabel"
+		"Verse.HediffCompProperties_LetterOnDeath"
+		"HediffCompProperties_LetterOnDeath"
+		"Verse.HediffCompProperties_MessageAboveSeverity"
+		"HediffCompProperties_MessageAboveSeverity"
+		"Verse.HediffCompProperties_MessageAfterTicks"
+		"HediffCompProperties_MessageAfterTicks"
+		"letterType"
+		"Verse.HediffCompProperties_MessageBase"
+		"HediffCompProperties_MessageBase"
+		"Verse.HediffCompProperties_MessageOnRemoval"
+		"HediffCompProperties_MessageOnRemoval"
+		"Verse.HediffCompProperties_MessageStageIncreased"
+		"HediffCompProperties_MessageStageIncreased"
+		"Verse.HediffCompProperties_RandomizeSeverityPhases"
+		"HediffCompProperties_RandomizeSeverityPhases"
+		"Verse.HediffCompProperties_Randomizer"
+		"notifyMessage"
+		"phases"
+		"Verse.HediffCompProperties_RandomizeSeverityPhases+Phase"
+		"Phase"
+		"Verse.Phase"
+		"descriptionExtra"
+		"labelPrefix"
+		"Verse.HediffCompProperties_RandomizeStageWithInterval"
+		"HediffCompProperties_RandomizeStageWithInterval"
+		"Verse.HediffCompProperties_RemoveIfOtherHediff"
+		"HediffCompProperties_RemoveIfOtherHediff"
+		"Verse.HediffCompProperties_ReplaceHediff"
+		"HediffCompProperties_ReplaceHediff"
+		"messageDef"
+		"Verse.HediffCompProperties_SurgeryInspectable"
+		"HediffCompProperties_SurgeryInspectable"
+		"surgicalDetectionDesc"
+		"Verse.HediffCompProperties_SurgeryInspectableMetalHorror"
+		"HediffCompProperties_SurgeryInspectableMetalHorror"
+		"HediffDef"
+		"battleStateLabel"
+		"extraTooltip"
+		"labelNoun"
+		"labelNounPretty"
+		"overrideTooltip"
+		"targetPrefix"
+		"givesInfectionPathways"
+		"onlyLifeThreateningTo"
+		"possiblePathways"
+		"Verse.HediffInfectionPathway"
+		"removeOnRedressIfNotOfKind"
+		"reportStringOverrides"
+		"Verse.HediffDef+ReportStringOverride"
+		"Verse.HediffStage"
+		"defaultInstallPart"
+		"skinShader"
+		"taleOnVisible"
+		"ReportStringOverride"
+		"Verse.ReportStringOverride"
+		"reportString"
+		"HediffInfectionPathway"
+		"explanation"
+		"pathwayDef"
+		"HediffStage"
+		"overrideLabel"
+		"capacityFactorEffectMultiplier"
+		"statFactorEffectMultiplier"
+		"statOffsetEffectMultiplier"
+		"Verse.IdeoStoryPatternDef"
+		"IdeoStoryPatternDef"
+		"rules"
+		"Verse.ImplementOwnerTypeDef"
+		"ImplementOwnerTypeDef"
+		"Verse.InventoryStockGroupDef"
+		"InventoryStockGroupDef"
+		"defaultThingDef"
+		"JobDef"
+		"containerReservationLayer"
+		"Verse.ReservationLayerDef"
+		"joySkill"
+		"taleOnCompletion"
+		"KeyBindingCategoryDef"
+		"checkForConflicts"
+		"KeyBindingDef"
+		"LetterDef"
+		"arriveSound"
+		"Verse.LogEntryDef"
+		"LogEntryDef"
+		"Verse.ManeuverDef"
+		"ManeuverDef"
+		"combatLogRulesDeflect"
+		"combatLogRulesDodge"
+		"combatLogRulesHit"
+		"combatLogRulesMiss"
+		"logEntryDef"
+		"requiredCapacity"
+		"Verse.ToolCapacityDef"
+		"MapGeneratorDef"
+		"genSteps"
+		"roofDef"
+		"Verse.RoofDef"
+		"Verse.MechWorkModeDef"
+		"MechWorkModeDef"
+		"MentalBreakDef"
+		"requiredPrecept"
+		"requiredTrait"
+		"Verse.MentalFitDef"
+		"MentalFitDef"
+		"MentalStateDef"
+		"recoveryMessage"
+		"blockInteractionInitiationExcept"
+		"blockInteractionRecipientExcept"
+		"moodRecoveryThought"
+		"stateEffecter"
+		"MessageTypeDef"
+		"Verse.OptionCategoryDef"
+		"OptionCategoryDef"
+		"Verse.OrderedTakeGroupDef"
+		"OrderedTakeGroupDef"
+		"PawnCapacityDef"
+		"labelAnimals"
+		"labelAnomalyEntity"
+		"labelMechanoids"
+		"PawnKindDef"
+		"PawnKindLifeStage"
+		"Verse.PawnRenderNodeTagDef"
+		"PawnRenderNodeTagDef"
+		"Verse.PawnRenderTreeDef"
+		"PawnRenderTreeDef"
+		"Verse.PlaceDef"
+		"PlaceDef"
+		"placeRules"
+		"Verse.RaceProperties"
+		"RaceProperties"
+		"meatLabel"
+		"hediffGiverSets"
+		"mechEnabledWorkTypes"
+		"willNeverEat"
+		"bulletStaggerEffecterDef"
+		"cachedAnyPawnKind"
+		"corpseDef"
+		"dutyBoss"
+		"fleshType"
+		"leatherDef"
+		"linkedCorpseKind"
+		"meatDef"
+		"nameGenerator"
+		"nameGeneratorFemale"
+		"renderTree"
+		"soundAmbience"
+		"soundEating"
+		"soundMeleeDodge"
+		"soundMeleeHitBuilding"
+		"soundMeleeHitPawn"
+		"soundMeleeMiss"
+		"soundMoving"
+		"specificMeatDef"
+		"startingAnimation"
+		"thinkTreeMain"
+		"trainability"
+		"unnaturalCorpseDef"
+		"useLeatherFrom"
+		"useMeatFrom"
+		"RecipeDef"
+		"successfullyRemovedHediffMessage"
+		"appliedOnFixedBodyPartGroups"
+		"appliedOnFixedBodyParts"
+		"forceHiddenSpecialFilters"
+		"Verse.SpecialThingFilterDef"
+		"memePrerequisitesAny"
+		"mutantBlacklist"
+		"mutantPrerequisite"
+		"premultipliedSmallIngredients"
+		"recipeUsers"
+		"addsHediff"
+		"addsHediffOnFailure"
+		"changesHediffLevel"
+		"conceptLearned"
+		"defaultIngredientFilter"
+		"effectWorking"
+		"efficiencyStat"
+		"fixedIngredientFilter"
+		"removesHediff"
+		"requiredGiverWorkType"
+		"soundWorking"
+		"surgeryOutcomeEffect"
+		"uiIconThing"
+		"unfinishedThingDef"
+		"workSkill"
+		"workSpeedStat"
+		"workTableEfficiencyStat"
+		"workTableSpeedStat"
+		"Verse.RecipeMakerProperties"
+		"RecipeMakerProperties"
+		"ResearchProjectDef"
+		"discoveredLetterText"
+		"discoveredLetterTitle"
+		"cachedUnlockedDefs"
+		"hiddenPrerequisites"
+		"requiredAnalyzed"
+		"requiredByThis"
+		"requiredResearchFacilities"
+		"cachedTechprint"
+		"requiredResearchBuilding"
+		"tab"
+		"teachConcept"
+		"ResearchProjectTagDef"
+		"ReservationLayerDef"
+		"RoofDef"
+		"collapseLeavingThingDef"
+		"filthLeaving"
+		"soundPunchThrough"
+		"Verse.RoomRoleDef"
+		"RoomRoleDef"
+		"relatedStats"
+		"RoomStatDef"
+		"inputStat"
+		"RulePackDef"
+		"Verse.ScatterableDef"
+		"ScatterableDef"
+		"ShaderTypeDef"
+		"SongDef"
+		"minRoyalTitle"
+		"Verse.Sound"
+		"ImpactSoundTypeDef"
+		"soundDef"
+		"SoundDef"
+		"sustainFadeoutStartSound"
+		"sustainStartSound"
+		"sustainStopSound"
+		"SpecialThingFilterDef"
+		"parentCategory"
+		"Verse.StuffAppearanceDef"
+		"StuffAppearanceDef"
+		"StyleCategoryDef"
+		"ritualVisualEffectDef"
+		"soundOngoingRitual"
+		"Verse.SubcameraDef"
+		"SubcameraDef"
+		"TerrainAffordanceDef"
+		"TerrainDef"
+		"affordances"
+		"destroyEffect"
+		"destroyEffectWater"
+		"driesTo"
+		"generatedFilth"
+		"pollutionShaderType"
+		"smoothedTerrain"
+		"traversedThought"
+		"ThingCategoryDef"
+		"childCategories"
+		"childSpecialFilters"
+		"childThingDefs"
+		"sortedChildThingDefsCached"
+		"ThingDef"
+		"allRecipesCached"
+		"cachedRelevantStyleCategories"
+		"recipes"
+		"thingCategories"
+		"virtualDefs"
+		"weaponClasses"
+		"defaultStuff"
+		"entityCodexEntry"
+		"entityDefToBuild"
+		"ideoBuildingNamerBase"
+		"ingestible"
+		"interactionCellIcon"
+		"meleeHitSound"
+		"minifiedDef"
+		"orderedTakeGroup"
+		"projectileWhenLoaded"
+		"recipeMaker"
+		"requiresFactionToAcquire"
+		"slagDef"
+		"soundDrop"
+		"soundImpactDefault"
+		"soundInteract"
+		"soundOpen"
+		"soundPickup"
+		"soundPlayInstrument"
+		"soundSpawned"
+		"storedConceptLearnOpportunity"
+		"virtualDefParent"
+		"ThingFilter"
+		"allowAllWhoCanMake"
+		"disallowedSpecialFilters"
+		"disallowedThingDefs"
+		"hiddenSpecialFilters"
+		"stuffCategoriesToAllow"
+		"overrideRootDef"
+		"ThingStyleDef"
+		"cachedCategory"
+		"ThinkTreeDef"
+		"Verse.TipSetDef"
+		"TipSetDef"
+		"Tool"
+		"labelNoLocation"
+		"capacities"
+		"linkedBodyPartsGroup"
+		"soundMeleeHit"
+		"ToolCapacityDef"
+		"TrainabilityDef"
+		"VerbProperties"
+		"mouseTargetingText"
+		"aimingChargeMote"
+		"aimingLineMote"
+		"aimingTargetEffecter"
+		"aimingTargetMote"
+		"beamDamageDef"
+		"beamEndEffecterDef"
+		"beamGroundFleckDef"
+		"beamLineFleckDef"
+		"beamMoteDef"
+		"bodypartTagTarget"
+		"colonyWideTaleDef"
+		"defaultProjectile"
+		"flightEffecterDef"
+		"impactFleck"
+		"impactMote"
+		"meleeDamageDef"
+		"rangeStat"
+		"rangedFireRulepack"
+		"soundAiming"
+		"soundCast"
+		"soundCastBeam"
+		"soundCastTail"
+		"soundLanding"
+		"spawnDef"
+		"sprayEffecterDef"
+		"workModeDef"
+		"WeatherDef"
+		"ambientSounds"
+		"weatherThought"
+		"WorkTypeDef"
+		"gerundLabel"
+		"pawnLabel"
+		"relevantSkills"
+		"workGiversByPriority"
+		"Verse.WorldGenStepDef"
+		"WorldGenStepDef"
+		"WeaponClassPairDef"
+		"first"
+		"second"
+		;
+
+	[[nodiscard]]
+	constexpr std::string_view S(std::size_t pos, std::size_t len) noexcept { return { BLOB + pos, len }; }
+
+	inline constexpr std::string_view FIELDS[] =
+	{
+		S(62, 11), S(73, 18), S(91, 5), S(125, 22), S(62, 11), S(73, 18), S(91, 5), S(539, 10),
+		S(62, 11), S(73, 18), S(91, 5), S(669, 5), S(674, 11), S(685, 10), S(695, 16), S(62, 11),
+		S(73, 18), S(91, 5), S(1238, 17), S(1501, 11), S(1512, 14), S(1501, 11), S(1512, 14), S(1737, 31),
+		S(1512, 14), S(1912, 10), S(1922, 11), S(2052, 18), S(2070, 19), S(2089, 16), S(2105, 23), S(2128, 15),
+		S(2143, 20), S(2163, 14), S(2177, 13), S(2190, 9), S(2199, 22), S(2221, 20), S(2241, 16), S(2257, 21),
+		S(2278, 21), S(2299, 26), S(2325, 17), S(2607, 10), S(2617, 14), S(2607, 10), S(2798, 21), S(62, 11),
+		S(91, 5), S(3370, 17), S(3646, 14), S(3715, 18), S(3733, 15), S(3748, 25), S(3773, 14), S(3787, 20),
+		S(2052, 18), S(2070, 19), S(2089, 16), S(2105, 23), S(2163, 14), S(2177, 13), S(2190, 9), S(2199, 22),
+		S(2221, 20), S(2241, 16), S(4139, 7), S(2052, 18), S(2070, 19), S(2089, 16), S(2105, 23), S(2163, 14),
+		S(2177, 13), S(2190, 9), S(4212, 23), S(4235, 21), S(4256, 22), S(2199, 22), S(2221, 20), S(2241, 16),
+		S(4337, 11), S(4348, 10), S(4561, 18), S(4660, 19), S(4679, 18), S(2177, 13), S(5116, 13), S(5129, 15),
+		S(2190, 9), S(2052, 18), S(2070, 19), S(2089, 16), S(2105, 23), S(5361, 27), S(5388, 16), S(2163, 14),
+		S(2177, 13), S(2190, 9), S(5404, 15), S(5419, 14), S(2199, 22), S(2221, 20), S(2241, 16), S(5433, 21),
+		S(5454, 20), S(5474, 19), S(5493, 15), S(2052, 18), S(2070, 19), S(2089, 16), S(2105, 23), S(2163, 14),
+		S(2177, 13), S(2190, 9), S(5676, 17), S(2199, 22), S(2221, 20), S(2241, 16), S(5908, 14), S(5922, 9),
+		S(5931, 16), S(6012, 10), S(6079, 10), S(6089, 9), S(6259, 19), S(6278, 20), S(6298, 16), S(6551, 13),
+		S(6639, 8), S(6647, 10), S(62, 11), S(6959, 8), S(6967, 18), S(73, 18), S(91, 5), S(7194, 4),
+		S(62, 11), S(7565, 9), S(7574, 15), S(73, 18), S(91, 5), S(7589, 11), S(7600, 17), S(7617, 12),
+		S(7629, 11), S(7640, 15), S(8610, 16), S(62, 11), S(8626, 15), S(73, 18), S(91, 5), S(4348, 10),
+		S(1922, 11), S(62, 11), S(73, 18), S(91, 5), S(8817, 13), S(62, 11), S(9096, 11), S(73, 18),
+		S(91, 5), S(62, 11), S(539, 10), S(73, 18), S(91, 5), S(9520, 9), S(9529, 8), S(9537, 6),
+		S(9543, 5), S(62, 11), S(9643, 23), S(73, 18), S(91, 5), S(4337, 11), S(4348, 10), S(10069, 19),
+		S(10088, 18), S(10106, 21), S(10309, 15), S(10324, 11), S(10335, 16), S(62, 11), S(10351, 10), S(73, 18),
+		S(91, 5), S(62, 11), S(73, 18), S(91, 5), S(10566, 16), S(10582, 18), S(10600, 4), S(10604, 14),
+		S(10986, 28), S(11014, 20), S(9520, 9), S(22891, 19), S(62, 11), S(73, 18), S(91, 5), S(62, 11),
+		S(73, 18), S(91, 5), S(23098, 16), S(23114, 11), S(23509, 22), S(23531, 21), S(23552, 21), S(23573, 24),
+		S(23597, 17), S(23614, 17), S(23631, 19), S(62, 11), S(23650, 21), S(73, 18), S(91, 5), S(23671, 16),
+		S(23687, 26), S(23713, 19), S(23732, 13), S(23745, 25), S(62, 11), S(24095, 11), S(24106, 16), S(62, 11),
+		S(73, 18), S(91, 5), S(24122, 10), S(62, 11), S(24529, 9), S(73, 18), S(91, 5), S(5116, 13),
+		S(62, 11), S(73, 18), S(91, 5), S(24710, 11), S(62, 11), S(73, 18), S(91, 5), S(24908, 9),
+		S(24917, 12), S(24929, 14), S(62, 11), S(24988, 21), S(73, 18), S(91, 5), S(4337, 11), S(4348, 10),
+		S(25316, 24), S(62, 11), S(25407, 10), S(62, 11), S(26166, 24), S(73, 18), S(91, 5), S(26190, 16),
+		S(62, 11), S(73, 18), S(91, 5), S(26580, 19), S(26599, 21), S(26620, 20), S(62, 11), S(73, 18),
+		S(91, 5), S(26580, 19), S(26599, 21), S(26620, 20), S(26808, 18), S(62, 11), S(73, 18), S(91, 5),
+		S(28079, 40), S(28313, 16), S(62, 11), S(73, 18), S(91, 5), S(28344, 16), S(28360, 19), S(62, 11),
+		S(73, 18), S(91, 5), S(28379, 16), S(28395, 19), S(62, 11), S(28548, 18), S(28566, 12), S(73, 18),
+		S(91, 5), S(62, 11), S(28651, 10), S(73, 18), S(91, 5), S(28661, 14), S(62, 11), S(73, 18),
+		S(91, 5), S(4348, 10), S(1922, 11), S(28779, 15), S(28794, 15), S(91, 5), S(29017, 13), S(91, 5),
+		S(29017, 13), S(29156, 11), S(30709, 21), S(91, 5), S(29017, 13), S(31185, 14), S(31199, 33), S(62, 11),
+		S(91, 5), S(31530, 25), S(31577, 19), S(31596, 12), S(62, 11), S(73, 18), S(91, 5), S(31608, 18),
+		S(31626, 29), S(31655, 17), S(31672, 17), S(31808, 13), S(31821, 26), S(91, 5), S(31847, 11), S(31858, 21),
+		S(32023, 17), S(10600, 4), S(91, 5), S(34236, 13), S(62, 11), S(34435, 4), S(34439, 7), S(34545, 19),
+		S(34564, 23), S(34587, 13), S(34600, 22), S(62, 11), S(73, 18), S(91, 5), S(62, 11), S(73, 18),
+		S(91, 5), S(34723, 10), S(34846, 4), S(62, 11), S(35475, 12), S(35487, 23), S(73, 18), S(91, 5),
+		S(35510, 11), S(35521, 28), S(35771, 11), S(91, 5), S(10600, 4), S(62, 11), S(73, 18), S(91, 5),
+		S(35911, 4), S(62, 11), S(73, 18), S(91, 5), S(36653, 29), S(62, 11), S(91, 5), S(29017, 13),
+		S(37013, 11), S(62, 11), S(91, 5), S(24710, 11), S(37339, 9), S(62, 11), S(37927, 6), S(73, 18),
+		S(91, 5), S(37933, 4), S(62, 11), S(38182, 16), S(73, 18), S(91, 5), S(62, 11), S(73, 18),
+		S(91, 5), S(40483, 10), S(40493, 25), S(62, 11), S(73, 18), S(91, 5), S(40483, 10), S(62, 11),
+		S(73, 18), S(91, 5), S(40632, 20), S(62, 11), S(73, 18), S(91, 5), S(1912, 10), S(4337, 11),
+		S(4139, 7), S(40954, 29), S(62, 11), S(73, 18), S(91, 5), S(40954, 29), S(62, 11), S(73, 18),
+		S(91, 5), S(41065, 11), S(40954, 29), S(62, 11), S(73, 18), S(91, 5), S(1912, 10), S(4337, 11),
+		S(40954, 29), S(62, 11), S(73, 18), S(91, 5), S(24710, 11), S(41183, 17), S(37339, 9), S(41200, 15),
+		S(41215, 11), S(4337, 11), S(41226, 12), S(41722, 11), S(41733, 12), S(62, 11), S(73, 18), S(91, 5),
+		S(62, 11), S(42243, 17), S(10351, 10), S(73, 18), S(91, 5), S(4348, 10), S(42260, 12), S(62, 11),
+		S(73, 18), S(91, 5), S(8817, 13), S(42397, 19), S(42416, 13), S(42429, 24), S(42594, 6), S(42621, 12),
+		S(42694, 6), S(42817, 18), S(42835, 19), S(42977, 22), S(42999, 21), S(43020, 18), S(43385, 23), S(43408, 14),
+		S(4337, 11), S(4348, 10), S(4139, 7), S(44047, 13), S(44138, 16), S(44154, 11), S(1912, 10), S(4337, 11),
+		S(4139, 7), S(44519, 21), S(44655, 16), S(62, 11), S(38182, 16), S(44671, 12), S(73, 18), S(91, 5),
+		S(44683, 9), S(44692, 15), S(44707, 15), S(44722, 12), S(45008, 12), S(45042, 11), S(44671, 12), S(91, 5),
+		S(45074, 13), S(44707, 15), S(62, 11), S(73, 18), S(91, 5), S(45008, 12), S(10309, 15), S(10324, 11),
+		S(10335, 16), S(62, 11), S(73, 18), S(91, 5), S(45826, 15), S(62, 11), S(73, 18), S(91, 5),
+		S(46049, 12), S(46061, 18), S(46079, 15), S(62, 11), S(73, 18), S(91, 5), S(24710, 11), S(41183, 17),
+		S(37339, 9), S(41200, 15), S(41215, 11), S(91, 5), S(24710, 11), S(41183, 17), S(37339, 9), S(41200, 15),
+		S(41215, 11), S(46274, 9), S(62, 11), S(73, 18), S(2190, 9), S(91, 5), S(46683, 32), S(62, 11),
+		S(47267, 20), S(47287, 21), S(73, 18), S(91, 5), S(62, 11), S(73, 18), S(91, 5), S(45074, 13),
+		S(91, 5), S(48816, 15), S(91, 5), S(48918, 18), S(62, 11), S(49349, 11), S(73, 18), S(91, 5),
+		S(40483, 10), S(49360, 9), S(37933, 4),
+	};
+
+	inline constexpr field_type_t FIELD_TYPES[] =
+	{
+		{ S(147, 13), S(160, 16) }, { S(176, 8), S(0, 27) }, { S(184, 12), S(196, 14) }, { S(210, 8), S(218, 24) },
+		{ S(242, 6), S(248, 19) }, { S(267, 6), S(273, 12) }, { S(285, 14), S(299, 20) }, { S(319, 14), S(333, 17) },
+		{ S(350, 10), S(360, 14) }, { S(374, 17), S(391, 14) }, { S(405, 11), S(391, 14) }, { S(416, 16), S(391, 14) },
+		{ S(549, 22), S(571, 22) }, { S(593, 12), S(360, 14) }, { S(267, 6), S(273, 12) }, { S(711, 23), S(734, 17) },
+		{ S(751, 14), S(765, 20) }, { S(785, 14), S(765, 20) }, { S(799, 12), S(765, 20) }, { S(811, 9), S(820, 17) },
+		{ S(883, 21), S(904, 19) }, { S(923, 12), S(935, 13) }, { S(948, 14), S(962, 18) }, { S(1089, 18), S(360, 14) },
+		{ S(1107, 16), S(360, 14) }, { S(1123, 13), S(391, 14) }, { S(1136, 11), S(360, 14) }, { S(1181, 7), S(1188, 17) },
+		{ S(1255, 4), S(1158, 16) }, { S(1259, 5), S(1264, 23) }, { S(1287, 9), S(360, 14) }, { S(1327, 15), S(1342, 15) },
+		{ S(1357, 15), S(1342, 15) }, { S(1526, 10), S(1536, 15) }, { S(1551, 22), S(1573, 19) }, { S(1592, 22), S(1573, 19) },
+		{ S(1614, 11), S(1625, 20) }, { S(1645, 5), S(391, 14) }, { S(1650, 11), S(391, 14) }, { S(1661, 9), S(391, 14) },
+		{ S(1526, 10), S(1536, 15) }, { S(1592, 22), S(1573, 19) }, { S(1614, 11), S(1625, 20) }, { S(1645, 5), S(391, 14) },
+		{ S(1650, 11), S(391, 14) }, { S(1661, 9), S(391, 14) }, { S(1526, 10), S(1536, 15) }, { S(1614, 11), S(1625, 20) },
+		{ S(1645, 5), S(391, 14) }, { S(1650, 11), S(391, 14) }, { S(1661, 9), S(391, 14) }, { S(1933, 9), S(1942, 15) },
+		{ S(2342, 12), S(2354, 16) }, { S(2370, 18), S(1942, 15) }, { S(2388, 13), S(196, 14) }, { S(2401, 11), S(196, 14) },
+		{ S(2412, 19), S(333, 17) }, { S(2431, 19), S(1942, 15) }, { S(2450, 24), S(1942, 15) }, { S(2474, 13), S(391, 14) },
+		{ S(2631, 7), S(360, 14) }, { S(242, 6), S(248, 19) }, { S(2638, 11), S(391, 14) }, { S(242, 6), S(248, 19) },
+		{ S(2968, 16), S(2984, 24) }, { S(3008, 23), S(1573, 19) }, { S(3163, 18), S(3181, 17) }, { S(3198, 24), S(1342, 15) },
+		{ S(2968, 16), S(2984, 24) }, { S(2342, 12), S(2354, 16) }, { S(2388, 13), S(196, 14) }, { S(2401, 11), S(196, 14) },
+		{ S(2412, 19), S(333, 17) }, { S(2474, 13), S(391, 14) }, { S(4024, 10), S(96, 19) }, { S(2631, 7), S(360, 14) },
+		{ S(2638, 11), S(391, 14) }, { S(4146, 7), S(1573, 19) }, { S(4697, 12), S(1188, 17) }, { S(4857, 4), S(2354, 16) },
+		{ S(5020, 14), S(5034, 17) }, { S(1933, 9), S(1942, 15) }, { S(5255, 15), S(391, 14) }, { S(5270, 17), S(391, 14) },
+		{ S(5287, 13), S(333, 17) }, { S(5947, 10), S(5034, 17) }, { S(6098, 15), S(6113, 24) }, { S(2370, 18), S(1942, 15) },
+		{ S(6314, 17), S(6331, 29) }, { S(6564, 12), S(360, 14) }, { S(6576, 12), S(360, 14) }, { S(6657, 14), S(962, 18) },
+		{ S(6671, 12), S(360, 14) }, { S(6683, 20), S(6703, 19) }, { S(6722, 6), S(273, 12) }, { S(6728, 18), S(1342, 15) },
+		{ S(350, 10), S(360, 14) }, { S(6805, 8), S(6813, 22) }, { S(6835, 22), S(6857, 25) }, { S(6923, 7), S(6703, 19) },
+		{ S(7014, 14), S(820, 17) }, { S(7028, 14), S(820, 17) }, { S(7042, 17), S(820, 17) }, { S(7059, 13), S(820, 17) },
+		{ S(7072, 16), S(820, 17) }, { S(7088, 13), S(820, 17) }, { S(7101, 19), S(820, 17) }, { S(7358, 26), S(2984, 24) },
+		{ S(7384, 16), S(447, 28) }, { S(7400, 15), S(7415, 20) }, { S(7435, 12), S(360, 14) }, { S(7447, 20), S(7415, 20) },
+		{ S(176, 8), S(7268, 26) }, { S(7467, 18), S(360, 14) }, { S(7655, 15), S(6985, 19) }, { S(7670, 12), S(160, 16) },
+		{ S(7682, 15), S(7697, 22) }, { S(7719, 18), S(7697, 22) }, { S(7737, 15), S(160, 16) }, { S(7752, 18), S(7770, 19) },
+		{ S(7789, 29), S(7818, 30) }, { S(7848, 24), S(7872, 24) }, { S(7896, 16), S(1188, 17) }, { S(7912, 11), S(160, 16) },
+		{ S(7923, 30), S(6703, 19) }, { S(147, 13), S(160, 16) }, { S(7953, 30), S(7983, 24) }, { S(8007, 40), S(8047, 22) },
+		{ S(8069, 46), S(8047, 22) }, { S(8115, 20), S(8135, 27) }, { S(8162, 30), S(8135, 27) }, { S(8192, 6), S(8198, 22) },
+		{ S(8220, 18), S(7697, 22) }, { S(8238, 18), S(5034, 17) }, { S(8256, 15), S(1188, 17) }, { S(8271, 13), S(360, 14) },
+		{ S(8284, 15), S(360, 14) }, { S(8299, 16), S(820, 17) }, { S(8315, 32), S(820, 17) }, { S(8347, 13), S(6857, 25) },
+		{ S(8360, 15), S(6703, 19) }, { S(8375, 19), S(820, 17) }, { S(8423, 16), S(1064, 17) }, { S(8439, 10), S(1064, 17) },
+		{ S(811, 9), S(820, 17) }, { S(8482, 15), S(1573, 19) }, { S(8497, 9), S(1573, 19) }, { S(8506, 14), S(8520, 22) },
+		{ S(8542, 14), S(333, 17) }, { S(8641, 14), S(360, 14) }, { S(8655, 16), S(8047, 22) }, { S(8671, 4), S(8675, 16) },
+		{ S(8740, 14), S(2354, 16) }, { S(147, 13), S(160, 16) }, { S(8754, 11), S(1188, 17) }, { S(8765, 13), S(8691, 29) },
+		{ S(8830, 15), S(8845, 21) }, { S(8915, 4), S(160, 16) }, { S(8919, 9), S(160, 16) }, { S(9170, 23), S(9043, 31) },
+		{ S(9291, 8), S(6985, 19) }, { S(9299, 5), S(160, 16) }, { S(9304, 8), S(1372, 17) }, { S(9299, 5), S(160, 16) },
+		{ S(9472, 11), S(9386, 30) }, { S(9612, 4), S(9616, 16) }, { S(9666, 13), S(1064, 17) }, { S(9679, 26), S(7415, 20) },
+		{ S(9705, 16), S(1064, 17) }, { S(9721, 20), S(3181, 17) }, { S(9741, 25), S(1342, 15) }, { S(9766, 10), S(9776, 29) },
+		{ S(176, 8), S(9565, 28) }, { S(9805, 10), S(7311, 28) }, { S(9815, 15), S(1342, 15) }, { S(9830, 13), S(9843, 22) },
+		{ S(1933, 9), S(1942, 15) }, { S(9865, 19), S(360, 14) }, { S(9884, 10), S(1342, 15) }, { S(9894, 8), S(1188, 17) },
+		{ S(9902, 14), S(1264, 23) }, { S(9612, 4), S(9616, 16) }, { S(9916, 7), S(360, 14) }, { S(9923, 14), S(9937, 16) },
+		{ S(10127, 8), S(9193, 24) }, { S(10135, 12), S(333, 17) }, { S(10147, 15), S(333, 17) }, { S(10162, 11), S(391, 14) },
+		{ S(10173, 7), S(10180, 19) }, { S(10199, 6), S(360, 14) }, { S(10205, 9), S(360, 14) }, { S(10214, 26), S(1573, 19) },
+		{ S(10240, 20), S(1573, 19) }, { S(10260, 12), S(1573, 19) }, { S(10361, 16), S(10377, 17) }, { S(10394, 30), S(734, 17) },
+		{ S(10424, 18), S(10442, 21) }, { S(10463, 24), S(2354, 16) }, { S(10487, 28), S(734, 17) }, { S(10515, 14), S(1942, 15) },
+		{ S(10618, 7), S(6930, 19) }, { S(10625, 22), S(10529, 23) }, { S(10647, 17), S(360, 14) }, { S(10664, 9), S(10673, 15) },
+		{ S(10688, 8), S(360, 14) }, { S(10733, 16), S(1573, 19) }, { S(10749, 20), S(10377, 17) }, { S(10769, 15), S(360, 14) },
+		{ S(10784, 17), S(10801, 22) }, { S(10823, 17), S(10801, 22) }, { S(10840, 16), S(1573, 19) }, { S(10856, 20), S(10377, 17) },
+		{ S(11034, 7), S(96, 19) }, { S(12770, 14), S(391, 14) }, { S(12784, 12), S(391, 14) }, { S(19352, 3), S(360, 14) },
+		{ S(10424, 18), S(10442, 21) }, { S(22653, 9), S(360, 14) }, { S(267, 6), S(273, 12) }, { S(10173, 7), S(10180, 19) },
+		{ S(22672, 16), S(8047, 22) }, { S(22708, 16), S(6331, 29) }, { S(22746, 10), S(22756, 16) }, { S(22772, 17), S(22789, 26) },
+		{ S(22910, 25), S(22935, 18) }, { S(22953, 21), S(22935, 18) }, { S(23125, 19), S(23144, 32) }, { S(23176, 14), S(23190, 18) },
+		{ S(23208, 29), S(23190, 18) }, { S(23237, 19), S(360, 14) }, { S(23256, 16), S(6703, 19) }, { S(23272, 19), S(7159, 22) },
+		{ S(23291, 19), S(23310, 25) }, { S(23335, 20), S(360, 14) }, { S(23355, 24), S(2984, 24) }, { S(23379, 22), S(820, 17) },
+		{ S(23401, 22), S(820, 17) }, { S(23423, 12), S(10801, 22) }, { S(210, 8), S(23435, 21) }, { S(23770, 18), S(7415, 20) },
+		{ S(23788, 27), S(9843, 22) }, { S(23815, 13), S(391, 14) }, { S(23828, 14), S(391, 14) }, { S(23842, 32), S(7268, 26) },
+		{ S(23874, 21), S(6331, 29) }, { S(23936, 5), S(23941, 13) }, { S(23954, 12), S(23895, 25) }, { S(23966, 4), S(23941, 13) },
+		{ S(24015, 8), S(23895, 25) }, { S(24080, 6), S(962, 18) }, { S(24132, 9), S(96, 19) }, { S(24141, 16), S(96, 19) },
+		{ S(711, 23), S(734, 17) }, { S(24157, 13), S(935, 13) }, { S(24170, 13), S(360, 14) }, { S(24183, 12), S(24195, 16) },
+		{ S(24211, 15), S(24226, 17) }, { S(24243, 14), S(1342, 15) }, { S(24257, 5), S(24262, 10) }, { S(24272, 5), S(299, 20) },
+		{ S(24277, 8), S(360, 14) }, { S(24285, 13), S(360, 14) }, { S(9805, 10), S(7311, 28) }, { S(24298, 14), S(6703, 19) },
+		{ S(24312, 6), S(1342, 15) }, { S(6314, 17), S(6331, 29) }, { S(24318, 21), S(1573, 19) }, { S(24339, 10), S(391, 14) },
+		{ S(24349, 11), S(391, 14) }, { S(24360, 9), S(391, 14) }, { S(24369, 10), S(391, 14) }, { S(24379, 12), S(391, 14) },
+		{ S(24391, 17), S(24408, 18) }, { S(24426, 9), S(22935, 18) }, { S(24435, 17), S(22935, 18) }, { S(24459, 17), S(1342, 15) },
+		{ S(24476, 18), S(7770, 19) }, { S(22672, 16), S(8047, 22) }, { S(24538, 9), S(24547, 21) }, { S(24568, 8), S(734, 17) },
+		{ S(24643, 11), S(7518, 23) }, { S(24721, 12), S(1573, 19) }, { S(24733, 11), S(1573, 19) }, { S(24744, 17), S(1573, 19) },
+		{ S(24761, 13), S(1573, 19) }, { S(24774, 19), S(1573, 19) }, { S(24793, 11), S(1573, 19) }, { S(24804, 17), S(1573, 19) },
+		{ S(24854, 7), S(24494, 22) }, { S(25040, 10), S(7770, 19) }, { S(25040, 10), S(7770, 19) }, { S(4146, 7), S(1573, 19) },
+		{ S(25417, 8), S(9193, 24) }, { S(25040, 10), S(7770, 19) }, { S(25492, 17), S(8866, 29) }, { S(25040, 10), S(7770, 19) },
+		{ S(25417, 8), S(9193, 24) }, { S(25040, 10), S(7770, 19) }, { S(25578, 14), S(1573, 19) }, { S(4146, 7), S(1573, 19) },
+		{ S(25647, 14), S(25661, 20) }, { S(25040, 10), S(7770, 19) }, { S(25417, 8), S(9193, 24) }, { S(25040, 10), S(7770, 19) },
+		{ S(4146, 7), S(1573, 19) }, { S(25903, 17), S(1342, 15) }, { S(26145, 11), S(360, 14) }, { S(25417, 8), S(9193, 24) },
+		{ S(25040, 10), S(7770, 19) }, { S(26206, 15), S(160, 16) }, { S(26221, 23), S(7518, 23) }, { S(26244, 5), S(25009, 20) },
+		{ S(26249, 16), S(160, 16) }, { S(26265, 16), S(96, 19) }, { S(26281, 16), S(734, 17) }, { S(147, 13), S(160, 16) },
+		{ S(26297, 11), S(26308, 19) }, { S(26327, 8), S(7770, 19) }, { S(26335, 21), S(7770, 19) }, { S(26356, 25), S(7233, 22) },
+		{ S(26381, 5), S(10876, 17) }, { S(811, 9), S(820, 17) }, { S(26386, 17), S(23310, 25) }, { S(26403, 16), S(96, 19) },
+		{ S(26419, 17), S(7770, 19) }, { S(26436, 12), S(7770, 19) }, { S(26448, 30), S(218, 24) }, { S(26640, 16), S(26656, 29) },
+		{ S(26685, 20), S(2984, 24) }, { S(26826, 11), S(26656, 29) }, { S(26837, 12), S(26656, 29) }, { S(26849, 11), S(26656, 29) },
+		{ S(26685, 20), S(2984, 24) }, { S(26860, 10), S(26656, 29) }, { S(28133, 10), S(1264, 23) }, { S(28143, 27), S(9193, 24) },
+		{ S(28170, 23), S(1942, 15) }, { S(28193, 17), S(10801, 22) }, { S(28210, 28), S(10801, 22) }, { S(28238, 21), S(10801, 22) },
+		{ S(28259, 14), S(10801, 22) }, { S(28273, 19), S(9193, 24) }, { S(28414, 11), S(24861, 28) }, { S(28452, 16), S(273, 12) },
+		{ S(28675, 14), S(23310, 25) }, { S(28689, 17), S(23310, 25) }, { S(28706, 15), S(160, 16) }, { S(28721, 15), S(6703, 19) },
+		{ S(28809, 5), S(28814, 19) }, { S(28833, 25), S(391, 14) }, { S(28858, 15), S(28873, 30) }, { S(22653, 9), S(360, 14) },
+		{ S(29301, 4), S(360, 14) }, { S(30298, 20), S(24576, 38) }, { S(30318, 22), S(24576, 38) }, { S(30403, 8), S(10377, 17) },
+		{ S(30484, 7), S(2354, 16) }, { S(30484, 7), S(30975, 17) }, { S(26244, 5), S(28974, 26) }, { S(31232, 24), S(31256, 61) },
+		{ S(31317, 14), S(31331, 33) }, { S(31364, 17), S(31331, 33) }, { S(31381, 8), S(333, 17) }, { S(31389, 15), S(360, 14) },
+		{ S(31404, 8), S(196, 14) }, { S(31412, 9), S(1573, 19) }, { S(31421, 18), S(31331, 33) }, { S(31555, 6), S(1573, 19) },
+		{ S(811, 9), S(820, 17) }, { S(31689, 14), S(28736, 26) }, { S(31703, 28), S(28903, 40) }, { S(31731, 19), S(31132, 31) },
+		{ S(31750, 18), S(31768, 30) }, { S(31879, 7), S(7770, 19) }, { S(32040, 7), S(8675, 16) }, { S(32047, 18), S(10696, 23) },
+		{ S(31879, 7), S(7770, 19) }, { S(32167, 16), S(734, 17) }, { S(32183, 9), S(10377, 17) }, { S(33017, 14), S(1625, 20) },
+		{ S(33128, 12), S(33103, 17) }, { S(33163, 11), S(33174, 23) }, { S(33329, 10), S(1573, 19) }, { S(33813, 16), S(10180, 19) },
+		{ S(26265, 16), S(96, 19) }, { S(33829, 7), S(33836, 28) }, { S(33864, 15), S(494, 27) }, { S(33879, 21), S(360, 14) },
+		{ S(33900, 28), S(360, 14) }, { S(33928, 12), S(1573, 19) }, { S(24793, 11), S(1573, 19) }, { S(33940, 14), S(7518, 23) },
+		{ S(33954, 18), S(8047, 22) }, { S(6923, 7), S(6703, 19) }, { S(33991, 8), S(8047, 22) }, { S(33999, 12), S(33836, 28) },
+		{ S(9830, 13), S(9843, 22) }, { S(34065, 7), S(9937, 16) }, { S(34249, 12), S(24023, 20) }, { S(19352, 3), S(34034, 20) },
+		{ S(34374, 14), S(34388, 22) }, { S(34477, 8), S(34410, 17) }, { S(34622, 29), S(1342, 15) }, { S(34651, 13), S(9937, 16) },
+		{ S(34664, 16), S(1942, 15) }, { S(34680, 18), S(360, 14) }, { S(23423, 12), S(10801, 22) }, { S(34733, 17), S(10696, 23) },
+		{ S(34935, 19), S(360, 14) }, { S(34935, 19), S(360, 14) }, { S(10688, 8), S(360, 14) }, { S(35549, 22), S(2354, 16) },
+		{ S(35571, 20), S(1342, 15) }, { S(35591, 14), S(1188, 17) }, { S(35605, 11), S(2354, 16) }, { S(176, 8), S(6113, 24) },
+		{ S(35616, 22), S(10377, 17) }, { S(35718, 10), S(2354, 16) }, { S(4857, 4), S(2354, 16) }, { S(35718, 10), S(2354, 16) },
+		{ S(35782, 8), S(30975, 17) }, { S(35827, 16), S(7198, 22) }, { S(35915, 17), S(391, 14) }, { S(35932, 18), S(391, 14) },
+		{ S(35950, 17), S(391, 14) }, { S(36016, 16), S(862, 21) }, { S(176, 8), S(35967, 29) }, { S(883, 21), S(904, 19) },
+		{ S(923, 12), S(935, 13) }, { S(948, 14), S(962, 18) }, { S(36136, 8), S(36044, 23) }, { S(36370, 14), S(10673, 15) },
+		{ S(36384, 12), S(1342, 15) }, { S(24312, 6), S(1342, 15) }, { S(36478, 8), S(10801, 22) }, { S(36558, 21), S(2984, 24) },
+		{ S(36579, 9), S(22756, 16) }, { S(36588, 18), S(23144, 32) }, { S(36606, 21), S(8198, 22) }, { S(36682, 22), S(36704, 17) },
+		{ S(36721, 15), S(935, 13) }, { S(25903, 17), S(1342, 15) }, { S(36736, 18), S(9616, 16) }, { S(24476, 18), S(7770, 19) },
+		{ S(36754, 16), S(36704, 17) }, { S(36770, 15), S(1573, 19) }, { S(36785, 13), S(935, 13) }, { S(36798, 15), S(1342, 15) },
+		{ S(36813, 14), S(36704, 17) }, { S(36827, 6), S(36833, 21) }, { S(36854, 11), S(1296, 20) }, { S(36865, 21), S(2354, 16) },
+		{ S(9830, 13), S(9843, 22) }, { S(24312, 6), S(1342, 15) }, { S(36886, 11), S(36897, 20) }, { S(33940, 14), S(7518, 23) },
+		{ S(36917, 32), S(7518, 23) }, { S(36949, 11), S(1573, 19) }, { S(36960, 21), S(1573, 19) }, { S(36981, 7), S(9616, 16) },
+		{ S(36988, 13), S(1573, 19) }, { S(6923, 7), S(6703, 19) }, { S(37080, 24), S(33836, 28) }, { S(37116, 13), S(24547, 21) },
+		{ S(37129, 20), S(37149, 21) }, { S(37178, 19), S(10377, 17) }, { S(37197, 17), S(36704, 17) }, { S(37214, 11), S(37225, 24) },
+		{ S(37249, 17), S(734, 17) }, { S(37266, 14), S(10377, 17) }, { S(37280, 17), S(734, 17) }, { S(37297, 27), S(6703, 19) },
+		{ S(24132, 9), S(96, 19) }, { S(37348, 20), S(10876, 17) }, { S(37368, 20), S(160, 16) }, { S(37388, 27), S(23046, 27) },
+		{ S(37415, 13), S(24195, 16) }, { S(37428, 23), S(160, 16) }, { S(37451, 22), S(10272, 23) }, { S(37473, 30), S(23046, 27) },
+		{ S(37503, 22), S(36897, 20) }, { S(37525, 18), S(1573, 19) }, { S(37543, 29), S(10272, 23) }, { S(37572, 5), S(24195, 16) },
+		{ S(37577, 26), S(25661, 20) }, { S(37603, 17), S(36897, 20) }, { S(37620, 17), S(36897, 20) }, { S(24426, 9), S(22935, 18) },
+		{ S(37729, 17), S(360, 14) }, { S(37746, 16), S(360, 14) }, { S(37762, 9), S(360, 14) }, { S(37771, 11), S(37782, 23) },
+		{ S(37842, 13), S(1342, 15) }, { S(37855, 15), S(1342, 15) }, { S(37870, 13), S(1573, 19) }, { S(37883, 11), S(1573, 19) },
+		{ S(37937, 18), S(360, 14) }, { S(10424, 18), S(10442, 21) }, { S(37955, 16), S(37971, 37) }, { S(38008, 10), S(196, 14) },
+		{ S(38018, 9), S(360, 14) }, { S(38027, 10), S(360, 14) }, { S(24568, 8), S(734, 17) }, { S(38079, 18), S(9776, 29) },
+		{ S(38097, 12), S(38109, 21) }, { S(38143, 8), S(38151, 20) }, { S(38198, 22), S(38220, 14) }, { S(38234, 5), S(935, 13) },
+		{ S(811, 9), S(820, 17) }, { S(38239, 15), S(820, 17) }, { S(38254, 17), S(391, 14) }, { S(19352, 3), S(273, 12) },
+		{ S(38340, 11), S(10696, 23) }, { S(38351, 17), S(22935, 18) }, { S(38368, 13), S(360, 14) }, { S(38381, 17), S(391, 14) },
+		{ S(38398, 15), S(391, 14) }, { S(38413, 15), S(360, 14) }, { S(38428, 12), S(37894, 21) }, { S(40398, 14), S(40412, 20) },
+		{ S(40432, 32), S(40412, 20) }, { S(40464, 8), S(40412, 20) }, { S(40518, 4), S(40522, 20) }, { S(40542, 19), S(360, 14) },
+		{ S(40591, 6), S(571, 22) }, { S(40597, 5), S(40412, 20) }, { S(40602, 4), S(40378, 13) }, { S(19352, 3), S(3181, 17) },
+		{ S(10199, 6), S(40412, 20) }, { S(40652, 21), S(360, 14) }, { S(36558, 21), S(2984, 24) }, { S(40673, 15), S(35870, 25) },
+		{ S(40688, 12), S(360, 14) }, { S(40700, 15), S(333, 17) }, { S(40715, 19), S(40734, 28) }, { S(40762, 17), S(248, 19) },
+		{ S(36588, 18), S(23144, 32) }, { S(36606, 21), S(8198, 22) }, { S(40779, 8), S(360, 14) }, { S(40787, 19), S(360, 14) },
+		{ S(40806, 12), S(333, 17) }, { S(40818, 23), S(40841, 26) }, { S(41001, 8), S(40930, 24) }, { S(41009, 8), S(40930, 24) },
+		{ S(24132, 9), S(96, 19) }, { S(41076, 7), S(1342, 15) }, { S(24132, 9), S(96, 19) }, { S(41238, 15), S(360, 14) },
+		{ S(41253, 16), S(36704, 17) }, { S(41001, 8), S(40930, 24) }, { S(41269, 21), S(636, 21) }, { S(41290, 21), S(636, 21) },
+		{ S(41311, 16), S(1296, 20) }, { S(24211, 15), S(24226, 17) }, { S(41327, 10), S(41337, 23) }, { S(41360, 28), S(9973, 28) },
+		{ S(41388, 29), S(9973, 28) }, { S(41009, 8), S(40930, 24) }, { S(41417, 19), S(360, 14) }, { S(41436, 14), S(8047, 22) },
+		{ S(41450, 18), S(6703, 19) }, { S(41468, 10), S(8928, 16) }, { S(41478, 10), S(360, 14) }, { S(41488, 16), S(8047, 22) },
+		{ S(24080, 6), S(962, 18) }, { S(811, 9), S(820, 17) }, { S(38239, 15), S(820, 17) }, { S(41504, 4), S(360, 14) },
+		{ S(41508, 13), S(8047, 22) }, { S(41521, 19), S(360, 14) }, { S(41540, 14), S(41554, 19) }, { S(41675, 15), S(2354, 16) },
+		{ S(41690, 8), S(2354, 16) }, { S(41745, 13), S(41625, 28) }, { S(41758, 14), S(820, 17) }, { S(8542, 14), S(333, 17) },
+		{ S(41772, 21), S(333, 17) }, { S(41793, 18), S(196, 14) }, { S(41811, 17), S(360, 14) }, { S(41828, 23), S(333, 17) },
+		{ S(41851, 20), S(196, 14) }, { S(41871, 19), S(360, 14) }, { S(41890, 25), S(333, 17) }, { S(41915, 22), S(196, 14) },
+		{ S(41937, 21), S(360, 14) }, { S(24312, 6), S(1342, 15) }, { S(41958, 10), S(1342, 15) }, { S(41968, 11), S(1342, 15) },
+		{ S(41979, 15), S(41994, 30) }, { S(42024, 14), S(391, 14) }, { S(42038, 14), S(2354, 16) }, { S(42091, 13), S(42104, 27) },
+		{ S(42218, 9), S(391, 14) }, { S(42272, 19), S(9843, 22) }, { S(42291, 16), S(360, 14) }, { S(42307, 20), S(9843, 22) },
+		{ S(1933, 9), S(1942, 15) }, { S(42327, 10), S(42337, 16) }, { S(42363, 12), S(34514, 20) }, { S(24132, 9), S(96, 19) },
+		{ S(37415, 13), S(24195, 16) }, { S(24211, 15), S(24226, 17) }, { S(42453, 22), S(1342, 15) }, { S(42475, 12), S(1342, 15) },
+		{ S(42487, 10), S(24195, 16) }, { S(42497, 8), S(1296, 20) }, { S(42505, 17), S(9193, 24) }, { S(8830, 15), S(8845, 21) },
+		{ S(41468, 10), S(8928, 16) }, { S(42522, 3), S(8556, 15) }, { S(25647, 14), S(25661, 20) }, { S(33999, 12), S(935, 13) },
+		{ S(24360, 9), S(391, 14) }, { S(24369, 10), S(391, 14) }, { S(24379, 12), S(391, 14) }, { S(42633, 7), S(820, 17) },
+		{ S(36785, 13), S(935, 13) }, { S(42854, 17), S(36897, 20) }, { S(42871, 22), S(36897, 20) }, { S(42893, 16), S(36897, 20) },
+		{ S(1933, 9), S(1942, 15) }, { S(43038, 19), S(36897, 20) }, { S(1614, 11), S(1625, 20) }, { S(43666, 10), S(1942, 15) },
+		{ S(1614, 11), S(1625, 20) }, { S(44060, 6), S(44066, 56) }, { S(41076, 7), S(1342, 15) }, { S(1933, 9), S(1942, 15) },
+		{ S(44425, 10), S(1625, 20) }, { S(24132, 9), S(96, 19) }, { S(37388, 27), S(23046, 27) }, { S(37415, 13), S(24195, 16) },
+		{ S(44734, 22), S(9973, 28) }, { S(44756, 21), S(3181, 17) }, { S(44777, 16), S(44793, 28) }, { S(44821, 26), S(1188, 17) },
+		{ S(44847, 21), S(44868, 36) }, { S(36827, 6), S(44904, 17) }, { S(42487, 10), S(24195, 16) }, { S(44921, 18), S(3181, 17) },
+		{ S(44939, 10), S(904, 19) }, { S(40542, 19), S(360, 14) }, { S(44949, 13), S(9616, 16) }, { S(45053, 10), S(9973, 28) },
+		{ S(42475, 12), S(1342, 15) }, { S(45087, 30), S(2354, 16) }, { S(45117, 26), S(2354, 16) }, { S(45143, 26), S(2354, 16) },
+		{ S(9612, 4), S(9616, 16) }, { S(45213, 5), S(10801, 22) }, { S(45316, 15), S(360, 14) }, { S(45337, 25), S(45362, 25) },
+		{ S(10173, 7), S(10180, 19) }, { S(45387, 8), S(10377, 17) }, { S(45395, 16), S(9616, 16) }, { S(45432, 17), S(42104, 27) },
+		{ S(176, 8), S(42104, 27) }, { S(45471, 11), S(391, 14) }, { S(45538, 21), S(820, 17) }, { S(45559, 19), S(820, 17) },
+		{ S(45578, 17), S(820, 17) }, { S(45595, 18), S(820, 17) }, { S(45613, 11), S(45482, 17) }, { S(45624, 16), S(45640, 21) },
+		{ S(37933, 4), S(299, 20) }, { S(45676, 8), S(9937, 16) }, { S(45684, 7), S(45691, 13) }, { S(36886, 11), S(36897, 20) },
+		{ S(923, 12), S(935, 13) }, { S(45754, 15), S(7770, 19) }, { S(45769, 13), S(36704, 17) }, { S(36886, 11), S(36897, 20) },
+		{ S(45841, 32), S(10696, 23) }, { S(45873, 31), S(10696, 23) }, { S(10424, 18), S(10442, 21) }, { S(10515, 14), S(1942, 15) },
+		{ S(45904, 19), S(1573, 19) }, { S(45923, 13), S(333, 17) }, { S(9612, 4), S(9616, 16) }, { S(1645, 5), S(391, 14) },
+		{ S(24132, 9), S(96, 19) }, { S(41238, 15), S(360, 14) }, { S(41253, 16), S(36704, 17) }, { S(41269, 21), S(636, 21) },
+		{ S(41290, 21), S(636, 21) }, { S(41311, 16), S(1296, 20) }, { S(41327, 10), S(41337, 23) }, { S(41360, 28), S(9973, 28) },
+		{ S(41388, 29), S(9973, 28) }, { S(41417, 19), S(360, 14) }, { S(41436, 14), S(8047, 22) }, { S(46230, 10), S(10801, 22) },
+		{ S(46283, 15), S(8951, 26) }, { S(46298, 20), S(734, 17) }, { S(46318, 12), S(360, 14) }, { S(24277, 8), S(360, 14) },
+		{ S(24285, 13), S(360, 14) }, { S(40602, 4), S(40378, 13) }, { S(46330, 24), S(333, 17) }, { S(46354, 17), S(1188, 17) },
+		{ S(46371, 9), S(360, 14) }, { S(46380, 8), S(8675, 16) }, { S(46388, 9), S(8449, 21) }, { S(6314, 17), S(6331, 29) },
+		{ S(46397, 10), S(360, 14) }, { S(46407, 16), S(360, 14) }, { S(46423, 7), S(360, 14) }, { S(46430, 13), S(820, 17) },
+		{ S(46443, 19), S(820, 17) }, { S(46462, 10), S(46168, 23) }, { S(46472, 13), S(391, 14) }, { S(46485, 11), S(391, 14) },
+		{ S(46496, 15), S(391, 14) }, { S(46511, 21), S(391, 14) }, { S(46532, 17), S(391, 14) }, { S(46549, 14), S(391, 14) },
+		{ S(46563, 11), S(391, 14) }, { S(46574, 15), S(360, 14) }, { S(46589, 17), S(24408, 18) }, { S(24435, 17), S(22935, 18) },
+		{ S(46606, 13), S(22935, 18) }, { S(46619, 12), S(37149, 21) }, { S(46631, 18), S(360, 14) }, { S(46649, 14), S(360, 14) },
+		{ S(46663, 11), S(360, 14) }, { S(46715, 28), S(571, 22) }, { S(46743, 23), S(3181, 17) }, { S(46766, 25), S(46791, 27) },
+		{ S(46818, 20), S(160, 16) }, { S(46838, 15), S(962, 18) }, { S(46853, 18), S(962, 18) }, { S(46871, 29), S(360, 14) },
+		{ S(46900, 11), S(360, 14) }, { S(36558, 21), S(2984, 24) }, { S(46911, 10), S(1342, 15) }, { S(46921, 19), S(1342, 15) },
+		{ S(46940, 18), S(1342, 15) }, { S(46958, 14), S(6930, 19) }, { S(46972, 23), S(5034, 17) }, { S(46995, 13), S(333, 17) },
+		{ S(47008, 14), S(2354, 16) }, { S(47022, 21), S(5034, 17) }, { S(47043, 13), S(1342, 15) }, { S(47056, 21), S(734, 17) },
+		{ S(26685, 20), S(2984, 24) }, { S(47077, 12), S(391, 14) }, { S(47089, 20), S(36081, 32) }, { S(47109, 11), S(360, 14) },
+		{ S(47120, 18), S(360, 14) }, { S(47138, 9), S(10377, 17) }, { S(47147, 13), S(2354, 16) }, { S(47160, 23), S(2354, 16) },
+		{ S(47183, 18), S(2354, 16) }, { S(46818, 20), S(160, 16) }, { S(46900, 11), S(360, 14) }, { S(36558, 21), S(2984, 24) },
+		{ S(46972, 23), S(5034, 17) }, { S(46995, 13), S(333, 17) }, { S(47008, 14), S(2354, 16) }, { S(47056, 21), S(734, 17) },
+		{ S(26685, 20), S(2984, 24) }, { S(47077, 12), S(391, 14) }, { S(47120, 18), S(360, 14) }, { S(47138, 9), S(10377, 17) },
+		{ S(47147, 13), S(2354, 16) }, { S(47308, 18), S(53, 9) }, { S(47326, 19), S(2984, 24) }, { S(37116, 13), S(2984, 24) },
+		{ S(47345, 16), S(360, 14) }, { S(47361, 14), S(2984, 24) }, { S(47375, 26), S(360, 14) }, { S(40518, 4), S(8135, 27) },
+		{ S(47401, 15), S(360, 14) }, { S(23423, 12), S(10801, 22) }, { S(6314, 17), S(6331, 29) }, { S(47416, 24), S(360, 14) },
+		{ S(47440, 3), S(28511, 23) }, { S(47443, 12), S(6930, 19) }, { S(47502, 23), S(360, 14) }, { S(47525, 12), S(360, 14) },
+		{ S(47537, 17), S(391, 14) }, { S(47582, 12), S(30975, 17) }, { S(47605, 9), S(30975, 17) }, { S(47679, 13), S(8047, 22) },
+		{ S(47721, 8), S(391, 14) }, { S(47737, 24), S(391, 14) }, { S(47761, 17), S(391, 14) }, { S(47778, 16), S(391, 14) },
+		{ S(47815, 14), S(8520, 22) }, { S(23125, 19), S(23144, 32) }, { S(23176, 14), S(23190, 18) }, { S(23208, 29), S(23190, 18) },
+		{ S(47887, 21), S(33052, 30) }, { S(47908, 18), S(391, 14) }, { S(47986, 11), S(40841, 26) }, { S(40652, 21), S(360, 14) },
+		{ S(36558, 21), S(2984, 24) }, { S(40673, 15), S(35870, 25) }, { S(24257, 5), S(24262, 10) }, { S(40688, 12), S(360, 14) },
+		{ S(36579, 9), S(22756, 16) }, { S(9304, 8), S(1372, 17) }, { S(40700, 15), S(333, 17) }, { S(40715, 19), S(40734, 28) },
+		{ S(40762, 17), S(248, 19) }, { S(36588, 18), S(23144, 32) }, { S(47997, 13), S(333, 17) }, { S(48010, 18), S(333, 17) },
+		{ S(36606, 21), S(8198, 22) }, { S(48028, 7), S(22756, 16) }, { S(40779, 8), S(360, 14) }, { S(48035, 14), S(360, 14) },
+		{ S(40787, 19), S(360, 14) }, { S(48049, 19), S(904, 19) }, { S(40806, 12), S(333, 17) }, { S(48068, 15), S(22756, 16) },
+		{ S(40818, 23), S(40841, 26) }, { S(48083, 16), S(1573, 19) }, { S(48115, 15), S(8520, 22) }, { S(48130, 19), S(46791, 27) },
+		{ S(48149, 14), S(360, 14) }, { S(48163, 26), S(360, 14) }, { S(10199, 6), S(8520, 22) }, { S(48197, 16), S(10673, 15) },
+		{ S(40652, 21), S(360, 14) }, { S(48213, 29), S(8198, 22) }, { S(48242, 7), S(10673, 15) }, { S(36558, 21), S(2984, 24) },
+		{ S(40673, 15), S(35870, 25) }, { S(48249, 15), S(8520, 22) }, { S(24257, 5), S(24262, 10) }, { S(24272, 5), S(299, 20) },
+		{ S(48264, 11), S(360, 14) }, { S(48275, 13), S(38220, 14) }, { S(40688, 12), S(360, 14) }, { S(40700, 15), S(333, 17) },
+		{ S(48288, 12), S(360, 14) }, { S(40715, 19), S(40734, 28) }, { S(40762, 17), S(248, 19) }, { S(36588, 18), S(23144, 32) },
+		{ S(36606, 21), S(8198, 22) }, { S(48300, 16), S(7311, 28) }, { S(48316, 16), S(23190, 18) }, { S(47525, 12), S(360, 14) },
+		{ S(40779, 8), S(360, 14) }, { S(48332, 21), S(820, 17) }, { S(48353, 10), S(10020, 29) }, { S(40787, 19), S(360, 14) },
+		{ S(48363, 19), S(360, 14) }, { S(48382, 13), S(391, 14) }, { S(48395, 11), S(360, 14) }, { S(48406, 16), S(45990, 25) },
+		{ S(48422, 20), S(360, 14) }, { S(41504, 4), S(46240, 20) }, { S(48442, 11), S(47201, 27) }, { S(40806, 12), S(333, 17) },
+		{ S(48453, 24), S(6703, 19) }, { S(48477, 7), S(360, 14) }, { S(48484, 9), S(391, 14) }, { S(48493, 18), S(391, 14) },
+		{ S(48511, 13), S(391, 14) }, { S(48524, 9), S(391, 14) }, { S(48533, 11), S(391, 14) }, { S(48544, 19), S(391, 14) },
+		{ S(48563, 12), S(391, 14) }, { S(48575, 29), S(6930, 19) }, { S(40818, 23), S(40841, 26) }, { S(48604, 16), S(360, 14) },
+		{ S(48631, 18), S(360, 14) }, { S(48649, 24), S(46791, 27) }, { S(48673, 19), S(360, 14) }, { S(48692, 20), S(46791, 27) },
+		{ S(48712, 22), S(35870, 25) }, { S(22653, 9), S(360, 14) }, { S(48734, 15), S(8520, 22) }, { S(48762, 14), S(8198, 22) },
+		{ S(48831, 10), S(45640, 21) }, { S(24312, 6), S(1342, 15) }, { S(48841, 20), S(571, 22) }, { S(48861, 13), S(391, 14) },
+		{ S(46549, 14), S(391, 14) }, { S(48936, 16), S(360, 14) }, { S(48952, 14), S(360, 14) }, { S(48966, 20), S(333, 17) },
+		{ S(48986, 16), S(360, 14) }, { S(49002, 13), S(41698, 15) }, { S(49015, 18), S(333, 17) }, { S(49033, 18), S(196, 14) },
+		{ S(49051, 16), S(196, 14) }, { S(49067, 11), S(360, 14) }, { S(49078, 17), S(40522, 20) }, { S(49095, 17), S(9616, 16) },
+		{ S(49112, 17), S(360, 14) }, { S(49129, 17), S(333, 17) }, { S(49146, 11), S(196, 14) }, { S(49157, 10), S(360, 14) },
+		{ S(48841, 20), S(571, 22) }, { S(49167, 14), S(41698, 15) }, { S(49181, 9), S(2354, 16) }, { S(49190, 18), S(820, 17) },
+		{ S(49208, 11), S(391, 14) }, { S(49219, 9), S(391, 14) }, { S(49228, 13), S(391, 14) }, { S(49241, 13), S(391, 14) },
+		{ S(49254, 12), S(391, 14) }, { S(49266, 8), S(360, 14) }, { S(49274, 16), S(333, 17) }, { S(319, 14), S(333, 17) },
+		{ S(49290, 11), S(45704, 21) }, { S(49311, 13), S(391, 14) }, { S(49324, 14), S(1573, 19) }, { S(49369, 14), S(10377, 17) },
+		{ S(49383, 20), S(37894, 21) }, { S(49457, 5), S(38220, 14) }, { S(49462, 6), S(38220, 14) },
+	};
+
+	inline constexpr class_schema_t CLASSES[] =
+	{
+		{ S(0, 27), S(27, 8), S(35, 18), S(53, 9), S(35, 18), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.AbilityCategoryDef
+		{ S(96, 19), S(27, 8), S(115, 10), S(53, 9), S(115, 10), { FIELDS + 3, 4 }, {}, { FIELD_TYPES + 0, 1 }, { FIELD_TYPES + 1, 11 }, },	// RimWorld.AbilityDef
+		{ S(218, 24), S(27, 8), S(432, 15), S(53, 9), S(432, 15), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.AbilityGroupDef
+		{ S(447, 28), S(27, 8), S(475, 19), S(53, 9), S(475, 19), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.AnomalyPlaystyleDef
+		{ S(494, 27), S(27, 8), S(521, 18), S(539, 0), S(521, 18), { FIELDS + 7, 1 }, {}, { FIELD_TYPES + 12, 2 }, {}, },	// RimWorld.ApparelRequirement
+		{ S(605, 20), S(27, 8), S(625, 11), S(53, 9), S(625, 11), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 14, 1 }, },	// RimWorld.BabyPlayDef
+		{ S(636, 21), S(27, 8), S(657, 12), S(53, 9), S(657, 12), { FIELDS + 8, 7 }, {}, { FIELD_TYPES + 15, 1 }, { FIELD_TYPES + 16, 4 }, },	// RimWorld.BackstoryDef
+		{ S(837, 17), S(27, 8), S(854, 8), S(862, 21), S(854, 8), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 20, 3 }, },	// RimWorld.BeardDef
+		{ S(980, 26), S(27, 8), S(1006, 17), S(53, 9), S(1006, 17), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.BillRepeatModeDef
+		{ S(1023, 25), S(27, 8), S(1048, 16), S(53, 9), S(1048, 16), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.BillStoreModeDef
+		{ S(1064, 17), S(27, 8), S(1081, 8), S(53, 9), S(1081, 8), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 23, 3 }, { FIELD_TYPES + 26, 1 }, },	// RimWorld.BiomeDef
+		{ S(765, 20), S(27, 8), S(1147, 11), S(53, 9), S(1147, 11), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.BodyTypeDef
+		{ S(1158, 16), S(27, 8), S(1174, 7), S(53, 9), S(1174, 7), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 27, 1 }, },	// RimWorld.BossDef
+		{ S(1205, 21), S(27, 8), S(1226, 12), S(53, 9), S(1226, 12), { FIELDS + 15, 4 }, {}, {}, { FIELD_TYPES + 28, 3 }, },	// RimWorld.BossgroupDef
+		{ S(1296, 20), S(27, 8), S(1316, 11), S(53, 9), S(1316, 11), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 31, 2 }, },	// RimWorld.ChemicalDef
+		{ S(1372, 17), S(27, 8), S(1389, 8), S(53, 9), S(1389, 8), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.ColorDef
+		{ S(1397, 38), S(27, 8), S(1435, 29), S(1464, 37), S(1435, 29), { FIELDS + 19, 2 }, {}, {}, { FIELD_TYPES + 33, 7 }, },	// RimWorld.CompProperties_AbilityConvert
+		{ S(1670, 38), S(27, 8), S(1708, 29), S(1464, 37), S(1708, 29), { FIELDS + 21, 3 }, {}, {}, { FIELD_TYPES + 40, 6 }, },	// RimWorld.CompProperties_AbilityCounsel
+		{ S(1768, 39), S(27, 8), S(1807, 30), S(1464, 37), S(1807, 30), { FIELDS + 24, 1 }, {}, {}, { FIELD_TYPES + 46, 5 }, },	// RimWorld.CompProperties_AbilityReassure
+		{ S(1837, 32), S(27, 8), S(1869, 23), S(1892, 20), S(1869, 23), { FIELDS + 25, 2 }, {}, {}, { FIELD_TYPES + 51, 1 }, },	// RimWorld.CompProperties_Activity
+		{ S(1957, 34), S(27, 8), S(1991, 25), S(2016, 36), S(1991, 25), { FIELDS + 27, 15 }, { FIELDS + 42, 1 }, {}, { FIELD_TYPES + 52, 8 }, },	// RimWorld.CompProperties_Analyzable
+		{ S(2487, 41), S(27, 8), S(2528, 32), S(2560, 47), S(2528, 32), { FIELDS + 43, 2 }, {}, {}, { FIELD_TYPES + 60, 3 }, },	// RimWorld.CompProperties_ApparelReloadable
+		{ S(2560, 47), S(27, 8), S(2649, 38), S(2687, 40), S(2649, 38), { FIELDS + 45, 1 }, {}, {}, { FIELD_TYPES + 63, 1 }, },	// RimWorld.CompProperties_ApparelVerbOwnerCharged
+		{ S(2727, 40), S(27, 8), S(2767, 31), S(1892, 20), S(2767, 31), { FIELDS + 46, 1 }, {}, {}, {}, },	// RimWorld.CompProperties_AssignableToPawn
+		{ S(2819, 55), S(27, 8), S(2874, 46), S(2920, 48), S(2874, 46), { FIELDS + 47, 2 }, {}, { FIELD_TYPES + 64, 1 }, { FIELD_TYPES + 65, 1 }, },	// RimWorld.CompProperties_BiosculpterPod_AgeReversalCycle
+		{ S(2920, 48), S(27, 8), S(3031, 39), S(1892, 20), S(3031, 39), { FIELDS + 47, 2 }, {}, { FIELD_TYPES + 64, 1 }, { FIELD_TYPES + 65, 1 }, },	// RimWorld.CompProperties_BiosculpterPod_BaseCycle
+		{ S(3070, 51), S(27, 8), S(3121, 42), S(2920, 48), S(3121, 42), { FIELDS + 47, 2 }, {}, { FIELD_TYPES + 66, 3 }, { FIELD_TYPES + 65, 1 }, },	// RimWorld.CompProperties_BiosculpterPod_HealingCycle
+		{ S(3222, 52), S(27, 8), S(3274, 43), S(2920, 48), S(3274, 43), { FIELDS + 47, 2 }, {}, { FIELD_TYPES + 64, 1 }, { FIELD_TYPES + 65, 1 }, },	// RimWorld.CompProperties_BiosculpterPod_PleasureCycle
+		{ S(3317, 31), S(27, 8), S(3348, 22), S(1892, 20), S(3348, 22), { FIELDS + 49, 1 }, {}, {}, {}, },	// RimWorld.CompProperties_Chimera
+		{ S(3387, 50), S(27, 8), S(3437, 41), S(1957, 34), S(3437, 41), { FIELDS + 27, 15 }, { FIELDS + 42, 1 }, {}, { FIELD_TYPES + 52, 8 }, },	// RimWorld.CompProperties_CompAnalyzableBiosignature
+		{ S(3478, 52), S(27, 8), S(3530, 43), S(1957, 34), S(3530, 43), { FIELDS + 27, 15 }, { FIELDS + 42, 1 }, {}, { FIELD_TYPES + 52, 8 }, },	// RimWorld.CompProperties_CompAnalyzableUnlockResearch
+		{ S(3573, 41), S(27, 8), S(3614, 32), S(1892, 20), S(3614, 32), { FIELDS + 50, 1 }, {}, {}, {}, },	// RimWorld.CompProperties_DestroyAfterDelay
+		{ S(3660, 32), S(27, 8), S(3692, 23), S(1892, 20), S(3692, 23), { FIELDS + 51, 5 }, {}, {}, {}, },	// RimWorld.CompProperties_Devourer
+		{ S(3807, 46), S(27, 8), S(3853, 37), S(2016, 36), S(3853, 37), { FIELDS + 56, 10 }, {}, {}, { FIELD_TYPES + 69, 5 }, },	// RimWorld.CompProperties_DisableUnnaturalCorpse
+		{ S(3890, 51), S(27, 8), S(3941, 42), S(3983, 41), S(3941, 42), { FIELDS + 43, 2 }, {}, {}, { FIELD_TYPES + 74, 3 }, },	// RimWorld.CompProperties_EquippableAbilityReloadable
+		{ S(4034, 57), S(27, 8), S(4091, 48), S(1892, 20), S(4091, 48), { FIELDS + 66, 1 }, {}, {}, { FIELD_TYPES + 77, 1 }, },	// RimWorld.CompProperties_GiveThoughtToAllMapPawnsOnDestroy
+		{ S(4153, 34), S(27, 8), S(4187, 25), S(2016, 36), S(4187, 25), { FIELDS + 67, 13 }, {}, {}, { FIELD_TYPES + 69, 5 }, },	// RimWorld.CompProperties_GoldenCube
+		{ S(4278, 34), S(27, 8), S(4312, 25), S(1892, 20), S(4312, 25), { FIELDS + 80, 2 }, {}, {}, { FIELD_TYPES + 51, 1 }, },	// RimWorld.CompProperties_GrayStatue
+		{ S(4358, 37), S(27, 8), S(4395, 28), S(4278, 34), S(4395, 28), { FIELDS + 80, 2 }, {}, {}, { FIELD_TYPES + 51, 1 }, },	// RimWorld.CompProperties_GrayStatueGas
+		{ S(4423, 44), S(27, 8), S(4467, 35), S(4278, 34), S(4467, 35), { FIELDS + 80, 2 }, {}, {}, { FIELD_TYPES + 51, 1 }, },	// RimWorld.CompProperties_GrayStatueTeleporter
+		{ S(4502, 34), S(27, 8), S(4536, 25), S(1892, 20), S(4536, 25), { FIELDS + 82, 1 }, {}, {}, {}, },	// RimWorld.CompProperties_HasSources
+		{ S(4579, 45), S(27, 8), S(4624, 36), S(1892, 20), S(4624, 36), { FIELDS + 83, 2 }, {}, {}, { FIELD_TYPES + 78, 1 }, },	// RimWorld.CompProperties_HoldingPlatformTarget
+		{ S(4709, 37), S(27, 8), S(4746, 28), S(1892, 20), S(4746, 28), { FIELDS + 85, 1 }, {}, {}, {}, },	// RimWorld.CompProperties_InspectString
+		{ S(4774, 46), S(27, 8), S(4820, 37), S(4709, 37), S(4820, 37), { FIELDS + 85, 1 }, {}, {}, { FIELD_TYPES + 79, 1 }, },	// RimWorld.CompProperties_InspectStringStatValue
+		{ S(2016, 36), S(27, 8), S(4861, 27), S(1892, 20), S(4861, 27), { FIELDS + 56, 10 }, {}, {}, { FIELD_TYPES + 69, 5 }, },	// RimWorld.CompProperties_Interactable
+		{ S(4888, 37), S(27, 8), S(4925, 28), S(2016, 36), S(4925, 28), { FIELDS + 56, 10 }, {}, {}, { FIELD_TYPES + 69, 5 }, },	// RimWorld.CompProperties_LabyrinthDoor
+		{ S(4953, 38), S(27, 8), S(4991, 29), S(1892, 20), S(4991, 29), { FIELDS + 80, 2 }, {}, {}, { FIELD_TYPES + 80, 2 }, },	// RimWorld.CompProperties_LeavingsLetter
+		{ S(5051, 37), S(27, 8), S(5088, 28), S(1892, 20), S(5088, 28), { FIELDS + 86, 2 }, {}, {}, {}, },	// RimWorld.CompProperties_MechPowerCell
+		{ S(5144, 42), S(27, 8), S(5186, 33), S(5219, 36), S(5186, 33), { FIELDS + 88, 1 }, {}, {}, { FIELD_TYPES + 82, 3 }, },	// RimWorld.CompProperties_NeuralSupercharger
+		{ S(5300, 35), S(27, 8), S(5335, 26), S(2016, 36), S(5335, 26), { FIELDS + 89, 18 }, {}, {}, { FIELD_TYPES + 69, 5 }, },	// RimWorld.CompProperties_Nociosphere
+		{ S(5508, 53), S(27, 8), S(5561, 44), S(2016, 36), S(5561, 44), { FIELDS + 56, 10 }, {}, {}, { FIELD_TYPES + 69, 5 }, },	// RimWorld.CompProperties_ObeliskDeactivationInteractor
+		{ S(5605, 40), S(27, 8), S(5645, 31), S(2016, 36), S(5645, 31), { FIELDS + 107, 11 }, {}, {}, { FIELD_TYPES + 69, 5 }, },	// RimWorld.CompProperties_ObeliskLabyrinth
+		{ S(5693, 48), S(27, 8), S(5741, 39), S(2016, 36), S(5741, 39), { FIELDS + 56, 10 }, {}, {}, { FIELD_TYPES + 69, 5 }, },	// RimWorld.CompProperties_ObeliskTriggerInteractor
+		{ S(5780, 39), S(27, 8), S(5819, 30), S(1892, 20), S(5819, 30), { FIELDS + 80, 2 }, {}, {}, { FIELD_TYPES + 51, 1 }, },	// RimWorld.CompProperties_ProximityLetter
+		{ S(5849, 34), S(27, 8), S(5883, 25), S(1892, 20), S(5883, 25), { FIELDS + 118, 3 }, {}, {}, { FIELD_TYPES + 85, 1 }, },	// RimWorld.CompProperties_Refuelable
+		{ S(5957, 32), S(27, 8), S(5989, 23), S(1892, 20), S(5989, 23), { FIELDS + 121, 1 }, {}, {}, {}, },	// RimWorld.CompProperties_Schedule
+		{ S(6022, 33), S(27, 8), S(6055, 24), S(1892, 20), S(6055, 24), { FIELDS + 122, 2 }, {}, {}, { FIELD_TYPES + 86, 1 }, },	// RimWorld.CompProperties_StatEntry
+		{ S(6137, 37), S(27, 8), S(6174, 28), S(1464, 37), S(6174, 28), { FIELDS + 24, 1 }, {}, {}, { FIELD_TYPES + 46, 5 }, },	// RimWorld.CompProperties_StopManhunter
+		{ S(6202, 33), S(27, 8), S(6235, 24), S(1892, 20), S(6235, 24), { FIELDS + 124, 3 }, {}, {}, { FIELD_TYPES + 87, 2 }, },	// RimWorld.CompProperties_Studiable
+		{ S(6360, 41), S(27, 8), S(6401, 32), S(6202, 33), S(6401, 32), { FIELDS + 124, 3 }, {}, {}, { FIELD_TYPES + 87, 2 }, },	// RimWorld.CompProperties_StudiableMonolith
+		{ S(6433, 35), S(27, 8), S(6468, 26), S(1892, 20), S(6468, 26), { FIELDS + 85, 1 }, {}, {}, {}, },	// RimWorld.CompProperties_TempControl
+		{ S(6494, 33), S(27, 8), S(6527, 24), S(1464, 37), S(6527, 24), { FIELDS + 127, 1 }, {}, { FIELD_TYPES + 89, 2 }, { FIELD_TYPES + 46, 5 }, },	// RimWorld.CompProperties_Transmute
+		{ S(6588, 30), S(27, 8), S(6618, 21), S(1892, 20), S(6618, 21), { FIELDS + 128, 2 }, {}, { FIELD_TYPES + 91, 1 }, { FIELD_TYPES + 92, 5 }, },	// RimWorld.CompProperties_Usable
+		{ S(6746, 25), S(27, 8), S(6771, 16), S(6787, 18), S(6771, 16), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 97, 1 }, { FIELD_TYPES + 98, 1 }, },	// RimWorld.ComplexLayoutDef
+		{ S(6882, 25), S(27, 8), S(6907, 16), S(53, 9), S(6907, 16), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 99, 1 }, },	// RimWorld.ComplexThreatDef
+		{ S(6930, 19), S(27, 8), S(6949, 10), S(53, 9), S(6949, 10), { FIELDS + 130, 5 }, {}, {}, {}, },	// RimWorld.ConceptDef
+		{ S(6985, 19), S(27, 8), S(7004, 10), S(53, 9), S(7004, 10), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 100, 7 }, },	// RimWorld.CultureDef
+		{ S(7120, 24), S(27, 8), S(7144, 15), S(53, 9), S(7144, 15), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.DebugTabMenuDef
+		{ S(7159, 22), S(27, 8), S(7181, 13), S(539, 0), S(7181, 13), { FIELDS + 135, 1 }, {}, {}, {}, },	// RimWorld.DeityNameType
+		{ S(7198, 22), S(27, 8), S(7220, 13), S(53, 9), S(7220, 13), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.DifficultyDef
+		{ S(7233, 22), S(27, 8), S(7255, 13), S(53, 9), S(7255, 13), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.DrugPolicyDef
+		{ S(7268, 26), S(27, 8), S(7294, 17), S(53, 9), S(7294, 17), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.EntityCategoryDef
+		{ S(7311, 28), S(27, 8), S(7339, 19), S(53, 9), S(7339, 19), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 107, 5 }, { FIELD_TYPES + 112, 2 }, },	// RimWorld.EntityCodexEntryDef
+		{ S(7485, 21), S(27, 8), S(7506, 12), S(53, 9), S(7506, 12), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.ExpansionDef
+		{ S(7518, 23), S(27, 8), S(7541, 14), S(53, 9), S(7541, 14), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.ExpectationDef
+		{ S(6703, 19), S(27, 8), S(7555, 10), S(53, 9), S(7555, 10), { FIELDS + 136, 10 }, {}, { FIELD_TYPES + 114, 19 }, { FIELD_TYPES + 133, 9 }, },	// RimWorld.FactionDef
+		{ S(8394, 19), S(27, 8), S(8413, 10), S(53, 9), S(8413, 10), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 142, 2 }, { FIELD_TYPES + 144, 1 }, },	// RimWorld.FeatureDef
+		{ S(8449, 21), S(27, 8), S(8470, 12), S(53, 9), S(8470, 12), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 145, 4 }, },	// RimWorld.FleshTypeDef
+		{ S(8556, 15), S(27, 8), S(8571, 6), S(862, 21), S(8571, 6), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 20, 3 }, },	// RimWorld.FurDef
+		{ S(8577, 21), S(27, 8), S(8598, 12), S(53, 9), S(8598, 12), { FIELDS + 146, 7 }, {}, { FIELD_TYPES + 149, 2 }, { FIELD_TYPES + 151, 1 }, },	// RimWorld.GatheringDef
+		{ S(8691, 29), S(27, 8), S(8720, 20), S(53, 9), S(8720, 20), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 152, 2 }, { FIELD_TYPES + 154, 2 }, },	// RimWorld.GauranlenTreeModeDef
+		{ S(8778, 24), S(27, 8), S(8802, 15), S(53, 9), S(8802, 15), { FIELDS + 153, 4 }, {}, {}, { FIELD_TYPES + 156, 1 }, },	// RimWorld.GeneTemplateDef
+		{ S(8866, 29), S(27, 8), S(8895, 20), S(53, 9), S(8895, 20), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 157, 2 }, },	// RimWorld.GoodwillSituationDef
+		{ S(8928, 16), S(27, 8), S(8944, 7), S(862, 21), S(8944, 7), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 20, 3 }, },	// RimWorld.HairDef
+		{ S(8951, 26), S(27, 8), S(8977, 17), S(53, 9), S(8977, 17), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.HediffGiverSetDef
+		{ S(8994, 29), S(27, 8), S(9023, 20), S(53, 9), S(9023, 20), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.HibernatableStateDef
+		{ S(9043, 31), S(27, 8), S(9074, 22), S(53, 9), S(9074, 22), { FIELDS + 157, 4 }, {}, {}, {}, },	// RimWorld.HistoryAutoRecorderDef
+		{ S(9107, 36), S(27, 8), S(9143, 27), S(53, 9), S(9143, 27), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 159, 1 }, {}, },	// RimWorld.HistoryAutoRecorderGroupDef
+		{ S(9193, 24), S(27, 8), S(9217, 15), S(53, 9), S(9217, 15), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.HistoryEventDef
+		{ S(9232, 21), S(27, 8), S(9253, 12), S(9265, 26), S(9253, 12), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 160, 2 }, { FIELD_TYPES + 162, 1 }, },	// RimWorld.IdeoColorDef
+		{ S(9312, 26), S(27, 8), S(9338, 17), S(53, 9), S(9338, 17), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.IdeoFoundationDef
+		{ S(9355, 20), S(27, 8), S(9375, 11), S(9265, 26), S(9375, 11), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 160, 2 }, {}, },	// RimWorld.IdeoIconDef
+		{ S(9386, 30), S(27, 8), S(9416, 21), S(53, 9), S(9416, 21), { FIELDS + 161, 4 }, {}, {}, {}, },	// RimWorld.IdeoPresetCategoryDef
+		{ S(9437, 22), S(27, 8), S(9459, 13), S(53, 9), S(9459, 13), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 163, 1 }, { FIELD_TYPES + 164, 1 }, },	// RimWorld.IdeoPresetDef
+		{ S(9483, 23), S(27, 8), S(9506, 14), S(539, 0), S(9506, 14), { FIELDS + 165, 4 }, {}, {}, {}, },	// RimWorld.IdeoSymbolPack
+		{ S(9265, 26), S(27, 8), S(9548, 17), S(53, 9), S(9548, 17), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 160, 2 }, {}, },	// RimWorld.IdeoSymbolPartDef
+		{ S(9565, 28), S(27, 8), S(9593, 19), S(53, 9), S(9593, 19), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 165, 1 }, },	// RimWorld.IncidentCategoryDef
+		{ S(7415, 20), S(27, 8), S(9632, 11), S(53, 9), S(9632, 11), { FIELDS + 169, 6 }, {}, { FIELD_TYPES + 166, 6 }, { FIELD_TYPES + 172, 12 }, },	// RimWorld.IncidentDef
+		{ S(9776, 29), S(27, 8), S(9953, 20), S(53, 9), S(9953, 20), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.IncidentTargetTagDef
+		{ S(9973, 28), S(27, 8), S(10001, 19), S(53, 9), S(10001, 19), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.InfectionPathwayDef
+		{ S(10020, 29), S(27, 8), S(10049, 20), S(539, 0), S(10049, 20), { FIELDS + 175, 3 }, {}, {}, { FIELD_TYPES + 184, 10 }, },	// RimWorld.IngestibleProperties
+		{ S(10272, 23), S(27, 8), S(10295, 14), S(53, 9), S(10295, 14), { FIELDS + 178, 7 }, {}, { FIELD_TYPES + 194, 5 }, { FIELD_TYPES + 199, 1 }, },	// RimWorld.InspirationDef
+		{ S(10529, 23), S(27, 8), S(10552, 14), S(53, 9), S(10552, 14), { FIELDS + 185, 7 }, {}, {}, { FIELD_TYPES + 200, 5 }, },	// RimWorld.InstructionDef
+		{ S(10696, 23), S(27, 8), S(10719, 14), S(53, 9), S(10719, 14), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 205, 7 }, },	// RimWorld.InteractionDef
+		{ S(10876, 17), S(27, 8), S(10893, 8), S(53, 9), S(10893, 8), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.IssueDef
+		{ S(10901, 32), S(27, 8), S(10933, 23), S(10956, 30), S(10933, 23), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 212, 1 }, },	// RimWorld.JobGiver_AIAbilityFight
+		{ S(11041, 29), S(27, 8), S(11070, 20), S(11090, 27), S(11070, 20), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIBreaching
+		{ S(11117, 31), S(27, 8), S(11148, 22), S(11090, 27), S(11148, 22), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 212, 1 }, },	// RimWorld.JobGiver_AICastAbility
+		{ S(11170, 37), S(27, 8), S(11207, 28), S(11117, 31), S(11207, 28), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 212, 1 }, },	// RimWorld.JobGiver_AICastAbilityOnSelf
+		{ S(11235, 37), S(27, 8), S(11272, 28), S(11117, 31), S(11272, 28), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 212, 1 }, },	// RimWorld.JobGiver_AICastAnimalWarcall
+		{ S(11300, 34), S(27, 8), S(11334, 25), S(11359, 30), S(11334, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIDefendEscortee
+		{ S(11389, 32), S(27, 8), S(11421, 23), S(11359, 30), S(11421, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIDefendMaster
+		{ S(11444, 34), S(27, 8), S(11478, 25), S(11359, 30), S(11478, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIDefendOverseer
+		{ S(11359, 30), S(27, 8), S(11503, 21), S(10956, 30), S(11503, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIDefendPawn
+		{ S(11524, 31), S(27, 8), S(11555, 22), S(10956, 30), S(11555, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIDefendPoint
+		{ S(11577, 30), S(27, 8), S(11607, 21), S(11359, 30), S(11607, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIDefendSelf
+		{ S(11628, 32), S(27, 8), S(11660, 23), S(10956, 30), S(11660, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIFightEnemies
+		{ S(10956, 30), S(27, 8), S(11683, 21), S(11090, 27), S(11683, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIFightEnemy
+		{ S(11704, 34), S(27, 8), S(11738, 25), S(11763, 30), S(11738, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIFollowEscortee
+		{ S(11793, 32), S(27, 8), S(11825, 23), S(11763, 30), S(11825, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIFollowMaster
+		{ S(11848, 34), S(27, 8), S(11882, 25), S(11763, 30), S(11882, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIFollowOverseer
+		{ S(11763, 30), S(27, 8), S(11907, 21), S(11090, 27), S(11907, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIFollowPawn
+		{ S(11928, 38), S(27, 8), S(11966, 29), S(11090, 27), S(11966, 29), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIGotoNearestHostile
+		{ S(11995, 37), S(27, 8), S(12032, 28), S(11090, 27), S(12032, 28), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 212, 1 }, },	// RimWorld.JobGiver_AIJumpEscapeEnemies
+		{ S(12060, 41), S(27, 8), S(12101, 32), S(12133, 35), S(12101, 32), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 212, 1 }, },	// RimWorld.JobGiver_AIJumpToJobRescueTarget
+		{ S(12133, 35), S(27, 8), S(12168, 26), S(11090, 27), S(12168, 26), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 212, 1 }, },	// RimWorld.JobGiver_AIJumpToJobTarget
+		{ S(12194, 32), S(27, 8), S(12226, 23), S(11090, 27), S(12226, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIReleaseMechs
+		{ S(12249, 35), S(27, 8), S(12284, 26), S(11090, 27), S(12284, 26), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 212, 1 }, },	// RimWorld.JobGiver_AIResurrectTarget
+		{ S(12310, 26), S(27, 8), S(12336, 17), S(11090, 27), S(12336, 17), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AISapper
+		{ S(12353, 35), S(27, 8), S(12388, 26), S(11090, 27), S(12388, 26), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 212, 1 }, },	// RimWorld.JobGiver_AISkipToJobTarget
+		{ S(12414, 41), S(27, 8), S(12455, 32), S(11090, 27), S(12455, 32), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AITrashBuildingsDistant
+		{ S(12487, 36), S(27, 8), S(12523, 27), S(11090, 27), S(12523, 27), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AITrashColonyClose
+		{ S(12550, 34), S(27, 8), S(12584, 25), S(11090, 27), S(12584, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AITrashDutyFocus
+		{ S(12609, 30), S(27, 8), S(12639, 21), S(11090, 27), S(12639, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIWaitAmbush
+		{ S(12660, 36), S(27, 8), S(12696, 27), S(11090, 27), S(12696, 27), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AIWaitWithOverseer
+		{ S(12723, 28), S(27, 8), S(12751, 19), S(11090, 27), S(12751, 19), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 213, 2 }, },	// RimWorld.JobGiver_AcceptRole
+		{ S(12796, 33), S(27, 8), S(12829, 24), S(11090, 27), S(12829, 24), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ActivityDormant
+		{ S(12853, 30), S(27, 8), S(12883, 21), S(11090, 27), S(12883, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AnimaLinking
+		{ S(12904, 28), S(27, 8), S(12932, 19), S(11090, 27), S(12932, 19), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_AnimalFlee
+		{ S(12951, 26), S(27, 8), S(12977, 17), S(11090, 27), S(12977, 17), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Autofeed
+		{ S(12994, 25), S(27, 8), S(13019, 16), S(11090, 27), S(13019, 16), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Berserk
+		{ S(13035, 33), S(27, 8), S(13068, 24), S(12994, 25), S(13068, 24), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Berserk_Warcall
+		{ S(13092, 35), S(27, 8), S(13127, 26), S(11090, 27), S(13127, 26), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_BestowingCeremony
+		{ S(13153, 23), S(27, 8), S(13176, 14), S(11090, 27), S(13176, 14), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Binge
+		{ S(13190, 27), S(27, 8), S(13217, 18), S(13153, 23), S(13217, 18), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_BingeDrug
+		{ S(13235, 27), S(27, 8), S(13262, 18), S(13153, 23), S(13262, 18), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_BingeFood
+		{ S(13280, 23), S(27, 8), S(13303, 14), S(11090, 27), S(13303, 14), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Blind
+		{ S(13317, 35), S(27, 8), S(13352, 26), S(11090, 27), S(13352, 26), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_BringBabyToSafety
+		{ S(13378, 43), S(27, 8), S(13421, 34), S(11090, 27), S(13421, 34), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ChimeraAttackNearbyHumans
+		{ S(13455, 48), S(27, 8), S(13503, 39), S(11090, 27), S(13503, 39), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ConcertOrganizerPlayInstrument
+		{ S(13542, 47), S(27, 8), S(13589, 38), S(11090, 27), S(13589, 38), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ConfigurableHostilityResponse
+		{ S(13627, 38), S(27, 8), S(13665, 29), S(13694, 43), S(13665, 29), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_CreateAndEnterCocoon
+		{ S(13694, 43), S(27, 8), S(13737, 34), S(11090, 27), S(13737, 34), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_CreateAndEnterDryadHolder
+		{ S(13771, 42), S(27, 8), S(13813, 33), S(13694, 43), S(13813, 33), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_CreateAndEnterHealingPod
+		{ S(13846, 31), S(27, 8), S(13877, 22), S(11090, 27), S(13877, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_CubeSculpting
+		{ S(13899, 23), S(27, 8), S(13922, 14), S(11090, 27), S(13922, 14), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Dance
+		{ S(13936, 36), S(27, 8), S(13972, 27), S(13999, 39), S(13972, 27), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 14, 1 }, },	// RimWorld.JobGiver_DeliverPawnToAltar
+		{ S(14038, 34), S(27, 8), S(14072, 25), S(13999, 39), S(14072, 25), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 14, 1 }, },	// RimWorld.JobGiver_DeliverPawnToBed
+		{ S(14097, 35), S(27, 8), S(14132, 26), S(13999, 39), S(14132, 26), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 14, 1 }, },	// RimWorld.JobGiver_DeliverPawnToCell
+		{ S(14158, 48), S(27, 8), S(14206, 39), S(14097, 35), S(14206, 39), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 14, 1 }, },	// RimWorld.JobGiver_DeliverPawnToPsychicRitualCell
+		{ S(14245, 25), S(27, 8), S(14270, 16), S(11090, 27), S(14270, 16), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_DoLovin
+		{ S(14286, 41), S(27, 8), S(14327, 32), S(11090, 27), S(14327, 32), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_DropRandomGearOrApparel
+		{ S(14359, 37), S(27, 8), S(14396, 28), S(11090, 27), S(14396, 28), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_DropUnusedInventory
+		{ S(14424, 28), S(27, 8), S(14452, 19), S(11090, 27), S(14452, 19), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_DropWeapon
+		{ S(14471, 22), S(27, 8), S(14493, 13), S(11628, 32), S(14493, 13), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Duel
+		{ S(14506, 34), S(27, 8), S(14540, 25), S(11090, 27), S(14540, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_DuelPickupWeapon
+		{ S(14565, 25), S(27, 8), S(14590, 16), S(11090, 27), S(14590, 16), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_DyeHair
+		{ S(14606, 38), S(27, 8), S(14644, 29), S(11090, 27), S(14644, 29), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_EatAtCannibalPlatter
+		{ S(14673, 36), S(27, 8), S(14709, 27), S(11090, 27), S(14709, 27), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_EatInGatheringArea
+		{ S(14736, 27), S(27, 8), S(14763, 18), S(11090, 27), S(14763, 18), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_EatRandom
+		{ S(14781, 29), S(27, 8), S(14810, 20), S(11090, 27), S(14810, 20), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_EnterPortal
+		{ S(14830, 34), S(27, 8), S(14864, 25), S(11090, 27), S(14864, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_EnterTransporter
+		{ S(14889, 41), S(27, 8), S(14930, 32), S(11628, 32), S(14930, 32), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_EscapingHoldingPlatform
+		{ S(14962, 32), S(27, 8), S(14994, 23), S(11090, 27), S(14994, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ExtinguishSelf
+		{ S(15017, 37), S(27, 8), S(15054, 28), S(11090, 27), S(15054, 28), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_FightFiresNearPoint
+		{ S(15082, 35), S(27, 8), S(15117, 26), S(11090, 27), S(15117, 26), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_FireStartingSpree
+		{ S(15143, 30), S(27, 8), S(15173, 21), S(11090, 27), S(15173, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_FleeAllPawns
+		{ S(15194, 28), S(27, 8), S(15222, 19), S(11090, 27), S(15222, 19), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_FleeDanger
+		{ S(15241, 26), S(27, 8), S(15267, 17), S(11090, 27), S(15267, 17), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_FleeFire
+		{ S(15284, 33), S(27, 8), S(15317, 24), S(11090, 27), S(15317, 24), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_FleeForDistance
+		{ S(15341, 37), S(27, 8), S(15378, 28), S(11090, 27), S(15378, 28), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_FleeImmediateThreat
+		{ S(15406, 40), S(27, 8), S(15446, 31), S(11090, 27), S(15446, 31), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_FleePotentialExplosion
+		{ S(15477, 29), S(27, 8), S(15506, 20), S(11090, 27), S(15506, 20), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_FollowRoper
+		{ S(15526, 31), S(27, 8), S(15557, 22), S(11090, 27), S(15557, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ForceSleepNow
+		{ S(15579, 49), S(27, 8), S(15628, 40), S(11090, 27), S(15628, 40), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GatherOfferingsForPsychicRitual
+		{ S(15668, 32), S(27, 8), S(15700, 23), S(11090, 27), S(15700, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetAgeReversal
+		{ S(15723, 30), S(27, 8), S(15753, 21), S(11090, 27), S(15753, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetDeathrest
+		{ S(15774, 27), S(27, 8), S(15801, 18), S(11090, 27), S(15801, 18), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetEnergy
+		{ S(15819, 35), S(27, 8), S(15854, 26), S(15774, 27), S(15854, 26), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetEnergy_Charger
+		{ S(15880, 40), S(27, 8), S(15920, 31), S(15774, 27), S(15920, 31), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetEnergy_SelfShutdown
+		{ S(15951, 25), S(27, 8), S(15976, 16), S(11090, 27), S(15976, 16), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetFood
+		{ S(15992, 28), S(27, 8), S(16020, 19), S(11090, 27), S(16020, 19), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetHemogen
+		{ S(16039, 24), S(27, 8), S(16063, 15), S(11090, 27), S(16063, 15), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetJoy
+		{ S(16078, 29), S(27, 8), S(16107, 20), S(16039, 24), S(16107, 20), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetJoyInBed
+		{ S(16127, 39), S(27, 8), S(16166, 30), S(16039, 24), S(16166, 30), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetJoyInGatheringArea
+		{ S(16196, 38), S(27, 8), S(16234, 29), S(11090, 27), S(16234, 29), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetNeuralSupercharge
+		{ S(16263, 25), S(27, 8), S(16288, 16), S(11090, 27), S(16288, 16), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GetRest
+		{ S(16304, 28), S(27, 8), S(16332, 19), S(11090, 27), S(16332, 19), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 213, 2 }, },	// RimWorld.JobGiver_GiveSpeech
+		{ S(16351, 40), S(27, 8), S(16391, 31), S(11090, 27), S(16391, 31), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 213, 2 }, },	// RimWorld.JobGiver_GiveSpeechFacingTarget
+		{ S(16422, 44), S(27, 8), S(16466, 35), S(11090, 27), S(16466, 35), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_GotoAndStandSociallyActive
+		{ S(13999, 39), S(27, 8), S(16501, 30), S(11090, 27), S(16501, 30), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 14, 1 }, },	// RimWorld.JobGiver_GotoTravelDestination
+		{ S(16531, 27), S(27, 8), S(16558, 18), S(11090, 27), S(16558, 18), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_HateChant
+		{ S(16576, 22), S(27, 8), S(16598, 13), S(11090, 27), S(16598, 13), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Haul
+		{ S(16611, 41), S(27, 8), S(16652, 32), S(11090, 27), S(16652, 32), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_HaulCorpseToPublicPlace
+		{ S(16684, 30), S(27, 8), S(16714, 21), S(11090, 27), S(16714, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_HaulToPortal
+		{ S(16735, 29), S(27, 8), S(16764, 20), S(11628, 32), S(16764, 20), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_HiveDefense
+		{ S(16784, 25), S(27, 8), S(16809, 16), S(16039, 24), S(16809, 16), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_IdleJoy
+		{ S(16825, 40), S(27, 8), S(16865, 31), S(11090, 27), S(16865, 31), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_InducePrisonerToEscape
+		{ S(16896, 36), S(27, 8), S(16932, 27), S(11090, 27), S(16932, 27), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_InduceSlaveToRebel
+		{ S(16959, 32), S(27, 8), S(16991, 23), S(11090, 27), S(16991, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_InsultingSpree
+		{ S(17014, 29), S(27, 8), S(17043, 20), S(11090, 27), S(17043, 20), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_JumpInWater
+		{ S(17063, 31), S(27, 8), S(17094, 22), S(11090, 27), S(17094, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_KeepLyingDown
+		{ S(17116, 24), S(27, 8), S(17140, 15), S(11090, 27), S(17140, 15), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Kidnap
+		{ S(17155, 30), S(27, 8), S(17185, 21), S(11090, 27), S(17185, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_LayDownAwake
+		{ S(17206, 32), S(27, 8), S(17238, 23), S(11090, 27), S(17238, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_LayDownResting
+		{ S(17261, 24), S(27, 8), S(17285, 15), S(11090, 27), S(17285, 15), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_LayEgg
+		{ S(17300, 23), S(27, 8), S(17323, 14), S(11090, 27), S(17323, 14), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Learn
+		{ S(17337, 34), S(27, 8), S(17371, 25), S(11090, 27), S(17371, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_LoadTransporters
+		{ S(17396, 31), S(27, 8), S(17427, 22), S(11628, 32), S(17427, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_MaintainHives
+		{ S(17449, 28), S(27, 8), S(17477, 19), S(11090, 27), S(17477, 19), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ManTurrets
+		{ S(17496, 37), S(27, 8), S(17533, 28), S(17449, 28), S(17533, 28), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ManTurretsNearPoint
+		{ S(17561, 36), S(27, 8), S(17597, 27), S(17449, 28), S(17597, 27), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ManTurretsNearSelf
+		{ S(17624, 27), S(27, 8), S(17651, 18), S(11090, 27), S(17651, 18), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Manhunter
+		{ S(17669, 35), S(27, 8), S(17704, 26), S(11090, 27), S(17704, 26), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_MarryAdjacentPawn
+		{ S(17730, 22), S(27, 8), S(17752, 13), S(11090, 27), S(17752, 13), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Mate
+		{ S(17765, 26), S(27, 8), S(17791, 17), S(11090, 27), S(17791, 17), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Meditate
+		{ S(17808, 31), S(27, 8), S(17839, 22), S(17765, 26), S(17839, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_MeditateInBed
+		{ S(17861, 38), S(27, 8), S(17899, 29), S(11090, 27), S(17899, 29), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_MergeIntoGaumakerPod
+		{ S(17928, 34), S(27, 8), S(17962, 25), S(10956, 30), S(17962, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_MetalhorrorFight
+		{ S(17987, 28), S(27, 8), S(18015, 19), S(11090, 27), S(18015, 19), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_MineRandom
+		{ S(18034, 38), S(27, 8), S(18072, 29), S(11090, 27), S(18072, 29), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_MoveDrugsToInventory
+		{ S(18101, 31), S(27, 8), S(18132, 22), S(11090, 27), S(18132, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_MurderousRage
+		{ S(18154, 43), S(27, 8), S(18197, 34), S(11090, 27), S(18197, 34), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_NPCCastNonCombatAbilities
+		{ S(18231, 35), S(27, 8), S(18266, 26), S(11090, 27), S(18266, 26), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_NociosphereDepart
+		{ S(18292, 34), S(27, 8), S(18326, 25), S(11090, 27), S(18326, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_NociosphereFight
+		{ S(18351, 33), S(27, 8), S(18384, 24), S(11090, 27), S(18384, 24), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_NociosphereSkip
+		{ S(18408, 24), S(27, 8), S(18432, 15), S(11090, 27), S(18432, 15), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Nuzzle
+		{ S(18447, 33), S(27, 8), S(18480, 24), S(11090, 27), S(18480, 24), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_OptimizeApparel
+		{ S(18504, 43), S(27, 8), S(18547, 34), S(11090, 27), S(18547, 34), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PackAnimalFollowColonists
+		{ S(18581, 26), S(27, 8), S(18607, 17), S(11090, 27), S(18607, 17), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PackFood
+		{ S(18624, 32), S(27, 8), S(18656, 23), S(11090, 27), S(18656, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PatientGoToBed
+		{ S(18679, 43), S(27, 8), S(18722, 34), S(11090, 27), S(18722, 34), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PickUpOpportunisticWeapon
+		{ S(18756, 38), S(27, 8), S(18794, 29), S(11090, 27), S(18794, 29), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PlayTargetInstrument
+		{ S(18823, 36), S(27, 8), S(18859, 27), S(11090, 27), S(18859, 27), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PlayWithGoldenCube
+		{ S(18886, 45), S(27, 8), S(18931, 36), S(18967, 42), S(18931, 36), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PrepareCaravan_CollectPawns
+		{ S(19009, 50), S(27, 8), S(19059, 41), S(11090, 27), S(19059, 41), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PrepareCaravan_GatherDownedPawns
+		{ S(19100, 44), S(27, 8), S(19144, 35), S(11090, 27), S(19144, 35), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PrepareCaravan_GatherItems
+		{ S(19179, 44), S(27, 8), S(19223, 35), S(18967, 42), S(19223, 35), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PrepareCaravan_GatherPawns
+		{ S(18967, 42), S(27, 8), S(19258, 33), S(11090, 27), S(19258, 33), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PrepareCaravan_RopePawns
+		{ S(19291, 35), S(27, 8), S(19326, 26), S(16422, 44), S(19326, 26), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 215, 1 }, },	// RimWorld.JobGiver_PrepareSkylantern
+		{ S(19355, 32), S(27, 8), S(19387, 23), S(11090, 27), S(19387, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PrisonerEscape
+		{ S(19410, 36), S(27, 8), S(19446, 27), S(11090, 27), S(19446, 27), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PrisonerGetDressed
+		{ S(19473, 47), S(27, 8), S(19520, 38), S(19558, 24), S(19520, 38), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_PrisonerWaitInsteadOfEscaping
+		{ S(19582, 30), S(27, 8), S(19612, 21), S(11090, 27), S(19612, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ReachOutside
+		{ S(19633, 41), S(27, 8), S(19674, 32), S(11090, 27), S(19674, 32), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ReactToCloseMeleeThreat
+		{ S(19706, 31), S(27, 8), S(19737, 22), S(11090, 27), S(19737, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ReleaseEntity
+		{ S(19759, 24), S(27, 8), S(19783, 15), S(11090, 27), S(19783, 15), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Reload
+		{ S(19798, 30), S(27, 8), S(19828, 21), S(11090, 27), S(19828, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_RescueNearby
+		{ S(19849, 39), S(27, 8), S(19888, 30), S(11090, 27), S(19888, 30), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ReturnToGauranlenTree
+		{ S(19918, 44), S(27, 8), S(19962, 35), S(18967, 42), S(19962, 35), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ReturnedCaravan_PenAnimals
+		{ S(19997, 32), S(27, 8), S(20029, 23), S(11090, 27), S(20029, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_RevenantAttack
+		{ S(20052, 32), S(27, 8), S(20084, 23), S(11090, 27), S(20084, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_RevenantEscape
+		{ S(20107, 31), S(27, 8), S(20138, 22), S(11090, 27), S(20138, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_RevenantSleep
+		{ S(20160, 32), S(27, 8), S(20192, 23), S(11090, 27), S(20192, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_RevenantWander
+		{ S(20215, 27), S(27, 8), S(20242, 18), S(11090, 27), S(20242, 18), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Sacrifice
+		{ S(20260, 42), S(27, 8), S(20302, 33), S(11090, 27), S(20302, 33), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SatifyChemicalDependency
+		{ S(20335, 37), S(27, 8), S(20372, 28), S(11090, 27), S(20372, 28), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SatisfyChemicalNeed
+		{ S(20400, 25), S(27, 8), S(20425, 16), S(11090, 27), S(20425, 16), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Scarify
+		{ S(20441, 33), S(27, 8), S(20474, 24), S(11090, 27), S(20474, 24), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SeekAllowedArea
+		{ S(20498, 37), S(27, 8), S(20535, 28), S(11090, 27), S(20535, 28), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SeekSafeTemperature
+		{ S(20563, 30), S(27, 8), S(20593, 21), S(11090, 27), S(20593, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SelfShutdown
+		{ S(20614, 26), S(27, 8), S(20640, 17), S(11090, 27), S(20640, 17), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SelfTend
+		{ S(20657, 31), S(27, 8), S(20688, 22), S(10956, 30), S(20688, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ShamblerFight
+		{ S(20710, 32), S(27, 8), S(20742, 23), S(19558, 24), S(20742, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_ShamblerWander
+		{ S(20765, 36), S(27, 8), S(20801, 27), S(11090, 27), S(20801, 27), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SightstealerAttack
+		{ S(20828, 33), S(27, 8), S(20861, 24), S(11090, 27), S(20861, 24), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SlaughterEntity
+		{ S(20885, 39), S(27, 8), S(20924, 30), S(11090, 27), S(20924, 30), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SlaughterRandomAnimal
+		{ S(20954, 32), S(27, 8), S(20986, 23), S(11090, 27), S(20986, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SocialFighting
+		{ S(21009, 42), S(27, 8), S(21051, 33), S(11090, 27), S(21051, 33), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SpectateDutySpectateRect
+		{ S(21084, 38), S(27, 8), S(21122, 29), S(21009, 42), S(21122, 29), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_SpectateInCircleDuty
+		{ S(21151, 42), S(27, 8), S(21193, 33), S(11090, 27), S(21193, 33), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_StandAndBeSociallyActive
+		{ S(21226, 31), S(27, 8), S(21257, 22), S(11090, 27), S(21257, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_StandAndStare
+		{ S(21279, 30), S(27, 8), S(21309, 21), S(11090, 27), S(21309, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_StartRoaming
+		{ S(21330, 23), S(27, 8), S(21353, 14), S(11090, 27), S(21353, 14), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Steal
+		{ S(21367, 41), S(27, 8), S(21408, 32), S(11090, 27), S(21408, 32), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_TakeCombatEnhancingDrug
+		{ S(21440, 38), S(27, 8), S(21478, 29), S(11090, 27), S(21478, 29), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 215, 1 }, },	// RimWorld.JobGiver_TakeCountToInventory
+		{ S(21507, 40), S(27, 8), S(21547, 31), S(11090, 27), S(21547, 31), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_TakeDrugsForDrugPolicy
+		{ S(21578, 39), S(27, 8), S(21617, 30), S(11090, 27), S(21617, 30), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_TakeForInventoryStock
+		{ S(21647, 34), S(27, 8), S(21681, 25), S(11090, 27), S(21681, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_TakeWoundedGuest
+		{ S(21706, 25), S(27, 8), S(21731, 16), S(11090, 27), S(21731, 16), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_Tantrum
+		{ S(21747, 38), S(27, 8), S(21785, 29), S(11090, 27), S(21785, 29), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_UnloadMyLordCarriers
+		{ S(21814, 37), S(27, 8), S(21851, 28), S(11090, 27), S(21851, 28), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_UnloadYourInventory
+		{ S(21879, 39), S(27, 8), S(21918, 30), S(11090, 27), S(21918, 30), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_UnnaturalCorpseAttack
+		{ S(21948, 37), S(27, 8), S(21985, 28), S(11090, 27), S(21985, 28), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_UnnaturalCorpseIdle
+		{ S(22013, 37), S(27, 8), S(22050, 28), S(11090, 27), S(22050, 28), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_UnnaturalCorpseSkip
+		{ S(22078, 43), S(27, 8), S(22121, 34), S(22013, 37), S(22121, 34), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_UnnaturalCorpseSkipBackup
+		{ S(22155, 54), S(27, 8), S(22209, 45), S(11090, 27), S(22209, 45), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_UnnaturalCorpseTowardVictimDirection
+		{ S(22254, 40), S(27, 8), S(22294, 31), S(22013, 37), S(22294, 31), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_UnnaturalCorpseUnstuck
+		{ S(22325, 30), S(27, 8), S(22355, 21), S(19558, 24), S(22355, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_WanderColony
+		{ S(22376, 42), S(27, 8), S(22418, 33), S(19558, 24), S(22418, 33), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_WanderControlGroupTarget
+		{ S(22451, 28), S(27, 8), S(22479, 19), S(19558, 24), S(22479, 19), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_WanderHive
+		{ S(22498, 39), S(27, 8), S(22537, 30), S(19558, 24), S(22537, 30), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_WanderInGatheringArea
+		{ S(22567, 32), S(27, 8), S(22599, 23), S(19558, 24), S(22599, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// RimWorld.JobGiver_WanderOverseer
+		{ S(22622, 20), S(27, 8), S(22642, 11), S(53, 9), S(22642, 11), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 216, 2 }, { FIELD_TYPES + 218, 2 }, },	// RimWorld.JoyGiverDef
+		{ S(10180, 19), S(27, 8), S(22662, 10), S(53, 9), S(22662, 10), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 220, 1 }, {}, },	// RimWorld.JoyKindDef
+		{ S(6331, 29), S(27, 8), S(22688, 20), S(53, 9), S(22688, 20), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 221, 1 }, },	// RimWorld.KnowledgeCategoryDef
+		{ S(6787, 18), S(27, 8), S(22724, 9), S(53, 9), S(22724, 9), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 97, 1 }, {}, },	// RimWorld.LayoutDef
+		{ S(6813, 22), S(27, 8), S(22733, 13), S(53, 9), S(22733, 13), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 222, 1 }, { FIELD_TYPES + 223, 1 }, },	// RimWorld.LayoutRoomDef
+		{ S(22815, 26), S(27, 8), S(22841, 17), S(53, 9), S(22841, 17), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 14, 1 }, },	// RimWorld.LearningDesireDef
+		{ S(22858, 21), S(27, 8), S(22879, 12), S(53, 9), S(22879, 12), { FIELDS + 194, 5 }, {}, {}, { FIELD_TYPES + 224, 2 }, },	// RimWorld.LifeStageDef
+		{ S(22974, 22), S(27, 8), S(22996, 13), S(53, 9), S(22996, 13), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 63, 1 }, },	// RimWorld.MainButtonDef
+		{ S(23009, 23), S(27, 8), S(23032, 14), S(53, 9), S(23032, 14), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.MapMeshFlagDef
+		{ S(23046, 27), S(27, 8), S(23073, 18), S(53, 9), S(23073, 18), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.MeditationFocusDef
+		{ S(160, 16), S(27, 8), S(23091, 7), S(53, 9), S(23091, 7), { FIELDS + 199, 4 }, { FIELDS + 203, 1 }, { FIELD_TYPES + 226, 9 }, { FIELD_TYPES + 235, 4 }, },	// RimWorld.MemeDef
+		{ S(23435, 21), S(27, 8), S(23456, 12), S(53, 9), S(23456, 12), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.MemeGroupDef
+		{ S(23468, 25), S(27, 8), S(23493, 16), S(53, 9), S(23493, 16), { FIELDS + 204, 16 }, {}, { FIELD_TYPES + 239, 2 }, { FIELD_TYPES + 241, 4 }, },	// RimWorld.MonolithLevelDef
+		{ S(23895, 25), S(27, 8), S(23920, 16), S(53, 9), S(23920, 16), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 245, 1 }, { FIELD_TYPES + 246, 2 }, },	// RimWorld.MusicSequenceDef
+		{ S(23970, 27), S(27, 8), S(23997, 18), S(53, 9), S(23997, 18), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 248, 1 }, },	// RimWorld.MusicTransitionDef
+		{ S(24023, 20), S(27, 8), S(24043, 11), S(24054, 26), S(24043, 11), { FIELDS + 220, 1 }, {}, {}, { FIELD_TYPES + 249, 1 }, },	// RimWorld.MutantCount
+		{ S(962, 18), S(27, 8), S(24086, 9), S(53, 9), S(24086, 9), { FIELDS + 221, 6 }, {}, { FIELD_TYPES + 250, 10 }, { FIELD_TYPES + 260, 15 }, },	// RimWorld.MutantDef
+		{ S(24195, 16), S(27, 8), S(24452, 7), S(53, 9), S(24452, 7), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 275, 3 }, {}, },	// RimWorld.NeedDef
+		{ S(24494, 22), S(27, 8), S(24516, 13), S(53, 9), S(24516, 13), { FIELDS + 227, 4 }, {}, {}, { FIELD_TYPES + 278, 2 }, },	// RimWorld.PawnColumnDef
+		{ S(24576, 38), S(27, 8), S(24614, 29), S(539, 0), S(24614, 29), { FIELDS + 231, 1 }, {}, {}, { FIELD_TYPES + 280, 1 }, },	// RimWorld.PawnExpectationsQualityOffset
+		{ S(24654, 25), S(27, 8), S(24679, 16), S(53, 9), S(24679, 16), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.PawnGroupKindDef
+		{ S(7983, 24), S(27, 8), S(24695, 15), S(53, 9), S(24695, 15), { FIELDS + 232, 4 }, {}, { FIELD_TYPES + 281, 1 }, { FIELD_TYPES + 282, 6 }, },	// RimWorld.PawnRelationDef
+		{ S(24821, 21), S(27, 8), S(24842, 12), S(53, 9), S(24842, 12), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 288, 1 }, {}, },	// RimWorld.PawnTableDef
+		{ S(24861, 28), S(27, 8), S(24889, 19), S(53, 9), S(24889, 19), { FIELDS + 236, 6 }, {}, {}, {}, },	// RimWorld.PawnsArrivalModeDef
+		{ S(24943, 27), S(27, 8), S(24970, 18), S(53, 9), S(24970, 18), { FIELDS + 242, 6 }, {}, {}, {}, },	// RimWorld.PitGateIncidentDef
+		{ S(25009, 20), S(27, 8), S(25029, 11), S(539, 0), S(25029, 11), { FIELDS + 220, 1 }, {}, {}, { FIELD_TYPES + 289, 1 }, },	// RimWorld.PreceptComp
+		{ S(25050, 28), S(27, 8), S(25078, 19), S(25009, 20), S(25078, 19), { FIELDS + 220, 1 }, {}, {}, { FIELD_TYPES + 289, 1 }, },	// RimWorld.PreceptComp_Apparel
+		{ S(25097, 36), S(27, 8), S(25133, 27), S(25050, 28), S(25133, 27), { FIELDS + 220, 1 }, {}, {}, { FIELD_TYPES + 289, 1 }, },	// RimWorld.PreceptComp_Apparel_Desired
+		{ S(25160, 42), S(27, 8), S(25202, 33), S(25050, 28), S(25202, 33), { FIELDS + 220, 1 }, {}, {}, { FIELD_TYPES + 289, 1 }, },	// RimWorld.PreceptComp_Apparel_DesiredStrong
+		{ S(25235, 31), S(27, 8), S(25266, 22), S(25288, 28), S(25266, 22), { FIELDS + 220, 1 }, { FIELDS + 248, 1 }, {}, { FIELD_TYPES + 290, 2 }, },	// RimWorld.PreceptComp_BedThought
+		{ S(25340, 38), S(27, 8), S(25378, 29), S(25009, 20), S(25378, 29), { FIELDS + 249, 2 }, {}, {}, { FIELD_TYPES + 292, 2 }, },	// RimWorld.PreceptComp_DevelopmentPoints
+		{ S(25425, 38), S(27, 8), S(25463, 29), S(25009, 20), S(25463, 29), { FIELDS + 220, 1 }, {}, {}, { FIELD_TYPES + 294, 2 }, },	// RimWorld.PreceptComp_GoodwillSituation
+		{ S(25509, 39), S(27, 8), S(25548, 30), S(25288, 28), S(25548, 30), { FIELDS + 220, 1 }, { FIELDS + 248, 1 }, {}, { FIELD_TYPES + 296, 4 }, },	// RimWorld.PreceptComp_KnowsMemoryThought
+		{ S(25592, 32), S(27, 8), S(25624, 23), S(25009, 20), S(25624, 23), { FIELDS + 220, 1 }, {}, {}, { FIELD_TYPES + 300, 2 }, },	// RimWorld.PreceptComp_MentalBreak
+		{ S(25681, 42), S(27, 8), S(25723, 33), S(25288, 28), S(25723, 33), { FIELDS + 220, 1 }, { FIELDS + 248, 1 }, {}, { FIELD_TYPES + 302, 3 }, },	// RimWorld.PreceptComp_SelfTookMemoryThought
+		{ S(25756, 39), S(27, 8), S(25795, 30), S(25288, 28), S(25795, 30), { FIELDS + 220, 1 }, { FIELDS + 248, 1 }, {}, { FIELD_TYPES + 290, 2 }, },	// RimWorld.PreceptComp_SituationalThought
+		{ S(25288, 28), S(27, 8), S(25825, 19), S(25009, 20), S(25825, 19), { FIELDS + 220, 1 }, { FIELDS + 248, 1 }, {}, { FIELD_TYPES + 290, 2 }, },	// RimWorld.PreceptComp_Thought
+		{ S(25844, 34), S(27, 8), S(25878, 25), S(25009, 20), S(25878, 25), { FIELDS + 220, 1 }, {}, { FIELD_TYPES + 305, 1 }, { FIELD_TYPES + 292, 2 }, },	// RimWorld.PreceptComp_UnwillingToDo
+		{ S(25920, 41), S(27, 8), S(25961, 32), S(25844, 34), S(25961, 32), { FIELDS + 220, 1 }, {}, { FIELD_TYPES + 305, 1 }, { FIELD_TYPES + 292, 2 }, },	// RimWorld.PreceptComp_UnwillingToDo_Chance
+		{ S(25993, 43), S(27, 8), S(26036, 34), S(25844, 34), S(26036, 34), { FIELDS + 220, 1 }, {}, { FIELD_TYPES + 305, 1 }, { FIELD_TYPES + 292, 2 }, },	// RimWorld.PreceptComp_UnwillingToDo_Gendered
+		{ S(26070, 42), S(27, 8), S(26112, 33), S(25844, 34), S(26112, 33), { FIELDS + 220, 1 }, {}, { FIELD_TYPES + 305, 1 }, { FIELD_TYPES + 306, 3 }, },	// RimWorld.PreceptComp_UnwillingToDo_WithDef
+		{ S(7770, 19), S(27, 8), S(26156, 10), S(53, 9), S(26156, 10), { FIELDS + 251, 5 }, {}, { FIELD_TYPES + 309, 8 }, { FIELD_TYPES + 317, 10 }, },	// RimWorld.PreceptDef
+		{ S(26478, 35), S(27, 8), S(26513, 26), S(53, 9), S(26513, 26), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.PrisonerInteractionModeDef
+		{ S(26539, 25), S(27, 8), S(26564, 16), S(53, 9), S(26564, 16), { FIELDS + 256, 6 }, {}, { FIELD_TYPES + 327, 1 }, { FIELD_TYPES + 328, 1 }, },	// RimWorld.PsychicRitualDef
+		{ S(26705, 35), S(27, 8), S(26740, 26), S(26766, 42), S(26740, 26), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_BloodRain
+		{ S(26870, 35), S(27, 8), S(26905, 26), S(26766, 42), S(26905, 26), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_Brainwipe
+		{ S(26931, 37), S(27, 8), S(26968, 28), S(26766, 42), S(26968, 28), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_Chronophagy
+		{ S(26996, 43), S(27, 8), S(27039, 34), S(26766, 42), S(27039, 34), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_ImbueDeathRefusal
+		{ S(26766, 42), S(27, 8), S(27073, 33), S(26539, 25), S(27073, 33), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_InvocationCircle
+		{ S(27106, 39), S(27, 8), S(27145, 30), S(26766, 42), S(27145, 30), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_NeurosisPulse
+		{ S(27175, 36), S(27, 8), S(27211, 27), S(26766, 42), S(27211, 27), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_Philophagy
+		{ S(27238, 39), S(27, 8), S(27277, 30), S(26766, 42), S(27277, 30), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_PleasurePulse
+		{ S(27307, 37), S(27, 8), S(27344, 28), S(26766, 42), S(27344, 28), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_Psychophagy
+		{ S(27372, 39), S(27, 8), S(27411, 30), S(26766, 42), S(27411, 30), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_SkipAbduction
+		{ S(27441, 45), S(27, 8), S(27486, 36), S(26766, 42), S(27486, 36), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_SkipAbductionPlayer
+		{ S(27522, 39), S(27, 8), S(27561, 30), S(26766, 42), S(27561, 30), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_SummonAnimals
+		{ S(27591, 43), S(27, 8), S(27634, 34), S(26766, 42), S(27634, 34), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_SummonFleshbeasts
+		{ S(27668, 49), S(27, 8), S(27717, 40), S(26766, 42), S(27717, 40), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_SummonFleshbeastsPlayer
+		{ S(27757, 39), S(27, 8), S(27796, 30), S(26766, 42), S(27796, 30), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_SummonPitGate
+		{ S(27826, 41), S(27, 8), S(27867, 32), S(26766, 42), S(27867, 32), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_SummonShamblers
+		{ S(27899, 41), S(27, 8), S(27940, 32), S(26766, 42), S(27940, 32), { FIELDS + 262, 7 }, {}, {}, { FIELD_TYPES + 329, 5 }, },	// RimWorld.PsychicRitualDef_VoidProvocation
+		{ S(26656, 29), S(27, 8), S(27972, 20), S(53, 9), S(27972, 20), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.PsychicRitualRoleDef
+		{ S(27992, 48), S(27, 8), S(28040, 39), S(26656, 29), S(28040, 39), { FIELDS + 269, 4 }, {}, {}, {}, },	// RimWorld.PsychicRitualRoleDef_DeathRefusalTarget
+		{ S(1264, 23), S(27, 8), S(28119, 14), S(53, 9), S(28119, 14), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 334, 8 }, },	// RimWorld.QuestScriptDef
+		{ S(7818, 30), S(27, 8), S(28292, 21), S(53, 9), S(28292, 21), { FIELDS + 273, 4 }, {}, {}, {}, },	// RimWorld.RaidAgeRestrictionDef
+		{ S(7872, 24), S(27, 8), S(28329, 15), S(53, 9), S(28329, 15), { FIELDS + 277, 7 }, {}, { FIELD_TYPES + 342, 1 }, {}, },	// RimWorld.RaidStrategyDef
+		{ S(28425, 18), S(27, 8), S(28443, 9), S(53, 9), S(28443, 9), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 343, 1 }, {}, },	// RimWorld.RecordDef
+		{ S(28468, 26), S(27, 8), S(28494, 17), S(53, 9), S(28494, 17), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.RenderSkipFlagDef
+		{ S(28511, 23), S(27, 8), S(28534, 14), S(53, 9), S(28534, 14), { FIELDS + 284, 5 }, {}, {}, {}, },	// RimWorld.ResearchTabDef
+		{ S(28578, 41), S(27, 8), S(28619, 32), S(53, 9), S(28619, 32), { FIELDS + 289, 5 }, {}, { FIELD_TYPES + 344, 3 }, { FIELD_TYPES + 347, 1 }, },	// RimWorld.RitualAttachableOutcomeEffectDef
+		{ S(28736, 26), S(27, 8), S(28762, 17), S(53, 9), S(28762, 17), { FIELDS + 294, 7 }, {}, { FIELD_TYPES + 348, 2 }, { FIELD_TYPES + 350, 1 }, },	// RimWorld.RitualBehaviorDef
+		{ S(28903, 40), S(27, 8), S(28943, 31), S(53, 9), S(28943, 31), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 351, 1 }, {}, },	// RimWorld.RitualObligationTargetFilterDef
+		{ S(28974, 26), S(27, 8), S(29000, 17), S(539, 0), S(29000, 17), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp
+		{ S(29030, 46), S(27, 8), S(29076, 37), S(29113, 43), S(29076, 37), { FIELDS + 303, 3 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_AtLeastOneSpectator
+		{ S(29167, 50), S(27, 8), S(29217, 41), S(29258, 43), S(29217, 41), { FIELDS + 301, 2 }, {}, { FIELD_TYPES + 352, 1 }, {}, },	// RimWorld.RitualOutcomeComp_BuildingOfAnyDefPresent
+		{ S(29305, 47), S(27, 8), S(29352, 38), S(29258, 43), S(29352, 38), { FIELDS + 301, 2 }, {}, {}, { FIELD_TYPES + 215, 1 }, },	// RimWorld.RitualOutcomeComp_BuildingOfDefPresent
+		{ S(29390, 44), S(27, 8), S(29434, 35), S(29469, 46), S(29434, 35), { FIELDS + 301, 2 }, {}, {}, { FIELD_TYPES + 215, 1 }, },	// RimWorld.RitualOutcomeComp_BuildingOfDefUsed
+		{ S(29258, 43), S(27, 8), S(29515, 34), S(29469, 46), S(29515, 34), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_BuildingsPresent
+		{ S(29549, 52), S(27, 8), S(29601, 43), S(28974, 26), S(29601, 43), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_DestroyConsumableBuilding
+		{ S(29644, 38), S(27, 8), S(29682, 29), S(29469, 46), S(29682, 29), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_DuelistDied
+		{ S(29711, 34), S(27, 8), S(29745, 25), S(29469, 46), S(29745, 25), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_Indoors
+		{ S(29770, 42), S(27, 8), S(29812, 33), S(29845, 34), S(29812, 33), { FIELDS + 303, 3 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_LovedOnePresent
+		{ S(29879, 48), S(27, 8), S(29927, 39), S(29845, 34), S(29927, 39), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_NumActiveLoudspeakers
+		{ S(29966, 49), S(27, 8), S(30015, 40), S(29845, 34), S(30015, 40), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_NumParticipantsWithTag
+		{ S(30055, 41), S(27, 8), S(30096, 32), S(29845, 34), S(30096, 32), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_NumPlayedDrums
+		{ S(29113, 43), S(27, 8), S(30128, 34), S(29845, 34), S(30128, 34), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_ParticipantCount
+		{ S(30162, 34), S(27, 8), S(30196, 25), S(29469, 46), S(30196, 25), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_PawnAge
+		{ S(30221, 43), S(27, 8), S(30264, 34), S(29469, 46), S(30264, 34), { FIELDS + 301, 2 }, {}, { FIELD_TYPES + 353, 1 }, { FIELD_TYPES + 354, 1 }, },	// RimWorld.RitualOutcomeComp_PawnExpectations
+		{ S(30340, 36), S(27, 8), S(30376, 27), S(29845, 34), S(30376, 27), { FIELDS + 301, 2 }, {}, {}, { FIELD_TYPES + 355, 1 }, },	// RimWorld.RitualOutcomeComp_PawnSkill
+		{ S(30411, 41), S(27, 8), S(30452, 32), S(29469, 46), S(30452, 32), { FIELDS + 301, 2 }, {}, {}, { FIELD_TYPES + 356, 1 }, },	// RimWorld.RitualOutcomeComp_PawnStatScaled
+		{ S(29845, 34), S(27, 8), S(30491, 25), S(28974, 26), S(30491, 25), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_Quality
+		{ S(29469, 46), S(27, 8), S(30516, 37), S(29845, 34), S(30516, 37), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_QualitySingleOffset
+		{ S(30553, 44), S(27, 8), S(30597, 35), S(29258, 43), S(30597, 35), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_RitualSeatPresent
+		{ S(30632, 43), S(27, 8), S(30675, 34), S(29469, 46), S(30675, 34), { FIELDS + 306, 3 }, {}, { FIELD_TYPES + 352, 1 }, {}, },	// RimWorld.RitualOutcomeComp_RitualTargetDefs
+		{ S(30730, 49), S(27, 8), S(30779, 40), S(29113, 43), S(30779, 40), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_RoleChangeParticipants
+		{ S(30819, 52), S(27, 8), S(30871, 43), S(29469, 46), S(30871, 43), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_RolePresentNotSubstituted
+		{ S(30914, 35), S(27, 8), S(30949, 26), S(29845, 34), S(30949, 26), { FIELDS + 301, 2 }, {}, {}, { FIELD_TYPES + 357, 1 }, },	// RimWorld.RitualOutcomeComp_RoomStat
+		{ S(30992, 42), S(27, 8), S(31034, 33), S(29845, 34), S(31034, 33), { FIELDS + 301, 2 }, {}, {}, { FIELD_TYPES + 356, 1 }, },	// RimWorld.RitualOutcomeComp_TargetThingStat
+		{ S(31067, 37), S(27, 8), S(31104, 28), S(29469, 46), S(31104, 28), { FIELDS + 301, 2 }, {}, {}, {}, },	// RimWorld.RitualOutcomeComp_WeaponUsed
+		{ S(31132, 31), S(27, 8), S(31163, 22), S(53, 9), S(31163, 22), { FIELDS + 0, 3 }, { FIELDS + 309, 2 }, { FIELD_TYPES + 358, 3 }, { FIELD_TYPES + 361, 6 }, },	// RimWorld.RitualOutcomeEffectDef
+		{ S(31256, 61), S(27, 8), S(31439, 29), S(539, 0), S(31468, 38), { FIELDS + 220, 1 }, {}, {}, {}, },	// RimWorld.RitualOutcomeEffectDef+ExtraOutcomeChanceDescription
+		{ S(31331, 33), S(27, 8), S(31506, 24), S(539, 0), S(31506, 24), { FIELDS + 311, 3 }, {}, {}, { FIELD_TYPES + 367, 1 }, },	// RimWorld.RitualOutcomePossibility
+		{ S(23310, 25), S(27, 8), S(31561, 16), S(53, 9), S(31561, 16), { FIELDS + 314, 9 }, {}, {}, { FIELD_TYPES + 368, 5 }, },	// RimWorld.RitualPatternDef
+		{ S(28814, 19), S(27, 8), S(31798, 10), S(539, 0), S(31798, 10), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRole
+		{ S(31886, 30), S(27, 8), S(31916, 21), S(28814, 19), S(31916, 21), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRoleAnimaLinker
+		{ S(31937, 25), S(27, 8), S(31962, 16), S(28814, 19), S(31962, 16), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRoleAnimal
+		{ S(31978, 27), S(27, 8), S(32005, 18), S(539, 0), S(32005, 18), { FIELDS + 328, 1 }, {}, {}, { FIELD_TYPES + 374, 2 }, },	// RimWorld.RitualRoleBehavior
+		{ S(32065, 33), S(27, 8), S(32098, 24), S(28814, 19), S(32098, 24), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRoleBlindingTarget
+		{ S(32122, 27), S(27, 8), S(32149, 18), S(28814, 19), S(32149, 18), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 376, 3 }, },	// RimWorld.RitualRoleColonist
+		{ S(32192, 38), S(27, 8), S(32230, 29), S(32122, 27), S(32230, 29), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 376, 3 }, },	// RimWorld.RitualRoleColonistConnectable
+		{ S(32259, 28), S(27, 8), S(32287, 19), S(28814, 19), S(32287, 19), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRoleConvertee
+		{ S(32306, 25), S(27, 8), S(32331, 16), S(28814, 19), S(32331, 16), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRoleForced
+		{ S(32347, 34), S(27, 8), S(32381, 25), S(28814, 19), S(32381, 25), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRoleIdeoRoleChanger
+		{ S(32406, 28), S(27, 8), S(32434, 19), S(28814, 19), S(32434, 19), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRoleOrganizer
+		{ S(32453, 27), S(27, 8), S(32480, 18), S(28814, 19), S(32480, 18), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRolePrisoner
+		{ S(32498, 34), S(27, 8), S(32532, 25), S(28814, 19), S(32532, 25), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRolePrisonerOrSlave
+		{ S(32557, 38), S(27, 8), S(32595, 29), S(28814, 19), S(32595, 29), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRoleScarificationTarget
+		{ S(32624, 22), S(27, 8), S(32646, 13), S(28814, 19), S(32646, 13), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRoleTag
+		{ S(32659, 25), S(27, 8), S(32684, 16), S(28814, 19), S(32684, 16), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRoleWarden
+		{ S(32700, 26), S(27, 8), S(32726, 17), S(32306, 25), S(32726, 17), { FIELDS + 323, 5 }, {}, {}, { FIELD_TYPES + 373, 1 }, },	// RimWorld.RitualRole_Mother
+		{ S(28873, 30), S(27, 8), S(32743, 21), S(539, 0), S(32743, 21), { FIELDS + 220, 1 }, {}, {}, {}, },	// RimWorld.RitualSpectatorFilter
+		{ S(32764, 42), S(27, 8), S(32806, 33), S(28873, 30), S(32806, 33), { FIELDS + 220, 1 }, {}, {}, {}, },	// RimWorld.RitualSpectatorFilter_NatureFocus
+		{ S(32839, 51), S(27, 8), S(32890, 42), S(28873, 30), S(32890, 42), { FIELDS + 220, 1 }, {}, {}, {}, },	// RimWorld.RitualSpectatorFilter_WillWitnessExecution
+		{ S(32932, 34), S(27, 8), S(32966, 25), S(32991, 26), S(32966, 25), { FIELDS + 329, 1 }, {}, {}, { FIELD_TYPES + 379, 1 }, },	// RimWorld.RitualStageAction_Message
+		{ S(31768, 30), S(27, 8), S(33031, 21), S(53, 9), S(33031, 21), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.RitualTargetFilterDef
+		{ S(33052, 30), S(27, 8), S(33082, 21), S(53, 9), S(33082, 21), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.RitualVisualEffectDef
+		{ S(33103, 17), S(27, 8), S(33120, 8), S(53, 9), S(33120, 8), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 380, 1 }, },	// RimWorld.RiverDef
+		{ S(33140, 16), S(27, 8), S(33156, 7), S(53, 9), S(33156, 7), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 381, 1 }, },	// RimWorld.RoadDef
+		{ S(33174, 23), S(27, 8), S(33197, 14), S(53, 9), S(33197, 14), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.RoadPathingDef
+		{ S(33211, 26), S(27, 8), S(33237, 17), S(53, 9), S(33237, 17), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.RoadWorldLayerDef
+		{ S(26308, 19), S(27, 8), S(33254, 10), S(539, 0), S(33254, 10), { FIELDS + 330, 1 }, {}, {}, {}, },	// RimWorld.RoleEffect
+		{ S(33264, 37), S(27, 8), S(33301, 28), S(26308, 19), S(33301, 28), { FIELDS + 330, 1 }, {}, {}, { FIELD_TYPES + 382, 1 }, },	// RimWorld.RoleEffect_GiveThoughtOnTend
+		{ S(33339, 46), S(27, 8), S(33385, 37), S(26308, 19), S(33385, 37), { FIELDS + 330, 1 }, {}, {}, {}, },	// RimWorld.RoleEffect_HuntingRevengeChanceFactor
+		{ S(33422, 34), S(27, 8), S(33456, 25), S(26308, 19), S(33456, 25), { FIELDS + 330, 1 }, {}, {}, {}, },	// RimWorld.RoleEffect_NoMeleeWeapons
+		{ S(33481, 35), S(27, 8), S(33516, 26), S(26308, 19), S(33516, 26), { FIELDS + 330, 1 }, {}, {}, {}, },	// RimWorld.RoleEffect_NoRangedWeapons
+		{ S(33542, 34), S(27, 8), S(33576, 25), S(33601, 36), S(33576, 25), { FIELDS + 330, 1 }, {}, {}, { FIELD_TYPES + 356, 1 }, },	// RimWorld.RoleEffect_PawnStatFactor
+		{ S(33601, 36), S(27, 8), S(33637, 27), S(26308, 19), S(33637, 27), { FIELDS + 330, 1 }, {}, {}, { FIELD_TYPES + 356, 1 }, },	// RimWorld.RoleEffect_PawnStatModifier
+		{ S(33664, 34), S(27, 8), S(33698, 25), S(33601, 36), S(33698, 25), { FIELDS + 330, 1 }, {}, {}, { FIELD_TYPES + 356, 1 }, },	// RimWorld.RoleEffect_PawnStatOffset
+		{ S(33723, 43), S(27, 8), S(33766, 34), S(26308, 19), S(33766, 34), { FIELDS + 330, 1 }, {}, {}, {}, },	// RimWorld.RoleEffect_ProductionQualityOffset
+		{ S(8047, 22), S(27, 8), S(33800, 13), S(53, 9), S(33800, 13), { FIELDS + 232, 4 }, {}, { FIELD_TYPES + 383, 6 }, { FIELD_TYPES + 389, 4 }, },	// RimWorld.RoyalTitleDef
+		{ S(33836, 28), S(27, 8), S(33972, 19), S(53, 9), S(33972, 19), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 393, 3 }, },	// RimWorld.RoyalTitlePermitDef
+		{ S(34011, 16), S(27, 8), S(34027, 7), S(53, 9), S(34027, 7), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.RuleDef
+		{ S(34034, 20), S(27, 8), S(34054, 11), S(53, 9), S(34054, 11), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 396, 2 }, },	// RimWorld.ScenPartDef
+		{ S(34072, 59), S(27, 8), S(34131, 50), S(34181, 55), S(34131, 50), { FIELDS + 331, 1 }, {}, { FIELD_TYPES + 398, 1 }, { FIELD_TYPES + 399, 1 }, },	// RimWorld.ScenPart_ConfigPage_ConfigureStartingPawns_Mutants
+		{ S(34261, 61), S(27, 8), S(34322, 52), S(34181, 55), S(34322, 52), { FIELDS + 331, 1 }, {}, { FIELD_TYPES + 400, 1 }, { FIELD_TYPES + 399, 1 }, },	// RimWorld.ScenPart_ConfigPage_ConfigureStartingPawns_Xenotypes
+		{ S(34410, 17), S(27, 8), S(34427, 8), S(539, 0), S(34427, 8), { FIELDS + 332, 3 }, {}, {}, {}, },	// RimWorld.Scenario
+		{ S(34446, 20), S(27, 8), S(34466, 11), S(53, 9), S(34466, 11), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 401, 1 }, },	// RimWorld.ScenarioDef
+		{ S(34485, 19), S(27, 8), S(34504, 10), S(53, 9), S(34504, 10), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.ShipJobDef
+		{ S(34514, 20), S(27, 8), S(34534, 11), S(53, 9), S(34534, 11), { FIELDS + 335, 7 }, {}, { FIELD_TYPES + 402, 2 }, { FIELD_TYPES + 404, 2 }, },	// RimWorld.SitePartDef
+		{ S(22789, 26), S(27, 8), S(34698, 17), S(53, 9), S(34698, 17), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.SketchResolverDef
+		{ S(10377, 17), S(27, 8), S(34715, 8), S(53, 9), S(34715, 8), { FIELDS + 342, 4 }, {}, {}, { FIELD_TYPES + 406, 2 }, },	// RimWorld.SkillDef
+		{ S(34750, 32), S(27, 8), S(34782, 23), S(53, 9), S(34782, 23), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.SlaveInteractionModeDef
+		{ S(34805, 25), S(27, 8), S(34830, 16), S(539, 0), S(34830, 16), { FIELDS + 346, 1 }, {}, {}, {}, },	// RimWorld.StageFailTrigger
+		{ S(34850, 47), S(27, 8), S(34897, 38), S(34805, 25), S(34897, 38), { FIELDS + 346, 1 }, {}, {}, { FIELD_TYPES + 408, 1 }, },	// RimWorld.StageFailTrigger_NoPoweredLoudspeakers
+		{ S(34954, 40), S(27, 8), S(34994, 31), S(34805, 25), S(34994, 31), { FIELDS + 346, 1 }, {}, {}, { FIELD_TYPES + 409, 2 }, },	// RimWorld.StageFailTrigger_NoThingPresent
+		{ S(35025, 35), S(27, 8), S(35060, 26), S(34805, 25), S(35060, 26), { FIELDS + 346, 1 }, {}, {}, {}, },	// RimWorld.StageFailTrigger_PawnAlive
+		{ S(35086, 36), S(27, 8), S(35122, 27), S(34805, 25), S(35122, 27), { FIELDS + 346, 1 }, {}, {}, {}, },	// RimWorld.StageFailTrigger_PawnAsleep
+		{ S(35149, 38), S(27, 8), S(35187, 29), S(34805, 25), S(35187, 29), { FIELDS + 346, 1 }, {}, {}, { FIELD_TYPES + 408, 1 }, },	// RimWorld.StageFailTrigger_TargetNotLit
+		{ S(35216, 47), S(27, 8), S(35263, 38), S(34805, 25), S(35263, 38), { FIELDS + 346, 1 }, {}, {}, {}, },	// RimWorld.StageFailTrigger_TargetPawnUnreachable
+		{ S(35301, 44), S(27, 8), S(35345, 35), S(34805, 25), S(35345, 35), { FIELDS + 346, 1 }, {}, {}, { FIELD_TYPES + 408, 1 }, },	// RimWorld.StageFailTrigger_TargetThingMissing
+		{ S(35380, 41), S(27, 8), S(35421, 32), S(34805, 25), S(35421, 32), { FIELDS + 346, 1 }, {}, {}, { FIELD_TYPES + 408, 1 }, },	// RimWorld.StageFailTrigger_TargetUnpowered
+		{ S(6113, 24), S(27, 8), S(35453, 15), S(53, 9), S(35453, 15), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.StatCategoryDef
+		{ S(2354, 16), S(27, 8), S(35468, 7), S(53, 9), S(35468, 7), { FIELDS + 347, 7 }, {}, { FIELD_TYPES + 411, 4 }, { FIELD_TYPES + 415, 2 }, },	// RimWorld.StatDef
+		{ S(35638, 36), S(27, 8), S(35674, 27), S(35701, 17), S(35674, 27), { FIELDS + 330, 1 }, {}, {}, { FIELD_TYPES + 417, 2 }, },	// RimWorld.StatPart_OverseerStatOffset
+		{ S(35728, 26), S(27, 8), S(35754, 17), S(35701, 17), S(35754, 17), { FIELDS + 354, 1 }, {}, {}, { FIELD_TYPES + 419, 2 }, },	// RimWorld.StatPart_RoomStat
+		{ S(35790, 23), S(27, 8), S(35813, 14), S(53, 9), S(35813, 14), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 421, 1 }, },	// RimWorld.StorytellerDef
+		{ S(35843, 18), S(27, 8), S(35861, 9), S(539, 0), S(35861, 9), { FIELDS + 355, 2 }, {}, {}, {}, },	// RimWorld.StudyNote
+		{ S(35870, 25), S(27, 8), S(35895, 16), S(53, 9), S(35895, 16), { FIELDS + 357, 4 }, {}, {}, { FIELD_TYPES + 422, 3 }, },	// RimWorld.StuffCategoryDef
+		{ S(35967, 29), S(27, 8), S(35996, 20), S(53, 9), S(35996, 20), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 425, 1 }, {}, },	// RimWorld.StyleItemCategoryDef
+		{ S(862, 21), S(27, 8), S(36032, 12), S(53, 9), S(36032, 12), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 426, 4 }, },	// RimWorld.StyleItemDef
+		{ S(36044, 23), S(27, 8), S(36067, 14), S(539, 0), S(36067, 14), { FIELDS + 80, 2 }, {}, {}, {}, },	// RimWorld.SurgeryOutcome
+		{ S(36081, 32), S(27, 8), S(36113, 23), S(53, 9), S(36113, 23), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 430, 1 }, {}, },	// RimWorld.SurgeryOutcomeEffectDef
+		{ S(36144, 30), S(27, 8), S(36174, 21), S(36044, 23), S(36174, 21), { FIELDS + 80, 2 }, {}, {}, {}, },	// RimWorld.SurgeryOutcomeSuccess
+		{ S(36195, 29), S(27, 8), S(36224, 20), S(36044, 23), S(36224, 20), { FIELDS + 80, 2 }, {}, {}, {}, },	// RimWorld.SurgeryOutcome_Death
+		{ S(36244, 31), S(27, 8), S(36275, 22), S(36044, 23), S(36275, 22), { FIELDS + 80, 2 }, {}, {}, {}, },	// RimWorld.SurgeryOutcome_Failure
+		{ S(36297, 41), S(27, 8), S(36338, 32), S(36244, 31), S(36338, 32), { FIELDS + 80, 2 }, {}, { FIELD_TYPES + 431, 1 }, { FIELD_TYPES + 432, 1 }, },	// RimWorld.SurgeryOutcome_FailureWithHediff
+		{ S(36396, 42), S(27, 8), S(36438, 33), S(36044, 23), S(36438, 33), { FIELDS + 80, 2 }, {}, {}, { FIELD_TYPES + 433, 1 }, },	// RimWorld.SurgeryOutcome_HediffWithDuration
+		{ S(9616, 16), S(27, 8), S(36471, 7), S(53, 9), S(36471, 7), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 434, 1 }, },	// RimWorld.TaleDef
+		{ S(36486, 18), S(27, 8), S(36504, 9), S(862, 21), S(36504, 9), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 20, 3 }, },	// RimWorld.TattooDef
+		{ S(36513, 27), S(27, 8), S(36540, 18), S(53, 9), S(36540, 18), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 435, 1 }, { FIELD_TYPES + 436, 3 }, },	// RimWorld.TerrainTemplateDef
+		{ S(6857, 25), S(27, 8), S(36627, 16), S(53, 9), S(36627, 16), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.ThingSetMakerDef
+		{ S(1573, 19), S(27, 8), S(36643, 10), S(53, 9), S(36643, 10), { FIELDS + 361, 4 }, {}, { FIELD_TYPES + 439, 11 }, { FIELD_TYPES + 450, 11 }, },	// RimWorld.ThoughtDef
+		{ S(36833, 21), S(27, 8), S(37001, 12), S(539, 0), S(37001, 12), { FIELDS + 365, 4 }, {}, {}, {}, },	// RimWorld.ThoughtStage
+		{ S(37024, 26), S(27, 8), S(37050, 17), S(53, 9), S(37050, 17), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.TimeAssignmentDef
+		{ S(7697, 22), S(27, 8), S(37067, 13), S(53, 9), S(37067, 13), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 461, 2 }, },	// RimWorld.TraderKindDef
+		{ S(24547, 21), S(27, 8), S(37104, 12), S(53, 9), S(37104, 12), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 463, 1 }, { FIELD_TYPES + 464, 1 }, },	// RimWorld.TrainableDef
+		{ S(36704, 17), S(27, 8), S(37170, 8), S(53, 9), S(37170, 8), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 465, 6 }, { FIELD_TYPES + 471, 1 }, },	// RimWorld.TraitDef
+		{ S(37225, 24), S(27, 8), S(37324, 15), S(539, 0), S(37324, 15), { FIELDS + 369, 4 }, {}, { FIELD_TYPES + 472, 13 }, { FIELD_TYPES + 485, 3 }, },	// RimWorld.TraitDegreeData
+		{ S(37637, 30), S(27, 8), S(37667, 21), S(53, 9), S(37667, 21), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.TransferableSorterDef
+		{ S(37688, 25), S(27, 8), S(37713, 16), S(53, 9), S(37713, 16), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 488, 4 }, },	// RimWorld.TransportShipDef
+		{ S(37805, 23), S(27, 8), S(37828, 14), S(53, 9), S(37828, 14), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 492, 2 }, { FIELD_TYPES + 494, 2 }, },	// RimWorld.WeaponTraitDef
+		{ S(37894, 21), S(27, 8), S(37915, 12), S(53, 9), S(37915, 12), { FIELDS + 373, 5 }, {}, { FIELD_TYPES + 496, 2 }, { FIELD_TYPES + 498, 5 }, },	// RimWorld.WorkGiverDef
+		{ S(37971, 37), S(27, 8), S(38037, 28), S(53, 9), S(38037, 28), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.WorkGiverEquivalenceGroupDef
+		{ S(37782, 23), S(27, 8), S(38065, 14), S(53, 9), S(38065, 14), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 503, 1 }, { FIELD_TYPES + 504, 1 }, },	// RimWorld.WorldObjectDef
+		{ S(34388, 22), S(27, 8), S(38130, 13), S(24054, 26), S(38130, 13), { FIELDS + 220, 1 }, {}, {}, { FIELD_TYPES + 505, 1 }, },	// RimWorld.XenotypeCount
+		{ S(38151, 20), S(27, 8), S(38171, 11), S(53, 9), S(38171, 11), { FIELDS + 378, 4 }, {}, { FIELD_TYPES + 506, 2 }, { FIELD_TYPES + 508, 3 }, },	// RimWorld.XenotypeDef
+		{ S(38271, 24), S(27, 8), S(38295, 15), S(53, 9), S(38295, 15), { FIELDS + 0, 3 }, {}, {}, {}, },	// RimWorld.XenotypeIconDef
+		{ S(8675, 16), S(38310, 8), S(38318, 7), S(53, 9), S(38318, 7), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.AI.DutyDef
+		{ S(38325, 12), S(38310, 8), S(38337, 3), S(539, 0), S(38337, 3), { FIELDS + 192, 2 }, {}, {}, { FIELD_TYPES + 511, 8 }, },	// Verse.AI.Job
+		{ S(38440, 25), S(38310, 8), S(38465, 16), S(11090, 27), S(38465, 16), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_Carried
+		{ S(38481, 25), S(38310, 8), S(38506, 16), S(11090, 27), S(38506, 16), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_ExitMap
+		{ S(38522, 29), S(38310, 8), S(38551, 20), S(38481, 25), S(38551, 20), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_ExitMapBest
+		{ S(38571, 39), S(38310, 8), S(38610, 30), S(38522, 29), S(38610, 30), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_ExitMapFollowOverseer
+		{ S(38640, 39), S(38310, 8), S(38679, 30), S(38481, 25), S(38679, 30), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_ExitMapNearDutyTarget
+		{ S(38709, 30), S(38310, 8), S(38739, 21), S(38522, 29), S(38739, 21), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_ExitMapPanic
+		{ S(38760, 31), S(38310, 8), S(38791, 22), S(38481, 25), S(38791, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_ExitMapRandom
+		{ S(38813, 45), S(38310, 8), S(38858, 36), S(11090, 27), S(38858, 36), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_FightFiresNearConnectedTree
+		{ S(38894, 28), S(38310, 8), S(38922, 19), S(11090, 27), S(38922, 19), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_ForcedGoto
+		{ S(38941, 22), S(38310, 8), S(38963, 13), S(11090, 27), S(38963, 13), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_Idle
+		{ S(38976, 27), S(38310, 8), S(39003, 18), S(11090, 27), S(39003, 18), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_IdleError
+		{ S(39021, 29), S(38310, 8), S(39050, 20), S(11090, 27), S(39050, 20), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_IdleForever
+		{ S(39070, 36), S(38310, 8), S(39106, 27), S(11090, 27), S(39106, 27), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_IdleWhileDespawned
+		{ S(39133, 33), S(38310, 8), S(39166, 24), S(11090, 27), S(39166, 24), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_MoveToStandable
+		{ S(39190, 24), S(38310, 8), S(39214, 15), S(11090, 27), S(39214, 15), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_Orders
+		{ S(39229, 37), S(38310, 8), S(39266, 28), S(11090, 27), S(39266, 28), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_PickupDroppedWeapon
+		{ S(39294, 27), S(38310, 8), S(39321, 18), S(19558, 24), S(39321, 18), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_RunRandom
+		{ S(39339, 44), S(38310, 8), S(39383, 35), S(11090, 27), S(39383, 35), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_UseStylingStationAutomatic
+		{ S(19558, 24), S(38310, 8), S(39418, 15), S(11090, 27), S(39418, 15), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_Wander
+		{ S(39433, 32), S(38310, 8), S(39465, 23), S(19558, 24), S(39465, 23), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderAnywhere
+		{ S(39488, 35), S(38310, 8), S(39523, 26), S(19558, 24), S(39523, 26), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderCurrentRoom
+		{ S(39549, 28), S(38310, 8), S(39577, 19), S(19558, 24), S(39577, 19), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderHerd
+		{ S(39596, 29), S(38310, 8), S(39625, 20), S(19558, 24), S(39625, 20), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderInPen
+		{ S(39645, 42), S(38310, 8), S(39687, 33), S(19558, 24), S(39687, 33), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderInRoofedCellsInPen
+		{ S(39720, 31), S(38310, 8), S(39751, 22), S(19558, 24), S(39751, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderMapEdge
+		{ S(39773, 36), S(38310, 8), S(39809, 27), S(19558, 24), S(39809, 27), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderNearBreacher
+		{ S(39836, 41), S(38310, 8), S(39877, 32), S(19558, 24), S(39877, 32), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderNearConnectedTree
+		{ S(39909, 40), S(38310, 8), S(39949, 31), S(19558, 24), S(39949, 31), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderNearDutyLocation
+		{ S(39980, 44), S(38310, 8), S(40024, 35), S(19558, 24), S(40024, 35), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderNearFallbackLocation
+		{ S(40059, 34), S(38310, 8), S(40093, 25), S(19558, 24), S(40093, 25), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderNearMaster
+		{ S(40118, 39), S(38310, 8), S(40157, 30), S(19558, 24), S(40157, 30), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderNearRoamingExit
+		{ S(40187, 31), S(38310, 8), S(40218, 22), S(19558, 24), S(40218, 22), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderOwnRoom
+		{ S(40240, 29), S(38310, 8), S(40269, 20), S(19558, 24), S(40269, 20), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.JobGiver_WanderRoped
+		{ S(11090, 27), S(38310, 8), S(40289, 18), S(40307, 18), S(40289, 18), { FIELDS + 192, 2 }, {}, {}, {}, },	// Verse.AI.ThinkNode_JobGiver
+		{ S(24408, 18), S(40325, 5), S(40330, 12), S(53, 9), S(40330, 12), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.AnimationDef
+		{ S(40342, 21), S(40325, 5), S(40363, 15), S(53, 9), S(40363, 15), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.ApparelLayerDef
+		{ S(40378, 13), S(40325, 5), S(40391, 7), S(53, 9), S(40391, 7), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 519, 2 }, { FIELD_TYPES + 521, 1 }, },	// Verse.BodyDef
+		{ S(3181, 17), S(40325, 5), S(40472, 11), S(53, 9), S(40472, 11), { FIELDS + 382, 5 }, {}, { FIELD_TYPES + 522, 1 }, { FIELD_TYPES + 523, 1 }, },	// Verse.BodyPartDef
+		{ S(571, 22), S(40325, 5), S(40561, 16), S(53, 9), S(40561, 16), { FIELDS + 387, 4 }, {}, {}, {}, },	// Verse.BodyPartGroupDef
+		{ S(40412, 20), S(40325, 5), S(40577, 14), S(539, 0), S(40577, 14), { FIELDS + 354, 1 }, {}, { FIELD_TYPES + 524, 2 }, { FIELD_TYPES + 526, 3 }, },	// Verse.BodyPartRecord
+		{ S(40522, 20), S(40325, 5), S(40606, 14), S(53, 9), S(40606, 14), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.BodyPartTagDef
+		{ S(23190, 18), S(40325, 5), S(40620, 12), S(53, 9), S(40620, 12), { FIELDS + 391, 4 }, {}, { FIELD_TYPES + 529, 3 }, { FIELD_TYPES + 532, 10 }, },	// Verse.BuildableDef
+		{ S(1536, 15), S(40325, 5), S(40867, 9), S(53, 9), S(40867, 9), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.ClamorDef
+		{ S(40876, 30), S(40325, 5), S(40906, 24), S(40930, 24), S(40906, 24), { FIELDS + 395, 7 }, {}, {}, { FIELD_TYPES + 51, 1 }, },	// Verse.CreepJoinerAggressiveDef
+		{ S(40930, 24), S(40325, 5), S(40983, 18), S(53, 9), S(40983, 18), { FIELDS + 402, 4 }, {}, { FIELD_TYPES + 542, 2 }, {}, },	// Verse.CreepJoinerBaseDef
+		{ S(41017, 27), S(40325, 5), S(41044, 21), S(40930, 24), S(41044, 21), { FIELDS + 406, 5 }, {}, { FIELD_TYPES + 544, 2 }, {}, },	// Verse.CreepJoinerBenefitDef
+		{ S(41083, 28), S(40325, 5), S(41111, 22), S(40930, 24), S(41111, 22), { FIELDS + 411, 6 }, {}, { FIELD_TYPES + 544, 2 }, { FIELD_TYPES + 51, 1 }, },	// Verse.CreepJoinerDownsideDef
+		{ S(41133, 28), S(40325, 5), S(41161, 22), S(1188, 17), S(41161, 22), { FIELDS + 417, 10 }, {}, { FIELD_TYPES + 546, 14 }, { FIELD_TYPES + 560, 11 }, },	// Verse.CreepJoinerFormKindDef
+		{ S(41573, 29), S(40325, 5), S(41602, 23), S(40930, 24), S(41602, 23), { FIELDS + 411, 6 }, {}, {}, { FIELD_TYPES + 51, 1 }, },	// Verse.CreepJoinerRejectionDef
+		{ S(41625, 28), S(40325, 5), S(41653, 22), S(53, 9), S(41653, 22), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 571, 2 }, },	// Verse.DamageArmorCategoryDef
+		{ S(41698, 15), S(40325, 5), S(41713, 9), S(53, 9), S(41713, 9), { FIELDS + 427, 5 }, {}, {}, { FIELD_TYPES + 573, 18 }, },	// Verse.DamageDef
+		{ S(53, 9), S(40325, 5), S(42052, 3), S(42055, 14), S(42052, 3), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.Def
+		{ S(40734, 28), S(40325, 5), S(42069, 22), S(53, 9), S(42069, 22), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 435, 1 }, { FIELD_TYPES + 591, 1 }, },	// Verse.DesignationCategoryDef
+		{ S(42131, 20), S(40325, 5), S(42151, 14), S(53, 9), S(42151, 14), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.DesignationDef
+		{ S(23144, 32), S(40325, 5), S(42165, 26), S(53, 9), S(42165, 26), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.DesignatorDropdownGroupDef
+		{ S(42055, 14), S(40325, 5), S(42191, 8), S(539, 0), S(42191, 8), {}, {}, {}, {}, },	// Verse.Editable
+		{ S(333, 17), S(40325, 5), S(42199, 11), S(53, 9), S(42199, 11), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.EffecterDef
+		{ S(196, 14), S(40325, 5), S(42210, 8), S(53, 9), S(42210, 8), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 592, 1 }, },	// Verse.FleckDef
+		{ S(9843, 22), S(40325, 5), S(42227, 16), S(53, 9), S(42227, 16), { FIELDS + 432, 7 }, {}, { FIELD_TYPES + 593, 3 }, { FIELD_TYPES + 596, 2 }, },	// Verse.GameConditionDef
+		{ S(9937, 16), S(40325, 5), S(42353, 10), S(53, 9), S(42353, 10), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 598, 1 }, },	// Verse.GenStepDef
+		{ S(8845, 21), S(40325, 5), S(42375, 15), S(53, 9), S(42375, 15), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.GeneCategoryDef
+		{ S(935, 13), S(40325, 5), S(42390, 7), S(53, 9), S(42390, 7), { FIELDS + 439, 6 }, { FIELDS + 445, 1 }, { FIELD_TYPES + 599, 5 }, { FIELD_TYPES + 604, 11 }, },	// Verse.GeneDef
+		{ S(42525, 35), S(40325, 5), S(42560, 14), S(539, 0), S(42574, 20), { FIELDS + 446, 1 }, {}, {}, {}, },	// Verse.GeneSymbolPack+WeightedSymbol
+		{ S(10801, 22), S(42600, 13), S(42613, 8), S(539, 0), S(42613, 8), {}, { FIELDS + 447, 1 }, { FIELD_TYPES + 615, 1 }, {}, },	// Verse.Grammar.RulePack
+		{ S(42640, 25), S(42600, 13), S(42665, 11), S(42676, 18), S(42665, 11), { FIELDS + 448, 1 }, {}, {}, {}, },	// Verse.Grammar.Rule_String
+		{ S(24226, 17), S(40325, 5), S(42700, 11), S(53, 9), S(42700, 11), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 616, 1 }, {}, },	// Verse.HeadTypeDef
+		{ S(42711, 43), S(40325, 5), S(42754, 37), S(42791, 26), S(42754, 37), { FIELDS + 449, 2 }, {}, {}, { FIELD_TYPES + 617, 4 }, },	// Verse.HediffCompProperties_CauseMentalState
+		{ S(42909, 37), S(40325, 5), S(42946, 31), S(42791, 26), S(42946, 31), { FIELDS + 451, 3 }, {}, {}, { FIELD_TYPES + 621, 1 }, },	// Verse.HediffCompProperties_Disappears
+		{ S(43057, 45), S(40325, 5), S(43102, 39), S(43141, 48), S(43102, 39), { FIELDS + 451, 3 }, {}, {}, { FIELD_TYPES + 621, 1 }, },	// Verse.HediffCompProperties_DisappearsAndKills
+		{ S(43141, 48), S(40325, 5), S(43189, 42), S(42909, 37), S(43189, 42), { FIELDS + 451, 3 }, {}, {}, { FIELD_TYPES + 621, 1 }, },	// Verse.HediffCompProperties_DisappearsDisableable
+		{ S(43231, 43), S(40325, 5), S(43274, 37), S(42791, 26), S(43274, 37), { FIELDS + 80, 2 }, {}, {}, {}, },	// Verse.HediffCompProperties_FleshbeastEmerge
+		{ S(43311, 40), S(40325, 5), S(43351, 34), S(42791, 26), S(43351, 34), { FIELDS + 454, 2 }, {}, {}, {}, },	// Verse.HediffCompProperties_GetsPermanent
+		{ S(43422, 40), S(40325, 5), S(43462, 34), S(42791, 26), S(43462, 34), { FIELDS + 80, 2 }, {}, {}, { FIELD_TYPES + 51, 1 }, },	// Verse.HediffCompProperties_LetterOnDeath
+		{ S(43496, 47), S(40325, 5), S(43543, 41), S(42791, 26), S(43543, 41), { FIELDS + 66, 1 }, {}, {}, { FIELD_TYPES + 622, 1 }, },	// Verse.HediffCompProperties_MessageAboveSeverity
+		{ S(43584, 44), S(40325, 5), S(43628, 38), S(42791, 26), S(43628, 38), { FIELDS + 456, 3 }, {}, {}, { FIELD_TYPES + 623, 2 }, },	// Verse.HediffCompProperties_MessageAfterTicks
+		{ S(43676, 38), S(40325, 5), S(43714, 32), S(42791, 26), S(43714, 32), { FIELDS + 66, 1 }, {}, {}, { FIELD_TYPES + 622, 1 }, },	// Verse.HediffCompProperties_MessageBase
+		{ S(43746, 43), S(40325, 5), S(43789, 37), S(43676, 38), S(43789, 37), { FIELDS + 66, 1 }, {}, {}, { FIELD_TYPES + 622, 1 }, },	// Verse.HediffCompProperties_MessageOnRemoval
+		{ S(43826, 48), S(40325, 5), S(43874, 42), S(42791, 26), S(43874, 42), { FIELDS + 66, 1 }, {}, {}, { FIELD_TYPES + 622, 1 }, },	// Verse.HediffCompProperties_MessageStageIncreased
+		{ S(43916, 50), S(40325, 5), S(43966, 44), S(44010, 37), S(43966, 44), { FIELDS + 459, 1 }, {}, { FIELD_TYPES + 625, 1 }, {}, },	// Verse.HediffCompProperties_RandomizeSeverityPhases
+		{ S(44066, 56), S(40325, 5), S(44122, 5), S(539, 0), S(44127, 11), { FIELDS + 460, 2 }, {}, {}, {}, },	// Verse.HediffCompProperties_RandomizeSeverityPhases+Phase
+		{ S(44165, 53), S(40325, 5), S(44218, 47), S(44010, 37), S(44218, 47), { FIELDS + 459, 1 }, {}, {}, {}, },	// Verse.HediffCompProperties_RandomizeStageWithInterval
+		{ S(44265, 46), S(40325, 5), S(44311, 40), S(43676, 38), S(44311, 40), { FIELDS + 66, 1 }, {}, { FIELD_TYPES + 626, 1 }, { FIELD_TYPES + 622, 1 }, },	// Verse.HediffCompProperties_RemoveIfOtherHediff
+		{ S(44351, 40), S(40325, 5), S(44391, 34), S(42791, 26), S(44391, 34), { FIELDS + 462, 3 }, {}, {}, { FIELD_TYPES + 627, 2 }, },	// Verse.HediffCompProperties_ReplaceHediff
+		{ S(44435, 45), S(40325, 5), S(44480, 39), S(42791, 26), S(44480, 39), { FIELDS + 465, 1 }, {}, {}, {}, },	// Verse.HediffCompProperties_SurgeryInspectable
+		{ S(44540, 56), S(40325, 5), S(44596, 50), S(44435, 45), S(44596, 50), { FIELDS + 465, 1 }, {}, {}, {}, },	// Verse.HediffCompProperties_SurgeryInspectableMetalHorror
+		{ S(1342, 15), S(40325, 5), S(44646, 9), S(53, 9), S(44646, 9), { FIELDS + 466, 10 }, {}, { FIELD_TYPES + 629, 9 }, { FIELD_TYPES + 638, 5 }, },	// Verse.HediffDef
+		{ S(44868, 36), S(40325, 5), S(44962, 20), S(539, 0), S(44982, 26), { FIELDS + 476, 1 }, {}, {}, { FIELD_TYPES + 14, 1 }, },	// Verse.HediffDef+ReportStringOverride
+		{ S(44793, 28), S(40325, 5), S(45020, 22), S(539, 0), S(45020, 22), { FIELDS + 477, 1 }, {}, {}, { FIELD_TYPES + 643, 1 }, },	// Verse.HediffInfectionPathway
+		{ S(44904, 17), S(40325, 5), S(45063, 11), S(539, 0), S(45063, 11), { FIELDS + 478, 4 }, {}, { FIELD_TYPES + 644, 1 }, { FIELD_TYPES + 645, 4 }, },	// Verse.HediffStage
+		{ S(45169, 25), S(40325, 5), S(45194, 19), S(53, 9), S(45194, 19), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 649, 1 }, },	// Verse.IdeoStoryPatternDef
+		{ S(45218, 27), S(40325, 5), S(45245, 21), S(53, 9), S(45245, 21), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.ImplementOwnerTypeDef
+		{ S(45266, 28), S(40325, 5), S(45294, 22), S(53, 9), S(45294, 22), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 351, 1 }, { FIELD_TYPES + 650, 1 }, },	// Verse.InventoryStockGroupDef
+		{ S(273, 12), S(40325, 5), S(45331, 6), S(53, 9), S(45331, 6), { FIELDS + 482, 4 }, {}, {}, { FIELD_TYPES + 651, 4 }, },	// Verse.JobDef
+		{ S(42104, 27), S(40325, 5), S(45411, 21), S(53, 9), S(45411, 21), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 655, 1 }, {}, },	// Verse.KeyBindingCategoryDef
+		{ S(248, 19), S(40325, 5), S(45449, 13), S(53, 9), S(45449, 13), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 656, 1 }, },	// Verse.KeyBindingDef
+		{ S(1942, 15), S(40325, 5), S(45462, 9), S(53, 9), S(45462, 9), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 657, 1 }, },	// Verse.LetterDef
+		{ S(45482, 17), S(40325, 5), S(45499, 11), S(53, 9), S(45499, 11), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.LogEntryDef
+		{ S(45510, 17), S(40325, 5), S(45527, 11), S(53, 9), S(45527, 11), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 658, 7 }, },	// Verse.ManeuverDef
+		{ S(38109, 21), S(40325, 5), S(45661, 15), S(53, 9), S(45661, 15), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 665, 1 }, { FIELD_TYPES + 666, 1 }, },	// Verse.MapGeneratorDef
+		{ S(45704, 21), S(40325, 5), S(45725, 15), S(53, 9), S(45725, 15), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.MechWorkModeDef
+		{ S(25661, 20), S(40325, 5), S(45740, 14), S(53, 9), S(45740, 14), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 667, 4 }, },	// Verse.MentalBreakDef
+		{ S(45782, 18), S(40325, 5), S(45800, 12), S(53, 9), S(45800, 12), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 671, 1 }, },	// Verse.MentalFitDef
+		{ S(36897, 20), S(40325, 5), S(45812, 14), S(53, 9), S(45812, 14), { FIELDS + 486, 7 }, {}, { FIELD_TYPES + 672, 3 }, { FIELD_TYPES + 675, 4 }, },	// Verse.MentalStateDef
+		{ S(1625, 20), S(40325, 5), S(45936, 14), S(53, 9), S(45936, 14), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 679, 1 }, },	// Verse.MessageTypeDef
+		{ S(45950, 23), S(40325, 5), S(45973, 17), S(53, 9), S(45973, 17), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.OptionCategoryDef
+		{ S(45990, 25), S(40325, 5), S(46015, 19), S(53, 9), S(46015, 19), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.OrderedTakeGroupDef
+		{ S(10442, 21), S(40325, 5), S(46034, 15), S(53, 9), S(46034, 15), { FIELDS + 493, 6 }, {}, {}, {}, },	// Verse.PawnCapacityDef
+		{ S(1188, 17), S(40325, 5), S(46094, 11), S(53, 9), S(46094, 11), { FIELDS + 499, 8 }, {}, { FIELD_TYPES + 680, 11 }, { FIELD_TYPES + 560, 11 }, },	// Verse.PawnKindDef
+		{ S(41337, 23), S(40325, 5), S(46105, 17), S(539, 0), S(46105, 17), { FIELDS + 507, 6 }, {}, {}, {}, },	// Verse.PawnKindLifeStage
+		{ S(46122, 26), S(40325, 5), S(46148, 20), S(53, 9), S(46148, 20), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.PawnRenderNodeTagDef
+		{ S(46168, 23), S(40325, 5), S(46191, 17), S(53, 9), S(46191, 17), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.PawnRenderTreeDef
+		{ S(46208, 14), S(40325, 5), S(46222, 8), S(53, 9), S(46222, 8), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 691, 1 }, },	// Verse.PlaceDef
+		{ S(46240, 20), S(40325, 5), S(46260, 14), S(539, 0), S(46260, 14), { FIELDS + 513, 1 }, {}, { FIELD_TYPES + 692, 3 }, { FIELD_TYPES + 695, 30 }, },	// Verse.RaceProperties
+		{ S(10673, 15), S(40325, 5), S(46674, 9), S(53, 9), S(46674, 9), { FIELDS + 514, 5 }, {}, { FIELD_TYPES + 725, 9 }, { FIELD_TYPES + 734, 19 }, },	// Verse.RecipeDef
+		{ S(47201, 27), S(40325, 5), S(47228, 21), S(539, 0), S(47228, 21), { FIELDS + 330, 1 }, {}, { FIELD_TYPES + 753, 3 }, { FIELD_TYPES + 756, 9 }, },	// Verse.RecipeMakerProperties
+		{ S(2984, 24), S(40325, 5), S(47249, 18), S(53, 9), S(47249, 18), { FIELDS + 519, 5 }, {}, { FIELD_TYPES + 765, 7 }, { FIELD_TYPES + 772, 6 }, },	// Verse.ResearchProjectDef
+		{ S(8135, 27), S(40325, 5), S(47455, 21), S(53, 9), S(47455, 21), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.ResearchProjectTagDef
+		{ S(45362, 25), S(40325, 5), S(47476, 19), S(53, 9), S(47476, 19), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.ReservationLayerDef
+		{ S(45691, 13), S(40325, 5), S(47495, 7), S(53, 9), S(47495, 7), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 778, 3 }, },	// Verse.RoofDef
+		{ S(47554, 17), S(40325, 5), S(47571, 11), S(53, 9), S(47571, 11), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 781, 1 }, {}, },	// Verse.RoomRoleDef
+		{ S(30975, 17), S(40325, 5), S(47594, 11), S(53, 9), S(47594, 11), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 782, 1 }, },	// Verse.RoomStatDef
+		{ S(820, 17), S(40325, 5), S(47614, 11), S(53, 9), S(47614, 11), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 615, 1 }, { FIELD_TYPES + 434, 1 }, },	// Verse.RulePackDef
+		{ S(47625, 20), S(40325, 5), S(47645, 14), S(53, 9), S(47645, 14), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.ScatterableDef
+		{ S(904, 19), S(40325, 5), S(47659, 13), S(53, 9), S(47659, 13), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.ShaderTypeDef
+		{ S(23941, 13), S(40325, 5), S(47672, 7), S(53, 9), S(47672, 7), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 783, 1 }, },	// Verse.SongDef
+		{ S(41994, 30), S(47692, 11), S(47703, 18), S(53, 9), S(47703, 18), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 784, 1 }, },	// Verse.Sound.ImpactSoundTypeDef
+		{ S(391, 14), S(40325, 5), S(47729, 8), S(53, 9), S(47729, 8), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 785, 3 }, },	// Verse.SoundDef
+		{ S(46791, 27), S(40325, 5), S(47794, 21), S(53, 9), S(47794, 21), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 788, 1 }, },	// Verse.SpecialThingFilterDef
+		{ S(47829, 24), S(40325, 5), S(47853, 18), S(53, 9), S(47853, 18), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.StuffAppearanceDef
+		{ S(8198, 22), S(40325, 5), S(47871, 16), S(53, 9), S(47871, 16), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 789, 3 }, { FIELD_TYPES + 792, 2 }, },	// Verse.StyleCategoryDef
+		{ S(47926, 18), S(40325, 5), S(47944, 12), S(53, 9), S(47944, 12), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.SubcameraDef
+		{ S(40841, 26), S(40325, 5), S(47956, 20), S(53, 9), S(47956, 20), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.TerrainAffordanceDef
+		{ S(22756, 16), S(40325, 5), S(47976, 10), S(23190, 18), S(47976, 10), { FIELDS + 391, 4 }, {}, { FIELD_TYPES + 794, 5 }, { FIELD_TYPES + 799, 19 }, },	// Verse.TerrainDef
+		{ S(8520, 22), S(40325, 5), S(48099, 16), S(53, 9), S(48099, 16), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 818, 4 }, { FIELD_TYPES + 822, 1 }, },	// Verse.ThingCategoryDef
+		{ S(360, 14), S(40325, 5), S(48189, 8), S(23190, 18), S(48189, 8), { FIELDS + 391, 4 }, {}, { FIELD_TYPES + 823, 11 }, { FIELD_TYPES + 834, 34 }, },	// Verse.ThingDef
+		{ S(5034, 17), S(40325, 5), S(48620, 11), S(539, 0), S(48620, 11), { FIELDS + 331, 1 }, {}, { FIELD_TYPES + 868, 6 }, { FIELD_TYPES + 874, 1 }, },	// Verse.ThingFilter
+		{ S(41554, 19), S(40325, 5), S(48749, 13), S(53, 9), S(48749, 13), { FIELDS + 524, 4 }, {}, {}, { FIELD_TYPES + 875, 1 }, },	// Verse.ThingStyleDef
+		{ S(22935, 18), S(40325, 5), S(48776, 12), S(53, 9), S(48776, 12), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.ThinkTreeDef
+		{ S(48788, 15), S(40325, 5), S(48803, 9), S(53, 9), S(48803, 9), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.TipSetDef
+		{ S(24262, 10), S(40325, 5), S(48812, 4), S(539, 0), S(48812, 4), { FIELDS + 528, 2 }, {}, { FIELD_TYPES + 876, 1 }, { FIELD_TYPES + 877, 4 }, },	// Verse.Tool
+		{ S(45640, 21), S(40325, 5), S(48874, 15), S(53, 9), S(48874, 15), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.ToolCapacityDef
+		{ S(37149, 21), S(40325, 5), S(48889, 15), S(53, 9), S(48889, 15), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.TrainabilityDef
+		{ S(299, 20), S(40325, 5), S(48904, 14), S(539, 0), S(48904, 14), { FIELDS + 530, 2 }, {}, {}, { FIELD_TYPES + 881, 28 }, },	// Verse.VerbProperties
+		{ S(42337, 16), S(40325, 5), S(49301, 10), S(53, 9), S(49301, 10), { FIELDS + 0, 3 }, {}, { FIELD_TYPES + 909, 1 }, { FIELD_TYPES + 910, 1 }, },	// Verse.WeatherDef
+		{ S(734, 17), S(40325, 5), S(49338, 11), S(53, 9), S(49338, 11), { FIELDS + 532, 7 }, {}, { FIELD_TYPES + 911, 2 }, {}, },	// Verse.WorkTypeDef
+		{ S(49403, 21), S(40325, 5), S(49424, 15), S(53, 9), S(49424, 15), { FIELDS + 0, 3 }, {}, {}, {}, },	// Verse.WorldGenStepDef
+		{ S(38220, 14), S(539, 0), S(38220, 14), S(53, 9), S(38220, 14), { FIELDS + 0, 3 }, {}, {}, {}, },	// WeaponClassDef
+		{ S(49439, 18), S(539, 0), S(49439, 18), S(53, 9), S(49439, 18), { FIELDS + 0, 3 }, {}, {}, { FIELD_TYPES + 913, 2 }, },	// WeaponClassPairDef
+	};
+
+	inline constexpr std::string_view NAMESPACES[] = { S(539, 0), S(27, 8), S(40325, 5), S(38310, 8), S(42600, 13), S(47692, 11), };
+
+	inline constexpr std::uint16_t SEEDS[] =
+	{
+		0, 5, 1, 1, 30, 3, 23, 3, 4, 1, 2, 7, 22, 14, 1, 2,
+		1, 6, 1, 13, 1, 2, 3, 1, 5, 2, 9, 2, 1, 4, 2, 2,
+		2, 26, 3, 4, 2, 21, 15, 8, 6, 14, 18, 2, 7, 11, 13, 2,
+		2, 8, 5, 5, 35, 5, 13, 7, 1, 3, 3, 5, 3, 6, 13, 2,
+		14, 8, 1, 14, 21, 13, 6, 29, 8, 4, 1, 5, 16, 1, 3, 1,
+		9, 1, 1, 2, 3, 48, 4, 3, 15, 3, 17, 6, 2, 7, 5, 1,
+		1, 7, 2, 2, 11, 18, 1, 1, 5, 2, 14, 2, 1, 1, 2, 5,
+		4, 1, 25, 3, 11, 7, 9, 1, 4, 4, 1, 3, 4, 1, 7, 3,
+		7, 11, 6, 29, 12, 3, 4, 1, 1, 3, 17, 20, 11, 16, 4, 1,
+		7, 1, 40, 7, 2, 34, 10, 2, 1, 10, 12, 2, 3, 31, 1, 4,
+		2, 2,
+	};
+
+	inline constexpr std::uint16_t SLOTS[] =
+	{
+		123, 636, 140, 65535, 65535, 493, 566, 183, 360, 192, 65535, 65535, 502, 609, 65535, 574,
+		449, 65535, 617, 139, 619, 347, 273, 444, 65535, 235, 65535, 65535, 65535, 292, 159, 633,
+		297, 201, 65535, 165, 65535, 65535, 65535, 65535, 198, 65535, 248, 575, 335, 429, 395, 65535,
+		65535, 30, 170, 164, 570, 402, 482, 107, 1, 599, 354, 65535, 65535, 594, 65535, 65535,
+		65535, 65535, 65535, 291, 267, 286, 454, 563, 65535, 106, 18, 177, 547, 625, 63, 65535,
+		408, 416, 65535, 65535, 65535, 238, 169, 65535, 65535, 150, 220, 65535, 84, 456, 531, 546,
+		626, 548, 65535, 65535, 385, 33, 569, 65535, 65535, 65535, 65535, 108, 65535, 65535, 10, 278,
+		332, 65535, 226, 65535, 65535, 65535, 315, 255, 34, 65535, 465, 23, 326, 65535, 263, 391,
+		470, 113, 9, 330, 432, 400, 65535, 242, 62, 552, 188, 507, 339, 65535, 65535, 65535,
+		65535, 39, 65535, 65535, 590, 65535, 484, 221, 486, 365, 90, 325, 65535, 48, 65535, 175,
+		65535, 65535, 65535, 581, 337, 50, 216, 374, 61, 65535, 65535, 521, 464, 65535, 191, 204,
+		65535, 65535, 65535, 403, 65535, 91, 230, 265, 181, 65535, 65535, 65535, 65535, 156, 65535, 51,
+		487, 117, 65535, 269, 38, 65535, 109, 576, 65535, 65535, 316, 65535, 65535, 195, 513, 355,
+		65535, 288, 578, 65535, 65535, 373, 65535, 596, 65535, 134, 65535, 65535, 65535, 54, 397, 65535,
+		115, 65535, 294, 555, 508, 65535, 82, 16, 110, 65535, 65535, 88, 274, 43, 74, 495,
+		190, 65535, 65535, 328, 19, 65535, 603, 59, 344, 97, 490, 649, 582, 20, 382, 359,
+		239, 317, 130, 27, 215, 104, 65535, 264, 65535, 211, 194, 96, 272, 480, 363, 65535,
+		282, 207, 401, 439, 206, 179, 589, 65535, 467, 65535, 65535, 65535, 494, 352, 65535, 65535,
+		65535, 65535, 65535, 65535, 379, 65535, 65535, 433, 320, 266, 640, 126, 65535, 65535, 65535, 78,
+		519, 187, 163, 65535, 65535, 588, 22, 368, 65535, 236, 65535, 65535, 65, 81, 65535, 512,
+		65535, 259, 208, 613, 65535, 65535, 567, 124, 145, 146, 65535, 6, 184, 281, 318, 137,
+		65535, 176, 4, 100, 271, 65535, 86, 514, 453, 65535, 65535, 65535, 193, 47, 474, 65535,
+		75, 600, 65535, 65535, 65535, 65535, 478, 65535, 65535, 314, 168, 559, 65535, 228, 65535, 65535,
+		421, 65535, 65535, 65535, 65535, 112, 287, 80, 65535, 25, 65535, 65535, 217, 70, 256, 65535,
+		65535, 441, 87, 65535, 411, 172, 65535, 65535, 504, 510, 306, 65535, 483, 370, 65535, 334,
+		65535, 65535, 319, 65535, 549, 65535, 647, 65535, 637, 65535, 65535, 111, 180, 65535, 491, 94,
+		0, 515, 65535, 305, 65535, 361, 65535, 331, 77, 450, 430, 65535, 125, 231, 472, 505,
+		65535, 222, 76, 65535, 481, 167, 289, 69, 65535, 65535, 203, 65535, 65535, 443, 307, 568,
+		65535, 466, 399, 469, 65535, 460, 65535, 545, 65535, 29, 65535, 571, 65535, 602, 65535, 383,
+		561, 65535, 31, 65535, 357, 65535, 121, 455, 346, 65535, 389, 56, 605, 628, 293, 65535,
+		591, 26, 434, 299, 149, 65535, 65535, 622, 275, 611, 459, 518, 65535, 414, 300, 65535,
+		7, 103, 612, 375, 44, 65535, 587, 173, 624, 551, 212, 542, 65535, 338, 543, 284,
+		185, 65535, 5, 398, 55, 65535, 65535, 65535, 341, 557, 65535, 392, 65535, 623, 11, 380,
+		378, 65535, 419, 58, 435, 336, 143, 65535, 479, 218, 584, 53, 65535, 65535, 60, 65535,
+		442, 506, 367, 606, 99, 65535, 40, 237, 98, 244, 65535, 65535, 351, 533, 71, 65535,
+		127, 500, 489, 66, 475, 65535, 553, 384, 65535, 639, 527, 65535, 65535, 333, 65535, 65535,
+		65535, 243, 436, 501, 65535, 65535, 65535, 178, 525, 522, 65535, 65535, 65535, 356, 65535, 579,
+		65535, 560, 358, 65535, 57, 65535, 468, 65535, 277, 245, 65535, 632, 290, 270, 45, 65535,
+		171, 417, 65535, 342, 65535, 65535, 65535, 424, 425, 577, 119, 233, 160, 65535, 65535, 65535,
+		369, 89, 65535, 65535, 65535, 558, 105, 377, 65535, 422, 67, 65535, 129, 635, 65535, 65535,
+		65535, 65535, 427, 615, 323, 214, 65535, 166, 311, 65535, 65535, 65535, 477, 227, 595, 73,
+		197, 541, 463, 65535, 65535, 152, 536, 65535, 407, 572, 447, 438, 65535, 65535, 412, 141,
+		154, 234, 645, 529, 15, 631, 65535, 65535, 65535, 295, 65535, 92, 65535, 364, 366, 580,
+		223, 283, 65535, 451, 65535, 304, 122, 65535, 376, 371, 646, 186, 65535, 65535, 65535, 461,
+		65535, 406, 409, 648, 520, 530, 65535, 65535, 65535, 36, 65535, 388, 65535, 65535, 65535, 65535,
+		413, 65535, 240, 65535, 448, 509, 381, 65535, 65535, 253, 503, 65535, 405, 148, 65535, 138,
+		65535, 65535, 65535, 13, 298, 565, 343, 488, 246, 65535, 65535, 114, 327, 348, 65535, 586,
+		629, 644, 511, 65535, 301, 65535, 116, 296, 232, 65535, 616, 583, 279, 65535, 200, 598,
+		65535, 446, 642, 93, 49, 65535, 65535, 24, 540, 340, 65535, 196, 65535, 349, 418, 65535,
+		621, 268, 213, 610, 65535, 538, 14, 133, 250, 420, 573, 516, 65535, 136, 261, 65535,
+		46, 65535, 65535, 597, 182, 249, 564, 65535, 65535, 496, 65535, 131, 396, 102, 445, 618,
+		65535, 65535, 65535, 554, 101, 251, 65535, 155, 65535, 247, 65535, 79, 52, 65535, 426, 280,
+		544, 410, 65535, 65535, 65535, 135, 65535, 608, 440, 322, 144, 393, 423, 65535, 65535, 262,
+		492, 65535, 3, 524, 309, 415, 209, 65535, 523, 329, 614, 65535, 65535, 534, 593, 556,
+		350, 65535, 28, 65535, 17, 65535, 120, 497, 219, 174, 537, 550, 189, 485, 65535, 151,
+		65535, 252, 471, 72, 462, 65535, 83, 241, 372, 585, 65535, 65535, 532, 390, 2, 65535,
+		431, 157, 345, 539, 458, 65535, 362, 205, 404, 643, 65535, 161, 65535, 64, 65535, 452,
+		65535, 254, 41, 473, 526, 310, 499, 353, 65535, 65535, 65535, 324, 128, 562, 95, 65535,
+		65535, 437, 21, 65535, 620, 65535, 627, 313, 65535, 65535, 641, 65535, 229, 142, 65535, 65535,
+		601, 65535, 199, 65535, 65535, 312, 65535, 65535, 592, 498, 65535, 32, 65535, 302, 65535, 428,
+		65535, 65535, 285, 65535, 65535, 65535, 276, 65535, 65535, 308, 42, 37, 65535, 85, 517, 35,
+		257, 65535, 12, 132, 303, 118, 8, 210, 476, 65535, 224, 65535, 153, 162, 258, 65535,
+		65535, 321, 604, 68, 65535, 65535, 65535, 65535, 387, 65535, 65535, 65535, 147, 394, 528, 457,
+		638, 65535, 158, 65535, 535, 65535, 225, 260, 65535, 630, 65535, 607, 202, 65535, 634, 386,
+	};
+}
+
+inline constexpr static_classinfo_dict_t gRimWorldClasses{ RimWorldSchema::CLASSES, RimWorldSchema::SEEDS, RimWorldSchema::SLOTS, RimWorldSchema::NAMESPACES, };
 
+static_assert(std::ranges::all_of(gRimWorldClasses, [](class_schema_t const& info) { return gRimWorldClasses.find(info.m_FullName) == &info; }));
@@ -0,0 +1,257 @@
+#include "Precompiled.hpp"
+#include "BinaryStream.hpp"
+#include "FileWriter.hpp"
+#include "Mod.hpp"
+#include "Log.hpp"
+
+import CRC64;
+import Style;
+
+namespace fs = std::filesystem;
+
+using std::span;
+using std::string;
+using std::string_view;
+using std::vector;
+
+// Layout, all integers are little-endian:
+//	char[8]		magic
+//	u32			format version
+//	str			RIMWORLD_ASSEMBLY_VERSION
+//	u8			SchemaCache::EReader
+//	u32			count of assemblies, then for each: str relative path, u64 CRC64
+//	u32			count of classes, then for each:
+//		str		key, namespace, name, base
+//		u32		count, then str for each entry of m_MustTranslates and m_ArraysMustTranslate respectively
+//		u32		count, then str, str for each entry of m_ObjectArrays and m_Objects respectively
+// where str is a u32 length followed by UTF-8 bytes without terminator.
+
+inline constexpr char SCHEMA_CACHE_MAGIC[8] = { 'R', 'W', 'P', 'H', 'G', 'S', 'C', 'H', };
+inline constexpr uint32_t SCHEMA_CACHE_VERSION = 2;
+
+static void WriteHeader(binary_writer_t* writer, SchemaCache::assembly_digests_t const& Digests, SchemaCache::EReader Reader) noexcept
+{
+	writer->m_Buffer.append_range(std::as_bytes(span{ SCHEMA_CACHE_MAGIC }));
+	writer->Write(SCHEMA_CACHE_VERSION);
+	writer->Write(string_view{ RIMWORLD_ASSEMBLY_VERSION });
+	writer->Write(static_cast<uint8_t>(Reader));
+
+	writer->Write(static_cast<uint32_t>(Digests.size()));
+	for (auto&& [szPath, iCRC] : Digests)
+	{
+		writer->Write(string_view{ szPath });
+		writer->Write(iCRC);
+	}
+}
+
+static void WriteClasses(binary_writer_t* writer, classinfo_dict_t const& dict) noexcept
+{
+	writer->Write(static_cast<uint32_t>(dict.size()));
+
+	for (auto&& [szFullName, info] : dict)
+	{
+		writer->Write(string_view{ szFullName });
+		writer->Write(string_view{ info.m_Namespace });
+		writer->Write(string_view{ info.m_Name });
+		writer->Write(string_view{ info.m_Base });
+
+		for (auto&& Fields : { &info.m_MustTranslates, &info.m_ArraysMustTranslate })
+		{
+			writer->Write(static_cast<uint32_t>(Fields->size()));
+			for (auto&& szField : *Fields)
+				writer->Write(string_view{ szField });
+		}
+
+		for (auto&& FieldTypes : { &info.m_ObjectArrays, &info.m_Objects })
+		{
+			writer->Write(static_cast<uint32_t>(FieldTypes->size()));
+			for (auto&& [szField, szType] : *FieldTypes)
+			{
+				writer->Write(string_view{ szField });
+				writer->Write(string_view{ szType });
+			}
+		}
+	}
+}
+
+// Same layout as the one above, plus the folder names and the namespaces, which only the vanilla table carries.
+static void WriteClasses(binary_writer_t* writer, static_classinfo_dict_t const& dict) noexcept
+{
+	writer->Write(static_cast<uint32_t>(dict.m_Classes.size()));
+
+	for (auto&& info : dict.m_Classes)
+	{
+		writer->Write(info.m_FullName);
+		writer->Write(info.m_Namespace);
+		writer->Write(info.m_Name);
+		writer->Write(info.m_Base);
+		writer->Write(info.m_FolderName);
+
+		for (auto&& Fields : { info.m_MustTranslates, info.m_ArraysMustTranslate })
+		{
+			writer->Write(static_cast<uint32_t>(Fields.size()));
+			for (auto&& szField : Fields)
+				writer->Write(szField);
+		}
+
+		for (auto&& FieldTypes : { info.m_ObjectArrays, info.m_Objects })
+		{
+			writer->Write(static_cast<uint32_t>(FieldTypes.size()));
+			for (auto&& [szField, szType] : FieldTypes)
+			{
+				writer->Write(szField);
+				writer->Write(szType);
+			}
+		}
+	}
+
+	writer->Write(static_cast<uint32_t>(dict.m_Namespaces.size()));
+	for (auto&& szNamespace : dict.m_Namespaces)
+		writer->Write(szNamespace);
+}
+
+[[nodiscard]]
+static bool ReadClasses(binary_reader_t* reader, classinfo_dict_t* pret) noexcept
+{
+	auto const iClassCount = reader->Read<uint32_t>();
+
+	for (uint32_t i = 0; i < iClassCount && !reader->m_bBad; ++i)
+	{
+		string szFullName{ reader->ReadString() };
+		class_info_t info{
+			.m_Namespace{ string{ reader->ReadString() } },
+			.m_Name{ string{ reader->ReadString() } },
+			.m_Base{ string{ reader->ReadString() } },
+		};
+
+		for (auto&& Fields : { &info.m_MustTranslates, &info.m_ArraysMustTranslate })
+		{
+			auto const iCount = reader->Read<uint32_t>();
+			for (uint32_t j = 0; j < iCount && !reader->m_bBad; ++j)
+				Fields->emplace(reader->ReadString());
+		}
+
+		for (auto&& FieldTypes : { &info.m_ObjectArrays, &info.m_Objects })
+		{
+			auto const iCount = reader->Read<uint32_t>();
+			for (uint32_t j = 0; j < iCount && !reader->m_bBad; ++j)
+			{
+				auto const szField = reader->ReadString();
+				FieldTypes->try_emplace(string{ szField }, reader->ReadString());
+			}
+		}
+
+		pret->try_emplace(std::move(szFullName), std::move(info));
+	}
+
+	return !reader->m_bBad;
+}
+
+SchemaCache::assembly_digests_t SchemaCache::DigestModAssemblies(fs::path const& ModDir) noexcept
+{
+	// Must cover the same set of files as ::GetModClasses() loads.
+	assembly_digests_t ret{};
+	std::error_code ec{};
+
+	if (!fs::exists(ModDir / L"Assemblies", ec))
+		return ret;
+
+	for (auto&& hPath :
+		fs::recursive_directory_iterator(ModDir, ec)
+		| std::views::transform(&fs::directory_entry::path)
+		| std::views::filter([](fs::path const& pth) noexcept { return pth.has_extension() && pth.extension() == ".dll"; })
+		)
+	{
+		ret.emplace_back(fs::relative(hPath, ModDir, ec).u8string(), CheckFileCRC(hPath));
+	}
+
+	std::ranges::sort(ret);
+	return ret;
+}
+
+vector<std::byte> SchemaCache::Serialize(classinfo_dict_t const& dict) noexcept
+{
+	binary_writer_t writer{};
+	WriteClasses(&writer, dict);
+
+	return std::move(writer.m_Buffer);
+}
+
+uint64_t SchemaCache::DigestVanillaClasses() noexcept
+{
+	static uint64_t const iDigest =
+		[]() noexcept
+		{
+			binary_writer_t writer{};
+			WriteClasses(&writer, gRimWorldClasses);
+
+			return CRC64::CheckStream(writer.m_Buffer.data(), writer.m_Buffer.size());
+		}();
+
+	return iDigest;
+}
+
+bool SchemaCache::Load(fs::path const& hFile, assembly_digests_t const& Digests, EReader Reader, classinfo_dict_t* pret) noexcept
+{
+	vector<std::byte> Content{};
+
+	if (auto const f = _wfopen(hFile.c_str(), L"rb"); f != nullptr)
+	{
+		std::error_code ec{};
+		Content.resize(static_cast<size_t>(fs::file_size(hFile, ec)));
+
+		if (ec || fread(Content.data(), 1, Content.size(), f) != Content.size())
+			Content.clear();
+
+		fclose(f);
+	}
+
+	if (Content.empty())
+		return false;
+
+	// Any change in the assemblies, in the game itself or of the reader invalidates the whole cache.
+	binary_writer_t Expected{};
+	WriteHeader(&Expected, Digests, Reader);
+
+	if (!std::ranges::starts_with(Content, Expected.m_Buffer))
+	{
+		// Switching between the metadata reader and -reflect is a miss of its own, the assemblies are read again by the one asked for.
+		binary_writer_t OtherReader{};
+		WriteHeader(&OtherReader, Digests, Reader == EReader::Reflection ? EReader::Metadata : EReader::Reflection);
+
+		if (std::ranges::starts_with(Content, OtherReader.m_Buffer))
+			Log::Print(ELogLevel::Info, Style::Skipping, "Schema cache '{}' was built by the other class reader.\n", hFile.u8string());
+		else
+			Log::Print(ELogLevel::Info, Style::Skipping, "Schema cache '{}' is outdated.\n", hFile.u8string());
+
+		return false;
+	}
+
+	binary_reader_t reader{ .m_Data{ span{ Content }.subspan(Expected.m_Buffer.size()) } };
+	classinfo_dict_t Classes{};
+
+	if (!ReadClasses(&reader, &Classes)) [[unlikely]]
+	{
+		Log::Print(ELogLevel::Warning, Style::Warning, "Bad schema cache file: '{}'\n", hFile.u8string());
+		return false;
+	}
+
+	*pret = std::move(Classes);
+
+	Log::Print(ELogLevel::Info, Style::Positive, "{0} types loaded from schema cache.\n", pret->size());
+	Log::Print(ELogLevel::Info, "\n");
+
+	return true;
+}
+
+void SchemaCache::Save(fs::path const& hFile, assembly_digests_t const& Digests, EReader Reader, classinfo_dict_t const& dict) noexcept
+{
+	binary_writer_t writer{};
+	WriteHeader(&writer, Digests, Reader);
+	WriteClasses(&writer, dict);
+
+	std::error_code ec{};
+	fs::create_directories(hFile.parent_path(), ec);
+
+	WriteFileIfChanged(hFile, writer.m_Buffer);
+}
@@ -0,0 +1,549 @@
+#include "Precompiled.hpp"
+#include "Json.hpp"
+#include "Log.hpp"
+#include "Server.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <WinSock2.h>
+#include <afunix.h>
+#pragma comment(lib, "Ws2_32.lib")
+#define MSG_NOSIGNAL 0
+#define poll WSAPoll
+using nfds_t = ULONG;
+#else
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+using SOCKET = int;
+inline constexpr SOCKET INVALID_SOCKET = -1;
+#define closesocket close
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+import Style;
+
+namespace fs = std::filesystem;
+
+using std::optional;
+using std::string;
+using std::string_view;
+using std::vector;
+
+inline constexpr size_t SERVER_MAX_LINE = 1 << 20;	// A request is a handful of paths, anything longer is garbage.
+inline constexpr int SERVER_MAX_DEPTH = 16;
+
+#pragma region JSON
+// Just enough of JSON for a flat request object. Values of the unknown keys are skipped, so the clients are free to add their own.
+struct json_reader_t final
+{
+	string_view m_Text{};
+	bool m_bBad{};
+
+	void SkipSpaces() noexcept
+	{
+		while (!m_Text.empty() && (m_Text.front() == ' ' || m_Text.front() == '\t' || m_Text.front() == '\r' || m_Text.front() == '\n'))
+			m_Text.remove_prefix(1);
+	}
+
+	[[nodiscard]] bool Peek(char c) noexcept
+	{
+		SkipSpaces();
+		return !m_Text.empty() && m_Text.front() == c;
+	}
+
+	bool Consume(char c) noexcept
+	{
+		if (!Peek(c))
+			return false;
+
+		m_Text.remove_prefix(1);
+		return true;
+	}
+
+	void Expect(char c) noexcept
+	{
+		if (!Consume(c))
+			m_bBad = true;
+	}
+
+	[[nodiscard]] uint32_t ReadHex4() noexcept
+	{
+		uint32_t ret{};
+
+		if (m_Text.size() < 4 || std::from_chars(m_Text.data(), m_Text.data() + 4, ret, 16).ptr != m_Text.data() + 4)
+		{
+			m_bBad = true;
+			return 0;
+		}
+
+		m_Text.remove_prefix(4);
+		return ret;
+	}
+
+	static void AppendUtf8(string* pOut, uint32_t cp) noexcept
+	{
+		if (cp < 0x80)
+			pOut->push_back(static_cast<char>(cp));
+		else if (cp < 0x800)
+		{
+			pOut->push_back(static_cast<char>(0xC0 | (cp >> 6)));
+			pOut->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+		}
+		else if (cp < 0x10000)
+		{
+			pOut->push_back(static_cast<char>(0xE0 | (cp >> 12)));
+			pOut->push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+			pOut->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+		}
+		else
+		{
+			pOut->push_back(static_cast<char>(0xF0 | (cp >> 18)));
+			pOut->push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+			pOut->push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+			pOut->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+		}
+	}
+
+	[[nodiscard]] string ReadString() noexcept
+	{
+		string ret{};
+
+		if (!Consume('"'))
+		{
+			m_bBad = true;
+			return ret;
+		}
+
+		while (!m_bBad)
+		{
+			if (m_Text.empty())
+			{
+				m_bBad = true;
+				break;
+			}
+
+			auto const c = m_Text.front();
+			m_Text.remove_prefix(1);
+
+			if (c == '"')
+				break;
+			else if (c != '\\')
+			{
+				ret.push_back(c);
+				continue;
+			}
+
+			if (m_Text.empty())
+			{
+				m_bBad = true;
+				break;
+			}
+
+			auto const e = m_Text.front();
+			m_Text.remove_prefix(1);
+
+			switch (e)
+			{
+			case '"':
+			case '\\':
+			case '/':	ret.push_back(e); break;
+			case 'b':	ret.push_back('\b'); break;
+			case 'f':	ret.push_back('\f'); break;
+			case 'n':	ret.push_back('\n'); break;
+			case 'r':	ret.push_back('\r'); break;
+			case 't':	ret.push_back('\t'); break;
+
+			case 'u':
+			{
+				auto cp = ReadHex4();
+
+				// Characters out of the BMP come as a surrogate pair.
+				if (cp >= 0xD800 && cp < 0xDC00 && m_Text.starts_with("\\u"))
+				{
+					m_Text.remove_prefix(2);
+
+					if (auto const lo = ReadHex4(); lo >= 0xDC00 && lo < 0xE000)
+						cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+					else
+						m_bBad = true;
+				}
+
+				AppendUtf8(&ret, cp);
+				break;
+			}
+
+			default:
+				m_bBad = true;
+				break;
+			}
+		}
+
+		return ret;
+	}
+
+	// Numbers and literals, as they are.
+	[[nodiscard]] string_view ReadToken() noexcept
+	{
+		SkipSpaces();
+
+		auto const iLength = std::ranges::find_if(m_Text, [](char c) noexcept { return c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\r' || c == '\n'; }) - m_Text.begin();
+		auto const ret = m_Text.substr(0, iLength);
+		m_Text.remove_prefix(iLength);
+
+		if (ret.empty())
+			m_bBad = true;
+
+		return ret;
+	}
+
+	void SkipValue(int iDepth = 0) noexcept
+	{
+		if (iDepth > SERVER_MAX_DEPTH)
+		{
+			m_bBad = true;
+			return;
+		}
+
+		if (Peek('"'))
+			(void)ReadString();
+		else if (Consume('['))
+		{
+			if (Consume(']'))
+				return;
+
+			do
+				SkipValue(iDepth + 1);
+			while (!m_bBad && Consume(','));
+
+			Expect(']');
+		}
+		else if (Consume('{'))
+		{
+			if (Consume('}'))
+				return;
+
+			do
+			{
+				(void)ReadString();
+				Expect(':');
+				SkipValue(iDepth + 1);
+			}
+			while (!m_bBad && Consume(','));
+
+			Expect('}');
+		}
+		else
+			(void)ReadToken();
+	}
+};
+
+bool Server::ParseRequest(string_view szLine, request_t* pret) noexcept
+{
+	json_reader_t reader{ .m_Text{ szLine } };
+	*pret = { .m_Id{ "null" } };
+
+	reader.Expect('{');
+
+	if (!reader.m_bBad && !reader.Consume('}'))
+	{
+		do
+		{
+			auto const szKey = reader.ReadString();
+			reader.Expect(':');
+
+			if (reader.m_bBad)
+				break;
+
+			if (szKey == "id")
+			{
+				// Echoed back in the answer, hence kept in its JSON form.
+				if (reader.Peek('"'))
+				{
+					pret->m_Id.clear();
+					AppendJsonString(&pret->m_Id, reader.ReadString());
+				}
+				else
+					pret->m_Id = reader.ReadToken();
+			}
+			else if (szKey == "cmd")
+				pret->m_Command = reader.ReadString();
+			else if (szKey == "args")
+			{
+				reader.Expect('[');
+
+				if (!reader.m_bBad && !reader.Consume(']'))
+				{
+					do
+						pret->m_Args.emplace_back(reader.ReadString());
+					while (!reader.m_bBad && reader.Consume(','));
+
+					reader.Expect(']');
+				}
+			}
+			else
+				reader.SkipValue();
+		}
+		while (!reader.m_bBad && reader.Consume(','));
+
+		reader.Expect('}');
+	}
+
+	reader.SkipSpaces();
+	return !reader.m_bBad && reader.m_Text.empty() && !pret->m_Command.empty();
+}
+#pragma endregion JSON
+
+#pragma region Socket
+struct socket_t final
+{
+	socket_t() noexcept = default;
+	explicit socket_t(SOCKET hSocket) noexcept : m_hSocket{ hSocket } {}
+	~socket_t() noexcept
+	{
+		if (m_hSocket != INVALID_SOCKET)
+			closesocket(m_hSocket);
+	}
+
+	socket_t(socket_t const&) noexcept = delete;
+	socket_t(socket_t&& rhs) noexcept : m_hSocket{ std::exchange(rhs.m_hSocket, INVALID_SOCKET) }, m_Pending{ std::move(rhs.m_Pending) } {}
+	socket_t& operator=(socket_t const&) noexcept = delete;
+	socket_t& operator=(socket_t&& rhs) noexcept { std::swap(m_hSocket, rhs.m_hSocket); std::swap(m_Pending, rhs.m_Pending); return *this; }
+
+	[[nodiscard]] explicit operator bool() const noexcept { return m_hSocket != INVALID_SOCKET; }
+
+	[[nodiscard]] bool SendAll(string_view sz) const noexcept
+	{
+		while (!sz.empty())
+		{
+			auto const iSent = send(m_hSocket, sz.data(), static_cast<int>(std::min<size_t>(sz.size(), INT_MAX)), MSG_NOSIGNAL);	// No SIGPIPE from a client gone.
+			if (iSent <= 0)
+				return false;
+
+			sz.remove_prefix(static_cast<size_t>(iSent));
+		}
+
+		return true;
+	}
+
+	// One recv() of whatever has arrived. False once the peer is gone, or the line has grown too long.
+	[[nodiscard]] bool Receive() noexcept
+	{
+		if (m_Pending.size() > SERVER_MAX_LINE)
+			return false;
+
+		char Buffer[4096];
+		auto const iReceived = recv(m_hSocket, Buffer, static_cast<int>(sizeof(Buffer)), 0);
+		if (iReceived <= 0)
+			return false;
+
+		m_Pending.append(Buffer, static_cast<size_t>(iReceived));
+		return true;
+	}
+
+	// A line already received, if any. Line break excluded, as well as the '\r' before it.
+	[[nodiscard]] bool TakeLine(string* pret) noexcept
+	{
+		auto const iBreak = m_Pending.find('\n');
+		if (iBreak == string::npos)
+			return false;
+
+		pret->assign(m_Pending, 0, iBreak);
+		m_Pending.erase(0, iBreak + 1);
+
+		if (pret->ends_with('\r'))
+			pret->pop_back();
+
+		return true;
+	}
+
+	[[nodiscard]] bool HasLine() const noexcept { return m_Pending.contains('\n'); }
+
+	// Blocks until a whole line is in.
+	[[nodiscard]] bool ReadLine(string* pret) noexcept
+	{
+		while (!TakeLine(pret))
+		{
+			if (!Receive())
+				return false;
+		}
+
+		return true;
+	}
+
+	SOCKET m_hSocket{ INVALID_SOCKET };
+	string m_Pending{};	// Received but not yet taken as a line.
+};
+
+[[nodiscard]] static bool StartUp() noexcept
+{
+#ifdef _WIN32
+	static bool const bStarted =
+		[]() noexcept
+		{
+			WSADATA Data{};
+			return WSAStartup(MAKEWORD(2, 2), &Data) == 0;
+		}();
+
+	return bStarted;
+#else
+	return true;
+#endif
+}
+
+[[nodiscard]] static bool MakeAddress(fs::path const& Endpoint, sockaddr_un* pret) noexcept
+{
+	auto const szPath = Endpoint.u8string();
+	*pret = {};
+	pret->sun_family = AF_UNIX;
+
+	if (szPath.empty() || szPath.size() >= sizeof(pret->sun_path))
+	{
+		Log::Print(ELogLevel::Error, Style::Error, "Socket path '{}' is longer than the {} bytes allowed.\n", szPath, sizeof(pret->sun_path) - 1);
+		return false;
+	}
+
+	std::ranges::copy(szPath, pret->sun_path);
+	return true;
+}
+
+[[nodiscard]] static socket_t Connect(fs::path const& Endpoint) noexcept
+{
+	sockaddr_un Address{};
+	if (!StartUp() || !MakeAddress(Endpoint, &Address))
+		return {};
+
+	socket_t ret{ socket(AF_UNIX, SOCK_STREAM, 0) };
+	if (ret && connect(ret.m_hSocket, reinterpret_cast<sockaddr const*>(&Address), sizeof(Address)) != 0)
+		return {};
+
+	return ret;
+}
+#pragma endregion Socket
+
+fs::path Server::DefaultEndpoint() noexcept
+{
+	std::error_code ec{};
+	return fs::temp_directory_path(ec) / L"RWPHG.sock";
+}
+
+bool Server::Serve(fs::path const& Endpoint, bool(*pfnHandle)(string_view szLine, string* pResponse)) noexcept
+{
+	sockaddr_un Address{};
+	if (!StartUp() || !MakeAddress(Endpoint, &Address))
+		return false;
+
+	if (Connect(Endpoint))
+	{
+		Log::Print(ELogLevel::Error, Style::Error, "Another server is already listening on '{}'\n", Endpoint.u8string());
+		return false;
+	}
+
+	std::error_code ec{};
+	fs::remove(Endpoint, ec);	// Left over by a server that did not quit properly, bind() fails otherwise.
+
+	socket_t const Listener{ socket(AF_UNIX, SOCK_STREAM, 0) };
+
+	if (!Listener
+		|| bind(Listener.m_hSocket, reinterpret_cast<sockaddr const*>(&Address), sizeof(Address)) != 0
+		|| listen(Listener.m_hSocket, SOMAXCONN) != 0)
+	{
+		Log::Print(ELogLevel::Error, Style::Error, "Unable to listen on '{}'\n", Endpoint.u8string());
+		return false;
+	}
+
+	Log::Print(ELogLevel::Warning, Style::Positive, "Serving on '{}'\n", Endpoint.u8string());
+	Log::Flush();
+
+	// A client may keep its connection for as many requests as it likes, e.g. an editor regenerating on every save.
+	// Connections are polled together and take turns, one request each per round, so that no client holds the others up by staying connected.
+	vector<socket_t> Clients{};
+	vector<pollfd> Fds{};
+	string szLine{}, szResponse{};
+
+	for (bool bServing = true; bServing;)
+	{
+		Fds.clear();
+		Fds.push_back({ .fd = Listener.m_hSocket, .events = POLLIN, });
+
+		for (auto&& Client : Clients)
+			Fds.push_back({ .fd = Client.m_hSocket, .events = POLLIN, });
+
+		// Lines already received are served without waiting for anything new.
+		auto const bHasPending = std::ranges::any_of(Clients, &socket_t::HasLine);
+
+		if (poll(Fds.data(), static_cast<nfds_t>(Fds.size()), bHasPending ? 0 : -1) < 0)
+		{
+			Log::Print(ELogLevel::Error, Style::Error, "Unable to wait for any further request on '{}'\n", Endpoint.u8string());
+			break;
+		}
+
+		vector<bool> Gone(Clients.size());
+
+		for (size_t i = 0; i < Clients.size(); ++i)
+		{
+			if ((Fds[i + 1].revents & (POLLIN | POLLHUP | POLLERR)) && !Clients[i].Receive())
+				Gone[i] = true;
+		}
+
+		for (size_t i = 0; i < Clients.size() && bServing; ++i)
+		{
+			while (Clients[i].TakeLine(&szLine))
+			{
+				if (szLine.find_first_not_of(" \t") == string::npos)
+					continue;
+
+				szResponse.clear();
+				bServing = pfnHandle(szLine, &szResponse);
+				szResponse.push_back('\n');
+
+				if (!Clients[i].SendAll(szResponse))
+					Gone[i] = true;
+
+				break;
+			}
+		}
+
+		// Everything a client sent before it hung up is still answered, as far as it goes.
+		for (size_t i = Clients.size(); i-- > 0;)
+		{
+			if (Gone[i] && !Clients[i].HasLine())
+				Clients.erase(Clients.begin() + static_cast<ptrdiff_t>(i));
+		}
+
+		if (bServing && (Fds.front().revents & POLLIN))
+		{
+			if (socket_t Client{ accept(Listener.m_hSocket, nullptr, nullptr) }; Client)
+				Clients.push_back(std::move(Client));
+			else
+			{
+				Log::Print(ELogLevel::Error, Style::Error, "Unable to accept any further connection on '{}'\n", Endpoint.u8string());
+				break;
+			}
+		}
+	}
+
+	fs::remove(Endpoint, ec);
+	return true;
+}
+
+optional<string> Server::Request(fs::path const& Endpoint, string_view szLine) noexcept
+{
+	auto Connection = Connect(Endpoint);
+
+	if (!Connection)
+	{
+		Log::Print(ELogLevel::Error, Style::Error, "No server is listening on '{}'\n", Endpoint.u8string());
+		return std::nullopt;
+	}
+
+	if (string ret{}; Connection.SendAll(szLine) && Connection.SendAll("\n") && Connection.ReadLine(&ret))
+		return ret;
+
+	Log::Print(ELogLevel::Error, Style::Error, "Connection to '{}' is lost before any answer.\n", Endpoint.u8string());
+	return std::nullopt;
+}
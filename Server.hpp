@@ -0,0 +1,46 @@
+#pragma once
+
+#ifndef _FILESYSTEM_
+#include <filesystem>
+#endif
+
+#ifndef _OPTIONAL_
+#include <optional>
+#endif
+
+#ifndef _STRING_
+#include <string>
+#endif
+
+#ifndef _STRING_VIEW_
+#include <string_view>
+#endif
+
+#ifndef _VECTOR_
+#include <vector>
+#endif
+
+// Resident mode of -serve. Requests come over a Unix-domain socket, which Windows has as well since 10 1803, one JSON object per line:
+//	{"id": 1, "cmd": "genph", "args": ["path/to/mod", "ChineseTraditional"]}
+// Every one of them is answered with a line of its own, the id is echoed back as is:
+//	{"id": 1, "ok": true, "ms": 12.34}
+// Requests are served one after another, the connected clients taking turns, as the pipeline keeps the state of its mod in globals.
+
+namespace Server
+{
+	struct request_t final
+	{
+		std::string m_Id{};	// Raw JSON token, "null" if absent.
+		std::string m_Command{};
+		std::vector<std::string> m_Args{};
+	};
+
+	[[nodiscard]] std::filesystem::path DefaultEndpoint() noexcept;	// Under the temp folder.
+	[[nodiscard]] bool ParseRequest(std::string_view szLine, request_t* pret) noexcept;
+
+	// Blocks until pfnHandle returns false. pfnHandle answers one request line in pResponse, without the line break.
+	[[nodiscard]] bool Serve(std::filesystem::path const& Endpoint, bool(*pfnHandle)(std::string_view szLine, std::string* pResponse)) noexcept;
+
+	// Client stub: sends one line, waits for the answering one.
+	[[nodiscard]] std::optional<std::string> Request(std::filesystem::path const& Endpoint, std::string_view szLine) noexcept;
+}
@@ -0,0 +1,121 @@
+#include "Precompiled.hpp"
+#include "FileWriter.hpp"
+#include "Log.hpp"
+#include "Mod.hpp"
+#include "Stats.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <Psapi.h>
+#pragma comment(lib, "Psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+import Application;
+import Style;
+
+namespace fs = std::filesystem;
+
+using std::string;
+using std::string_view;
+
+inline constexpr string_view PHASE_NAMES[] = { "Discovery", "Schema", "Extraction", "SortLocView", "LoadCRC", "TranslationMemory", "ProcessXml", "ProcessTxt", "SaveCRC", };
+inline constexpr string_view STAT_NAMES[] = { "Files", "Entries", "Bytes", "Written", };
+
+static_assert(std::size(PHASE_NAMES) == (size_t)EPhase::COUNT && std::size(STAT_NAMES) == (size_t)EStat::COUNT);
+
+uint64_t Stats::FileSize(fs::path const& hPath) noexcept
+{
+	std::error_code ec{};
+	auto const iSize = fs::file_size(hPath, ec);
+
+	return ec ? 0 : static_cast<uint64_t>(iSize);
+}
+
+uint64_t Stats::PeakMemory() noexcept
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS Counters{ .cb = sizeof(PROCESS_MEMORY_COUNTERS), };
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &Counters, sizeof(Counters)))
+		return 0;
+
+	return static_cast<uint64_t>(Counters.PeakWorkingSetSize);
+#else
+	rusage Usage{};
+	if (getrusage(RUSAGE_SELF, &Usage) != 0)
+		return 0;
+
+#ifdef __APPLE__
+	return static_cast<uint64_t>(Usage.ru_maxrss);	// Bytes on macOS, KiB anywhere else.
+#else
+	return static_cast<uint64_t>(Usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+void Stats::Print() noexcept
+{
+#ifdef RWPHG_NO_STATS
+	Log::Print(ELogLevel::Warning, Style::Warning, "Statistics are not compiled into this build.\n");
+#else
+	// Explicitly asked for, hence written regardless of the log level.
+	string szTable{};
+	auto out = std::back_inserter(szTable);
+
+	fmt::format_to(out, Style::Action, "\n{:<14}{:>6}{:>12}", "Phase", "Runs", "Time (ms)");
+	for (auto&& szStat : STAT_NAMES)
+		fmt::format_to(out, Style::Action, "{:>12}", szStat);
+	fmt::format_to(out, "\n");
+
+	for (auto&& [szPhase, Phase] : std::views::zip(PHASE_NAMES, gPhases))
+	{
+		auto const iRuns = Phase.m_iRuns.load(std::memory_order_relaxed);
+
+		fmt::format_to(out, iRuns ? Style::Name : Style::Skipping, "{:<14}", szPhase);
+		fmt::format_to(out, Style::Info, "{:>6}{:>12.2f}", iRuns, Phase.m_iNanoseconds.load(std::memory_order_relaxed) / 1e6);
+
+		for (auto&& iCounter : Phase.m_Counters)
+			fmt::format_to(out, Style::Info, "{:>12}", iCounter.load(std::memory_order_relaxed));
+
+		fmt::format_to(out, "\n");
+	}
+
+	fmt::format_to(out, Style::Info, "\nPeak resident memory: {:.1f} MiB\n", PeakMemory() / (1024.0 * 1024.0));
+
+	Log::Write(szTable);
+#endif
+}
+
+bool Stats::SaveJson(fs::path const& hFile) noexcept
+{
+	string szJson{};
+	auto out = std::back_inserter(szJson);
+
+	fmt::format_to(
+		out,
+		"{{\n\t\"Version\": \"{}\",\n\t\"Build\": {},\n\t\"Timestamp\": {},\n\t\"Jobs\": {},\n\t\"PeakMemory\": {},\n\t\"Phases\": {{",
+		APP_VERSION.ToString(), BUILD_NUMBER, std::time(nullptr), gJobs, PeakMemory()
+	);
+
+	bool bFirst = true;
+	for (auto&& [szPhase, Phase] : std::views::zip(PHASE_NAMES, gPhases))
+	{
+		fmt::format_to(
+			out, "{}\n\t\t\"{}\": {{ \"Runs\": {}, \"Nanoseconds\": {}",
+			bFirst ? "" : ",", szPhase, Phase.m_iRuns.load(std::memory_order_relaxed), Phase.m_iNanoseconds.load(std::memory_order_relaxed)
+		);
+
+		for (auto&& [szStat, iCounter] : std::views::zip(STAT_NAMES, Phase.m_Counters))
+			fmt::format_to(out, ", \"{}\": {}", szStat, iCounter.load(std::memory_order_relaxed));
+
+		fmt::format_to(out, " }}");
+		bFirst = false;
+	}
+
+	fmt::format_to(out, "\n\t}}\n}}\n");
+
+	return WriteFileIfChanged(hFile, std::as_bytes(std::span{ szJson })) != EWriteResult::Failed;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#ifndef _ARRAY_
+#include <array>
+#endif
+
+#ifndef _ATOMIC_
+#include <atomic>
+#endif
+
+#ifndef _CHRONO_
+#include <chrono>
+#endif
+
+#ifndef _FILESYSTEM_
+#include <filesystem>
+#endif
+
+#ifndef _OPTIONAL_
+#include <optional>
+#endif
+
+// Per-phase wall time and counters, reported by -stats.
+// Probes are relaxed atomic adds, cheap enough to be left on. Define RWPHG_NO_STATS to strip them altogether.
+// Phases may nest, e.g. Discovery is part of the extraction command, hence the times are not meant to be summed up.
+
+enum struct EPhase : uint8_t
+{
+	Discovery,
+	Schema,
+	Extraction,
+	SortLocView,
+	LoadCRC,
+	TranslationMemory,
+	ProcessXml,
+	ProcessTxt,
+	SaveCRC,
+
+	COUNT,
+};
+
+enum struct EStat : uint8_t
+{
+	Files,
+	Entries,
+	Bytes,
+	Written,	// Files actually touched on disk.
+
+	COUNT,
+};
+
+inline bool gStats = false;	// Set by -stats, reported once all commands are done.
+inline std::optional<std::filesystem::path> gStatsJson;
+
+namespace Stats
+{
+	struct phase_t final
+	{
+		std::atomic<uint64_t> m_iNanoseconds{};
+		std::atomic<uint64_t> m_iRuns{};
+		std::array<std::atomic<uint64_t>, (size_t)EStat::COUNT> m_Counters{};
+	};
+
+	inline std::array<phase_t, (size_t)EPhase::COUNT> gPhases{};
+
+	inline void Add(EPhase phase, EStat stat, uint64_t n) noexcept
+	{
+		gPhases[(size_t)phase].m_Counters[(size_t)stat].fetch_add(n, std::memory_order_relaxed);
+	}
+
+	struct scoped_timer_t final
+	{
+		explicit scoped_timer_t(EPhase phase) noexcept : m_Phase{ phase } {}
+		~scoped_timer_t() noexcept
+		{
+			auto& Phase = gPhases[(size_t)m_Phase];
+
+			Phase.m_iNanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Begin).count(), std::memory_order_relaxed);
+			Phase.m_iRuns.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		scoped_timer_t(scoped_timer_t const&) = delete;
+		scoped_timer_t& operator=(scoped_timer_t const&) = delete;
+
+		EPhase m_Phase;
+		std::chrono::steady_clock::time_point m_Begin{ std::chrono::steady_clock::now() };
+	};
+
+	[[nodiscard]] uint64_t FileSize(std::filesystem::path const& hPath) noexcept;	// 0 on error.
+	[[nodiscard]] uint64_t PeakMemory() noexcept;	// Peak resident set of the process so far in bytes, 0 if unknown.
+
+	void Print() noexcept;
+	[[nodiscard]] bool SaveJson(std::filesystem::path const& hFile) noexcept;
+}
+
+#ifdef RWPHG_NO_STATS
+#define RWPHG_STAT_SCOPE(phase)			((void)0)
+#define RWPHG_STAT_ADD(phase, stat, n)	((void)0)
+#else
+#define RWPHG_STAT_CONCAT_IMPL(a, b)	a##b
+#define RWPHG_STAT_CONCAT(a, b)			RWPHG_STAT_CONCAT_IMPL(a, b)
+#define RWPHG_STAT_SCOPE(phase)			::Stats::scoped_timer_t const RWPHG_STAT_CONCAT(_StatTimer, __COUNTER__){ ::EPhase::phase }
+#define RWPHG_STAT_ADD(phase, stat, n)	::Stats::Add(::EPhase::phase, ::EStat::stat, static_cast<uint64_t>(n))
+#endif
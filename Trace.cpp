@@ -0,0 +1,237 @@
+#include "Precompiled.hpp"
+#include "FileWriter.hpp"
+#include "Json.hpp"
+#include "Log.hpp"
+#include "Trace.hpp"
+
+import Style;
+
+namespace ch = std::chrono;
+namespace fs = std::filesystem;
+
+using std::string;
+using std::string_view;
+using std::vector;
+
+inline constexpr size_t TRACE_RING_CAPACITY = 1 << 14;	// events per ring, 2 MiB.
+
+struct trace_event_t final
+{
+	char const* m_pszName;
+	uint64_t m_iBegin;
+	uint64_t m_iEnd;
+	uint16_t m_iArgLength;
+	char m_szArg[TRACE_ARG_CAPACITY];
+};
+
+static_assert(sizeof(trace_event_t) == 128);
+
+struct trace_ring_t final
+{
+	trace_ring_t(uint32_t iLane, bool bMainThread) noexcept : m_iLane{ iLane }, m_bMainThread{ bMainThread } {}
+
+	uint32_t const m_iLane;
+	bool const m_bMainThread;
+	std::atomic<uint64_t> m_iHead{};	// Count of events ever recorded, the slot is at m_iHead % TRACE_RING_CAPACITY.
+	std::unique_ptr<trace_event_t[]> m_Events{ std::make_unique_for_overwrite<trace_event_t[]>(TRACE_RING_CAPACITY) };
+};
+
+// Only touched when a thread records for the first time or exits.
+struct trace_registry_t final
+{
+	[[nodiscard]] trace_ring_t* Acquire(bool bMainThread) noexcept
+	{
+		std::scoped_lock Lock{ m_Lock };
+
+		// The main thread keeps a lane of its own, not to be mistaken for a worker.
+		if (!bMainThread && !m_Free.empty())
+		{
+			auto const pRing = m_Free.back();
+			m_Free.pop_back();
+
+			return pRing;
+		}
+
+		return m_Rings.emplace_back(std::make_unique<trace_ring_t>(static_cast<uint32_t>(m_Rings.size()), bMainThread)).get();
+	}
+
+	void Release(trace_ring_t* pRing) noexcept
+	{
+		std::scoped_lock Lock{ m_Lock };
+		m_Free.push_back(pRing);
+	}
+
+	std::mutex m_Lock{};
+	vector<std::unique_ptr<trace_ring_t>> m_Rings{};
+	vector<trace_ring_t*> m_Free{};
+};
+
+[[nodiscard]] static trace_registry_t& Registry() noexcept
+{
+	static trace_registry_t Instance{};
+	return Instance;
+}
+
+static auto const gTraceEpoch = ch::steady_clock::now();
+static auto const gMainThreadId = std::this_thread::get_id();	// Static initialization is done on the main thread.
+
+struct thread_ring_t final
+{
+	trace_ring_t* m_pRing{};
+
+	~thread_ring_t() noexcept
+	{
+		if (m_pRing && std::this_thread::get_id() != gMainThreadId)
+			Registry().Release(m_pRing);
+	}
+};
+
+static thread_local thread_ring_t tRing{};
+
+uint64_t Trace::Now() noexcept
+{
+	return static_cast<uint64_t>(ch::duration_cast<ch::nanoseconds>(ch::steady_clock::now() - gTraceEpoch).count());
+}
+
+uint16_t Trace::CopyTail(string_view Arg, char* pOut) noexcept
+{
+	if (Arg.size() > TRACE_ARG_CAPACITY)
+	{
+		Arg.remove_prefix(Arg.size() - TRACE_ARG_CAPACITY);
+
+		while (!Arg.empty() && (static_cast<unsigned char>(Arg.front()) & 0xC0) == 0x80)	// Never starts in the middle of a UTF-8 sequence.
+			Arg.remove_prefix(1);
+	}
+
+	std::ranges::copy(Arg, pOut);
+	return static_cast<uint16_t>(Arg.size());
+}
+
+uint16_t Trace::CopyTail(fs::path const& Arg, char* pOut) noexcept
+{
+	auto const& Native = Arg.native();
+
+#ifndef _WIN32
+	return CopyTail(string_view{ Native }, pOut);	// Already UTF-8.
+#else
+	// UTF-16 on Windows. Walked back from the end for where the tail starts, then encoded from there, a lone surrogate as three bytes.
+	constexpr auto fnIsHigh = [](char32_t c) noexcept { return c >= 0xD800 && c <= 0xDBFF; };
+	constexpr auto fnIsLow = [](char32_t c) noexcept { return c >= 0xDC00 && c <= 0xDFFF; };
+
+	size_t iStart = Native.size();
+
+	for (size_t iBytes = 0; iStart > 0;)
+	{
+		char32_t const c = Native[iStart - 1];
+		auto const bPair = fnIsLow(c) && iStart >= 2 && fnIsHigh(Native[iStart - 2]);
+		auto const iLength = bPair ? 4 : c < 0x80 ? 1 : c < 0x800 ? 2 : 3;
+
+		if (iBytes + iLength > TRACE_ARG_CAPACITY)
+			break;
+
+		iBytes += iLength;
+		iStart -= bPair ? 2 : 1;
+	}
+
+	auto p = pOut;
+
+	for (auto i = iStart; i < Native.size(); ++i)
+	{
+		char32_t cp = Native[i];
+
+		if (fnIsHigh(cp) && i + 1 < Native.size() && fnIsLow(Native[i + 1]))
+			cp = 0x10000 + ((cp - 0xD800) << 10) + (Native[++i] - 0xDC00);
+
+		if (cp < 0x80)
+			*p++ = static_cast<char>(cp);
+		else if (cp < 0x800)
+		{
+			*p++ = static_cast<char>(0xC0 | (cp >> 6));
+			*p++ = static_cast<char>(0x80 | (cp & 0x3F));
+		}
+		else if (cp < 0x10000)
+		{
+			*p++ = static_cast<char>(0xE0 | (cp >> 12));
+			*p++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			*p++ = static_cast<char>(0x80 | (cp & 0x3F));
+		}
+		else
+		{
+			*p++ = static_cast<char>(0xF0 | (cp >> 18));
+			*p++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+			*p++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			*p++ = static_cast<char>(0x80 | (cp & 0x3F));
+		}
+	}
+
+	return static_cast<uint16_t>(p - pOut);
+#endif
+}
+
+void Trace::Record(char const* pszName, uint64_t iBegin, uint64_t iEnd, string_view Arg) noexcept
+{
+	if (!tRing.m_pRing) [[unlikely]]
+		tRing.m_pRing = Registry().Acquire(std::this_thread::get_id() == gMainThreadId);
+
+	auto& Ring = *tRing.m_pRing;
+	auto const iHead = Ring.m_iHead.load(std::memory_order_relaxed);	// This thread is the only writer.
+	auto& Event = Ring.m_Events[iHead % TRACE_RING_CAPACITY];
+
+	Event.m_pszName = pszName;
+	Event.m_iBegin = iBegin;
+	Event.m_iEnd = iEnd;
+	Event.m_iArgLength = CopyTail(Arg, Event.m_szArg);
+
+	Ring.m_iHead.store(iHead + 1, std::memory_order_release);
+}
+
+bool Trace::Save(fs::path const& hFile) noexcept
+{
+	auto& Reg = Registry();
+	std::scoped_lock Lock{ Reg.m_Lock };
+
+	string szJson{};
+	auto out = std::back_inserter(szJson);
+	uint64_t iDropped = 0;
+
+	szJson.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+	for (auto&& pRing : Reg.m_Rings)
+	{
+		auto const iHead = pRing->m_iHead.load(std::memory_order_acquire);
+		auto const iFirst = iHead > TRACE_RING_CAPACITY ? iHead - TRACE_RING_CAPACITY : 0;
+		iDropped += iFirst;
+
+		fmt::format_to(
+			out, "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{0},\"args\":{{\"name\":\"{1} {0}\"}}}},\n",
+			pRing->m_iLane, pRing->m_bMainThread ? "Main" : "Worker"
+		);
+
+		for (auto i = iFirst; i < iHead; ++i)
+		{
+			auto const& Event = pRing->m_Events[i % TRACE_RING_CAPACITY];
+
+			fmt::format_to(
+				out, "{{\"name\":\"{}\",\"cat\":\"RWPHG\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}",
+				Event.m_pszName, pRing->m_iLane, Event.m_iBegin / 1e3, (Event.m_iEnd - Event.m_iBegin) / 1e3
+			);
+
+			if (Event.m_iArgLength)
+			{
+				szJson.append(",\"args\":{\"detail\":");
+				AppendJsonString(&szJson, string_view{ Event.m_szArg, Event.m_iArgLength });
+				szJson.push_back('}');
+			}
+
+			szJson.append("},\n");
+		}
+	}
+
+	// Metadata event of the process as the last one, so no trailing comma to take care of.
+	szJson.append("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"RimWorldPlaceholderGenerator\"}}\n]}\n");
+
+	if (iDropped)
+		Log::Print(ELogLevel::Warning, Style::Warning, "{} oldest trace events were overwritten.\n", iDropped);
+
+	return WriteFileIfChanged(hFile, std::as_bytes(std::span{ szJson })) != EWriteResult::Failed;
+}
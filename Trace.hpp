@@ -0,0 +1,70 @@
+#pragma once
+
+#ifndef _FILESYSTEM_
+#include <filesystem>
+#endif
+
+#ifndef _OPTIONAL_
+#include <optional>
+#endif
+
+#ifndef _STRING_VIEW_
+#include <string_view>
+#endif
+
+// Timeline of a run in the Chrome trace-event format, for chrome://tracing or ui.perfetto.dev. Enabled by -trace.
+// Every thread records into a ring buffer of its own with no lock involved. Rings of finished workers are handed to the next ones, so one ring is one lane.
+// A scope makes a single complete event ("ph": "X"), i.e. its begin and end in one record. The oldest events are overwritten once a ring is full.
+// Define RWPHG_NO_TRACE to strip the probes altogether.
+
+inline bool gTrace = false;	// Only to be altered between commands.
+inline std::optional<std::filesystem::path> gTraceFile;
+
+inline constexpr size_t TRACE_ARG_CAPACITY = 102;	// Bytes of UTF-8. The tail of it if too long, the file name of a path matters the most.
+
+namespace Trace
+{
+	[[nodiscard]] uint64_t Now() noexcept;	// Nanoseconds since the start of the process.
+	void Record(char const* pszName, uint64_t iBegin, uint64_t iEnd, std::string_view Arg = {}) noexcept;	// pszName must be a string literal.
+
+	// Fill the TRACE_ARG_CAPACITY bytes at pOut with the tail of Arg, returns the length. Nothing is allocated, not even for a path in UTF-16.
+	[[nodiscard]] uint16_t CopyTail(std::string_view Arg, char* pOut) noexcept;
+	[[nodiscard]] uint16_t CopyTail(std::filesystem::path const& Arg, char* pOut) noexcept;
+
+	// All the recording threads must have been joined.
+	[[nodiscard]] bool Save(std::filesystem::path const& hFile) noexcept;
+
+	struct scope_t final
+	{
+		explicit scope_t(char const* pszName) noexcept
+			: m_pszName{ gTrace ? pszName : nullptr }, m_iBegin{ m_pszName ? Now() : 0 } {}
+		scope_t(char const* pszName, std::string_view Arg) noexcept
+			: m_pszName{ gTrace ? pszName : nullptr }, m_iArgLength{ m_pszName ? CopyTail(Arg, m_szArg) : uint16_t{} }, m_iBegin{ m_pszName ? Now() : 0 } {}
+		scope_t(char const* pszName, std::filesystem::path const& Arg) noexcept
+			: m_pszName{ gTrace ? pszName : nullptr }, m_iArgLength{ m_pszName ? CopyTail(Arg, m_szArg) : uint16_t{} }, m_iBegin{ m_pszName ? Now() : 0 } {}
+
+		~scope_t() noexcept
+		{
+			if (m_pszName)
+				Record(m_pszName, m_iBegin, Now(), std::string_view{ m_szArg, m_iArgLength });
+		}
+
+		scope_t(scope_t const&) = delete;
+		scope_t& operator=(scope_t const&) = delete;
+
+		char const* m_pszName;
+		char m_szArg[TRACE_ARG_CAPACITY];	// Left alone unless traced.
+		uint16_t m_iArgLength{};
+		uint64_t m_iBegin;
+	};
+}
+
+#ifdef RWPHG_NO_TRACE
+#define RWPHG_TRACE_SCOPE(name)				((void)0)
+#define RWPHG_TRACE_SCOPE_ARG(name, arg)	((void)0)
+#else
+#define RWPHG_TRACE_CONCAT_IMPL(a, b)		a##b
+#define RWPHG_TRACE_CONCAT(a, b)			RWPHG_TRACE_CONCAT_IMPL(a, b)
+#define RWPHG_TRACE_SCOPE(name)				::Trace::scope_t const RWPHG_TRACE_CONCAT(_TraceScope, __COUNTER__){ name }
+#define RWPHG_TRACE_SCOPE_ARG(name, arg)	::Trace::scope_t const RWPHG_TRACE_CONCAT(_TraceScope, __COUNTER__){ name, arg }
+#endif
@@ -0,0 +1,249 @@
+#include "Precompiled.hpp"
+#include "Log.hpp"
+#include "Watcher.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#endif
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include <csignal>
+
+import Style;
+
+namespace ch = std::chrono;
+namespace fs = std::filesystem;
+
+using std::span;
+using std::vector;
+
+inline constexpr auto WATCH_POLL_INTERVAL = ch::milliseconds{ 500 };
+
+#ifdef __linux__
+inline constexpr uint32_t WATCH_EVENTS = IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+#endif
+
+#ifdef _WIN32
+static BOOL WINAPI OnConsoleControl(DWORD dwType) noexcept
+{
+	if (dwType != CTRL_C_EVENT && dwType != CTRL_BREAK_EVENT)
+		return FALSE;	// Closing the console or logging off still ends the process.
+
+	dir_watcher_t::Interrupt();
+	return TRUE;
+}
+#else
+static void OnInterrupt(int) noexcept
+{
+	dir_watcher_t::Interrupt();
+}
+#endif
+
+dir_watcher_t::dir_watcher_t(span<fs::path const> Roots) noexcept
+{
+	std::error_code ec{};
+
+	for (auto&& Root : Roots)
+	{
+		if (fs::is_directory(Root, ec))
+			m_Roots.push_back(Root);
+	}
+
+#ifdef __linux__
+	m_iNotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+	if (m_iNotify >= 0 && !std::ranges::all_of(m_Roots, [this](auto&& Root) noexcept { return AddWatches(Root); }))
+	{
+		Log::Print(ELogLevel::Warning, Style::Warning, "Out of inotify watches, polling the folders instead.\n");
+
+		close(m_iNotify);
+		m_iNotify = -1;
+		m_Watches.clear();
+	}
+#endif
+
+	if (IsPolling())
+		m_Snapshot = Snapshot();
+
+#ifdef _WIN32
+	SetConsoleCtrlHandler(&OnConsoleControl, TRUE);
+#else
+	std::signal(SIGINT, &OnInterrupt);
+	std::signal(SIGTERM, &OnInterrupt);
+#endif
+}
+
+dir_watcher_t::~dir_watcher_t() noexcept
+{
+#ifdef _WIN32
+	SetConsoleCtrlHandler(&OnConsoleControl, FALSE);
+#else
+	std::signal(SIGINT, SIG_DFL);
+	std::signal(SIGTERM, SIG_DFL);
+#endif
+
+#ifdef __linux__
+	if (m_iNotify >= 0)
+		close(m_iNotify);
+#endif
+}
+
+dir_watcher_t::snapshot_t dir_watcher_t::Snapshot() const noexcept
+{
+	snapshot_t ret{};
+	std::error_code ec{};
+
+	for (auto&& Root : m_Roots)
+	{
+		for (auto it = fs::recursive_directory_iterator(Root, ec); !ec && it != fs::recursive_directory_iterator{}; it.increment(ec))
+		{
+			if (it->is_regular_file(ec))
+				ret.try_emplace(it->path(), it->file_size(ec), it->last_write_time(ec));
+		}
+	}
+
+	return ret;
+}
+
+bool dir_watcher_t::AddWatches(fs::path const& Dir) noexcept
+{
+#ifdef __linux__
+	auto const fnAdd =
+		[this](fs::path const& Path) noexcept
+		{
+			if (auto const wd = inotify_add_watch(m_iNotify, Path.c_str(), WATCH_EVENTS | IN_ONLYDIR); wd >= 0)
+				m_Watches.insert_or_assign(wd, Path);
+			else
+				return errno != ENOSPC;	// Anything else, e.g. a folder gone in the meantime, is no reason to give up.
+
+			return true;
+		};
+
+	if (!fnAdd(Dir))
+		return false;
+
+	std::error_code ec{};
+
+	for (auto it = fs::recursive_directory_iterator(Dir, ec); !ec && it != fs::recursive_directory_iterator{}; it.increment(ec))
+	{
+		if (it->is_directory(ec) && !fnAdd(it->path()))
+			return false;
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+void dir_watcher_t::Collect(vector<fs::path>* pret) noexcept
+{
+#ifdef __linux__
+	alignas(inotify_event) char Buffer[16 * 1024];
+
+	for (auto iRead = read(m_iNotify, Buffer, sizeof(Buffer)); iRead > 0; iRead = read(m_iNotify, Buffer, sizeof(Buffer)))
+	{
+		for (auto p = Buffer; p < Buffer + iRead;)
+		{
+			auto const pEvent = reinterpret_cast<inotify_event const*>(p);
+			p += sizeof(inotify_event) + pEvent->len;
+
+			// Events were dropped, any file could have changed.
+			if (pEvent->mask & IN_Q_OVERFLOW)
+			{
+				pret->append_range(m_Roots);
+				continue;
+			}
+
+			auto const it = m_Watches.find(pEvent->wd);
+			if (it == m_Watches.end())
+				continue;
+
+			if (pEvent->mask & IN_IGNORED)
+			{
+				m_Watches.erase(it);
+				continue;
+			}
+
+			auto Path = pEvent->len ? it->second / pEvent->name : it->second;
+
+			// A folder moved in comes with its content already, which raises no event of its own.
+			if ((pEvent->mask & IN_ISDIR) && (pEvent->mask & (IN_CREATE | IN_MOVED_TO)))
+			{
+				(void)AddWatches(Path);
+
+				std::error_code ec{};
+				for (auto itFile = fs::recursive_directory_iterator(Path, ec); !ec && itFile != fs::recursive_directory_iterator{}; itFile.increment(ec))
+				{
+					if (itFile->is_regular_file(ec))
+						pret->push_back(itFile->path());
+				}
+			}
+
+			pret->push_back(std::move(Path));
+		}
+	}
+#endif
+}
+
+vector<fs::path> dir_watcher_t::Wait(ch::milliseconds Quiet) noexcept
+{
+	vector<fs::path> ret{};
+
+#ifdef __linux__
+	if (!IsPolling())
+	{
+		// The first change is waited for as long as it takes, every one after it restarts the quiet period.
+		// A signal breaks poll() off with EINTR, the interval is only for one that came right before it.
+		pollfd Fd{ .fd = m_iNotify, .events = POLLIN, };
+
+		while (!Interrupted())
+		{
+			auto const iReady = poll(&Fd, 1, static_cast<int>((ret.empty() ? WATCH_POLL_INTERVAL : Quiet).count()));
+
+			if (iReady > 0)
+				Collect(&ret);
+			else if (iReady < 0 && errno == EINTR)
+				continue;
+			else if (iReady < 0 || !ret.empty())
+				break;
+		}
+	}
+	else
+#endif
+	{
+		vector<snapshot_t::value_type> Diff{};
+
+		while (!Interrupted())
+		{
+			std::this_thread::sleep_for(ret.empty() ? WATCH_POLL_INTERVAL : Quiet);
+
+			auto Current = Snapshot();
+
+			// Altered ones are on both sides, with different size or time.
+			Diff.clear();
+			std::ranges::set_symmetric_difference(m_Snapshot, Current, std::back_inserter(Diff));
+			m_Snapshot = std::move(Current);
+
+			if (Diff.empty() && !ret.empty())
+				break;
+
+			ret.append_range(Diff | std::views::keys);
+		}
+	}
+
+	if (Interrupted())
+		return {};
+
+	std::ranges::sort(ret);
+	ret.erase(std::ranges::unique(ret).begin(), ret.end());
+
+	return ret;
+}
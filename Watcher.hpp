@@ -0,0 +1,60 @@
+#pragma once
+
+#ifndef _ATOMIC_
+#include <atomic>
+#endif
+
+#ifndef _CHRONO_
+#include <chrono>
+#endif
+
+#ifndef _FILESYSTEM_
+#include <filesystem>
+#endif
+
+#ifndef _MAP_
+#include <map>
+#endif
+
+#ifndef _SPAN_
+#include <span>
+#endif
+
+#ifndef _VECTOR_
+#include <vector>
+#endif
+
+// Changes of the files under a few folders, for -watch. Folders missing at the start are not looked after.
+// inotify on Linux. Anywhere else, or when inotify runs out of watches, the folders are polled and compared by size and write time.
+// Bursts are debounced, e.g. an editor saving through a temporary file: nothing is handed out until the folders have been quiet for a while.
+// While a watcher lives, Ctrl+C no longer ends the process but the wait, so that the caller may finish as usual.
+struct dir_watcher_t final
+{
+	explicit dir_watcher_t(std::span<std::filesystem::path const> Roots) noexcept;
+	~dir_watcher_t() noexcept;
+
+	dir_watcher_t(dir_watcher_t const&) noexcept = delete;
+	dir_watcher_t& operator=(dir_watcher_t const&) noexcept = delete;
+
+	// Blocks until anything changes and then settles for Quiet. Files removed are included, sorted and without duplicates.
+	// Empty once interrupted, for good. A run in progress at Ctrl+C is finished first, the interruption is noticed by the next call.
+	[[nodiscard]] std::vector<std::filesystem::path> Wait(std::chrono::milliseconds Quiet) noexcept;
+
+	[[nodiscard]] bool IsPolling() const noexcept { return m_iNotify < 0; }
+	[[nodiscard]] static bool Interrupted() noexcept { return m_bInterrupted.load(std::memory_order_relaxed); }
+	static void Interrupt() noexcept { m_bInterrupted.store(true, std::memory_order_relaxed); }	// Lock-free, hence safe from a signal handler.
+
+private:
+	using snapshot_t = std::map<std::filesystem::path, std::pair<std::uintmax_t, std::filesystem::file_time_type>>;
+
+	[[nodiscard]] snapshot_t Snapshot() const noexcept;
+	[[nodiscard]] bool AddWatches(std::filesystem::path const& Dir) noexcept;	// The folder and every one under it.
+	void Collect(std::vector<std::filesystem::path>* pret) noexcept;	// inotify events pending.
+
+	std::vector<std::filesystem::path> m_Roots{};
+	snapshot_t m_Snapshot{};	// Polling only.
+	std::map<int, std::filesystem::path> m_Watches{};	// inotify only, by watch descriptor.
+	int m_iNotify{ -1 };
+
+	static inline std::atomic<bool> m_bInterrupted{};	// Set from a signal handler, or the console control thread on Windows.
+};